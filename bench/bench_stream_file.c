@@ -0,0 +1,231 @@
+/**
+ * \file bench_stream_file.c
+ *
+ * Benchmark for vccrypt_stream_encrypt_file() and
+ * vccrypt_stream_decrypt_file().
+ *
+ * For each file size, a plaintext file of that size is created in a temporary
+ * directory, encrypted and decrypted with AES-256-2X-CTR, and the throughput of
+ * each direction is reported in GB/s.  Each run encrypts under a fresh random
+ * IV.  The largest size, in MiB, may be passed as the first argument.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <vccrypt/prng.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#define BENCH_DEFAULT_MAX_MIB 1024
+
+/**
+ * Return the current monotonic time in seconds.
+ */
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * Create an unlinked temporary file.
+ */
+static int temp_file(void)
+{
+    char name[] = "/tmp/vccrypt_bench_XXXXXX";
+    int fd = mkstemp(name);
+
+    if (fd >= 0)
+        unlink(name);
+
+    return fd;
+}
+
+/**
+ * Fill a file with size bytes of pattern data.
+ */
+static int fill_file(int fd, size_t size)
+{
+    static unsigned char block[1024 * 1024];
+
+    for (size_t i = 0; i < sizeof(block); ++i)
+        block[i] = (unsigned char)(i * 131);
+
+    while (size > 0)
+    {
+        size_t n = size < sizeof(block) ? size : sizeof(block);
+        if ((ssize_t)n != write(fd, block, n))
+            return -1;
+
+        size -= n;
+    }
+
+    return 0;
+}
+
+/**
+ * Encrypt and decrypt a file of the given size, timing each direction.
+ */
+static int bench_size(
+    vccrypt_stream_context_t* ctx, const unsigned char* iv, size_t iv_size,
+    size_t size, double* enc_time, double* dec_time)
+{
+    int in_fd = temp_file();
+    int enc_fd = temp_file();
+    int dec_fd = temp_file();
+    double start;
+    int retval = 1;
+
+    /* the engine reads from the current position, so rewind after filling. */
+    if (in_fd < 0 || enc_fd < 0 || dec_fd < 0 || 0 != fill_file(in_fd, size)
+     || 0 != lseek(in_fd, 0, SEEK_SET))
+    {
+        fprintf(stderr, "could not create temporary files.\n");
+        goto cleanup_files;
+    }
+
+    start = now();
+    if (0 != vccrypt_stream_encrypt_file(ctx, iv, iv_size, in_fd, enc_fd))
+    {
+        fprintf(stderr, "encryption failed.\n");
+        goto cleanup_files;
+    }
+    *enc_time = now() - start;
+
+    if (0 != lseek(enc_fd, 0, SEEK_SET))
+    {
+        fprintf(stderr, "could not rewind encrypted file.\n");
+        goto cleanup_files;
+    }
+
+    start = now();
+    if (0 != vccrypt_stream_decrypt_file(ctx, enc_fd, dec_fd))
+    {
+        fprintf(stderr, "decryption failed.\n");
+        goto cleanup_files;
+    }
+    *dec_time = now() - start;
+
+    retval = 0;
+
+cleanup_files:
+    if (in_fd >= 0)
+        close(in_fd);
+    if (enc_fd >= 0)
+        close(enc_fd);
+    if (dec_fd >= 0)
+        close(dec_fd);
+
+    return retval;
+}
+
+int main(int argc, char* argv[])
+{
+    allocator_options_t alloc_opts;
+    vccrypt_prng_options_t prng_options;
+    vccrypt_prng_context_t prng;
+    vccrypt_stream_options_t options;
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+    unsigned char iv[8];
+    size_t max_mib = BENCH_DEFAULT_MAX_MIB;
+    int retval = 1;
+
+    if (argc > 1)
+        max_mib = (size_t)strtoul(argv[1], NULL, 10);
+
+    vccrypt_prng_register_source_operating_system();
+    vccrypt_stream_register_AES_256_2X_CTR();
+    malloc_allocator_options_init(&alloc_opts);
+
+    if (0 !=
+        vccrypt_prng_options_init(
+            &prng_options, &alloc_opts, VCCRYPT_PRNG_SOURCE_OPERATING_SYSTEM))
+    {
+        fprintf(stderr, "could not initialize prng options.\n");
+        goto cleanup_allocator;
+    }
+
+    if (0 != vccrypt_prng_init(&prng_options, &prng))
+    {
+        fprintf(stderr, "could not initialize prng.\n");
+        goto cleanup_prng_options;
+    }
+
+    if (0 !=
+        vccrypt_stream_options_init(
+            &options, &alloc_opts, VCCRYPT_STREAM_ALGORITHM_AES_256_2X_CTR))
+    {
+        fprintf(stderr, "could not initialize stream options.\n");
+        goto cleanup_prng;
+    }
+
+    if (0 != vccrypt_buffer_init(&key, &alloc_opts, options.key_size))
+    {
+        fprintf(stderr, "could not allocate key.\n");
+        goto cleanup_options;
+    }
+
+    memset(key.data, 0x5a, key.size);
+
+    if (0 != vccrypt_stream_init(&options, &ctx, &key))
+    {
+        fprintf(stderr, "could not initialize stream cipher.\n");
+        goto cleanup_key;
+    }
+
+    printf("%12s %14s %14s\n", "size (MiB)", "encrypt GB/s", "decrypt GB/s");
+
+    for (size_t mib = 1; mib <= max_mib; mib *= 4)
+    {
+        size_t size = mib * 1024 * 1024;
+        double enc_time, dec_time;
+
+        /* never reuse an IV under the same key. */
+        if (0 != vccrypt_prng_read_c(&prng, iv, sizeof(iv)))
+        {
+            fprintf(stderr, "could not generate an IV.\n");
+            goto cleanup_context;
+        }
+
+        if (0 != bench_size(&ctx, iv, sizeof(iv), size, &enc_time, &dec_time))
+            goto cleanup_context;
+
+        printf(
+            "%12zu %14.3f %14.3f\n", mib, (double)size / enc_time / 1e9,
+            (double)size / dec_time / 1e9);
+    }
+
+    retval = 0;
+
+cleanup_context:
+    dispose((disposable_t*)&ctx);
+
+cleanup_key:
+    dispose((disposable_t*)&key);
+
+cleanup_options:
+    dispose((disposable_t*)&options);
+
+cleanup_prng:
+    dispose((disposable_t*)&prng);
+
+cleanup_prng_options:
+    dispose((disposable_t*)&prng_options);
+
+cleanup_allocator:
+    dispose((disposable_t*)&alloc_opts);
+
+    return retval;
+}
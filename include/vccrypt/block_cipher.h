@@ -66,6 +66,26 @@ extern "C" {
  * \brief Selector for AES-256-CBC-4X mode.
  */
 #define VCCRYPT_BLOCK_ALGORITHM_AES_256_4X_CBC 0x08000000
+
+/**
+ * \brief Selector for AES-256-XTS FIPS mode.
+ */
+#define VCCRYPT_BLOCK_ALGORITHM_AES_256_XTS_FIPS 0x10000000
+
+/**
+ * \brief Selector for AES-256-XTS-2X mode.
+ */
+#define VCCRYPT_BLOCK_ALGORITHM_AES_256_2X_XTS 0x20000000
+
+/**
+ * \brief Selector for AES-256-XTS-3X mode.
+ */
+#define VCCRYPT_BLOCK_ALGORITHM_AES_256_3X_XTS 0x40000000
+
+/**
+ * \brief Selector for AES-256-XTS-4X mode.
+ */
+#define VCCRYPT_BLOCK_ALGORITHM_AES_256_4X_XTS 0x80000000
 /**
  * @}
  */
@@ -100,6 +120,26 @@ void vccrypt_block_register_AES_256_3X_CBC();
  * \brief Register the AES-256-CBC-4X algorithm.
  */
 void vccrypt_block_register_AES_256_4X_CBC();
+
+/**
+ * \brief Register the AES-256-XTS-FIPS algorithm.
+ */
+void vccrypt_block_register_AES_256_XTS_FIPS();
+
+/**
+ * \brief Register the AES-256-XTS-2X algorithm.
+ */
+void vccrypt_block_register_AES_256_2X_XTS();
+
+/**
+ * \brief Register the AES-256-XTS-3X algorithm.
+ */
+void vccrypt_block_register_AES_256_3X_XTS();
+
+/**
+ * \brief Register the AES-256-XTS-4X algorithm.
+ */
+void vccrypt_block_register_AES_256_4X_XTS();
 /**
  * @}
  */
@@ -206,6 +246,139 @@ typedef struct vccrypt_block_options
         void* options, void* context, const void* iv, const void* input,
         void* output);
 
+    /**
+     * \brief Return the size of the context storage needed by this algorithm.
+     *
+     * This method is optional.  If it is NULL, then this algorithm does not
+     * support caller-provided storage.
+     *
+     * \param options       Opaque pointer to this options structure.
+     *
+     * \returns the storage size in bytes.
+     */
+    size_t (*vccrypt_block_alg_storage_size)(void* options);
+
+    /**
+     * \brief Algorithm-specific initialization for block cipher using
+     * caller-provided storage for the cipher state.
+     *
+     * This method is optional, and must be set if
+     * vccrypt_block_alg_storage_size is set.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       Opaque pointer to vccrypt_block_context_t
+     *                      structure.
+     * \param key           The key to use for this instance.
+     * \param encrypt       Set to true if this is for encryption, and false
+     *                      for decryption.
+     * \param storage       The storage for the cipher state.
+     * \param storage_size  The size of the storage, in bytes.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on error.
+     */
+    int (*vccrypt_block_alg_init_with_storage)(
+        void* options, void* context, const vccrypt_buffer_t* key,
+        bool encrypt, void* storage, size_t storage_size);
+
+    /**
+     * \brief Encrypt a run of blocks in cipher block chaining mode.
+     *
+     * This method is optional.  If it is NULL, then vccrypt_block_encrypt_cbc()
+     * chains single block encryptions.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_block_context_t
+     *                      structure.
+     * \param iv            The chaining value, which is updated to the last
+     *                      ciphertext block.  Must be the block size in
+     *                      length.
+     * \param input         The plaintext blocks to encrypt.
+     * \param output        The output buffer for the ciphertext blocks.
+     * \param blocks        The number of blocks to encrypt.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_block_alg_encrypt_cbc)(
+        void* options, void* context, void* iv, const void* input,
+        void* output, size_t blocks);
+
+    /**
+     * \brief Decrypt a run of blocks in cipher block chaining mode.
+     *
+     * This method is optional.  If it is NULL, then vccrypt_block_decrypt_cbc()
+     * chains single block decryptions.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_block_context_t
+     *                      structure.
+     * \param iv            The chaining value, which is updated to the last
+     *                      ciphertext block.  Must be the block size in
+     *                      length.
+     * \param input         The ciphertext blocks to decrypt.
+     * \param output        The output buffer for the plaintext blocks.
+     * \param blocks        The number of blocks to decrypt.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_block_alg_decrypt_cbc)(
+        void* options, void* context, void* iv, const void* input,
+        void* output, size_t blocks);
+
+    /**
+     * \brief Encrypt many independent messages in cipher block chaining
+     * mode in a single call.
+     *
+     * This method is optional.  If it is NULL, then
+     * vccrypt_block_encrypt_cbc_many() encrypts each job in turn.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param jobs          An array of vccrypt_block_job_t jobs, each of
+     *                      which uses a context with this method.
+     * \param count         The number of jobs.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_block_alg_encrypt_cbc_many)(
+        void* options, void* jobs, size_t count);
+
+    /**
+     * \brief Encrypt a whole sector, using the sector number as the tweak.
+     *
+     * This method is optional, and is only set for tweakable sector modes.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_block_context_t
+     *                      structure.
+     * \param sector        The sector number.
+     * \param input         The plaintext sector.
+     * \param output        The output buffer for the ciphertext sector.
+     * \param size          The size of the sector, in bytes.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_block_alg_encrypt_sector)(
+        void* options, void* context, uint64_t sector, const void* input,
+        void* output, size_t size);
+
+    /**
+     * \brief Decrypt a whole sector, using the sector number as the tweak.
+     *
+     * This method is optional, and is only set for tweakable sector modes.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_block_context_t
+     *                      structure.
+     * \param sector        The sector number.
+     * \param input         The ciphertext sector.
+     * \param output        The output buffer for the plaintext sector.
+     * \param size          The size of the sector, in bytes.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_block_alg_decrypt_sector)(
+        void* options, void* context, uint64_t sector, const void* input,
+        void* output, size_t size);
+
     /**
      * \brief Algorithm-specific data for a block cipher.
      */
@@ -252,6 +425,39 @@ typedef struct vccrypt_block_context
 
 } vccrypt_block_context_t;
 
+/**
+ * \brief A single message passed to vccrypt_block_encrypt_cbc_many().
+ */
+typedef struct vccrypt_block_job
+{
+    /**
+     * \brief The block cipher context for this message.  Each job must use a
+     * different context.
+     */
+    vccrypt_block_context_t* context;
+
+    /**
+     * \brief The chaining value, updated to the last ciphertext block.
+     */
+    void* iv;
+
+    /**
+     * \brief The plaintext blocks to encrypt.
+     */
+    const void* input;
+
+    /**
+     * \brief The output buffer for the ciphertext blocks.
+     */
+    void* output;
+
+    /**
+     * \brief The number of blocks to encrypt.
+     */
+    size_t blocks;
+
+} vccrypt_block_job_t;
+
 /**
  * \brief Initialize Block Cipher options, looking up an appropriate Block
  * Cipher algorithm registered in the abstract factory.
@@ -305,6 +511,53 @@ int VCCRYPT_DECL_MUST_CHECK vccrypt_block_init(
     vccrypt_block_options_t* options, vccrypt_block_context_t* context,
     const vccrypt_buffer_t* key, bool encrypt);
 
+/**
+ * \brief The required alignment of storage passed to
+ * vccrypt_block_init_with_storage().
+ */
+#define VCCRYPT_BLOCK_STORAGE_ALIGNMENT 16
+
+/**
+ * \brief Return the number of bytes of storage needed to hold the cipher
+ * state for the given options.
+ *
+ * \param options       The options for the block cipher.
+ *
+ * \returns the size in bytes, or 0 if the selected algorithm does not support
+ *          caller-provided storage.
+ */
+size_t vccrypt_block_storage_size(const vccrypt_block_options_t* options);
+
+/**
+ * \brief Initialize a Block Cipher algorithm instance, storing the cipher
+ * state in caller-provided storage instead of allocating it.
+ *
+ * The storage must be aligned to \ref VCCRYPT_BLOCK_STORAGE_ALIGNMENT bytes,
+ * must be at least vccrypt_block_storage_size() bytes in size, and must
+ * outlive the context.  The context must still be disposed by calling
+ * dispose(), which wipes the storage but does not release it.
+ *
+ * \param options       The options to use for this algorithm instance.
+ * \param context       The block cipher instance to initialize.
+ * \param key           The key to use for this algorithm instance.
+ * \param encrypt       Set to true if this is for encryption, and false for
+ *                      decryption.
+ * \param storage       The storage for the cipher state.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_BLOCK_INIT_INVALID_ARG if an invalid argument is
+ *             provided, or if the storage is too small or is misaligned.
+ *      - \ref VCCRYPT_ERROR_BLOCK_INIT_STORAGE_UNSUPPORTED if the selected
+ *             algorithm does not support caller-provided storage.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK vccrypt_block_init_with_storage(
+    vccrypt_block_options_t* options, vccrypt_block_context_t* context,
+    const vccrypt_buffer_t* key, bool encrypt, void* storage,
+    size_t storage_size);
+
 /**
  * \brief Encrypt a single block of data using the block cipher.
  *
@@ -350,6 +603,187 @@ int VCCRYPT_DECL_MUST_CHECK vccrypt_block_decrypt(
     vccrypt_block_context_t* context, const void* iv, const void* input,
     void* output);
 
+/**
+ * \brief Encrypt a run of blocks in cipher block chaining mode.
+ *
+ * This is equivalent to calling vccrypt_block_encrypt() once per block, using
+ * the previous ciphertext block as the IV of the next, but chains internally.
+ *
+ * \param context       The block cipher context to use.
+ * \param iv            The chaining value.  On entry, this is the IV for the
+ *                      first block, which must be cryptographically random
+ *                      for the first block of a message.  On return, this is
+ *                      the last ciphertext block, so that a following call
+ *                      continues the chain.  Must be the block size in
+ *                      length.
+ * \param input         The plaintext blocks to encrypt.
+ * \param output        The output buffer for the ciphertext blocks.  Must be
+ *                      either identical to input or not overlap it.
+ * \param blocks        The number of blocks to encrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK vccrypt_block_encrypt_cbc(
+    vccrypt_block_context_t* context, void* iv, const void* input,
+    void* output, size_t blocks);
+
+/**
+ * \brief Decrypt a run of blocks in cipher block chaining mode.
+ *
+ * This is equivalent to calling vccrypt_block_decrypt() once per block, using
+ * the previous ciphertext block as the IV of the next.  Because each plaintext
+ * block only depends on two ciphertext blocks, several block decryptions are
+ * kept in flight at once.
+ *
+ * \param context       The block cipher context to use.
+ * \param iv            The chaining value.  On entry, this is the IV for the
+ *                      first block.  On return, this is the last ciphertext
+ *                      block, so that a following call continues the chain,
+ *                      even when decrypting in place.  Must be the block size
+ *                      in length.
+ * \param input         The ciphertext blocks to decrypt.
+ * \param output        The output buffer for the plaintext blocks.  Must be
+ *                      either identical to input or not overlap it.
+ * \param blocks        The number of blocks to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK vccrypt_block_decrypt_cbc(
+    vccrypt_block_context_t* context, void* iv, const void* input,
+    void* output, size_t blocks);
+
+/**
+ * \brief Encrypt many independent messages in cipher block chaining mode in a
+ * single call.
+ *
+ * Each job is encrypted exactly as if vccrypt_block_encrypt_cbc() were called
+ * on its context.  CBC encryption is serial within a message, so algorithms
+ * that support it instead interleave blocks from different messages, keeping
+ * the cipher pipeline full even when every message uses its own key.  Jobs are
+ * only interleaved when every context uses the same algorithm family;
+ * otherwise, they are encrypted in turn.
+ *
+ * \param jobs          The jobs to encrypt.
+ * \param count         The number of jobs.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG if a job is invalid.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK vccrypt_block_encrypt_cbc_many(
+    vccrypt_block_job_t* jobs, size_t count);
+
+/**
+ * \brief Encrypt a whole storage sector in a tweakable sector mode, such as
+ * AES-256-XTS.
+ *
+ * The sector number is the tweak, so no IV needs to be stored, and any sector
+ * can be read or rewritten independently of the others.  The blocks within a
+ * sector are processed in parallel.
+ *
+ * \param context       The block cipher context to use.
+ * \param sector        The sector number.
+ * \param input         The plaintext sector.
+ * \param output        The output buffer for the ciphertext sector.  Must
+ *                      be either identical to input or not overlap it.
+ * \param size          The size of the sector, in bytes.  Must be a
+ *                      non-zero multiple of the block size.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG if an argument is invalid
+ *             or the sector size is not a multiple of the block size.
+ *      - \ref VCCRYPT_ERROR_BLOCK_SECTOR_UNSUPPORTED if the selected
+ *             algorithm is not a sector mode.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK vccrypt_block_encrypt_sector(
+    vccrypt_block_context_t* context, uint64_t sector, const void* input,
+    void* output, size_t size);
+
+/**
+ * \brief Decrypt a whole storage sector in a tweakable sector mode, such as
+ * AES-256-XTS.
+ *
+ * \param context       The block cipher context to use.
+ * \param sector        The sector number.
+ * \param input         The ciphertext sector.
+ * \param output        The output buffer for the plaintext sector.  Must be
+ *                      either identical to input or not overlap it.
+ * \param size          The size of the sector, in bytes.  Must be a
+ *                      non-zero multiple of the block size.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG if an argument is invalid
+ *             or the sector size is not a multiple of the block size.
+ *      - \ref VCCRYPT_ERROR_BLOCK_SECTOR_UNSUPPORTED if the selected
+ *             algorithm is not a sector mode.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK vccrypt_block_decrypt_sector(
+    vccrypt_block_context_t* context, uint64_t sector, const void* input,
+    void* output, size_t size);
+
+/**
+ * \brief Encrypt a run of consecutive storage sectors using multiple threads.
+ *
+ * This is equivalent to calling vccrypt_block_encrypt_sector() for sectors
+ * first_sector through first_sector + count - 1, with the sectors split across
+ * threads.
+ *
+ * \param context       The block cipher context to use.
+ * \param first_sector  The sector number of the first sector.
+ * \param sector_size   The size of each sector, in bytes.
+ * \param input         The plaintext sectors.
+ * \param output        The output buffer for the ciphertext sectors.
+ * \param count         The number of sectors.
+ * \param threads       The number of threads to use, or 0 to use one thread
+ *                      per online processor.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG if an argument is invalid
+ *             or the sector size is not a multiple of the block size.
+ *      - \ref VCCRYPT_ERROR_BLOCK_SECTOR_UNSUPPORTED if the selected
+ *             algorithm is not a sector mode.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK vccrypt_block_encrypt_sectors(
+    vccrypt_block_context_t* context, uint64_t first_sector,
+    size_t sector_size, const void* input, void* output, size_t count,
+    size_t threads);
+
+/**
+ * \brief Decrypt a run of consecutive storage sectors using multiple threads.
+ *
+ * \param context       The block cipher context to use.
+ * \param first_sector  The sector number of the first sector.
+ * \param sector_size   The size of each sector, in bytes.
+ * \param input         The ciphertext sectors.
+ * \param output        The output buffer for the plaintext sectors.
+ * \param count         The number of sectors.
+ * \param threads       The number of threads to use, or 0 to use one thread
+ *                      per online processor.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG if an argument is invalid
+ *             or the sector size is not a multiple of the block size.
+ *      - \ref VCCRYPT_ERROR_BLOCK_SECTOR_UNSUPPORTED if the selected
+ *             algorithm is not a sector mode.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK vccrypt_block_decrypt_sectors(
+    vccrypt_block_context_t* context, uint64_t first_sector,
+    size_t sector_size, const void* input, void* output, size_t count,
+    size_t threads);
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -67,6 +67,24 @@ typedef struct vccrypt_buffer
 
 } vccrypt_buffer_t;
 
+/**
+ * \brief A non-owning view of a contiguous span of bytes, used to pass
+ * scattered data to the vectored digest methods.
+ */
+typedef struct vccrypt_segment
+{
+    /**
+     * \brief The data in this segment.  May be NULL if size is 0.
+     */
+    const void* data;
+
+    /**
+     * \brief The size of this segment, in bytes.
+     */
+    size_t size;
+
+} vccrypt_segment_t;
+
 /**
  * \brief Initialize a buffer with the given size.
  *
@@ -291,6 +291,238 @@ extern "C" {
  */
 #define VCCRYPT_ERROR_MOCK_NOT_ADDED 0x2190
 
+/**
+ * \brief An attempt was made to call a parallel stream cipher method with an
+ * invalid argument.
+ */
+#define VCCRYPT_ERROR_STREAM_PARALLEL_INVALID_ARG 0x2194
+
+/**
+ * \brief A parallel stream cipher method could not allocate its worker state.
+ */
+#define VCCRYPT_ERROR_STREAM_PARALLEL_OUT_OF_MEMORY 0x2195
+
+/**
+ * \brief An attempt was made to call vccrypt_stream_decrypt_range() with a
+ * range that does not fit in the message body.
+ */
+#define VCCRYPT_ERROR_STREAM_DECRYPT_RANGE_INVALID_ARG 0x2196
+
+/**
+ * \brief An encrypted file passed to vccrypt_stream_decrypt_file() is too
+ * short to hold its IV header.
+ */
+#define VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG 0x2197
+
+/**
+ * \brief A read, write, or resize failed while encrypting or decrypting a
+ * file.
+ */
+#define VCCRYPT_ERROR_STREAM_FILE_IO 0x2198
+
+/**
+ * \brief The buffer used to stream a file could not be allocated.
+ */
+#define VCCRYPT_ERROR_STREAM_FILE_OUT_OF_MEMORY 0x2199
+
+/**
+ * \brief File encryption is not supported on this platform.
+ */
+#define VCCRYPT_ERROR_STREAM_FILE_UNSUPPORTED 0x219A
+
+/**
+ * \brief The input and output segments passed to vccrypt_stream_encryptv()
+ * or vccrypt_stream_decryptv() do not describe the same number of bytes.
+ */
+#define VCCRYPT_ERROR_STREAM_VECTOR_INVALID_ARG 0x219B
+
+/**
+ * \brief An attempt was made to call vccrypt_key_schedule_cache_enable() with
+ * an invalid argument.
+ */
+#define VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_INVALID_ARG 0x219C
+
+/**
+ * \brief The key schedule cache entries could not be allocated.
+ */
+#define VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_OUT_OF_MEMORY 0x219D
+
+/**
+ * \brief The key schedule cache is not supported on this platform.
+ */
+#define VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_UNSUPPORTED 0x219E
+
+/**
+ * \brief vccrypt_stream_init_with_storage() was called for a stream cipher that
+ * does not support caller-provided storage.
+ */
+#define VCCRYPT_ERROR_STREAM_INIT_STORAGE_UNSUPPORTED 0x219F
+
+/**
+ * \brief vccrypt_block_init_with_storage() was called for a block cipher that
+ * does not support caller-provided storage.
+ */
+#define VCCRYPT_ERROR_BLOCK_INIT_STORAGE_UNSUPPORTED 0x21A0
+
+/**
+ * \brief An invalid argument was passed to vccrypt_suite_aead_encrypt() or
+ * vccrypt_suite_aead_decrypt().
+ */
+#define VCCRYPT_ERROR_SUITE_AEAD_INVALID_ARG 0x21A1
+
+/**
+ * \brief The authentication tag did not match the message in
+ * vccrypt_suite_aead_decrypt().
+ */
+#define VCCRYPT_ERROR_SUITE_AEAD_AUTHENTICATION_FAILED 0x21A2
+
+/**
+ * \brief An authenticated encryption method was called on a stream cipher that
+ * does not authenticate messages, or an unauthenticated helper such as a file
+ * or range method was called on one that does.
+ */
+#define VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED 0x21A3
+
+/**
+ * \brief An invalid argument was passed to an authenticated stream cipher, or
+ * its methods were called out of order.
+ */
+#define VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG 0x21A4
+
+/**
+ * \brief The authentication tag did not match in vccrypt_stream_verify().
+ */
+#define VCCRYPT_ERROR_STREAM_AEAD_AUTHENTICATION_FAILED 0x21A5
+
+/**
+ * \brief An invalid argument was passed to vccrypt_block_encrypt_cbc(),
+ * vccrypt_block_decrypt_cbc(), or vccrypt_block_encrypt_cbc_many().
+ */
+#define VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG 0x21A6
+
+/**
+ * \brief An invalid job was passed to vccrypt_stream_encrypt_many() or
+ * vccrypt_stream_decrypt_many().
+ */
+#define VCCRYPT_ERROR_STREAM_MANY_INVALID_ARG 0x21A7
+
+/**
+ * \brief An invalid argument was passed to a block cipher sector method.
+ */
+#define VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG 0x21A8
+
+/**
+ * \brief The selected block cipher does not support sector encryption.
+ */
+#define VCCRYPT_ERROR_BLOCK_SECTOR_UNSUPPORTED 0x21A9
+
+/**
+ * \brief An invalid argument was passed to a stream cipher keystream
+ * precomputation method.
+ */
+#define VCCRYPT_ERROR_STREAM_PRECOMPUTE_INVALID_ARG 0x21AA
+
+/**
+ * \brief The selected stream cipher does not support keystream
+ * precomputation.
+ */
+#define VCCRYPT_ERROR_STREAM_PRECOMPUTE_UNSUPPORTED 0x21AB
+
+/**
+ * \brief Out of memory allocating the precomputed keystream buffer.
+ */
+#define VCCRYPT_ERROR_STREAM_PRECOMPUTE_OUT_OF_MEMORY 0x21AC
+
+/**
+ * \brief An invalid argument or job was passed to vccrypt_hash_digest_many().
+ */
+#define VCCRYPT_ERROR_HASH_DIGEST_MANY_INVALID_ARG 0x21AD
+
+/**
+ * \brief An invalid argument was passed to vccrypt_hash_clone().
+ */
+#define VCCRYPT_ERROR_HASH_CLONE_INVALID_ARG 0x21AE
+
+/**
+ * \brief An invalid argument was passed to vccrypt_hash_export_state().
+ */
+#define VCCRYPT_ERROR_HASH_EXPORT_STATE_INVALID_ARG 0x21AF
+
+/**
+ * \brief An invalid argument or a malformed midstate was passed to
+ * vccrypt_hash_import_state().
+ */
+#define VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG 0x21B0
+
+/**
+ * \brief The hash algorithm does not support midstate export and import.
+ */
+#define VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED 0x21B1
+
+/**
+ * \brief An invalid argument was passed to vccrypt_hash_oneshot().
+ */
+#define VCCRYPT_ERROR_HASH_ONESHOT_INVALID_ARG 0x21B2
+
+/**
+ * \brief An invalid argument or segment was passed to vccrypt_hash_digestv().
+ */
+#define VCCRYPT_ERROR_HASH_DIGESTV_INVALID_ARG 0x21B3
+
+/**
+ * \brief An invalid argument or segment was passed to vccrypt_mac_digestv().
+ */
+#define VCCRYPT_ERROR_MAC_DIGESTV_INVALID_ARG 0x21B4
+
+/**
+ * \brief An invalid argument was passed to vccrypt_merkle_init().
+ */
+#define VCCRYPT_ERROR_MERKLE_INIT_INVALID_ARG 0x21B5
+
+/**
+ * \brief A Merkle tree could not allocate its node storage.
+ */
+#define VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY 0x21B6
+
+/**
+ * \brief An invalid argument or leaf was passed to vccrypt_merkle_append() or
+ * vccrypt_merkle_append_many().
+ */
+#define VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG 0x21B7
+
+/**
+ * \brief An invalid argument was passed to vccrypt_merkle_root().
+ */
+#define VCCRYPT_ERROR_MERKLE_ROOT_INVALID_ARG 0x21B8
+
+/**
+ * \brief An invalid argument or leaf index was passed to
+ * vccrypt_merkle_proof().
+ */
+#define VCCRYPT_ERROR_MERKLE_PROOF_INVALID_ARG 0x21B9
+
+/**
+ * \brief An inclusion proof was requested from a Merkle tree that does not
+ * retain its nodes.
+ */
+#define VCCRYPT_ERROR_MERKLE_PROOF_UNSUPPORTED 0x21BA
+
+/**
+ * \brief An invalid argument was passed to vccrypt_merkle_verify().
+ */
+#define VCCRYPT_ERROR_MERKLE_VERIFY_INVALID_ARG 0x21BB
+
+/**
+ * \brief An inclusion proof did not match the expected Merkle root.
+ */
+#define VCCRYPT_ERROR_MERKLE_VERIFY_FAILED 0x21BC
+
+/**
+ * \brief A stream cipher was asked to seek to or process data past the end of
+ * the keystream available for a single message.
+ */
+#define VCCRYPT_ERROR_STREAM_MESSAGE_SIZE_EXCEEDED 0x21BD
+
 /**
  * @}
  */
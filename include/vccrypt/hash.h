@@ -34,6 +34,16 @@ extern "C" {
  * @{
  */
 
+/**
+ * \brief Digest size for SHA-2 256.
+ */
+#define VCCRYPT_HASH_SHA_256_DIGEST_SIZE 32
+
+/**
+ * \brief Block size for SHA-2 256.
+ */
+#define VCCRYPT_HASH_SHA_256_BLOCK_SIZE 64
+
 /**
  * \brief Digest size for SHA-2 512/256.
  */
@@ -63,6 +73,16 @@ extern "C" {
  * \brief Block size for SHA-2 512.
  */
 #define VCCRYPT_HASH_SHA_512_BLOCK_SIZE 128
+
+/**
+ * \brief The largest midstate exported by any hash algorithm, in bytes.
+ */
+#define VCCRYPT_HASH_MAX_STATE_SIZE 256
+
+/**
+ * \brief The size of the hash state storage embedded in each hash context.
+ */
+#define VCCRYPT_HASH_CONTEXT_STORAGE_SIZE 256
 /**
  * @}
  */
@@ -105,6 +125,70 @@ extern "C" {
  * \brief Selector for SHA-2 512/256.
  */
 #define VCCRYPT_HASH_ALGORITHM_SHA_2_512_256 0x00001000
+
+/**
+ * \brief Feature bit shared by every SHA-2 512 tree hash selector.
+ *
+ * Use \ref VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE to build a complete selector.
+ */
+#define VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE_FLAG 0x00002000
+
+/**
+ * \brief Tree hash leaf chunk size of 64 KiB.
+ */
+#define VCCRYPT_HASH_TREE_CHUNK_64K 0x00010000
+
+/**
+ * \brief Tree hash leaf chunk size of 256 KiB.
+ */
+#define VCCRYPT_HASH_TREE_CHUNK_256K 0x00020000
+
+/**
+ * \brief Tree hash leaf chunk size of 1 MiB.
+ */
+#define VCCRYPT_HASH_TREE_CHUNK_1M 0x00040000
+
+/**
+ * \brief Tree hash leaf chunk size of 4 MiB.
+ */
+#define VCCRYPT_HASH_TREE_CHUNK_4M 0x00080000
+
+/**
+ * \brief Tree hash fan-out of 2 children per parent node.
+ */
+#define VCCRYPT_HASH_TREE_FANOUT_2 0x00100000
+
+/**
+ * \brief Tree hash fan-out of 4 children per parent node.
+ */
+#define VCCRYPT_HASH_TREE_FANOUT_4 0x00200000
+
+/**
+ * \brief Tree hash fan-out of 8 children per parent node.
+ */
+#define VCCRYPT_HASH_TREE_FANOUT_8 0x00400000
+
+/**
+ * \brief Tree hash fan-out of 16 children per parent node.
+ */
+#define VCCRYPT_HASH_TREE_FANOUT_16 0x00800000
+
+/**
+ * \brief Selector for a SHA-2 512 tree hash with the given leaf chunk size
+ * and fan-out.
+ *
+ * The input is split into chunks of the selected size, which are hashed in
+ * parallel as leaves.  Groups of up to fan-out child digests are then hashed
+ * into parent nodes until a single node remains.  Leaf, parent, and root
+ * nodes are domain separated, and the root also commits to the chunk size,
+ * the fan-out, and the input length, so the result never collides with a
+ * plain SHA-2 512 digest or with a tree hash using different parameters.
+ *
+ * \param chunk        One of the VCCRYPT_HASH_TREE_CHUNK_* values.
+ * \param fanout       One of the VCCRYPT_HASH_TREE_FANOUT_* values.
+ */
+#define VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE(chunk, fanout) \
+    (VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE_FLAG | (chunk) | (fanout))
 /**
  * @}
  */
@@ -143,6 +227,11 @@ void vccrypt_hash_register_SHA_2_512_224();
  * \brief Register the SHA-2 512/256 algorithm.
  */
 void vccrypt_hash_register_SHA_2_512_256();
+
+/**
+ * \brief Register every chunk size and fan-out of the SHA-2 512 tree hash.
+ */
+void vccrypt_hash_register_SHA_2_512_TREE();
 /**
  * @}
  */
@@ -177,9 +266,26 @@ typedef struct vccrypt_hash_options
      */
     size_t hash_block_size;
 
+    /**
+     * \brief The size of an exported midstate in bytes, or 0 if this
+     * algorithm does not support midstate export and import.
+     */
+    size_t hash_state_size;
+
+    /**
+     * \brief The size of the algorithm-specific working state in bytes, if it
+     * can be embedded in the hash context by vccrypt_hash_init_embedded(), or
+     * 0 if the algorithm always allocates its working state.
+     */
+    size_t hash_context_state_size;
+
     /**
      * \brief Algorithm-specific initialization for hash.
      *
+     * If hash_context_state_size is not 0, then the context's hash_state may
+     * already point to its embedded storage, in which case the algorithm must
+     * use that storage instead of allocating its working state.
+     *
      * \param options   Opaque pointer to this options structure.
      * \param context   Opaque pointer to vccrypt_hash_context_t structure.
      *
@@ -208,6 +314,23 @@ typedef struct vccrypt_hash_options
     int (*vccrypt_hash_alg_digest)(
         void* context, const uint8_t* data, size_t size);
 
+    /**
+     * \brief Digest several segments of data, in order, for the given hash
+     * instance.
+     *
+     * This method is optional.  If it is NULL, then vccrypt_hash_digestv()
+     * digests each segment in turn with vccrypt_hash_alg_digest.
+     *
+     * \param context       An opaque pointer to the vccrypt_hash_context_t
+     *                      structure.
+     * \param segments      The segments to digest.
+     * \param count         The number of segments.
+     *
+     * \returns \ref VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_hash_alg_digestv)(
+        void* context, const vccrypt_segment_t* segments, size_t count);
+
     /**
      * \brief Finalize the hash, copying the output data to the given buffer.
      *
@@ -221,6 +344,50 @@ typedef struct vccrypt_hash_options
     int (*vccrypt_hash_alg_finalize)(
         void* context, vccrypt_buffer_t* hash_buffer);
 
+    /**
+     * \brief Hash many independent messages in a single call.
+     *
+     * This method is optional.  If it is NULL, then
+     * vccrypt_hash_digest_many() hashes each job in turn with a new context.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param jobs          An array of vccrypt_hash_job_t jobs.
+     * \param count         The number of jobs.
+     *
+     * \returns \ref VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_hash_alg_digest_many)(
+        void* options, void* jobs, size_t count);
+
+    /**
+     * \brief Export the midstate of the given hash instance.
+     *
+     * This method is optional, and must be set if hash_state_size is not 0.
+     *
+     * \param context       An opaque pointer to the vccrypt_hash_context_t
+     *                      structure.
+     * \param state         The buffer to receive the midstate.  Must be at
+     *                      least hash_state_size bytes in length.
+     *
+     * \returns \ref VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_hash_alg_export_state)(void* context, uint8_t* state);
+
+    /**
+     * \brief Replace the state of the given hash instance with an exported
+     * midstate.
+     *
+     * This method is optional, and must be set if hash_state_size is not 0.
+     *
+     * \param context       An opaque pointer to the vccrypt_hash_context_t
+     *                      structure.
+     * \param state         The midstate to import, which is hash_state_size
+     *                      bytes in length.
+     *
+     * \returns \ref VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_hash_alg_import_state)(void* context, const uint8_t* state);
+
     /**
      * \brief Implementation specific options init method.
      *
@@ -260,8 +427,37 @@ typedef struct vccrypt_hash_context
      */
     void* hash_state;
 
+    /**
+     * \brief Storage for the hash state of an instance initialized with
+     * vccrypt_hash_init_embedded().
+     */
+    uint64_t hash_state_storage[VCCRYPT_HASH_CONTEXT_STORAGE_SIZE / 8];
+
 } vccrypt_hash_context_t;
 
+/**
+ * \brief A single message passed to vccrypt_hash_digest_many().
+ */
+typedef struct vccrypt_hash_job
+{
+    /**
+     * \brief The message to hash.  May be NULL if size is 0.
+     */
+    const uint8_t* data;
+
+    /**
+     * \brief The size of the message, in bytes.
+     */
+    size_t size;
+
+    /**
+     * \brief The buffer to receive the hash.  Must be at least hash_size bytes
+     * in length for the selected algorithm.
+     */
+    uint8_t* digest;
+
+} vccrypt_hash_job_t;
+
 /**
  * \brief Initialize hash options, looking up an appropriate hash algorithm
  * registered in the abstract factory.
@@ -308,6 +504,33 @@ int VCCRYPT_DECL_MUST_CHECK
 vccrypt_hash_init(
     vccrypt_hash_options_t* options, vccrypt_hash_context_t* context);
 
+/**
+ * \brief Initialize a hash algorithm instance with the given options, keeping
+ * the hash state inside the context structure rather than allocating it.
+ *
+ * This behaves like vccrypt_hash_init(), but avoids an allocation and release
+ * per instance for algorithms that support it.  Other algorithms silently
+ * fall back to allocating their state.  Because the instance refers to its
+ * own storage, the context structure must not be moved or copied until it
+ * has been disposed.
+ *
+ * If initialization is successful, then this hash algorithm instance is owned
+ * by the caller and must be disposed by calling dispose() when no longer
+ * needed.
+ *
+ * \param options       The options to use for this algorithm instance.
+ * \param context       The hash instance to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_INIT_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_hash_init_embedded(
+    vccrypt_hash_options_t* options, vccrypt_hash_context_t* context);
+
 /**
  * \brief Digest data for the given hash instance.
  *
@@ -325,6 +548,30 @@ int VCCRYPT_DECL_MUST_CHECK
 vccrypt_hash_digest(
     vccrypt_hash_context_t* context, const uint8_t* data, size_t size);
 
+/**
+ * \brief Digest several segments of data, in order, for the given hash
+ * instance.
+ *
+ * This is equivalent to calling vccrypt_hash_digest() for each non-empty
+ * segment, but avoids a dispatch per segment.  Block boundaries that fall
+ * between segments are handled by the algorithm's own buffering, so callers
+ * need not copy small fields into a temporary buffer first.
+ *
+ * \param context       The hash instance.
+ * \param segments      The segments to digest.
+ * \param count         The number of segments.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_DIGESTV_INVALID_ARG if an invalid argument or
+ *             segment is provided.
+ *      - a non-zero error code.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_hash_digestv(
+    vccrypt_hash_context_t* context, const vccrypt_segment_t* segments,
+    size_t count);
+
 /**
  * \brief Finalize the hash, copying the output data to the given buffer.
  *
@@ -341,6 +588,121 @@ int VCCRYPT_DECL_MUST_CHECK
 vccrypt_hash_finalize(
     vccrypt_hash_context_t* context, vccrypt_buffer_t* hash_buffer);
 
+/**
+ * \brief Hash a single message, writing the hash to the given pointer.
+ *
+ * This is equivalent to initializing a hash instance, digesting the message,
+ * and finalizing it, but needs no allocation for algorithms that support
+ * vccrypt_hash_init_embedded().
+ *
+ * \param options       The options for the hash algorithm to use.
+ * \param data          The message to hash.  May be NULL if size is 0.
+ * \param size          The size of the message, in bytes.
+ * \param digest        The buffer to receive the hash.  Must be at least
+ *                      hash_size bytes in length.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_ONESHOT_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_hash_oneshot(
+    vccrypt_hash_options_t* options, const uint8_t* data, size_t size,
+    uint8_t* digest);
+
+/**
+ * \brief Hash many independent messages in a single call.
+ *
+ * Each job is hashed exactly as if a new hash instance were initialized with
+ * these options, given the job's message, and finalized into the job's digest
+ * buffer.  Algorithms that support it hash several messages at once in SIMD
+ * lanes, which greatly improves aggregate throughput for batches of short
+ * messages.
+ *
+ * \param options       The options for the hash algorithm to use.
+ * \param jobs          The jobs to hash.
+ * \param count         The number of jobs.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_DIGEST_MANY_INVALID_ARG if an invalid argument
+ *             or job is provided.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_hash_digest_many(
+    vccrypt_hash_options_t* options, vccrypt_hash_job_t* jobs, size_t count);
+
+/**
+ * \brief Initialize a hash algorithm instance as a copy of another.
+ *
+ * The new instance uses the same options as the source instance, and
+ * continues from the data digested into the source instance so far.  Both
+ * instances can then be digested and finalized independently.  This allows a
+ * common prefix to be hashed once and then forked for each message.
+ *
+ * If cloning is successful, then the new instance is owned by the caller and
+ * must be disposed by calling dispose() when no longer needed.
+ *
+ * \param dst           The hash instance to initialize.
+ * \param src           The hash instance to copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_CLONE_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - \ref VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED if the algorithm does not
+ *             support midstate export and import.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_hash_clone(vccrypt_hash_context_t* dst, vccrypt_hash_context_t* src);
+
+/**
+ * \brief Export the midstate of a hash instance.
+ *
+ * The midstate captures everything digested so far, and can later be imported
+ * into any instance of the same algorithm to continue from this point.  The
+ * hash instance itself is not modified.
+ *
+ * \param context       The hash instance.
+ * \param state_buffer  The buffer to receive the midstate.  Must be at least
+ *                      hash_state_size bytes in length.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_EXPORT_STATE_INVALID_ARG if an invalid
+ *             argument is provided.
+ *      - \ref VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED if the algorithm does not
+ *             support midstate export and import.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_hash_export_state(
+    vccrypt_hash_context_t* context, vccrypt_buffer_t* state_buffer);
+
+/**
+ * \brief Replace the state of a hash instance with an exported midstate.
+ *
+ * The midstate must have been exported from an instance of the same
+ * algorithm.
+ *
+ * \param context       The hash instance.
+ * \param state_buffer  The midstate to import.  Must be at least
+ *                      hash_state_size bytes in length.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG if an invalid
+ *             argument or a malformed midstate is provided.
+ *      - \ref VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED if the algorithm does not
+ *             support midstate export and import.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_hash_import_state(
+    vccrypt_hash_context_t* context, const vccrypt_buffer_t* state_buffer);
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -0,0 +1,97 @@
+/**
+ * \file key_schedule_cache.h
+ *
+ * \brief An opt-in cache of expanded AES key schedules.
+ *
+ * Initializing an AES stream or block cipher context expands the key into a
+ * full round key schedule, which for the 4X variants is 57 round keys.  Services
+ * that repeatedly create contexts for the same long-lived keys can enable this
+ * cache so that vccrypt_stream_init() and vccrypt_block_init() reuse a
+ * previously expanded schedule instead.
+ *
+ * The cache is process-wide, bounded, and safe to use from multiple threads.
+ * Entries are indexed by a keyed hash of the key material, round multiplier,
+ * and direction, using a secret drawn from a caller-supplied PRNG when the
+ * cache is enabled, and are verified against the full key in constant time
+ * before use.  The hash selects a small set of entries for each key; when that
+ * set is full, its least recently used entry is evicted, and every evicted
+ * entry is wiped.  The cache is disabled by default.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCRYPT_KEY_SCHEDULE_CACHE_HEADER_GUARD
+#define VCCRYPT_KEY_SCHEDULE_CACHE_HEADER_GUARD
+
+#include <stddef.h>
+#include <vccrypt/error_codes.h>
+#include <vccrypt/function_decl.h>
+#include <vccrypt/prng.h>
+#include <vpr/allocator.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The maximum number of entries that the key schedule cache can hold.
+ */
+#define VCCRYPT_KEY_SCHEDULE_CACHE_MAX_CAPACITY 4096
+
+/**
+ * \brief Enable the AES key schedule cache.
+ *
+ * If the cache is already enabled, it is first disabled, wiping all entries.
+ *
+ * \param prng          The PRNG used to generate the secret key for the
+ *                      keyed hash that indexes the cache.
+ * \param alloc_opts    The allocator used for the cache entries.  It must
+ *                      outlive the cache.
+ * \param capacity      The maximum number of key schedules to cache.  Must be
+ *                      between 1 and
+ *                      \ref VCCRYPT_KEY_SCHEDULE_CACHE_MAX_CAPACITY.  Above
+ *                      eight, it is rounded down to a multiple of eight.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_INVALID_ARG if the capacity is
+ *        out of range.
+ *      - \ref VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_OUT_OF_MEMORY if the cache
+ *        entries could not be allocated.
+ *      - \ref VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_UNSUPPORTED on platforms
+ *        without thread support.
+ *      - a non-zero error code if the PRNG could not be read.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_key_schedule_cache_enable(
+    vccrypt_prng_context_t* prng, allocator_options_t* alloc_opts,
+    size_t capacity);
+
+/**
+ * \brief Disable the AES key schedule cache, wiping and releasing all entries.
+ *
+ * Contexts that were initialized from the cache are unaffected, since each
+ * context holds its own copy of the key schedule.  It is safe to call this
+ * method when the cache is not enabled.
+ */
+void vccrypt_key_schedule_cache_disable();
+
+/**
+ * \brief Read the hit and miss counters of the key schedule cache.
+ *
+ * The counters are reset when the cache is enabled.
+ *
+ * \param hits          Set to the number of lookups satisfied by the cache.
+ *                      May be NULL.
+ * \param misses        Set to the number of lookups that expanded a new key
+ *                      schedule.  May be NULL.
+ */
+void vccrypt_key_schedule_cache_stats(size_t* hits, size_t* misses);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCRYPT_KEY_SCHEDULE_CACHE_HEADER_GUARD
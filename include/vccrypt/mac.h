@@ -47,6 +47,21 @@ extern "C" {
  * @{
  */
 
+/**
+ * \brief Key size for HMAC SHA-2 256.
+ */
+#define VCCRYPT_MAC_SHA_256_KEY_SIZE 32
+
+/**
+ * \brief MAC size for HMAC SHA-2 256.
+ */
+#define VCCRYPT_MAC_SHA_256_MAC_SIZE 32
+
+/**
+ * \brief Block size for HMAC SHA-2 256.
+ */
+#define VCCRYPT_MAC_SHA_256_BLOCK_SIZE 64
+
 /**
  * \brief Key size for HMAC SHA-2 512/256.
  */
@@ -91,6 +106,21 @@ extern "C" {
  * \brief Block size for HMAC SHA-2 512.
  */
 #define VCCRYPT_MAC_SHA_512_BLOCK_SIZE 128
+
+/**
+ * \brief Key size for Poly1305.
+ */
+#define VCCRYPT_MAC_POLY1305_KEY_SIZE 32
+
+/**
+ * \brief MAC size for Poly1305.
+ */
+#define VCCRYPT_MAC_POLY1305_MAC_SIZE 16
+
+/**
+ * \brief Block size for Poly1305.
+ */
+#define VCCRYPT_MAC_POLY1305_BLOCK_SIZE 16
 /**
  * @}
  */
@@ -133,6 +163,13 @@ extern "C" {
  * \brief Selector for HMAC SHA-2 512/256.
  */
 #define VCCRYPT_MAC_ALGORITHM_SHA_2_512_256_HMAC 0x00001000
+
+/**
+ * \brief Selector for the Poly1305 one-time authenticator.
+ *
+ * Poly1305 keys MUST NOT be used for more than one message.
+ */
+#define VCCRYPT_MAC_ALGORITHM_POLY1305 0x00002000
 /**
  * @}
  */
@@ -171,6 +208,11 @@ void vccrypt_mac_register_SHA_2_512_224_HMAC();
  * \brief Register the HMAC SHA-2 512/256 algorithm.
  */
 void vccrypt_mac_register_SHA_2_512_256_HMAC();
+
+/**
+ * \brief Register the Poly1305 algorithm.
+ */
+void vccrypt_mac_register_POLY1305();
 /**
  * @}
  */
@@ -248,6 +290,23 @@ typedef struct vccrypt_mac_options
     int (*vccrypt_mac_alg_digest)(
         void* context, const uint8_t* data, size_t size);
 
+    /**
+     * \brief Digest several segments of data, in order, for the given MAC
+     * instance.
+     *
+     * This method is optional.  If it is NULL, then vccrypt_mac_digestv()
+     * digests each segment in turn with vccrypt_mac_alg_digest.
+     *
+     * \param context       An opaque pointer to the vccrypt_mac_context_t
+     *                      structure.
+     * \param segments      The segments to digest.
+     * \param count         The number of segments.
+     *
+     * \returns \ref VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_mac_alg_digestv)(
+        void* context, const vccrypt_segment_t* segments, size_t count);
+
     /**
      * \brief Finalize the message authentication code, copying the output data
      * to the given buffer.
@@ -374,6 +433,28 @@ int VCCRYPT_DECL_MUST_CHECK
 vccrypt_mac_digest(
     vccrypt_mac_context_t* context, const uint8_t* data, size_t size);
 
+/**
+ * \brief Digest several segments of data, in order, for the given MAC
+ * instance.
+ *
+ * This is equivalent to calling vccrypt_mac_digest() for each non-empty
+ * segment, but avoids a dispatch per segment.
+ *
+ * \param context       The MAC instance.
+ * \param segments      The segments to digest.
+ * \param count         The number of segments.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MAC_DIGESTV_INVALID_ARG if an invalid argument or
+ *             segment is provided.
+ *      - a non-zero return code on error.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_mac_digestv(
+    vccrypt_mac_context_t* context, const vccrypt_segment_t* segments,
+    size_t count);
+
 /**
  * \brief Finalize the message authentication code, copying the output data to
  * the given buffer.
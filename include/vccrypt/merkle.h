@@ -0,0 +1,244 @@
+/**
+ * \file merkle.h
+ *
+ * \brief Incremental Merkle trees with inclusion proofs.
+ *
+ * A Merkle tree is built on top of a registered hash algorithm, using the
+ * construction from RFC 6962 / RFC 9162.  A leaf is hashed as
+ * H(0x00 || data), and an interior node as H(0x01 || left || right).  A tree
+ * of n leaves is split at the largest power of two smaller than n, so every
+ * left subtree is perfect.  The root of an empty tree is H().
+ *
+ * Leaves can only be appended.  The tree caches the root of each perfect
+ * subtree along its right edge, which is one node per set bit of the leaf
+ * count, so appending a leaf costs two hashes on average and computing the
+ * root costs at most one hash per cached node.  Trees that retain their nodes
+ * keep every leaf and interior hash in a single contiguous array in post-order,
+ * which only ever grows at the end, and can produce inclusion proofs.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCRYPT_MERKLE_HEADER_GUARD
+#define VCCRYPT_MERKLE_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <vccrypt/buffer.h>
+#include <vccrypt/error_codes.h>
+#include <vccrypt/function_decl.h>
+#include <vccrypt/hash.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The maximum height of a Merkle tree, which bounds the number of
+ * cached frontier nodes and the length of an inclusion proof.
+ */
+#define VCCRYPT_MERKLE_MAX_HEIGHT 64
+
+/**
+ * \brief The largest hash size supported by a Merkle tree.
+ */
+#define VCCRYPT_MERKLE_MAX_HASH_SIZE 64
+
+/**
+ * \brief An append-only Merkle tree.
+ */
+typedef struct vccrypt_merkle_tree
+{
+    /**
+     * \brief This tree is disposable.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The hash algorithm used for leaves and interior nodes.
+     */
+    vccrypt_hash_options_t* hash_options;
+
+    /**
+     * \brief The number of leaves in the tree.
+     */
+    uint64_t size;
+
+    /**
+     * \brief True if every node is kept so that proofs can be generated.
+     */
+    bool retain_nodes;
+
+    /**
+     * \brief Every node of the tree, in post-order, if nodes are retained.
+     */
+    uint8_t* nodes;
+
+    /**
+     * \brief The number of nodes in the node array.
+     */
+    size_t node_count;
+
+    /**
+     * \brief The number of nodes that fit in the node array.
+     */
+    size_t node_capacity;
+
+    /**
+     * \brief Scratch space used to hash batches of leaves.
+     */
+    void* batch;
+
+    /**
+     * \brief The root of the perfect subtree of height h on the right edge of
+     * the tree, for each bit h that is set in the leaf count.
+     */
+    uint8_t frontier[VCCRYPT_MERKLE_MAX_HEIGHT][VCCRYPT_MERKLE_MAX_HASH_SIZE];
+
+} vccrypt_merkle_tree_t;
+
+/**
+ * \brief Initialize an empty Merkle tree.
+ *
+ * If initialization is successful, then this tree is owned by the caller and
+ * must be disposed by calling dispose() when no longer needed.  The hash
+ * options must outlive the tree.
+ *
+ * \param tree          The tree to initialize.
+ * \param hash_options  The hash algorithm to use.  Its hash size must be no
+ *                      larger than \ref VCCRYPT_MERKLE_MAX_HASH_SIZE.
+ * \param retain_nodes  If true, the tree keeps every node so that inclusion
+ *                      proofs can be generated.  Otherwise, only the cached
+ *                      frontier is kept, and the tree uses a fixed amount of
+ *                      memory.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_INIT_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - \ref VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY if the tree's scratch space
+ *             could not be allocated.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_merkle_init(
+    vccrypt_merkle_tree_t* tree, vccrypt_hash_options_t* hash_options,
+    bool retain_nodes);
+
+/**
+ * \brief Append a single leaf to a Merkle tree.
+ *
+ * \param tree          The tree to update.
+ * \param data          The leaf data.  May be NULL if size is 0.
+ * \param size          The size of the leaf data, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG if an invalid argument
+ *             is provided.
+ *      - \ref VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY if the node array could not
+ *             be grown.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_merkle_append(
+    vccrypt_merkle_tree_t* tree, const void* data, size_t size);
+
+/**
+ * \brief Append several leaves to a Merkle tree, in order.
+ *
+ * Short leaves are hashed in batches with vccrypt_hash_digest_many(), so
+ * algorithms with a multi-buffer implementation hash several leaves at once.
+ * All leaves are validated before any are appended.  If hashing fails part way
+ * through, the leaves before the failing batch remain appended.
+ *
+ * \param tree          The tree to update.
+ * \param leaves        The leaves to append.
+ * \param count         The number of leaves.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG if an invalid argument
+ *             or leaf is provided.
+ *      - \ref VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY if the node array could not
+ *             be grown.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_merkle_append_many(
+    vccrypt_merkle_tree_t* tree, const vccrypt_segment_t* leaves,
+    size_t count);
+
+/**
+ * \brief Compute the root of a Merkle tree from its cached frontier.
+ *
+ * \param tree          The tree.
+ * \param root          The buffer to receive the root.  Must be at least the
+ *                      hash size of the tree's hash algorithm.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_ROOT_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_merkle_root(vccrypt_merkle_tree_t* tree, vccrypt_buffer_t* root);
+
+/**
+ * \brief Generate an inclusion proof for a leaf against the current root.
+ *
+ * The proof is the list of sibling hashes from the leaf up to the root, as
+ * defined by RFC 9162.  The proof buffer is initialized by this function, and
+ * on success is owned by the caller and must be disposed by calling dispose().
+ * Its size is the number of sibling hashes times the hash size.
+ *
+ * \param tree          The tree, which must retain its nodes.
+ * \param index         The index of the leaf.
+ * \param proof         The buffer to initialize with the proof.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_PROOF_INVALID_ARG if an invalid argument is
+ *             provided or the leaf index is out of range.
+ *      - \ref VCCRYPT_ERROR_MERKLE_PROOF_UNSUPPORTED if the tree does not
+ *             retain its nodes.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_merkle_proof(
+    vccrypt_merkle_tree_t* tree, uint64_t index, vccrypt_buffer_t* proof);
+
+/**
+ * \brief Verify that a leaf is included in a Merkle tree with the given root.
+ *
+ * \param hash_options  The hash algorithm used to build the tree.
+ * \param index         The index of the leaf.
+ * \param tree_size     The number of leaves in the tree.
+ * \param data          The leaf data.  May be NULL if size is 0.
+ * \param size          The size of the leaf data, in bytes.
+ * \param proof         The inclusion proof.
+ * \param root          The expected root.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS if the proof is valid.
+ *      - \ref VCCRYPT_ERROR_MERKLE_VERIFY_INVALID_ARG if an invalid argument
+ *             is provided.
+ *      - \ref VCCRYPT_ERROR_MERKLE_VERIFY_FAILED if the proof does not
+ *             match the leaf, its position, or the root.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_merkle_verify(
+    vccrypt_hash_options_t* hash_options, uint64_t index, uint64_t tree_size,
+    const void* data, size_t size, const vccrypt_buffer_t* proof,
+    const vccrypt_buffer_t* root);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCRYPT_MERKLE_HEADER_GUARD
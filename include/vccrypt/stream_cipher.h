@@ -60,6 +60,21 @@ extern "C" {
  * \brief Selector for AES-256-CTR-4X mode.
  */
 #define VCCRYPT_STREAM_ALGORITHM_AES_256_4X_CTR 0x00000800
+
+/**
+ * \brief Selector for AES-256-GCM mode.
+ */
+#define VCCRYPT_STREAM_ALGORITHM_AES_256_GCM 0x00001000
+
+/**
+ * \brief Selector for ChaCha20 (RFC 8439) without authentication.
+ */
+#define VCCRYPT_STREAM_ALGORITHM_CHACHA20 0x00002000
+
+/**
+ * \brief Selector for the ChaCha20-Poly1305 AEAD (RFC 8439).
+ */
+#define VCCRYPT_STREAM_ALGORITHM_CHACHA20_POLY1305 0x00004000
 /**
  * @}
  */
@@ -94,6 +109,21 @@ void vccrypt_stream_register_AES_256_3X_CTR();
  * \brief Register the AES-256-CTR-4X algorithm.
  */
 void vccrypt_stream_register_AES_256_4X_CTR();
+
+/**
+ * \brief Register the AES-256-GCM algorithm.
+ */
+void vccrypt_stream_register_AES_256_GCM();
+
+/**
+ * \brief Register the ChaCha20 algorithm.
+ */
+void vccrypt_stream_register_CHACHA20();
+
+/**
+ * \brief Register the ChaCha20-Poly1305 algorithm.
+ */
+void vccrypt_stream_register_CHACHA20_POLY1305();
 /**
  * @}
  */
@@ -132,6 +162,12 @@ typedef struct vccrypt_stream_options
      */
     uint64_t maximum_message_size;
 
+    /**
+     * \brief The authentication tag size in bytes, or 0 if this stream cipher
+     * does not authenticate messages.
+     */
+    size_t tag_size;
+
     /**
      * \brief Algorithm-specific initialization for stream cipher.
      *
@@ -263,6 +299,213 @@ typedef struct vccrypt_stream_options
         void* options, void* context, const void* input, size_t size,
         void* output, size_t* offset);
 
+    /**
+     * \brief Encrypt a large region of data using multiple threads.
+     *
+     * This method is optional.  If it is NULL, then
+     * vccrypt_stream_encrypt_parallel() falls back to a serial encryption.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_stream_context_t
+     *                      structure.
+     * \param iv            The IV for this stream.
+     * \param iv_size       The size of the IV in bytes.
+     * \param input_offset  The offset of input within the plaintext stream.
+     * \param input         A pointer to the plaintext input to encrypt.
+     * \param size          The size of the plaintext input, in bytes.
+     * \param output        The output buffer where data is written.  There must
+     *                      be at least *offset + size bytes available in this
+     *                      buffer.
+     * \param offset        A pointer to the current offset in the buffer.  Will
+     *                      be incremented by size.
+     * \param threads       The number of threads to use, or 0 to use one
+     *                      thread per online processor.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_stream_alg_encrypt_parallel)(
+        void* options, void* context, const void* iv, size_t iv_size,
+        size_t input_offset, const void* input, size_t size, void* output,
+        size_t* offset, size_t threads);
+
+    /**
+     * \brief Decrypt a large region of data using multiple threads.
+     *
+     * This method is optional.  If it is NULL, then
+     * vccrypt_stream_decrypt_parallel() falls back to a serial decryption.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_stream_context_t
+     *                      structure.
+     * \param iv            The IV for this stream.
+     * \param iv_size       The size of the IV in bytes.
+     * \param input_offset  The offset of input within the ciphertext stream,
+     *                      not counting the IV header.
+     * \param input         A pointer to the ciphertext input to decrypt.
+     * \param size          The size of the ciphertext input, in bytes.
+     * \param output        The output buffer where plaintext data is written.
+     *                      There must be at least *offset + size bytes
+     *                      available in this buffer.
+     * \param offset        A pointer to the current offset in the buffer.  Will
+     *                      be incremented by size.
+     * \param threads       The number of threads to use, or 0 to use one
+     *                      thread per online processor.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_stream_alg_decrypt_parallel)(
+        void* options, void* context, const void* iv, size_t iv_size,
+        size_t input_offset, const void* input, size_t size, void* output,
+        size_t* offset, size_t threads);
+
+    /**
+     * \brief Return the size of the context storage needed by this algorithm.
+     *
+     * This method is optional.  If it is NULL, then this algorithm does not
+     * support caller-provided storage.
+     *
+     * \param options       Opaque pointer to this options structure.
+     *
+     * \returns the storage size in bytes.
+     */
+    size_t (*vccrypt_stream_alg_storage_size)(void* options);
+
+    /**
+     * \brief Algorithm-specific initialization for stream cipher using
+     * caller-provided storage for the cipher state.
+     *
+     * This method is optional, and must be set if
+     * vccrypt_stream_alg_storage_size is set.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       Opaque pointer to vccrypt_stream_context_t
+     *                      structure.
+     * \param key           The key to use for this instance.
+     * \param storage       The storage for the cipher state.
+     * \param storage_size  The size of the storage, in bytes.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on error.
+     */
+    int (*vccrypt_stream_alg_init_with_storage)(
+        void* options, void* context, const vccrypt_buffer_t* key,
+        void* storage, size_t storage_size);
+
+    /**
+     * \brief Authenticate additional data that is not encrypted.
+     *
+     * This method is optional, and is only set for authenticated stream
+     * ciphers.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_stream_context_t
+     *                      structure.
+     * \param aad           The additional data.
+     * \param size          The size of the additional data, in bytes.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_stream_alg_authenticate)(
+        void* options, void* context, const void* aad, size_t size);
+
+    /**
+     * \brief Finish an authenticated encryption, writing the tag.
+     *
+     * This method is optional, and is only set for authenticated stream
+     * ciphers.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_stream_context_t
+     *                      structure.
+     * \param output        The output buffer where the tag is written.  There
+     *                      must be at least *offset + tag_size bytes available
+     *                      in this buffer.
+     * \param offset        A pointer to the current offset in the buffer.  Will
+     *                      be incremented by tag_size.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_stream_alg_finalize)(
+        void* options, void* context, void* output, size_t* offset);
+
+    /**
+     * \brief Finish an authenticated decryption, verifying the tag.
+     *
+     * This method is optional, and is only set for authenticated stream
+     * ciphers.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_stream_context_t
+     *                      structure.
+     * \param tag           The tag_size byte tag to verify.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_stream_alg_verify)(
+        void* options, void* context, const void* tag);
+
+    /**
+     * \brief Encrypt many independent messages in a single call.
+     *
+     * This method is optional.  If it is NULL, then
+     * vccrypt_stream_encrypt_many() encrypts each job in turn.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param jobs          An array of vccrypt_stream_job_t jobs, each of
+     *                      which uses a context with this method.
+     * \param count         The number of jobs.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_stream_alg_encrypt_many)(
+        void* options, void* jobs, size_t count);
+
+    /**
+     * \brief Decrypt many independent messages in a single call.
+     *
+     * This method is optional.  If it is NULL, then
+     * vccrypt_stream_decrypt_many() decrypts each job in turn.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param jobs          An array of vccrypt_stream_job_t jobs, each of
+     *                      which uses a context with this method.
+     * \param count         The number of jobs.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_stream_alg_decrypt_many)(
+        void* options, void* jobs, size_t count);
+
+    /**
+     * \brief Enable, resize, or disable keystream precomputation.
+     *
+     * This method is optional.  If it is NULL, then this algorithm does not
+     * support keystream precomputation.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_stream_context_t
+     *                      structure.
+     * \param size          The number of bytes of keystream to keep ready, or
+     *                      0 to disable precomputation.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_stream_alg_precompute_enable)(
+        void* options, void* context, size_t size);
+
+    /**
+     * \brief Top up the precomputed keystream.
+     *
+     * This method is optional, and must be set if
+     * vccrypt_stream_alg_precompute_enable is set.
+     *
+     * \param options       Opaque pointer to this options structure.
+     * \param context       An opaque pointer to the vccrypt_stream_context_t
+     *                      structure.
+     *
+     * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+     */
+    int (*vccrypt_stream_alg_precompute)(void* options, void* context);
+
     /**
      * \brief Algorithm-specific data.
      */
@@ -309,6 +552,59 @@ typedef struct vccrypt_stream_context
 
 } vccrypt_stream_context_t;
 
+/**
+ * \brief A single segment of a scatter / gather list passed to
+ * vccrypt_stream_encryptv() or vccrypt_stream_decryptv().
+ */
+typedef struct vccrypt_stream_iovec
+{
+    /**
+     * \brief The start of this segment.
+     */
+    void* data;
+
+    /**
+     * \brief The size of this segment, in bytes.
+     */
+    size_t size;
+
+} vccrypt_stream_iovec_t;
+
+/**
+ * \brief A single message passed to vccrypt_stream_encrypt_many() or
+ * vccrypt_stream_decrypt_many().
+ */
+typedef struct vccrypt_stream_job
+{
+    /**
+     * \brief The started stream cipher context for this message.  Jobs that
+     * share a context are processed one after another, in order.
+     */
+    vccrypt_stream_context_t* context;
+
+    /**
+     * \brief The input for this message.
+     */
+    const void* input;
+
+    /**
+     * \brief The size of the input, in bytes.
+     */
+    size_t size;
+
+    /**
+     * \brief The output buffer for this message.  There must be at least
+     * offset + size bytes available in this buffer.
+     */
+    void* output;
+
+    /**
+     * \brief The current offset in the output buffer.  Incremented by size.
+     */
+    size_t offset;
+
+} vccrypt_stream_job_t;
+
 /**
  * \brief Initialize Stream Cipher options, looking up an appropriate Stream
  * Cipher algorithm registered in the abstract factory.
@@ -362,6 +658,56 @@ vccrypt_stream_init(
     vccrypt_stream_options_t* options, vccrypt_stream_context_t* context,
     const vccrypt_buffer_t* key);
 
+/**
+ * \brief The required alignment of storage passed to
+ * vccrypt_stream_init_with_storage().
+ */
+#define VCCRYPT_STREAM_STORAGE_ALIGNMENT 16
+
+/**
+ * \brief Return the number of bytes of storage needed to hold the cipher
+ * state for the given options.
+ *
+ * The size reflects the selected algorithm, so for instance the AES FIPS
+ * variant needs considerably less storage than the 4X variant.
+ *
+ * \param options       The options for the stream cipher.
+ *
+ * \returns the size in bytes, or 0 if the selected algorithm does not support
+ *          caller-provided storage.
+ */
+size_t vccrypt_stream_storage_size(const vccrypt_stream_options_t* options);
+
+/**
+ * \brief Initialize a Stream Cipher algorithm instance, storing the cipher
+ * state in caller-provided storage instead of allocating it.
+ *
+ * The storage must be aligned to \ref VCCRYPT_STREAM_STORAGE_ALIGNMENT bytes,
+ * must be at least vccrypt_stream_storage_size() bytes in size, and must
+ * outlive the context.  It can live on the stack or inside a larger structure.
+ * The context must still be disposed by calling dispose(), which wipes the
+ * storage but does not release it.
+ *
+ * \param options       The options to use for this algorithm instance.
+ * \param context       The stream cipher instance to initialize.
+ * \param key           The key to use for this algorithm instance.
+ * \param storage       The storage for the cipher state.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_INIT_INVALID_ARG if one of the provided
+ *             arguments is invalid, or if the storage is too small or is
+ *             misaligned.
+ *      - \ref VCCRYPT_ERROR_STREAM_INIT_STORAGE_UNSUPPORTED if the selected
+ *             algorithm does not support caller-provided storage.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_init_with_storage(
+    vccrypt_stream_options_t* options, vccrypt_stream_context_t* context,
+    const vccrypt_buffer_t* key, void* storage, size_t storage_size);
+
 /**
  * \brief Algorithm-specific start for the stream cipher encryption.
  * Initializes output buffer with IV.
@@ -446,6 +792,9 @@ vccrypt_stream_continue_decryption(
  * \param offset        A pointer to the current offset in the buffer.  Will
  *                      be incremented by size.
  *
+ * Encryption may be performed in place: input may equal output + *offset.
+ * Other overlapping buffers are not supported.
+ *
  * \returns a status indicating success or failure.
  *      - \ref VCCRYPT_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
@@ -467,6 +816,9 @@ vccrypt_stream_encrypt(
  * \param offset        A pointer to the current offset in the buffer.  Will
  *                      be incremented by size.
  *
+ * Decryption may be performed in place: input may equal output + *offset.
+ * Other overlapping buffers are not supported.
+ *
  * \returns a status indicating success or failure.
  *      - \ref VCCRYPT_STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
@@ -476,6 +828,419 @@ vccrypt_stream_decrypt(
     vccrypt_stream_context_t* context, const void* input, size_t size,
     void* output, size_t* offset);
 
+/**
+ * \brief Authenticate additional data with an authenticated stream cipher.
+ *
+ * Additional data is covered by the tag but is not encrypted or written to the
+ * output.  It must be supplied after starting encryption or decryption and
+ * before the first call to vccrypt_stream_encrypt() or
+ * vccrypt_stream_decrypt().  It may be supplied in several pieces.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param aad           The additional data.
+ * \param size          The size of the additional data, in bytes.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if this stream cipher does
+ *             not authenticate messages.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG if an argument is invalid
+ *             or if data has already been encrypted or decrypted.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_authenticate(
+    vccrypt_stream_context_t* context, const void* aad, size_t size);
+
+/**
+ * \brief Finish an authenticated encryption, appending the tag to the output.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param output        The output buffer where the tag is written.  There must
+ *                      be at least *offset + tag_size bytes available in this
+ *                      buffer.
+ * \param offset        A pointer to the current offset in the buffer.  Will be
+ *                      incremented by tag_size.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if this stream cipher does
+ *             not authenticate messages.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG if an argument is invalid
+ *             or if no message has been started.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_finalize(
+    vccrypt_stream_context_t* context, void* output, size_t* offset);
+
+/**
+ * \brief Finish an authenticated decryption, verifying the tag.
+ *
+ * Plaintext returned by vccrypt_stream_decrypt() for an authenticated stream
+ * cipher must not be used until this function succeeds.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param tag           The tag_size byte tag that followed the ciphertext.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if this stream cipher does
+ *             not authenticate messages.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG if an argument is invalid
+ *             or if no message has been started.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_AUTHENTICATION_FAILED if the tag does
+ *             not match.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_verify(vccrypt_stream_context_t* context, const void* tag);
+
+/**
+ * \brief Encrypt a scatter / gather list of plaintext segments.
+ *
+ * The input segments are treated as one contiguous plaintext and encrypted
+ * into the output segments, which are treated as one contiguous output.  The
+ * two lists may be split at different points, but must describe the same total
+ * number of bytes.  The keystream position carries across segment boundaries
+ * and across calls, exactly as if vccrypt_stream_encrypt() had been called on
+ * the concatenated data.  Empty segments are skipped.
+ *
+ * Encryption may be performed in place by passing the same segments, or any
+ * segmentation of the same memory, for both input and output.  Other
+ * overlapping layouts are not supported.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param input         The plaintext input segments.
+ * \param input_count   The number of input segments.
+ * \param output        The output segments.
+ * \param output_count  The number of output segments.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_VECTOR_INVALID_ARG if the input and output
+ *        segments have different total sizes.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_encryptv(
+    vccrypt_stream_context_t* context, const vccrypt_stream_iovec_t* input,
+    size_t input_count, const vccrypt_stream_iovec_t* output,
+    size_t output_count);
+
+/**
+ * \brief Decrypt a scatter / gather list of ciphertext segments.
+ *
+ * This is the decryption counterpart of vccrypt_stream_encryptv(), with the
+ * same segment and in-place semantics.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param input         The ciphertext input segments.
+ * \param input_count   The number of input segments.
+ * \param output        The output segments.
+ * \param output_count  The number of output segments.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_VECTOR_INVALID_ARG if the input and output
+ *        segments have different total sizes.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_decryptv(
+    vccrypt_stream_context_t* context, const vccrypt_stream_iovec_t* input,
+    size_t input_count, const vccrypt_stream_iovec_t* output,
+    size_t output_count);
+
+/**
+ * \brief Pass as the message_size of vccrypt_stream_decrypt_range() when the
+ * size of the message body is not known, to skip range validation.
+ */
+#define VCCRYPT_STREAM_DECRYPT_RANGE_UNBOUNDED SIZE_MAX
+
+/**
+ * \brief Decrypt an arbitrary range of an encrypted stream.
+ *
+ * The caller supplies the IV, which is the IV header written by
+ * vccrypt_stream_start_encryption(), and only the slice of ciphertext that
+ * starts at the requested body offset.  The rest of the stream does not need
+ * to be read or held in memory.  The cipher is positioned directly at offset,
+ * so the cost is proportional to length rather than to offset.  Neither end of
+ * the range needs to be aligned to the cipher's block size.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param iv            The IV of the stream, IV_size bytes in length.
+ * \param input         The ciphertext slice, starting at body offset offset,
+ *                      which must be at least length bytes in size.
+ * \param offset        The offset of the first byte to decrypt, relative to
+ *                      the start of the message body.
+ * \param length        The number of bytes to decrypt.
+ * \param output        The output buffer, which must be at least length bytes
+ *                      in size.
+ * \param message_size  The size of the complete message body, used to check
+ *                      that the range lies within it, or
+ *                      VCCRYPT_STREAM_DECRYPT_RANGE_UNBOUNDED to skip the
+ *                      check.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if the cipher authenticates
+ *        messages, since a partial range cannot be verified.
+ *      - \ref VCCRYPT_ERROR_STREAM_DECRYPT_RANGE_INVALID_ARG if the range
+ *        extends past the end of the message body.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_decrypt_range(
+    vccrypt_stream_context_t* context, const void* iv, const void* input,
+    size_t offset, size_t length, void* output, size_t message_size);
+
+/**
+ * \brief Encrypt the contents of one file into another.
+ *
+ * The input is read from its current position to the end of file.  The IV
+ * header followed by the encrypted input is written at the output's current
+ * position, and if the output is a regular file, it is truncated at the end of
+ * the encrypted data.  On success, both positions are left just past the data
+ * that was read or written.  The input and output must be different files.
+ *
+ * When both descriptors refer to regular files, the output is resized to fit,
+ * both files are memory mapped with sequential access hints, and the body is
+ * encrypted directly from one mapping into the other without intermediate
+ * copies.  Otherwise, for instance for pipes or sockets, the input is streamed
+ * through a fixed-size buffer.  Both paths produce the same result.
+ *
+ * The context must have been initialized with vccrypt_stream_init().  On
+ * success, the context is positioned at the end of the stream.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param iv            The IV to use for this stream.  MUST ONLY BE USED ONCE
+ *                      PER KEY, EVER.
+ * \param iv_size       The size of the IV in bytes.
+ * \param input_fd      The file descriptor of the plaintext input.
+ * \param output_fd     The file descriptor of the encrypted output.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG if the input and output
+ *        are the same file.
+ *      - \ref VCCRYPT_ERROR_STREAM_FILE_IO if a read, write, or resize fails.
+ *      - \ref VCCRYPT_ERROR_STREAM_FILE_OUT_OF_MEMORY if the streaming buffer
+ *        could not be allocated.
+ *      - \ref VCCRYPT_ERROR_STREAM_FILE_UNSUPPORTED on platforms without file
+ *        support.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if the cipher produces an
+ *        authentication tag, which this file format does not carry.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_encrypt_file(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    int input_fd, int output_fd);
+
+/**
+ * \brief Decrypt the contents of one file into another.
+ *
+ * The IV is read from the header at the input's current position, and the
+ * decrypted body is written at the output's current position.  Positions,
+ * truncation, and memory mapping follow vccrypt_stream_encrypt_file().
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param input_fd      The file descriptor of the encrypted input.
+ * \param output_fd     The file descriptor of the plaintext output.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG if the input is too short
+ *        to hold the IV header, or if the input and output are the same file.
+ *      - \ref VCCRYPT_ERROR_STREAM_FILE_IO if a read, write, or resize fails.
+ *      - \ref VCCRYPT_ERROR_STREAM_FILE_OUT_OF_MEMORY if the streaming buffer
+ *        could not be allocated.
+ *      - \ref VCCRYPT_ERROR_STREAM_FILE_UNSUPPORTED on platforms without file
+ *        support.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if the cipher produces an
+ *        authentication tag, which this file format does not carry.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_decrypt_file(
+    vccrypt_stream_context_t* context, int input_fd, int output_fd);
+
+/**
+ * \brief Encrypt a large region of data using multiple threads.
+ *
+ * The region is split into independent chunks, each of which is encrypted at
+ * its own counter position on a worker thread.  The output is identical to
+ * calling vccrypt_stream_continue_encryption() with the same IV and
+ * input_offset followed by vccrypt_stream_encrypt().  On success, the context
+ * is left positioned at input_offset + size, so further serial calls to
+ * vccrypt_stream_encrypt() continue the stream.
+ *
+ * If the selected algorithm does not provide a parallel implementation, or if
+ * threads are not available on this platform, the region is encrypted on the
+ * calling thread.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param iv            The IV for this stream.
+ * \param iv_size       The size of the IV in bytes.
+ * \param input_offset  The offset of input within the plaintext stream.
+ * \param input         A pointer to the plaintext input to encrypt.
+ * \param size          The size of the plaintext input, in bytes.
+ * \param output        The output buffer where data is written.  There must
+ *                      be at least *offset + size bytes available in this
+ *                      buffer.
+ * \param offset        A pointer to the current offset in the buffer.  Will
+ *                      be incremented by size.
+ * \param threads       The number of threads to use, or 0 to use one thread
+ *                      per online processor.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_PARALLEL_INVALID_ARG if the IV size is
+ *        invalid for this algorithm.
+ *      - \ref VCCRYPT_ERROR_STREAM_PARALLEL_OUT_OF_MEMORY if worker state
+ *        could not be allocated.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_encrypt_parallel(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    size_t input_offset, const void* input, size_t size, void* output,
+    size_t* offset, size_t threads);
+
+/**
+ * \brief Decrypt a large region of data using multiple threads.
+ *
+ * The output is identical to calling vccrypt_stream_continue_decryption() with
+ * the same IV and input_offset followed by vccrypt_stream_decrypt().  On
+ * success, the context is left positioned at input_offset + size.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param iv            The IV for this stream.
+ * \param iv_size       The size of the IV in bytes.
+ * \param input_offset  The offset of input within the ciphertext stream, not
+ *                      counting the IV header.
+ * \param input         A pointer to the ciphertext input to decrypt.
+ * \param size          The size of the ciphertext input, in bytes.
+ * \param output        The output buffer where plaintext data is written.
+ *                      There must be at least *offset + size bytes
+ *                      available in this buffer.
+ * \param offset        A pointer to the current offset in the buffer.  Will
+ *                      be incremented by size.
+ * \param threads       The number of threads to use, or 0 to use one thread
+ *                      per online processor.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_PARALLEL_INVALID_ARG if the IV size is
+ *        invalid for this algorithm.
+ *      - \ref VCCRYPT_ERROR_STREAM_PARALLEL_OUT_OF_MEMORY if worker state
+ *        could not be allocated.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_decrypt_parallel(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    size_t input_offset, const void* input, size_t size, void* output,
+    size_t* offset, size_t threads);
+
+/**
+ * \brief Encrypt many independent messages in a single call.
+ *
+ * Each job is encrypted exactly as if vccrypt_stream_encrypt() were called on
+ * its context.  Algorithms that support it interleave the jobs, so that many
+ * short messages under different keys keep the cipher pipeline full.  Jobs
+ * are only interleaved when every context uses the same algorithm family;
+ * otherwise, they are encrypted in turn.
+ *
+ * \param jobs          The jobs to encrypt.
+ * \param count         The number of jobs.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_MANY_INVALID_ARG if a job is invalid.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_encrypt_many(vccrypt_stream_job_t* jobs, size_t count);
+
+/**
+ * \brief Decrypt many independent messages in a single call.
+ *
+ * Each job is decrypted exactly as if vccrypt_stream_decrypt() were called on
+ * its context.  See vccrypt_stream_encrypt_many().
+ *
+ * \param jobs          The jobs to decrypt.
+ * \param count         The number of jobs.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_MANY_INVALID_ARG if a job is invalid.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_decrypt_many(vccrypt_stream_job_t* jobs, size_t count);
+
+/**
+ * \brief The largest amount of keystream that can be precomputed for a single
+ * stream cipher context.
+ */
+#define VCCRYPT_STREAM_PRECOMPUTE_MAX_SIZE (1024 * 1024)
+
+/**
+ * \brief Enable, resize, or disable keystream precomputation for a stream
+ * cipher context.
+ *
+ * For stream ciphers whose keystream does not depend on the plaintext, such as
+ * AES CTR, the context can keep up to size bytes of keystream ready in an
+ * owned buffer, so that vccrypt_stream_encrypt() and vccrypt_stream_decrypt()
+ * reduce to a memory XOR while it lasts.  Once the precomputed keystream is
+ * used up, they transparently fall back to generating keystream as they go.
+ *
+ * The buffer is filled when precomputation is enabled, and again whenever the
+ * stream is started or continued, which moves the keystream work off the data
+ * path.  Call vccrypt_stream_precompute() at a convenient time, such as while
+ * waiting for the next request, to top it up.  Keystream is wiped as soon as
+ * it is used, and any unused keystream is wiped when precomputation is
+ * disabled or the context is disposed.
+ *
+ * \param context       The stream cipher context.
+ * \param size          The number of bytes of keystream to keep ready, up to
+ *                      \ref VCCRYPT_STREAM_PRECOMPUTE_MAX_SIZE, or 0 to
+ *                      disable precomputation.  This is rounded up to a whole
+ *                      number of cipher blocks.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_PRECOMPUTE_INVALID_ARG if the size is too
+ *             large.
+ *      - \ref VCCRYPT_ERROR_STREAM_PRECOMPUTE_UNSUPPORTED if the algorithm
+ *             does not support keystream precomputation.
+ *      - \ref VCCRYPT_ERROR_STREAM_PRECOMPUTE_OUT_OF_MEMORY if the buffer
+ *             could not be allocated.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_precompute_enable(
+    vccrypt_stream_context_t* context, size_t size);
+
+/**
+ * \brief Top up the precomputed keystream for a stream cipher context.
+ *
+ * \param context       The stream cipher context, which must have
+ *                      precomputation enabled.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_PRECOMPUTE_INVALID_ARG if precomputation
+ *             is not enabled.
+ *      - \ref VCCRYPT_ERROR_STREAM_PRECOMPUTE_UNSUPPORTED if the algorithm
+ *             does not support keystream precomputation.
+ *      - a non-zero error code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_stream_precompute(vccrypt_stream_context_t* context);
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -789,6 +789,91 @@ vccrypt_suite_stream_init(
     vccrypt_suite_options_t* options, vccrypt_stream_context_t* context,
     const vccrypt_buffer_t* key);
 
+/**
+ * \brief Return the number of bytes that vccrypt_suite_aead_encrypt() adds to
+ * a message.
+ *
+ * This is the stream cipher IV header plus the long MAC.
+ *
+ * \param options       The options structure for this crypto suite.
+ *
+ * \returns the AEAD overhead, in bytes.
+ */
+size_t vccrypt_suite_aead_overhead(const vccrypt_suite_options_t* options);
+
+/**
+ * \brief Encrypt and authenticate a message using the suite stream cipher and
+ * the suite MAC, in a single pass.
+ *
+ * This is an encrypt-then-MAC construction.  The output is the stream cipher
+ * IV header, followed by the ciphertext, followed by a MAC over the associated
+ * data, the IV header, the ciphertext, and the big-endian 64-bit sizes of the
+ * associated data and the ciphertext.  The message is processed in
+ * cache-sized chunks, so each chunk of ciphertext is MACed while it is still
+ * in cache.
+ *
+ * The cipher key and the MAC key must be independent.
+ *
+ * \param options       The options structure for this crypto suite.
+ * \param cipher_key    The stream cipher key.
+ * \param mac_key       The MAC key.
+ * \param iv            The IV, which must be stream_cipher_opts.IV_size bytes
+ *                      and must never be reused with the same cipher key.
+ * \param aad           Associated data to authenticate but not encrypt.  May
+ *                      be NULL if aad_size is 0.
+ * \param aad_size      The size of the associated data, in bytes.
+ * \param input         The plaintext to encrypt.
+ * \param size          The size of the plaintext, in bytes.
+ * \param output        The output buffer.  For in-place encryption, input
+ *                      may equal output plus the IV size.
+ * \param output_size   The size of the output buffer; this must be at least
+ *                      size + vccrypt_suite_aead_overhead().
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_SUITE_AEAD_INVALID_ARG if an argument is invalid.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_suite_aead_encrypt(
+    vccrypt_suite_options_t* options, const vccrypt_buffer_t* cipher_key,
+    const vccrypt_buffer_t* mac_key, const void* iv, const void* aad,
+    size_t aad_size, const void* input, size_t size, void* output,
+    size_t output_size);
+
+/**
+ * \brief Verify and decrypt a message produced by vccrypt_suite_aead_encrypt().
+ *
+ * The ciphertext is MACed and decrypted in the same cache-sized chunks.  No
+ * plaintext is released unless the tag matches: on any failure, the output
+ * buffer is wiped before returning.
+ *
+ * \param options       The options structure for this crypto suite.
+ * \param cipher_key    The stream cipher key.
+ * \param mac_key       The MAC key.
+ * \param aad           The associated data that was authenticated with this
+ *                      message.  May be NULL if aad_size is 0.
+ * \param aad_size      The size of the associated data, in bytes.
+ * \param input         The message to verify and decrypt.
+ * \param input_size    The size of the message, in bytes.
+ * \param output        The output buffer.  For in-place decryption, output
+ *                      may equal input plus the IV size.
+ * \param output_size   The size of the output buffer; this must be at least
+ *                      input_size - vccrypt_suite_aead_overhead().
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_SUITE_AEAD_INVALID_ARG if an argument is invalid.
+ *      - \ref VCCRYPT_ERROR_SUITE_AEAD_AUTHENTICATION_FAILED if the message or
+ *             associated data has been modified.
+ *      - a non-zero return code on failure.
+ */
+int VCCRYPT_DECL_MUST_CHECK
+vccrypt_suite_aead_decrypt(
+    vccrypt_suite_options_t* options, const vccrypt_buffer_t* cipher_key,
+    const vccrypt_buffer_t* mac_key, const void* aad, size_t aad_size,
+    const void* input, size_t input_size, void* output, size_t output_size);
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
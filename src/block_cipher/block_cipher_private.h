@@ -12,6 +12,7 @@
 #include <vccrypt/block_cipher.h>
 
 #include "../stream_cipher/aes/aes.h"
+#include "../parallel/parallel_private.h"
 
 /* make this header C++ friendly. */
 #ifdef __cplusplus
@@ -20,6 +21,9 @@ extern "C" {
 
 #define VCCRYPT_AES_CBC_ALG_IV_SIZE 16
 
+/* number of blocks decrypted together by the bulk CBC decrypt. */
+#define VCCRYPT_AES_CBC_ALG_PIPELINE_BLOCKS 8
+
 #define VCCRYPT_AES_CBC_ALG_ROUND_MULT_FIPS 1
 #define VCCRYPT_AES_CBC_ALG_ROUND_MULT_2X 2
 #define VCCRYPT_AES_CBC_ALG_ROUND_MULT_3X 3
@@ -27,6 +31,13 @@ extern "C" {
 
 #define VCCRYPT_AES_CBC_ALG_AES_256_KEY_SIZE 32
 
+/* XTS uses one AES-256 key for the data and another for the tweak. */
+#define VCCRYPT_AES_XTS_ALG_KEY_SIZE 64
+#define VCCRYPT_AES_XTS_ALG_TWEAK_SIZE 16
+
+/* sectors are grouped into jobs of at least this many bytes per thread. */
+#define VCCRYPT_BLOCK_SECTORS_PARALLEL_CHUNK_SIZE (64 * 1024)
+
 /**
  * AES CBC Mode specific options data.
  */
@@ -37,12 +48,42 @@ typedef struct aes_cbc_options_data
 
 /**
  * AES CBC Mode specific context data.
+ *
+ * The key schedule is the last member, so that this structure can be stored in
+ * vccrypt_aes_cbc_alg_storage_size() bytes, sized to the actual round count.
  */
 typedef struct aes_cbc_context_data
 {
+    size_t size;
+    bool owned;
+    bool encrypt;
     AES_KEY key;
 } aes_cbc_context_data_t;
 
+/**
+ * AES XTS Mode specific options data.
+ */
+typedef struct aes_xts_options_data
+{
+    int round_multiplier;
+} aes_xts_options_data_t;
+
+/**
+ * AES XTS Mode specific context data.
+ *
+ * The tweak key schedule is always an encryption schedule, while the data key
+ * schedule depends on the direction.  The data key schedule is the last member,
+ * so that this structure can be stored in vccrypt_aes_xts_alg_storage_size()
+ * bytes.
+ */
+typedef struct aes_xts_context_data
+{
+    size_t size;
+    bool owned;
+    AES_KEY tweak_key;
+    AES_KEY key;
+} aes_xts_context_data_t;
+
 /**
  * Algorithm-specific initialization for block cipher.
  *
@@ -57,6 +98,33 @@ typedef struct aes_cbc_context_data
 int vccrypt_aes_cbc_alg_init(
     void* options, void* context, const vccrypt_buffer_t* key, bool encrypt);
 
+/**
+ * Return the number of bytes of context storage needed by this algorithm.
+ *
+ * \param options   Opaque pointer to this options structure.
+ *
+ * \returns the storage size in bytes.
+ */
+size_t vccrypt_aes_cbc_alg_storage_size(void* options);
+
+/**
+ * Algorithm-specific initialization for block cipher using caller-provided
+ * storage.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_block_context_t structure.
+ * \param key           The key to use for this instance.
+ * \param encrypt       Set to true if this is for encryption, and false for
+ *                      decryption.
+ * \param storage       The storage for the cipher state.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_cbc_alg_init_with_storage(
+    void* options, void* context, const vccrypt_buffer_t* key, bool encrypt,
+    void* storage, size_t storage_size);
+
 /**
  * Algorithm-specific disposal for block cipher.
  *
@@ -110,6 +178,209 @@ int vccrypt_aes_cbc_alg_decrypt(
     void* options, void* context, const void* iv, const void* input,
     void* output);
 
+/**
+ * Encrypt a run of blocks using the block cipher, chaining internally.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param iv            The chaining value.  Updated to the last ciphertext
+ *                      block on return.  Must be the block size in length.
+ * \param input         A pointer to the plaintext blocks to encrypt.
+ * \param output        The output buffer where ciphertext is written.
+ * \param blocks        The number of blocks to encrypt.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_cbc_alg_encrypt_cbc(
+    void* options, void* context, void* iv, const void* input,
+    void* output, size_t blocks);
+
+/**
+ * Decrypt a run of blocks using the block cipher, chaining internally.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param iv            The chaining value.  Updated to the last ciphertext
+ *                      block on return.  Must be the block size in length.
+ * \param input         A pointer to the ciphertext blocks to decrypt.
+ * \param output        The output buffer where plaintext is written.  May
+ *                      be the same as input.
+ * \param blocks        The number of blocks to decrypt.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_cbc_alg_decrypt_cbc(
+    void* options, void* context, void* iv, const void* input,
+    void* output, size_t blocks);
+
+/**
+ * Encrypt many independent messages, interleaving their AES rounds.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param jobs          An array of vccrypt_block_job_t jobs, each of which
+ *                      uses an AES CBC context.
+ * \param count         The number of jobs.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_cbc_alg_encrypt_cbc_many(
+    void* options, void* jobs, size_t count);
+
+/**
+ * Encrypt or decrypt consecutive sectors using multiple threads.
+ *
+ * \param context       The block cipher context to use.
+ * \param first_sector  The sector number of the first sector.
+ * \param sector_size   The size of each sector, in bytes.
+ * \param input         The input sectors.
+ * \param output        The output sectors.
+ * \param count         The number of sectors.
+ * \param threads       The number of threads, or 0 for one per processor.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_block_transform_sectors(
+    vccrypt_block_context_t* context, uint64_t first_sector,
+    size_t sector_size, const void* input, void* output, size_t count,
+    size_t threads, bool encrypt);
+
+/**
+ * Algorithm-specific initialization for AES XTS Mode.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_block_context_t structure.
+ * \param key       The key to use for this instance.  The first half is the
+ *                  data key and the second half is the tweak key.
+ * \param encrypt   Set to true if this is for encryption, and false for
+ *                  decryption.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_xts_alg_init(
+    void* options, void* context, const vccrypt_buffer_t* key, bool encrypt);
+
+/**
+ * Return the number of bytes of context storage needed by AES XTS Mode.
+ *
+ * \param options   Opaque pointer to this options structure.
+ *
+ * \returns the storage size in bytes.
+ */
+size_t vccrypt_aes_xts_alg_storage_size(void* options);
+
+/**
+ * Algorithm-specific initialization for AES XTS Mode using caller-provided
+ * storage.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_block_context_t structure.
+ * \param key           The key to use for this instance.
+ * \param encrypt       Set to true if this is for encryption, and false for
+ *                      decryption.
+ * \param storage       The storage for the cipher state.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_xts_alg_init_with_storage(
+    void* options, void* context, const vccrypt_buffer_t* key, bool encrypt,
+    void* storage, size_t storage_size);
+
+/**
+ * Algorithm-specific disposal for AES XTS Mode.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_block_context_t structure.
+ */
+void vccrypt_aes_xts_alg_dispose(void* options, void* context);
+
+/**
+ * Encrypt or decrypt a run of blocks in AES XTS Mode.
+ *
+ * \param ctx_data      The AES XTS context data.
+ * \param tweak         The 16 byte tweak for the first block.
+ * \param input         The input blocks.
+ * \param output        The output blocks.
+ * \param blocks        The number of blocks.
+ * \param encrypt       true to encrypt, false to decrypt.
+ */
+void vccrypt_aes_xts_crypt(
+    const aes_xts_context_data_t* ctx_data, const uint8_t* tweak,
+    const uint8_t* input, uint8_t* output, size_t blocks, bool encrypt);
+
+/**
+ * Encrypt a single block sector in AES XTS Mode.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param iv            The 16 byte tweak, which is the little-endian sector
+ *                      number.
+ * \param input         A pointer to the plaintext block.
+ * \param output        The output buffer for the ciphertext block.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_xts_alg_encrypt(
+    void* options, void* context, const void* iv, const void* input,
+    void* output);
+
+/**
+ * Decrypt a single block sector in AES XTS Mode.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param iv            The 16 byte tweak, which is the little-endian sector
+ *                      number.
+ * \param input         A pointer to the ciphertext block.
+ * \param output        The output buffer for the plaintext block.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_xts_alg_decrypt(
+    void* options, void* context, const void* iv, const void* input,
+    void* output);
+
+/**
+ * Encrypt a whole sector in AES XTS Mode.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param sector        The sector number.
+ * \param input         The plaintext sector.
+ * \param output        The output buffer for the ciphertext sector.
+ * \param size          The size of the sector, in bytes.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_xts_alg_encrypt_sector(
+    void* options, void* context, uint64_t sector, const void* input,
+    void* output, size_t size);
+
+/**
+ * Decrypt a whole sector in AES XTS Mode.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param sector        The sector number.
+ * \param input         The ciphertext sector.
+ * \param output        The output buffer for the plaintext sector.
+ * \param size          The size of the sector, in bytes.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_xts_alg_decrypt_sector(
+    void* options, void* context, uint64_t sector, const void* input,
+    void* output, size_t size);
+
 /**
  * \brief Implementation specific options init method.
  *
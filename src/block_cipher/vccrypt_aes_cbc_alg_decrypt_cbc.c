@@ -0,0 +1,86 @@
+/**
+ * \file vccrypt_aes_cbc_alg_decrypt_cbc.c
+ *
+ * Decrypt a run of blocks using AES CBC Mode.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * Decrypt a run of blocks using the block cipher, chaining internally.
+ *
+ * Unlike encryption, each block can be decrypted independently, so blocks are
+ * decrypted in groups of VCCRYPT_AES_CBC_ALG_PIPELINE_BLOCKS to keep the AES
+ * pipeline full, and then XORed with the preceding ciphertext.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param iv            The chaining value.  Updated to the last ciphertext
+ *                      block on return.  Must be the block size in length.
+ * \param input         A pointer to the ciphertext blocks to decrypt.
+ * \param output        The output buffer where plaintext is written.  May
+ *                      be the same as input.
+ * \param blocks        The number of blocks to decrypt.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_cbc_alg_decrypt_cbc(
+    void* UNUSED(options), void* context, void* iv, const void* input,
+    void* output, size_t blocks)
+{
+    uint8_t tmp[
+        VCCRYPT_AES_CBC_ALG_PIPELINE_BLOCKS * VCCRYPT_AES_CBC_ALG_IV_SIZE];
+    uint8_t next[VCCRYPT_AES_CBC_ALG_IV_SIZE];
+    vccrypt_block_context_t* ctx = (vccrypt_block_context_t*)context;
+    aes_cbc_context_data_t* ctx_data =
+        (aes_cbc_context_data_t*)ctx->block_state;
+
+    const uint8_t* in = (const uint8_t*)input;
+    uint8_t* out = (uint8_t*)output;
+    uint8_t* chain = (uint8_t*)iv;
+
+    while (blocks > 0)
+    {
+        size_t n = blocks < VCCRYPT_AES_CBC_ALG_PIPELINE_BLOCKS
+                 ? blocks : VCCRYPT_AES_CBC_ALG_PIPELINE_BLOCKS;
+
+        /* the last ciphertext block of this group chains to the next. */
+        memcpy(
+            next, in + (n - 1) * VCCRYPT_AES_CBC_ALG_IV_SIZE,
+            VCCRYPT_AES_CBC_ALG_IV_SIZE);
+
+        AES_decrypt_blocks(in, tmp, n, &ctx_data->key);
+
+        /* walk backwards, so that in-place decryption does not clobber the
+         * ciphertext that the following block still needs. */
+        for (size_t b = n; b-- > 1; )
+        {
+            const uint8_t* prev = in + (b - 1) * VCCRYPT_AES_CBC_ALG_IV_SIZE;
+            const uint8_t* dec = tmp + b * VCCRYPT_AES_CBC_ALG_IV_SIZE;
+            uint8_t* o = out + b * VCCRYPT_AES_CBC_ALG_IV_SIZE;
+
+            for (int i = 0; i < VCCRYPT_AES_CBC_ALG_IV_SIZE; ++i)
+                o[i] = dec[i] ^ prev[i];
+        }
+
+        for (int i = 0; i < VCCRYPT_AES_CBC_ALG_IV_SIZE; ++i)
+            out[i] = tmp[i] ^ chain[i];
+
+        memcpy(chain, next, VCCRYPT_AES_CBC_ALG_IV_SIZE);
+
+        in += n * VCCRYPT_AES_CBC_ALG_IV_SIZE;
+        out += n * VCCRYPT_AES_CBC_ALG_IV_SIZE;
+        blocks -= n;
+    }
+
+    memset(tmp, 0, sizeof(tmp));
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
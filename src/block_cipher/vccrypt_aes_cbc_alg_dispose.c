@@ -24,6 +24,11 @@ void vccrypt_aes_cbc_alg_dispose(void* UNUSED(options), void* context)
     aes_cbc_context_data_t* ctx_data =
         (aes_cbc_context_data_t*)ctx->block_state;
 
-    memset(ctx_data, 0, sizeof(aes_cbc_context_data_t));
-    release(ctx->options->alloc_opts, ctx_data);
+    bool owned = ctx_data->owned;
+
+    memset(ctx_data, 0, ctx_data->size);
+
+    /* caller-provided storage is wiped but not released. */
+    if (owned)
+        release(ctx->options->alloc_opts, ctx_data);
 }
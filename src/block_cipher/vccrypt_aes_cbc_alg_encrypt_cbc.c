@@ -0,0 +1,59 @@
+/**
+ * \file vccrypt_aes_cbc_alg_encrypt_cbc.c
+ *
+ * Encrypt a run of blocks using AES CBC Mode.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * Encrypt a run of blocks using the block cipher, chaining internally.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param iv            The chaining value.  Updated to the last ciphertext
+ *                      block on return.  Must be the block size in length.
+ * \param input         A pointer to the plaintext blocks to encrypt.
+ * \param output        The output buffer where ciphertext is written.
+ * \param blocks        The number of blocks to encrypt.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_cbc_alg_encrypt_cbc(
+    void* UNUSED(options), void* context, void* iv, const void* input,
+    void* output, size_t blocks)
+{
+    uint8_t block[VCCRYPT_AES_CBC_ALG_IV_SIZE];
+    vccrypt_block_context_t* ctx = (vccrypt_block_context_t*)context;
+    aes_cbc_context_data_t* ctx_data =
+        (aes_cbc_context_data_t*)ctx->block_state;
+
+    const uint8_t* in = (const uint8_t*)input;
+    uint8_t* out = (uint8_t*)output;
+    uint8_t* chain = (uint8_t*)iv;
+
+    /* CBC encryption is inherently serial; just skip the per-block
+     * dispatch. */
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        for (int i = 0; i < VCCRYPT_AES_CBC_ALG_IV_SIZE; ++i)
+            block[i] = chain[i] ^ in[i];
+
+        AES_encrypt(block, out, &ctx_data->key);
+        memcpy(chain, out, VCCRYPT_AES_CBC_ALG_IV_SIZE);
+
+        in += VCCRYPT_AES_CBC_ALG_IV_SIZE;
+        out += VCCRYPT_AES_CBC_ALG_IV_SIZE;
+    }
+
+    memset(block, 0, sizeof(block));
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
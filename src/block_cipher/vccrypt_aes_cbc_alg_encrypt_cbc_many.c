@@ -0,0 +1,154 @@
+/**
+ * \file vccrypt_aes_cbc_alg_encrypt_cbc_many.c
+ *
+ * Encrypt many independent messages using AES CBC Mode, interleaving their
+ * AES rounds across lanes.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * A job that currently owns a lane.
+ */
+typedef struct aes_cbc_lane
+{
+    vccrypt_block_job_t* job;
+    const AES_KEY* key;
+    const uint8_t* in;
+    uint8_t* out;
+    size_t blocks;
+} aes_cbc_lane_t;
+
+/**
+ * Encrypt many independent messages, interleaving their AES rounds.
+ *
+ * Each lane holds one message.  Every step encrypts the next block of every
+ * lane in a single AES_encrypt_lanes() call, so the serial chain of one
+ * message runs in the shadow of the others.  As a message is finished, the
+ * next waiting message takes over its lane.  Messages whose key schedule
+ * can't be interleaved are encrypted on their own instead.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param jobs          An array of vccrypt_block_job_t jobs, each of which
+ *                      uses an AES CBC context initialized for encryption.
+ * \param count         The number of jobs.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_cbc_alg_encrypt_cbc_many(
+    void* options, void* jobs, size_t count)
+{
+    vccrypt_block_job_t* job = (vccrypt_block_job_t*)jobs;
+    aes_cbc_lane_t lanes[AES_MAX_LANES];
+    const AES_KEY* keys[AES_MAX_LANES];
+    uint8_t block[AES_MAX_LANES * VCCRYPT_AES_CBC_ALG_IV_SIZE];
+    size_t active = 0, next = 0;
+    int retval = VCCRYPT_STATUS_SUCCESS;
+
+    MODEL_ASSERT(NULL != job || 0 == count);
+
+    /* every context must hold an encryption key schedule. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        aes_cbc_context_data_t* ctx_data =
+            (aes_cbc_context_data_t*)job[i].context->block_state;
+
+        if (!ctx_data->encrypt)
+            return VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG;
+    }
+
+    for (;;)
+    {
+        /* fill the free lanes from the waiting jobs. */
+        while (active < AES_MAX_LANES && next < count)
+        {
+            vccrypt_block_job_t* j = &job[next++];
+            aes_cbc_context_data_t* ctx_data =
+                (aes_cbc_context_data_t*)j->context->block_state;
+
+            if (0 == j->blocks)
+                continue;
+
+            /* a schedule that can't be interleaved is chained on its own. */
+            if (!AES_lanes_supported(&ctx_data->key))
+            {
+                retval =
+                    vccrypt_aes_cbc_alg_encrypt_cbc(
+                        options, j->context, j->iv, j->input, j->output,
+                        j->blocks);
+                if (VCCRYPT_STATUS_SUCCESS != retval)
+                    goto cleanup;
+
+                continue;
+            }
+
+            lanes[active].job = j;
+            lanes[active].key = &ctx_data->key;
+            lanes[active].in = (const uint8_t*)j->input;
+            lanes[active].out = (uint8_t*)j->output;
+            lanes[active].blocks = j->blocks;
+            ++active;
+        }
+
+        /* a lone job gains nothing from the lanes. */
+        if (active < 2)
+            break;
+
+        for (size_t l = 0; l < active; ++l)
+        {
+            const uint8_t* chain = (const uint8_t*)lanes[l].job->iv;
+            uint8_t* b = block + VCCRYPT_AES_CBC_ALG_IV_SIZE * l;
+
+            for (int i = 0; i < VCCRYPT_AES_CBC_ALG_IV_SIZE; ++i)
+                b[i] = chain[i] ^ lanes[l].in[i];
+
+            keys[l] = lanes[l].key;
+        }
+
+        AES_encrypt_lanes(block, keys, active);
+
+        for (size_t l = 0; l < active; )
+        {
+            aes_cbc_lane_t* lane = &lanes[l];
+            const uint8_t* b = block + VCCRYPT_AES_CBC_ALG_IV_SIZE * l;
+
+            memcpy(lane->out, b, VCCRYPT_AES_CBC_ALG_IV_SIZE);
+            memcpy(lane->job->iv, b, VCCRYPT_AES_CBC_ALG_IV_SIZE);
+            lane->in += VCCRYPT_AES_CBC_ALG_IV_SIZE;
+            lane->out += VCCRYPT_AES_CBC_ALG_IV_SIZE;
+
+            if (0 == --lane->blocks)
+            {
+                /* retire this lane, moving the last lane into its slot. */
+                memmove(
+                    block + VCCRYPT_AES_CBC_ALG_IV_SIZE * l,
+                    block + VCCRYPT_AES_CBC_ALG_IV_SIZE * (active - 1),
+                    VCCRYPT_AES_CBC_ALG_IV_SIZE);
+                lanes[l] = lanes[--active];
+            }
+            else
+            {
+                ++l;
+            }
+        }
+    }
+
+    if (1 == active)
+    {
+        retval =
+            vccrypt_aes_cbc_alg_encrypt_cbc(
+                options, lanes[0].job->context, lanes[0].job->iv,
+                lanes[0].in, lanes[0].out, lanes[0].blocks);
+    }
+
+cleanup:
+    memset(block, 0, sizeof(block));
+
+    return retval;
+}
@@ -27,6 +27,9 @@ int vccrypt_aes_cbc_alg_init(
     void* options, void* context, const vccrypt_buffer_t* key, bool encrypt)
 {
     vccrypt_block_options_t* opt = (vccrypt_block_options_t*)options;
+    vccrypt_block_context_t* ctx = (vccrypt_block_context_t*)context;
+    size_t size = vccrypt_aes_cbc_alg_storage_size(options);
+    int retval;
 
     MODEL_ASSERT(NULL != opt->alloc_opts);
 
@@ -35,36 +38,23 @@ int vccrypt_aes_cbc_alg_init(
         return VCCRYPT_ERROR_BLOCK_INIT_BAD_ALLOCATOR;
     }
 
-    vccrypt_block_context_t* ctx = (vccrypt_block_context_t*)context;
-    aes_cbc_options_data_t* opt_data = (aes_cbc_options_data_t*)opt->data;
-    aes_cbc_context_data_t* ctx_data = (aes_cbc_context_data_t*)
-        allocate(opt->alloc_opts, sizeof(aes_cbc_context_data_t));
-    ctx->block_state = ctx_data;
-
-    memset(ctx_data, 0, sizeof(aes_cbc_context_data_t));
-
-    if (encrypt)
+    /* allocate only as much of the key schedule as this round count uses. */
+    void* storage = allocate(opt->alloc_opts, size);
+    if (NULL == storage)
     {
-        if (0 !=
-            AES_set_encrypt_key(
-                key->data, 256, opt_data->round_multiplier, &ctx_data->key))
-        {
-            memset(ctx_data, 0, sizeof(aes_cbc_context_data_t));
-            release(opt->alloc_opts, ctx_data);
-            return VCCRYPT_ERROR_BLOCK_INIT_BAD_ENCRYPTION_KEY;
-        }
+        return VCCRYPT_ERROR_BLOCK_INIT_BAD_ALLOCATOR;
     }
-    else
+
+    retval =
+        vccrypt_aes_cbc_alg_init_with_storage(
+            options, context, key, encrypt, storage, size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
     {
-        if (0 !=
-            AES_set_decrypt_key(
-                key->data, 256, opt_data->round_multiplier, &ctx_data->key))
-        {
-            memset(ctx_data, 0, sizeof(aes_cbc_context_data_t));
-            release(opt->alloc_opts, ctx_data);
-            return VCCRYPT_ERROR_BLOCK_INIT_BAD_DECRYPTION_KEY;
-        }
+        release(opt->alloc_opts, storage);
+        return retval;
     }
 
+    ((aes_cbc_context_data_t*)ctx->block_state)->owned = true;
+
     return VCCRYPT_STATUS_SUCCESS;
 }
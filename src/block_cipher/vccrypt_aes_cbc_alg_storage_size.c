@@ -0,0 +1,32 @@
+/**
+ * \file vccrypt_aes_cbc_alg_storage_size.c
+ *
+ * Compute the context storage size for an AES CBC Mode block cipher.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stddef.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * Return the number of bytes of context storage needed by this algorithm.
+ *
+ * \param options   Opaque pointer to this options structure.
+ *
+ * \returns the storage size in bytes.
+ */
+size_t vccrypt_aes_cbc_alg_storage_size(void* options)
+{
+    vccrypt_block_options_t* opt = (vccrypt_block_options_t*)options;
+    aes_cbc_options_data_t* opt_data = (aes_cbc_options_data_t*)opt->data;
+
+    MODEL_ASSERT(NULL != opt_data);
+
+    return
+        offsetof(aes_cbc_context_data_t, key)
+      + AES_key_size(AES_rounds(256, opt_data->round_multiplier));
+}
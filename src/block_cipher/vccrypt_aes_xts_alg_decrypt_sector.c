@@ -0,0 +1,53 @@
+/**
+ * \file vccrypt_aes_xts_alg_decrypt_sector.c
+ *
+ * Decrypt a whole sector using AES XTS Mode.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * Decrypt a whole sector in AES XTS Mode.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param sector        The sector number.
+ * \param input         The ciphertext sector.
+ * \param output        The output buffer for the plaintext sector.
+ * \param size          The size of the sector, in bytes.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_xts_alg_decrypt_sector(
+    void* UNUSED(options), void* context, uint64_t sector, const void* input,
+    void* output, size_t size)
+{
+    vccrypt_block_context_t* ctx = (vccrypt_block_context_t*)context;
+    aes_xts_context_data_t* ctx_data =
+        (aes_xts_context_data_t*)ctx->block_state;
+    uint8_t tweak[VCCRYPT_AES_XTS_ALG_TWEAK_SIZE];
+
+    /* ciphertext stealing is not supported; sectors are whole blocks. */
+    if (0 == size || 0 != size % VCCRYPT_AES_XTS_ALG_TWEAK_SIZE)
+    {
+        return VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG;
+    }
+
+    /* the tweak is the sector number as a 128-bit little-endian value. */
+    memset(tweak, 0, sizeof(tweak));
+    for (int i = 0; i < 8; ++i)
+        tweak[i] = (uint8_t)(sector >> (8 * i));
+
+    vccrypt_aes_xts_crypt(
+        ctx_data, tweak, (const uint8_t*)input, (uint8_t*)output,
+        size / VCCRYPT_AES_XTS_ALG_TWEAK_SIZE, false);
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,40 @@
+/**
+ * \file vccrypt_aes_xts_alg_encrypt.c
+ *
+ * Encrypt a single block sector using AES XTS Mode.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * Encrypt a single block sector in AES XTS Mode.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_block_context_t
+ *                      structure.
+ * \param iv            The 16 byte tweak, which is the little-endian sector
+ *                      number.
+ * \param input         A pointer to the plaintext block.
+ * \param output        The output buffer for the ciphertext block.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_xts_alg_encrypt(
+    void* UNUSED(options), void* context, const void* iv, const void* input,
+    void* output)
+{
+    vccrypt_block_context_t* ctx = (vccrypt_block_context_t*)context;
+    aes_xts_context_data_t* ctx_data =
+        (aes_xts_context_data_t*)ctx->block_state;
+
+    vccrypt_aes_xts_crypt(
+        ctx_data, (const uint8_t*)iv, (const uint8_t*)input,
+        (uint8_t*)output, 1, true);
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,60 @@
+/**
+ * \file vccrypt_aes_xts_alg_init.c
+ *
+ * Initialize the given AES XTS Mode block cipher context.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * Algorithm-specific initialization for block cipher.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_block_context_t structure.
+ * \param key       The key to use for this instance.
+ * \param encrypt   Set to true if this is for encryption, and false for
+ *                  decryption.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_xts_alg_init(
+    void* options, void* context, const vccrypt_buffer_t* key, bool encrypt)
+{
+    vccrypt_block_options_t* opt = (vccrypt_block_options_t*)options;
+    vccrypt_block_context_t* ctx = (vccrypt_block_context_t*)context;
+    size_t size = vccrypt_aes_xts_alg_storage_size(options);
+    int retval;
+
+    MODEL_ASSERT(NULL != opt->alloc_opts);
+
+    if (NULL == opt->alloc_opts)
+    {
+        return VCCRYPT_ERROR_BLOCK_INIT_BAD_ALLOCATOR;
+    }
+
+    /* allocate only as much of the key schedule as this round count uses. */
+    void* storage = allocate(opt->alloc_opts, size);
+    if (NULL == storage)
+    {
+        return VCCRYPT_ERROR_BLOCK_INIT_BAD_ALLOCATOR;
+    }
+
+    retval =
+        vccrypt_aes_xts_alg_init_with_storage(
+            options, context, key, encrypt, storage, size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        release(opt->alloc_opts, storage);
+        return retval;
+    }
+
+    ((aes_xts_context_data_t*)ctx->block_state)->owned = true;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
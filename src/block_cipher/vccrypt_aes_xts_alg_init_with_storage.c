@@ -0,0 +1,87 @@
+/**
+ * \file vccrypt_aes_xts_alg_init_with_storage.c
+ *
+ * Initialize an AES XTS Mode block cipher context in caller-provided storage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * Algorithm-specific initialization for block cipher using caller-provided
+ * storage.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_block_context_t structure.
+ * \param key           The key to use for this instance.
+ * \param encrypt       Set to true if this is for encryption, and false for
+ *                      decryption.
+ * \param storage       The storage for the cipher state.  Must be at least
+ *                      vccrypt_aes_xts_alg_storage_size() bytes.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_xts_alg_init_with_storage(
+    void* options, void* context, const vccrypt_buffer_t* key, bool encrypt,
+    void* storage, size_t storage_size)
+{
+    vccrypt_block_options_t* opt = (vccrypt_block_options_t*)options;
+    vccrypt_block_context_t* ctx = (vccrypt_block_context_t*)context;
+    aes_xts_options_data_t* opt_data = (aes_xts_options_data_t*)opt->data;
+    aes_xts_context_data_t* ctx_data = (aes_xts_context_data_t*)storage;
+    size_t size = vccrypt_aes_xts_alg_storage_size(options);
+
+    MODEL_ASSERT(NULL != storage);
+    MODEL_ASSERT(storage_size >= size);
+
+    if (NULL == storage || storage_size < size
+     || VCCRYPT_AES_XTS_ALG_KEY_SIZE != key->size)
+    {
+        return VCCRYPT_ERROR_BLOCK_INIT_INVALID_ARG;
+    }
+
+    const uint8_t* data_key = (const uint8_t*)key->data;
+    const uint8_t* tweak_key =
+        data_key + VCCRYPT_AES_CBC_ALG_AES_256_KEY_SIZE;
+
+    /* identical halves would reduce XTS to a weaker mode; reject them. */
+    if (0 ==
+        memcmp(data_key, tweak_key, VCCRYPT_AES_CBC_ALG_AES_256_KEY_SIZE))
+    {
+        return
+            encrypt
+                ? VCCRYPT_ERROR_BLOCK_INIT_BAD_ENCRYPTION_KEY
+                : VCCRYPT_ERROR_BLOCK_INIT_BAD_DECRYPTION_KEY;
+    }
+
+    memset(ctx_data, 0, size);
+    ctx_data->size = size;
+    ctx_data->owned = false;
+
+    /* the tweak is always encrypted, even when decrypting. */
+    if (0 !=
+        AES_set_key_cached(
+            tweak_key, 256, opt_data->round_multiplier,
+            AES_impl_default(), 1, &ctx_data->tweak_key)
+     || 0 !=
+        AES_set_key_cached(
+            data_key, 256, opt_data->round_multiplier,
+            AES_impl_default(), encrypt ? 1 : 0, &ctx_data->key))
+    {
+        memset(ctx_data, 0, size);
+        return
+            encrypt
+                ? VCCRYPT_ERROR_BLOCK_INIT_BAD_ENCRYPTION_KEY
+                : VCCRYPT_ERROR_BLOCK_INIT_BAD_DECRYPTION_KEY;
+    }
+
+    ctx->block_state = ctx_data;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,89 @@
+/**
+ * \file vccrypt_block_decrypt_cbc.c
+ *
+ * Generic method for decrypting a run of blocks in CBC mode.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/block_cipher.h>
+#include <vpr/parameters.h>
+
+/* largest block size supported by the single block fallback. */
+#define FALLBACK_MAX_BLOCK_SIZE 64
+
+/**
+ * \brief Decrypt a run of blocks in cipher block chaining mode.
+ *
+ * \param context       The block cipher context to use.
+ * \param iv            The chaining value, updated to the last ciphertext
+ *                      block.  Must be the block size in length.
+ * \param input         The ciphertext blocks to decrypt.
+ * \param output        The output buffer for the plaintext blocks.
+ * \param blocks        The number of blocks to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero return code on failure.
+ */
+int vccrypt_block_decrypt_cbc(
+    vccrypt_block_context_t* context, void* iv, const void* input,
+    void* output, size_t blocks)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != iv);
+
+    if (NULL == context || NULL == context->options || NULL == iv
+     || (blocks > 0 && (NULL == input || NULL == output)))
+    {
+        return VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG;
+    }
+
+    if (NULL != context->options->vccrypt_block_alg_decrypt_cbc)
+    {
+        return
+            context->options->vccrypt_block_alg_decrypt_cbc(
+                context->options, context, iv, input, output, blocks);
+    }
+
+    /* fall back to chaining single block decryptions. */
+    size_t block_size = context->options->IV_size;
+    const uint8_t* in = (const uint8_t*)input;
+    uint8_t* out = (uint8_t*)output;
+    uint8_t chain[FALLBACK_MAX_BLOCK_SIZE];
+    uint8_t next[FALLBACK_MAX_BLOCK_SIZE];
+    int retval = VCCRYPT_STATUS_SUCCESS;
+
+    if (block_size > FALLBACK_MAX_BLOCK_SIZE)
+    {
+        return VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG;
+    }
+
+    memcpy(chain, iv, block_size);
+
+    for (size_t i = 0; i < blocks; ++i)
+    {
+        /* save the ciphertext first, in case we are decrypting in place. */
+        memcpy(next, in, block_size);
+
+        retval =
+            context->options->vccrypt_block_alg_decrypt(
+                context->options, context, chain, in, out);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            goto done;
+
+        memcpy(chain, next, block_size);
+        in += block_size;
+        out += block_size;
+    }
+
+    memcpy(iv, chain, block_size);
+
+done:
+    memset(next, 0, sizeof(next));
+
+    return retval;
+}
@@ -0,0 +1,49 @@
+/**
+ * \file vccrypt_block_decrypt_sector.c
+ *
+ * Generic method for decrypting a whole storage sector.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/block_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Decrypt a whole storage sector in a tweakable sector mode.
+ *
+ * \param context       The block cipher context to use.
+ * \param sector        The sector number.
+ * \param input         The ciphertext sector.
+ * \param output        The output buffer for the plaintext sector.
+ * \param size          The size of the sector, in bytes.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero return code on failure.
+ */
+int vccrypt_block_decrypt_sector(
+    vccrypt_block_context_t* context, uint64_t sector, const void* input,
+    void* output, size_t size)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != input);
+    MODEL_ASSERT(NULL != output);
+
+    if (NULL == context || NULL == context->options || NULL == input
+     || NULL == output)
+    {
+        return VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG;
+    }
+
+    if (NULL == context->options->vccrypt_block_alg_decrypt_sector)
+    {
+        return VCCRYPT_ERROR_BLOCK_SECTOR_UNSUPPORTED;
+    }
+
+    return
+        context->options->vccrypt_block_alg_decrypt_sector(
+            context->options, context, sector, input, output, size);
+}
@@ -0,0 +1,75 @@
+/**
+ * \file vccrypt_block_encrypt_cbc.c
+ *
+ * Generic method for encrypting a run of blocks in CBC mode.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/block_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Encrypt a run of blocks in cipher block chaining mode.
+ *
+ * \param context       The block cipher context to use.
+ * \param iv            The chaining value, updated to the last ciphertext
+ *                      block.  Must be the block size in length.
+ * \param input         The plaintext blocks to encrypt.
+ * \param output        The output buffer for the ciphertext blocks.
+ * \param blocks        The number of blocks to encrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero return code on failure.
+ */
+int vccrypt_block_encrypt_cbc(
+    vccrypt_block_context_t* context, void* iv, const void* input,
+    void* output, size_t blocks)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != iv);
+
+    if (NULL == context || NULL == context->options || NULL == iv
+     || (blocks > 0 && (NULL == input || NULL == output)))
+    {
+        return VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG;
+    }
+
+    if (NULL != context->options->vccrypt_block_alg_encrypt_cbc)
+    {
+        return
+            context->options->vccrypt_block_alg_encrypt_cbc(
+                context->options, context, iv, input, output, blocks);
+    }
+
+    /* fall back to chaining single block encryptions. */
+    size_t block_size = context->options->IV_size;
+    const uint8_t* in = (const uint8_t*)input;
+    uint8_t* out = (uint8_t*)output;
+    const uint8_t* chain = (const uint8_t*)iv;
+    int retval;
+
+    for (size_t i = 0; i < blocks; ++i)
+    {
+        retval =
+            context->options->vccrypt_block_alg_encrypt(
+                context->options, context, chain, in, out);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            return retval;
+
+        chain = out;
+        in += block_size;
+        out += block_size;
+    }
+
+    if (blocks > 0)
+    {
+        memcpy(iv, chain, block_size);
+    }
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
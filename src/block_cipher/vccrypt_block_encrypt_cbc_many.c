@@ -0,0 +1,82 @@
+/**
+ * \file vccrypt_block_encrypt_cbc_many.c
+ *
+ * Generic method for encrypting many independent messages in CBC mode.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/block_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Encrypt many independent messages in cipher block chaining mode in a
+ * single call.
+ *
+ * \param jobs          The jobs to encrypt.
+ * \param count         The number of jobs.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero return code on failure.
+ */
+int vccrypt_block_encrypt_cbc_many(vccrypt_block_job_t* jobs, size_t count)
+{
+    int (*many)(void*, void*, size_t) = NULL;
+    int retval;
+
+    MODEL_ASSERT(NULL != jobs || 0 == count);
+
+    if (0 == count)
+        return VCCRYPT_STATUS_SUCCESS;
+
+    if (NULL == jobs)
+        return VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (NULL == jobs[i].context || NULL == jobs[i].context->options
+         || NULL == jobs[i].iv
+         || (jobs[i].blocks > 0
+                && (NULL == jobs[i].input || NULL == jobs[i].output)))
+        {
+            return VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG;
+        }
+    }
+
+    /* the jobs can only be interleaved if they share an implementation. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        int (*job_many)(void*, void*, size_t) =
+            jobs[i].context->options->vccrypt_block_alg_encrypt_cbc_many;
+
+        if (0 == i)
+        {
+            many = job_many;
+        }
+        else if (many != job_many)
+        {
+            many = NULL;
+            break;
+        }
+    }
+
+    if (NULL != many)
+    {
+        return many(jobs[0].context->options, jobs, count);
+    }
+
+    /* otherwise, encrypt each job in turn. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        retval =
+            vccrypt_block_encrypt_cbc(
+                jobs[i].context, jobs[i].iv, jobs[i].input, jobs[i].output,
+                jobs[i].blocks);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            return retval;
+    }
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/**
+ * \file vccrypt_block_encrypt_sectors.c
+ *
+ * Generic method for encrypting consecutive storage sectors on multiple
+ * threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <vccrypt/block_cipher.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * \brief Encrypt a run of consecutive storage sectors using multiple threads.
+ *
+ * \param context       The block cipher context to use.
+ * \param first_sector  The sector number of the first sector.
+ * \param sector_size   The size of each sector, in bytes.
+ * \param input         The plaintext sectors.
+ * \param output        The output buffer for the ciphertext sectors.
+ * \param count         The number of sectors.
+ * \param threads       The number of threads to use, or 0 to use one thread
+ *                      per online processor.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero return code on failure.
+ */
+int vccrypt_block_encrypt_sectors(
+    vccrypt_block_context_t* context, uint64_t first_sector,
+    size_t sector_size, const void* input, void* output, size_t count,
+    size_t threads)
+{
+    return
+        vccrypt_block_transform_sectors(
+            context, first_sector, sector_size, input, output, count,
+            threads, true);
+}
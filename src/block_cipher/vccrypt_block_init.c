@@ -7,6 +7,7 @@
  */
 
 #include <cbmc/model_assert.h>
+#include <stdint.h>
 #include <string.h>
 #include <vccrypt/block_cipher.h>
 #include <vpr/parameters.h>
@@ -59,6 +60,63 @@ int vccrypt_block_init(
     return options->vccrypt_block_alg_init(options, context, key, encrypt);
 }
 
+/**
+ * \brief Initialize a Block Cipher algorithm instance, storing the cipher
+ * state in caller-provided storage instead of allocating it.
+ *
+ * \param options       The options to use for this algorithm instance.
+ * \param context       The block cipher instance to initialize.
+ * \param key           The key to use for this algorithm instance.
+ * \param encrypt       Set to true if this is for encryption, and false for
+ *                      decryption.
+ * \param storage       The storage for the cipher state.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_BLOCK_INIT_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - \ref VCCRYPT_ERROR_BLOCK_INIT_STORAGE_UNSUPPORTED if the selected
+ *             algorithm does not support caller-provided storage.
+ *      - a non-zero return code on failure.
+ */
+int vccrypt_block_init_with_storage(
+    vccrypt_block_options_t* options, vccrypt_block_context_t* context,
+    const vccrypt_buffer_t* key, bool encrypt, void* storage,
+    size_t storage_size)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != key);
+    MODEL_ASSERT(NULL != storage);
+
+    if (NULL == options || NULL == context || NULL == key || NULL == storage)
+    {
+        return VCCRYPT_ERROR_BLOCK_INIT_INVALID_ARG;
+    }
+
+    if (NULL == options->vccrypt_block_alg_storage_size
+     || NULL == options->vccrypt_block_alg_init_with_storage)
+    {
+        return VCCRYPT_ERROR_BLOCK_INIT_STORAGE_UNSUPPORTED;
+    }
+
+    /* the storage must be large enough and suitably aligned. */
+    if (0 != ((uintptr_t)storage % VCCRYPT_BLOCK_STORAGE_ALIGNMENT)
+     || storage_size < options->vccrypt_block_alg_storage_size(options))
+    {
+        return VCCRYPT_ERROR_BLOCK_INIT_INVALID_ARG;
+    }
+
+    /* set up the basics. */
+    context->hdr.dispose = &vccrypt_block_dispose;
+    context->options = options;
+
+    return
+        options->vccrypt_block_alg_init_with_storage(
+            options, context, key, encrypt, storage, storage_size);
+}
+
 /**
  * \brief Dispose of a block cipher instance.
  *
@@ -0,0 +1,79 @@
+/**
+ * \file vccrypt_block_register_AES_256_3X_XTS.c
+ *
+ * This file contains the registration methods for the reference implementations
+ * of the block cipher interface for the triple-round version of
+ * AES 256 XTS MODE.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <vccrypt/block_cipher.h>
+#include <vpr/abstract_factory.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/* instance data for AES-256-3X-XTS. */
+static abstract_factory_registration_t aes_3x_impl;
+static vccrypt_block_options_t aes_3x_options;
+static aes_xts_options_data_t aes_3x_options_data;
+static bool aes_3x_impl_registered = false;
+
+/**
+ * Register the triple-round implementation of AES-256-XTS.
+ */
+void vccrypt_block_register_AES_256_3X_XTS()
+{
+    MODEL_ASSERT(!aes_3x_impl_registered);
+
+    /* only register once */
+    if (aes_3x_impl_registered)
+    {
+        return;
+    }
+
+    /* set up options for aes-256-3x-xts */
+    aes_3x_options_data.round_multiplier =
+        VCCRYPT_AES_CBC_ALG_ROUND_MULT_3X;
+    aes_3x_options.hdr.dispose = &vccrypt_aes_cbc_alg_options_dispose;
+    aes_3x_options.alloc_opts = 0; /* alloc by init */
+    aes_3x_options.key_size =
+        VCCRYPT_AES_XTS_ALG_KEY_SIZE;
+    aes_3x_options.IV_size = VCCRYPT_AES_XTS_ALG_TWEAK_SIZE;
+    aes_3x_options.maximum_message_size = UINT64_MAX;
+    aes_3x_options.vccrypt_block_alg_init = &vccrypt_aes_xts_alg_init;
+    aes_3x_options.vccrypt_block_alg_dispose = &vccrypt_aes_xts_alg_dispose;
+    aes_3x_options.vccrypt_block_alg_encrypt = &vccrypt_aes_xts_alg_encrypt;
+    aes_3x_options.vccrypt_block_alg_decrypt = &vccrypt_aes_xts_alg_decrypt;
+    aes_3x_options.vccrypt_block_alg_storage_size =
+        &vccrypt_aes_xts_alg_storage_size;
+    aes_3x_options.vccrypt_block_alg_init_with_storage =
+        &vccrypt_aes_xts_alg_init_with_storage;
+    aes_3x_options.vccrypt_block_alg_encrypt_sector =
+        &vccrypt_aes_xts_alg_encrypt_sector;
+    aes_3x_options.vccrypt_block_alg_decrypt_sector =
+        &vccrypt_aes_xts_alg_decrypt_sector;
+    aes_3x_options.data = &aes_3x_options_data;
+    aes_3x_options.vccrypt_block_alg_options_init =
+        &vccrypt_aes_cbc_alg_options_init;
+
+    /* set up this registration for the abstract factory. */
+    aes_3x_impl.interface =
+        VCCRYPT_INTERFACE_BLOCK;
+    aes_3x_impl.implementation =
+        VCCRYPT_BLOCK_ALGORITHM_AES_256_3X_XTS;
+    aes_3x_impl.implementation_features =
+        VCCRYPT_BLOCK_ALGORITHM_AES_256_3X_XTS;
+    aes_3x_impl.factory = 0;
+    aes_3x_impl.context = &aes_3x_options;
+
+    /* register this instance. */
+    abstract_factory_register(&aes_3x_impl);
+
+    /* only register once */
+    aes_3x_impl_registered = true;
+}
@@ -49,6 +49,16 @@ void vccrypt_block_register_AES_256_4X_CBC()
     aes_4x_options.vccrypt_block_alg_dispose = &vccrypt_aes_cbc_alg_dispose;
     aes_4x_options.vccrypt_block_alg_encrypt = &vccrypt_aes_cbc_alg_encrypt;
     aes_4x_options.vccrypt_block_alg_decrypt = &vccrypt_aes_cbc_alg_decrypt;
+    aes_4x_options.vccrypt_block_alg_storage_size =
+        &vccrypt_aes_cbc_alg_storage_size;
+    aes_4x_options.vccrypt_block_alg_init_with_storage =
+        &vccrypt_aes_cbc_alg_init_with_storage;
+    aes_4x_options.vccrypt_block_alg_encrypt_cbc =
+        &vccrypt_aes_cbc_alg_encrypt_cbc;
+    aes_4x_options.vccrypt_block_alg_decrypt_cbc =
+        &vccrypt_aes_cbc_alg_decrypt_cbc;
+    aes_4x_options.vccrypt_block_alg_encrypt_cbc_many =
+        &vccrypt_aes_cbc_alg_encrypt_cbc_many;
     aes_4x_options.data = &aes_4x_options_data;
     aes_4x_options.vccrypt_block_alg_options_init =
         &vccrypt_aes_cbc_alg_options_init;
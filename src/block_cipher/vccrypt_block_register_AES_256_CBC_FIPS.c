@@ -48,6 +48,16 @@ void vccrypt_block_register_AES_256_CBC_FIPS()
     aes_fips_options.vccrypt_block_alg_dispose = &vccrypt_aes_cbc_alg_dispose;
     aes_fips_options.vccrypt_block_alg_encrypt = &vccrypt_aes_cbc_alg_encrypt;
     aes_fips_options.vccrypt_block_alg_decrypt = &vccrypt_aes_cbc_alg_decrypt;
+    aes_fips_options.vccrypt_block_alg_storage_size =
+        &vccrypt_aes_cbc_alg_storage_size;
+    aes_fips_options.vccrypt_block_alg_init_with_storage =
+        &vccrypt_aes_cbc_alg_init_with_storage;
+    aes_fips_options.vccrypt_block_alg_encrypt_cbc =
+        &vccrypt_aes_cbc_alg_encrypt_cbc;
+    aes_fips_options.vccrypt_block_alg_decrypt_cbc =
+        &vccrypt_aes_cbc_alg_decrypt_cbc;
+    aes_fips_options.vccrypt_block_alg_encrypt_cbc_many =
+        &vccrypt_aes_cbc_alg_encrypt_cbc_many;
     aes_fips_options.data = &aes_fips_options_data;
     aes_fips_options.vccrypt_block_alg_options_init =
         &vccrypt_aes_cbc_alg_options_init;
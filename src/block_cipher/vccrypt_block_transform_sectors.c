@@ -0,0 +1,145 @@
+/**
+ * \file vccrypt_block_transform_sectors.c
+ *
+ * Encrypt or decrypt consecutive storage sectors on multiple threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <vccrypt/block_cipher.h>
+#include <vpr/parameters.h>
+
+#include "block_cipher_private.h"
+
+/**
+ * Shared state for a single multi-sector operation.
+ */
+typedef struct block_sectors
+{
+    vccrypt_block_context_t* context;
+    int (*crypt)(void*, void*, uint64_t, const void*, void*, size_t);
+    uint64_t first_sector;
+    size_t sector_size;
+    size_t sectors_per_job;
+    size_t count;
+    const uint8_t* input;
+    uint8_t* output;
+} block_sectors_t;
+
+/**
+ * Process the sectors belonging to a single job.
+ *
+ * The sector methods only read the key schedules, so every worker shares the
+ * caller's context.
+ */
+static void block_sectors_job(void* context, size_t UNUSED(worker), size_t job)
+{
+    block_sectors_t* sec = (block_sectors_t*)context;
+    size_t begin = job * sec->sectors_per_job;
+    size_t end = begin + sec->sectors_per_job;
+
+    if (end > sec->count)
+        end = sec->count;
+
+    /* the sector size was validated up front, so this cannot fail. */
+    for (size_t i = begin; i < end; ++i)
+    {
+        sec->crypt(
+            sec->context->options, sec->context, sec->first_sector + i,
+            sec->input + i * sec->sector_size,
+            sec->output + i * sec->sector_size, sec->sector_size);
+    }
+}
+
+/**
+ * Encrypt or decrypt consecutive sectors using multiple threads.
+ *
+ * \param context       The block cipher context to use.
+ * \param first_sector  The sector number of the first sector.
+ * \param sector_size   The size of each sector, in bytes.
+ * \param input         The input sectors.
+ * \param output        The output sectors.
+ * \param count         The number of sectors.
+ * \param threads       The number of threads, or 0 for one per processor.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_block_transform_sectors(
+    vccrypt_block_context_t* context, uint64_t first_sector,
+    size_t sector_size, const void* input, void* output, size_t count,
+    size_t threads, bool encrypt)
+{
+    block_sectors_t sec;
+    size_t jobs, workers;
+    int retval;
+
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+
+    if (NULL == context || NULL == context->options
+     || (count > 0 && (NULL == input || NULL == output)))
+    {
+        return VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG;
+    }
+
+    memset(&sec, 0, sizeof(sec));
+    sec.crypt =
+        encrypt
+            ? context->options->vccrypt_block_alg_encrypt_sector
+            : context->options->vccrypt_block_alg_decrypt_sector;
+    if (NULL == sec.crypt)
+    {
+        return VCCRYPT_ERROR_BLOCK_SECTOR_UNSUPPORTED;
+    }
+
+    if (0 == count)
+    {
+        return VCCRYPT_STATUS_SUCCESS;
+    }
+
+    /* validate the sector size on the first sector, serially. */
+    retval =
+        sec.crypt(
+            context->options, context, first_sector, input, output,
+            sector_size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    sec.context = context;
+    sec.first_sector = first_sector + 1;
+    sec.sector_size = sector_size;
+    sec.count = count - 1;
+    sec.input = (const uint8_t*)input + sector_size;
+    sec.output = (uint8_t*)output + sector_size;
+
+    /* group small sectors, so that each job is worth a thread hand off. */
+    sec.sectors_per_job =
+        (VCCRYPT_BLOCK_SECTORS_PARALLEL_CHUNK_SIZE + sector_size - 1)
+            / sector_size;
+    jobs = (sec.count + sec.sectors_per_job - 1) / sec.sectors_per_job;
+    workers = vccrypt_parallel_thread_count(threads, jobs);
+
+    if (workers < 2)
+    {
+        for (size_t i = 0; i < jobs; ++i)
+        {
+            block_sectors_job(&sec, 0, i);
+        }
+
+        return VCCRYPT_STATUS_SUCCESS;
+    }
+
+    vccrypt_parallel_run(
+        context->options->alloc_opts, workers, jobs, &block_sectors_job,
+        &sec);
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
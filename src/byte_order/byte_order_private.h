@@ -0,0 +1,104 @@
+/**
+ * \file byte_order_private.h
+ *
+ * \brief Private helpers for loading and storing fixed-width integers in a
+ * fixed byte order, shared by the ciphers, hashes, and MACs.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCRYPT_BYTE_ORDER_PRIVATE_HEADER_GUARD
+#define VCCRYPT_BYTE_ORDER_PRIVATE_HEADER_GUARD
+
+#include <stdint.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * Read a little-endian 32-bit value.
+ */
+static inline uint32_t vccrypt_load_le32(const uint8_t* p)
+{
+    return
+        ((uint32_t)p[0]) | ((uint32_t)p[1] << 8)
+      | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * Write a little-endian 32-bit value.
+ */
+static inline void vccrypt_store_le32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)(v);
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+/**
+ * Read a little-endian 64-bit value.
+ */
+static inline uint64_t vccrypt_load_le64(const uint8_t* p)
+{
+    return
+        ((uint64_t)vccrypt_load_le32(p))
+      | ((uint64_t)vccrypt_load_le32(p + 4) << 32);
+}
+
+/**
+ * Write a little-endian 64-bit value.
+ */
+static inline void vccrypt_store_le64(uint8_t* p, uint64_t v)
+{
+    vccrypt_store_le32(p, (uint32_t)v);
+    vccrypt_store_le32(p + 4, (uint32_t)(v >> 32));
+}
+
+/**
+ * Read a big-endian 32-bit value.
+ */
+static inline uint32_t vccrypt_load_be32(const uint8_t* p)
+{
+    return
+        ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+      | ((uint32_t)p[2] << 8) | ((uint32_t)p[3]);
+}
+
+/**
+ * Write a big-endian 32-bit value.
+ */
+static inline void vccrypt_store_be32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)(v);
+}
+
+/**
+ * Read a big-endian 64-bit value.
+ */
+static inline uint64_t vccrypt_load_be64(const uint8_t* p)
+{
+    return
+        ((uint64_t)vccrypt_load_be32(p) << 32) | vccrypt_load_be32(p + 4);
+}
+
+/**
+ * Write a big-endian 64-bit value.
+ */
+static inline void vccrypt_store_be64(uint8_t* p, uint64_t v)
+{
+    vccrypt_store_be32(p, (uint32_t)(v >> 32));
+    vccrypt_store_be32(p + 4, (uint32_t)v);
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCRYPT_BYTE_ORDER_PRIVATE_HEADER_GUARD
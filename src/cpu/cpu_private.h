@@ -0,0 +1,66 @@
+/**
+ * \file cpu_private.h
+ *
+ * \brief Private runtime CPU feature detection shared by the accelerated
+ * backends.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCRYPT_CPU_PRIVATE_HEADER_GUARD
+#define VCCRYPT_CPU_PRIVATE_HEADER_GUARD
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/* features are only detected on x86 GCC / Clang; elsewhere none are set. */
+#if (defined(__x86_64__) || defined(__i386__)) \
+ && (defined(__GNUC__) || defined(__clang__))
+#define VCCRYPT_CPU_X86
+#endif
+
+/**
+ * \brief Feature bits returned by vccrypt_cpu_features().
+ *
+ * VCCRYPT_CPU_AVX and VCCRYPT_CPU_AVX2 are only set when the operating system
+ * also saves the YMM register state, so they mean the instructions are usable
+ * and not just present.
+ */
+#define VCCRYPT_CPU_SSE2 (1U << 0)
+#define VCCRYPT_CPU_SSSE3 (1U << 1)
+#define VCCRYPT_CPU_SSE41 (1U << 2)
+#define VCCRYPT_CPU_AESNI (1U << 3)
+#define VCCRYPT_CPU_PCLMULQDQ (1U << 4)
+#define VCCRYPT_CPU_AVX (1U << 5)
+#define VCCRYPT_CPU_AVX2 (1U << 6)
+#define VCCRYPT_CPU_BMI2 (1U << 7)
+#define VCCRYPT_CPU_SHA (1U << 8)
+
+/**
+ * \brief Return the features supported by this CPU and operating system.
+ *
+ * The features are detected with CPUID and XGETBV on the first call and
+ * cached for later calls.
+ *
+ * \returns a mask of VCCRYPT_CPU_* feature bits.
+ */
+unsigned int vccrypt_cpu_features(void);
+
+/**
+ * \brief Return non-zero if all of the given features are supported by this
+ * CPU and operating system.
+ *
+ * \param features      A mask of VCCRYPT_CPU_* feature bits.
+ *
+ * \returns 1 if every requested feature is supported, and 0 otherwise.
+ */
+int vccrypt_cpu_has(unsigned int features);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCRYPT_CPU_PRIVATE_HEADER_GUARD
@@ -0,0 +1,104 @@
+/**
+ * \file vccrypt_cpu_features.c
+ *
+ * \brief Detect and cache the features of this CPU and operating system.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "cpu_private.h"
+
+#ifdef VCCRYPT_CPU_X86
+
+#include <cpuid.h>
+
+/* CPUID.1:EDX feature bits. */
+#define CPUID_1_EDX_SSE2 (1U << 26)
+
+/* CPUID.1:ECX feature bits. */
+#define CPUID_1_ECX_PCLMULQDQ (1U << 1)
+#define CPUID_1_ECX_SSSE3 (1U << 9)
+#define CPUID_1_ECX_SSE41 (1U << 19)
+#define CPUID_1_ECX_AES (1U << 25)
+#define CPUID_1_ECX_OSXSAVE (1U << 27)
+#define CPUID_1_ECX_AVX (1U << 28)
+
+/* CPUID.(EAX=7,ECX=0):EBX feature bits. */
+#define CPUID_7_EBX_AVX2 (1U << 5)
+#define CPUID_7_EBX_BMI2 (1U << 8)
+#define CPUID_7_EBX_SHA (1U << 29)
+
+/* XCR0 bits for SSE and AVX register state. */
+#define XCR0_YMM 0x6
+
+/* cached feature mask, valid once cpu_checked is set. */
+static volatile unsigned int cpu_features = 0;
+static volatile int cpu_checked = 0;
+
+/**
+ * Query CPUID and XGETBV for the features this library can use.
+ */
+static unsigned int cpu_detect(void)
+{
+    unsigned int eax, ebx, ecx, edx, xcr0_lo, xcr0_hi;
+    unsigned int features = 0;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+
+    if (edx & CPUID_1_EDX_SSE2)
+        features |= VCCRYPT_CPU_SSE2;
+    if (ecx & CPUID_1_ECX_SSSE3)
+        features |= VCCRYPT_CPU_SSSE3;
+    if (ecx & CPUID_1_ECX_SSE41)
+        features |= VCCRYPT_CPU_SSE41;
+    if (ecx & CPUID_1_ECX_AES)
+        features |= VCCRYPT_CPU_AESNI;
+    if (ecx & CPUID_1_ECX_PCLMULQDQ)
+        features |= VCCRYPT_CPU_PCLMULQDQ;
+
+    /* the OS must save the YMM registers for AVX to be usable. */
+    if ((ecx & CPUID_1_ECX_OSXSAVE) && (ecx & CPUID_1_ECX_AVX))
+    {
+        __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        (void)xcr0_hi;
+
+        if (XCR0_YMM == (xcr0_lo & XCR0_YMM))
+            features |= VCCRYPT_CPU_AVX;
+    }
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+    {
+        if ((features & VCCRYPT_CPU_AVX) && (ebx & CPUID_7_EBX_AVX2))
+            features |= VCCRYPT_CPU_AVX2;
+        if (ebx & CPUID_7_EBX_BMI2)
+            features |= VCCRYPT_CPU_BMI2;
+        if (ebx & CPUID_7_EBX_SHA)
+            features |= VCCRYPT_CPU_SHA;
+    }
+
+    return features;
+}
+
+#endif /*VCCRYPT_CPU_X86*/
+
+/**
+ * \brief Return the features supported by this CPU and operating system.
+ *
+ * \returns a mask of VCCRYPT_CPU_* feature bits.
+ */
+unsigned int vccrypt_cpu_features(void)
+{
+#ifdef VCCRYPT_CPU_X86
+    /* detection is idempotent, so racing first calls are harmless. */
+    if (!cpu_checked)
+    {
+        cpu_features = cpu_detect();
+        cpu_checked = 1;
+    }
+
+    return cpu_features;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,22 @@
+/**
+ * \file vccrypt_cpu_has.c
+ *
+ * \brief Check this CPU and operating system for a set of features.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "cpu_private.h"
+
+/**
+ * \brief Return non-zero if all of the given features are supported by this
+ * CPU and operating system.
+ *
+ * \param features      A mask of VCCRYPT_CPU_* feature bits.
+ *
+ * \returns 1 if every requested feature is supported, and 0 otherwise.
+ */
+int vccrypt_cpu_has(unsigned int features)
+{
+    return (features == (vccrypt_cpu_features() & features)) ? 1 : 0;
+}
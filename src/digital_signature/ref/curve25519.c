@@ -5743,50 +5743,45 @@ sc_muladd(uint8_t* s, const uint8_t* a, const uint8_t* b, const uint8_t* c)
     s[31] = s11 >> 17;
 }
 
+/**
+ * Finalize a SHA-512 instance directly into a 64 byte array.
+ */
+static int ed25519_sha512_finalize(
+    vccrypt_hash_context_t* sha512_ctx, uint8_t out[64])
+{
+    vccrypt_buffer_t out_buf;
+
+    /* out_buf is a view of out, and owns nothing. */
+    memset(&out_buf, 0, sizeof(out_buf));
+    out_buf.size = 64;
+    out_buf.data = out;
+
+    return vccrypt_hash_finalize(sha512_ctx, &out_buf);
+}
+
 int ED25519_keypair(
     uint8_t out_public_key[32], uint8_t out_private_key[64],
     vccrypt_prng_context_t* prng_ctx, vccrypt_hash_options_t* sha512_opts)
 {
     int retval = 0;
+    uint8_t seed[32];
+    uint8_t az[64];
 
     /* generate a seed for this keypair */
-    uint8_t seed[32];
     if (0 != vccrypt_prng_read_c(prng_ctx, seed, 32))
     {
         retval = 1;
         goto cleanup;
     }
 
-    /* create output buffer for sha-512 */
-    vccrypt_buffer_t az_buf;
-    if (0 != vccrypt_buffer_init(&az_buf, sha512_opts->alloc_opts, 64))
-    {
-        retval = 2;
-        goto cleanup;
-    }
-
-    /* create SHA-512 context for AZ */
-    vccrypt_hash_context_t sha512_ctx;
-    if (0 != vccrypt_hash_init(sha512_opts, &sha512_ctx))
-    {
-        retval = 3;
-        goto az_buf_cleanup;
-    }
-    /* add data to the digest */
-    if (0 != vccrypt_hash_digest(&sha512_ctx, seed, 32))
-    {
-        retval = 4;
-        goto sha512_ctx_cleanup;
-    }
-    /* finalize the digest */
-    if (0 != vccrypt_hash_finalize(&sha512_ctx, &az_buf))
+    /* hash the seed to derive AZ */
+    if (sha512_opts->hash_size > sizeof(az)
+     || 0 != vccrypt_hash_oneshot(sha512_opts, seed, 32, az))
     {
         retval = 5;
-        goto sha512_ctx_cleanup;
+        goto cleanup;
     }
 
-    uint8_t* az = (uint8_t*)az_buf.data;
-
     az[0] &= 248;
     az[31] &= 63;
     az[31] |= 64;
@@ -5798,13 +5793,10 @@ int ED25519_keypair(
     memcpy(out_private_key, seed, 32);
     memmove(out_private_key + 32, out_public_key, 32);
 
-sha512_ctx_cleanup:
-    dispose((disposable_t*)&sha512_ctx);
-
-az_buf_cleanup:
-    dispose((disposable_t*)&az_buf);
-
 cleanup:
+    memset(az, 0, sizeof(az));
+    memset(seed, 0, sizeof(seed));
+
     return retval;
 }
 
@@ -5813,76 +5805,48 @@ int ED25519_sign(
     const uint8_t private_key[64], vccrypt_hash_options_t* sha512_opts)
 {
     int retval = 0;
-
-    /* create the output buffer for the SHA-512 az operation */
-    vccrypt_buffer_t az_buf;
-    if (0 != vccrypt_buffer_init(&az_buf, sha512_opts->alloc_opts, 64))
-    {
-        retval = 2;
-        goto cleanup;
-    }
-    /* create SHA-512 context for AZ */
+    uint8_t az[64];
+    uint8_t nonce[64];
+    uint8_t hram[64];
     vccrypt_hash_context_t sha512_ctx;
-    if (0 != vccrypt_hash_init(sha512_opts, &sha512_ctx))
-    {
-        retval = 3;
-        goto az_buf_cleanup;
-    }
-    /* add data to digest */
-    if (0 != vccrypt_hash_digest(&sha512_ctx, private_key, 32))
-    {
-        retval = 4;
-        goto sha512_ctx_cleanup;
-    }
-    /* finalize the digest */
-    if (0 != vccrypt_hash_finalize(&sha512_ctx, &az_buf))
+
+    /* hash the private key seed to derive AZ */
+    if (sha512_opts->hash_size > sizeof(az)
+     || 0 != vccrypt_hash_oneshot(sha512_opts, private_key, 32, az))
     {
         retval = 5;
-        goto sha512_ctx_cleanup;
+        goto cleanup;
     }
 
-    uint8_t* az = (uint8_t*)az_buf.data;
-
     az[0] &= 248;
     az[31] &= 63;
     az[31] |= 64;
 
-    /* re-use the sha-context by disposing and re-initializing. */
-    dispose((disposable_t*)&sha512_ctx);
     /* create SHA-512 context for nonce */
-    if (0 != vccrypt_hash_init(sha512_opts, &sha512_ctx))
+    if (0 != vccrypt_hash_init_embedded(sha512_opts, &sha512_ctx))
     {
         retval = 6;
-        goto az_buf_cleanup;
-    }
-    /* create the output buffer for the nonce */
-    vccrypt_buffer_t nonce_buf;
-    if (0 != vccrypt_buffer_init(&nonce_buf, sha512_opts->alloc_opts, 64))
-    {
-        retval = 7;
-        goto sha512_ctx_cleanup;
+        goto cleanup;
     }
     /* add az subset to digest */
     if (0 != vccrypt_hash_digest(&sha512_ctx, az + 32, 32))
     {
         retval = 8;
-        goto nonce_cleanup;
+        goto sha512_ctx_cleanup;
     }
     /* add message to the digest */
     if (0 != vccrypt_hash_digest(&sha512_ctx, message, message_len))
     {
         retval = 9;
-        goto nonce_cleanup;
+        goto sha512_ctx_cleanup;
     }
     /* finalize the digest */
-    if (0 != vccrypt_hash_finalize(&sha512_ctx, &nonce_buf))
+    if (0 != ed25519_sha512_finalize(&sha512_ctx, nonce))
     {
         retval = 10;
-        goto nonce_cleanup;
+        goto sha512_ctx_cleanup;
     }
 
-    uint8_t* nonce = (uint8_t*)nonce_buf.data;
-
     x25519_sc_reduce(nonce);
     ge_p3 R;
     x25519_ge_scalarmult_base(&R, nonce);
@@ -5890,63 +5854,48 @@ int ED25519_sign(
 
     /* re-use the sha-context by disposing and re-initializing. */
     dispose((disposable_t*)&sha512_ctx);
-    /* create SHA-512 context for nonce */
-    if (0 != vccrypt_hash_init(sha512_opts, &sha512_ctx))
+    /* create SHA-512 context for hram */
+    if (0 != vccrypt_hash_init_embedded(sha512_opts, &sha512_ctx))
     {
         retval = 11;
-        dispose((disposable_t*)&nonce_buf);
-        goto az_buf_cleanup;
-    }
-    /* create the output buffer for the hram */
-    vccrypt_buffer_t hram_buf;
-    if (0 != vccrypt_buffer_init(&hram_buf, sha512_opts->alloc_opts, 64))
-    {
-        retval = 12;
-        goto nonce_cleanup;
+        goto cleanup;
     }
     /* add out_sig to the digest */
     if (0 != vccrypt_hash_digest(&sha512_ctx, out_sig, 32))
     {
         retval = 13;
-        goto hram_cleanup;
+        goto sha512_ctx_cleanup;
     }
     /* add public key to the digest (last 32 bytes of private key) */
     if (0 != vccrypt_hash_digest(&sha512_ctx, private_key + 32, 32))
     {
         retval = 14;
-        goto hram_cleanup;
+        goto sha512_ctx_cleanup;
     }
     /* add message to the digest */
     if (0 != vccrypt_hash_digest(&sha512_ctx, message, message_len))
     {
         retval = 15;
-        goto hram_cleanup;
+        goto sha512_ctx_cleanup;
     }
     /* finalize the hram digest */
-    if (0 != vccrypt_hash_finalize(&sha512_ctx, &hram_buf))
+    if (0 != ed25519_sha512_finalize(&sha512_ctx, hram))
     {
         retval = 16;
-        goto hram_cleanup;
+        goto sha512_ctx_cleanup;
     }
 
-    uint8_t* hram = (uint8_t*)hram_buf.data;
-
     x25519_sc_reduce(hram);
     sc_muladd(out_sig + 32, hram, az, nonce);
 
-hram_cleanup:
-    dispose((disposable_t*)&hram_buf);
-
-nonce_cleanup:
-    dispose((disposable_t*)&nonce_buf);
-
 sha512_ctx_cleanup:
     dispose((disposable_t*)&sha512_ctx);
 
-az_buf_cleanup:
-    dispose((disposable_t*)&az_buf);
-
 cleanup:
+    memset(hram, 0, sizeof(hram));
+    memset(nonce, 0, sizeof(nonce));
+    memset(az, 0, sizeof(az));
+
     return retval;
 }
 
@@ -5972,19 +5921,13 @@ int ED25519_verify(
     uint8_t scopy[32];
     memcpy(scopy, signature + 32, 32);
 
-    /* create the output buffer for SHA-512 hash verify */
-    vccrypt_buffer_t h_buf;
-    if (0 != vccrypt_buffer_init(&h_buf, sha512_opts->alloc_opts, 64))
-    {
-        retval = 2;
-        goto cleanup;
-    }
     /* create SHA-512 context for hash verify */
+    uint8_t h[64];
     vccrypt_hash_context_t sha512_ctx;
-    if (0 != vccrypt_hash_init(sha512_opts, &sha512_ctx))
+    if (0 != vccrypt_hash_init_embedded(sha512_opts, &sha512_ctx))
     {
         retval = 3;
-        goto h_buf_cleanup;
+        goto cleanup;
     }
     /* add signature subset to digest */
     if (0 != vccrypt_hash_digest(&sha512_ctx, signature, 32))
@@ -6005,14 +5948,12 @@ int ED25519_verify(
         goto sha512_ctx_cleanup;
     }
     /* finalize the digest */
-    if (0 != vccrypt_hash_finalize(&sha512_ctx, &h_buf))
+    if (0 != ed25519_sha512_finalize(&sha512_ctx, h))
     {
         retval = 7;
         goto sha512_ctx_cleanup;
     }
 
-    uint8_t* h = (uint8_t*)h_buf.data;
-
     x25519_sc_reduce(h);
 
     ge_p2 R;
@@ -6026,9 +5967,6 @@ int ED25519_verify(
 sha512_ctx_cleanup:
     dispose((disposable_t*)&sha512_ctx);
 
-h_buf_cleanup:
-    dispose((disposable_t*)&h_buf);
-
 cleanup:
     return retval;
 }
@@ -0,0 +1,115 @@
+/**
+ * \file hash_private.h
+ *
+ * Private implementation-specific data.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCRYPT_HASH_PRIVATE_HEADER_GUARD
+#define VCCRYPT_HASH_PRIVATE_HEADER_GUARD
+
+#include <vccrypt/hash.h>
+#include <vpr/allocator.h>
+
+#include "ref/sha512.h"
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Hash many independent messages with SHA-512 or one of its truncated
+ * variants, compressing several messages at once in SIMD lanes when the CPU
+ * supports it.
+ *
+ * \param jobs          The jobs to hash.
+ * \param count         The number of jobs.
+ * \param init          The SHA-512 family init function, which selects the
+ *                      initial hash value and the digest length.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_sha512_digest_many(
+    vccrypt_hash_job_t* jobs, size_t count, void (*init)(SHA512_CTX*));
+
+/**
+ * \brief The maximum height of a SHA-512 tree, which is enough for 2^64
+ * bytes of input at the smallest chunk size and fan-out.
+ */
+#define VCCRYPT_SHA512_TREE_MAX_LEVELS 64
+
+/**
+ * \brief The maximum number of leaves hashed by a single parallel batch.
+ */
+#define VCCRYPT_SHA512_TREE_BATCH 64
+
+/**
+ * \brief Working state of a SHA-512 tree hash.
+ *
+ * Each level of the tree holds the digests of its rightmost, incomplete
+ * group of nodes.  A group is only hashed into its parent once the next node
+ * at that level arrives, so that finalization can tell the last group apart.
+ */
+typedef struct vccrypt_sha512_tree
+{
+    allocator_options_t* alloc_opts;
+    size_t chunk_size;
+    size_t fanout;
+    uint64_t total;
+    size_t leaf_fill;
+    SHA512_CTX leaf;
+    size_t levels;
+    size_t count[VCCRYPT_SHA512_TREE_MAX_LEVELS];
+    uint8_t batch[VCCRYPT_SHA512_TREE_BATCH][SHA512_DIGEST_LENGTH];
+    uint8_t nodes[];
+} vccrypt_sha512_tree_t;
+
+/**
+ * \brief Return the size of a SHA-512 tree hash state with the given fan-out.
+ *
+ * \param fanout        The number of children per parent node.
+ */
+size_t vccrypt_sha512_tree_size(size_t fanout);
+
+/**
+ * \brief Initialize a SHA-512 tree hash state.
+ *
+ * \param tree          The state to initialize, which must be at least
+ *                      vccrypt_sha512_tree_size(fanout) bytes in size.
+ * \param alloc_opts    The allocator used for worker thread bookkeeping.
+ * \param chunk_size    The leaf chunk size, in bytes.
+ * \param fanout        The number of children per parent node.
+ */
+void vccrypt_sha512_tree_init(
+    vccrypt_sha512_tree_t* tree, allocator_options_t* alloc_opts,
+    size_t chunk_size, size_t fanout);
+
+/**
+ * \brief Add data to a SHA-512 tree hash.
+ *
+ * Whole chunks in the given data are hashed in parallel on all online
+ * processors, so callers should pass large buffers where possible.
+ *
+ * \param tree          The state to update.
+ * \param data          The data to digest.
+ * \param size          The size of the data, in bytes.
+ */
+void vccrypt_sha512_tree_update(
+    vccrypt_sha512_tree_t* tree, const uint8_t* data, size_t size);
+
+/**
+ * \brief Finalize a SHA-512 tree hash.
+ *
+ * \param tree          The state to finalize.
+ * \param md            The buffer to receive the 64 byte root digest.
+ */
+void vccrypt_sha512_tree_final(vccrypt_sha512_tree_t* tree, uint8_t* md);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*VCCRYPT_HASH_PRIVATE_HEADER_GUARD*/
@@ -0,0 +1,384 @@
+/**
+ * \file hash/ref/sha256.c
+ *
+ * Reference implementation of SHA-256 (FIPS 180-4).
+ *
+ * The portable compression function follows the same structure as the
+ * SHA-512 reference implementation.  On CPUs with the SHA extensions, the
+ * compression function is replaced at runtime with the SHA-NI backend.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sha256.h"
+
+#define GETU32(p) ( \
+    ((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) \
+  | ((uint32_t)(p)[2] << 8) | ((uint32_t)(p)[3]))
+
+/* forward decls */
+static void sha256_block_data_order(
+    SHA256_CTX* ctx, const void* in, size_t num);
+static void sha256_block_data_order_c(
+    SHA256_CTX* ctx, const void* in, size_t num);
+
+/**
+ * Initialize a SHA context for SHA-256 operation.
+ *
+ * \param c     The SHA context to initialize.
+ */
+void SHA256_Init(SHA256_CTX* c)
+{
+    c->h[0] = UINT32_C(0x6a09e667);
+    c->h[1] = UINT32_C(0xbb67ae85);
+    c->h[2] = UINT32_C(0x3c6ef372);
+    c->h[3] = UINT32_C(0xa54ff53a);
+    c->h[4] = UINT32_C(0x510e527f);
+    c->h[5] = UINT32_C(0x9b05688c);
+    c->h[6] = UINT32_C(0x1f83d9ab);
+    c->h[7] = UINT32_C(0x5be0cd19);
+
+    c->N = 0;
+    c->num = 0;
+    c->md_len = SHA256_DIGEST_LENGTH;
+}
+
+/**
+ * Add the given data to a SHA-256 context.
+ *
+ * \param c     The SHA-256 context to update.
+ * \param data  A pointer to the data to digest.
+ * \param len   The length of the data to digest.
+ */
+void SHA256_Update(SHA256_CTX* c, const void* _data, size_t len)
+{
+    const uint8_t* data = (const uint8_t*)_data;
+
+    /* nothing to be done for no data. */
+    if (len == 0)
+    {
+        return;
+    }
+
+    c->N += ((uint64_t)len) << 3;
+
+    if (c->num != 0)
+    {
+        size_t n = sizeof(c->p) - c->num;
+
+        if (len < n)
+        {
+            memcpy(c->p + c->num, data, len);
+            c->num += (unsigned int)len;
+
+            return;
+        }
+
+        memcpy(c->p + c->num, data, n);
+        c->num = 0;
+        len -= n;
+        data += n;
+        sha256_block_data_order(c, c->p, 1);
+    }
+
+    if (len >= sizeof(c->p))
+    {
+        sha256_block_data_order(c, data, len / sizeof(c->p));
+        data += len - len % sizeof(c->p);
+        len %= sizeof(c->p);
+    }
+
+    if (len != 0)
+    {
+        memcpy(c->p, data, len);
+        c->num = (unsigned int)len;
+    }
+}
+
+/**
+ * Finalize a SHA-256 context and generate the final hash.
+ *
+ * \param c     The SHA-256 context to finalize.
+ * \param md    A pointer to a buffer to hold the SHA-256 hash.  Must be at
+ *              least 32 bytes in length.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int SHA256_Final(SHA256_CTX* c, uint8_t* md)
+{
+    uint8_t* p = c->p;
+    size_t n = c->num;
+
+    p[n] = 0x80; /* There always is a room for one */
+    n++;
+    if (n > (sizeof(c->p) - 8))
+    {
+        memset(p + n, 0, sizeof(c->p) - n);
+        n = 0;
+        sha256_block_data_order(c, p, 1);
+    }
+
+    memset(p + n, 0, sizeof(c->p) - 8 - n);
+
+    for (n = 0; n < 8; ++n)
+    {
+        p[sizeof(c->p) - 1 - n] = (uint8_t)(c->N >> (8 * n));
+    }
+
+    sha256_block_data_order(c, p, 1);
+
+    /* return an error if the message digest buffer is null. */
+    if (md == 0 || c->md_len != SHA256_DIGEST_LENGTH)
+    {
+        return 1;
+    }
+
+    for (n = 0; n < SHA256_DIGEST_LENGTH / 4; n++)
+    {
+        uint32_t t = c->h[n];
+
+        *(md++) = (uint8_t)(t >> 24);
+        *(md++) = (uint8_t)(t >> 16);
+        *(md++) = (uint8_t)(t >> 8);
+        *(md++) = (uint8_t)(t);
+    }
+
+    return 0;
+}
+
+/**
+ * Export the midstate of a SHA-256 context.
+ *
+ * \param c     The SHA context to export.
+ * \param out   A buffer of at least SHA256_STATE_LENGTH bytes to receive the
+ *              midstate.
+ */
+void SHA256_Export(const SHA256_CTX* c, uint8_t* out)
+{
+    size_t i;
+
+    /* the chaining value, followed by the 64-bit bit count. */
+    for (i = 0; i < 8; ++i)
+    {
+        out[4 * i + 0] = (uint8_t)(c->h[i] >> 24);
+        out[4 * i + 1] = (uint8_t)(c->h[i] >> 16);
+        out[4 * i + 2] = (uint8_t)(c->h[i] >> 8);
+        out[4 * i + 3] = (uint8_t)(c->h[i]);
+    }
+
+    for (i = 0; i < 8; ++i)
+    {
+        out[39 - i] = (uint8_t)(c->N >> (8 * i));
+    }
+
+    /* the number of buffered bytes, followed by the partial block. */
+    out[40] = (uint8_t)c->num;
+    memcpy(out + 41, c->p, c->num);
+    memset(out + 41 + c->num, 0, sizeof(c->p) - c->num);
+}
+
+/**
+ * Import a midstate into a SHA-256 context.
+ *
+ * \param c     The SHA context to update.
+ * \param in    The midstate, as written by SHA256_Export().
+ *
+ * \returns 0 on success and non-zero if the midstate is malformed.
+ */
+int SHA256_Import(SHA256_CTX* c, const uint8_t* in)
+{
+    size_t i;
+    unsigned int num = in[40];
+
+    /* a partial block is never a full block. */
+    if (num >= sizeof(c->p))
+    {
+        return 1;
+    }
+
+    for (i = 0; i < 8; ++i)
+    {
+        c->h[i] = GETU32(in + 4 * i);
+    }
+
+    c->N = 0;
+    for (i = 32; i < 40; ++i)
+    {
+        c->N = (c->N << 8) | in[i];
+    }
+
+    c->num = num;
+    memcpy(c->p, in + 41, num);
+
+    return 0;
+}
+
+/**
+ * Constants for the SHA-256 block operation.
+ */
+const uint32_t SHA256_K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ROTR(x, s) (((x) >> (s)) | ((x) << (32 - (s))))
+
+#define Sigma0(x) (ROTR((x), 2) ^ ROTR((x), 13) ^ ROTR((x), 22))
+#define Sigma1(x) (ROTR((x), 6) ^ ROTR((x), 11) ^ ROTR((x), 25))
+#define sigma0(x) (ROTR((x), 7) ^ ROTR((x), 18) ^ ((x) >> 3))
+#define sigma1(x) (ROTR((x), 17) ^ ROTR((x), 19) ^ ((x) >> 10))
+
+#define Ch(x, y, z) (((x) & (y)) ^ ((~(x)) & (z)))
+#define Maj(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+
+#define ROUND_00_15(i, a, b, c, d, e, f, g, h) \
+    do \
+    { \
+        T1 += h + Sigma1(e) + Ch(e, f, g) + SHA256_K256[i]; \
+        h = Sigma0(a) + Maj(a, b, c); \
+        d += T1; \
+        h += T1; \
+    } while (0)
+
+#define ROUND_16_63(i, j, a, b, c, d, e, f, g, h, X) \
+    do \
+    { \
+        s0 = X[(j + 1) & 0x0f]; \
+        s0 = sigma0(s0); \
+        s1 = X[(j + 14) & 0x0f]; \
+        s1 = sigma1(s1); \
+        T1 = X[(j)&0x0f] += s0 + s1 + X[(j + 9) & 0x0f]; \
+        ROUND_00_15(i + j, a, b, c, d, e, f, g, h); \
+    } while (0)
+
+/**
+ * Compress num blocks into the hash state using portable C.
+ *
+ * \param ctx   The SHA context to update.
+ * \param in    The blocks to compress.
+ * \param num   The number of 64 byte blocks.
+ */
+static void sha256_block_data_order_c(
+    SHA256_CTX* ctx, const void* in, size_t num)
+{
+    const uint8_t* W = (const uint8_t*)in;
+    uint32_t a, b, c, d, e, f, g, h, s0, s1, T1;
+    uint32_t X[16];
+    int i;
+
+    while (num--)
+    {
+        a = ctx->h[0];
+        b = ctx->h[1];
+        c = ctx->h[2];
+        d = ctx->h[3];
+        e = ctx->h[4];
+        f = ctx->h[5];
+        g = ctx->h[6];
+        h = ctx->h[7];
+
+        T1 = X[0] = GETU32(W + 0);
+        ROUND_00_15(0, a, b, c, d, e, f, g, h);
+        T1 = X[1] = GETU32(W + 4);
+        ROUND_00_15(1, h, a, b, c, d, e, f, g);
+        T1 = X[2] = GETU32(W + 8);
+        ROUND_00_15(2, g, h, a, b, c, d, e, f);
+        T1 = X[3] = GETU32(W + 12);
+        ROUND_00_15(3, f, g, h, a, b, c, d, e);
+        T1 = X[4] = GETU32(W + 16);
+        ROUND_00_15(4, e, f, g, h, a, b, c, d);
+        T1 = X[5] = GETU32(W + 20);
+        ROUND_00_15(5, d, e, f, g, h, a, b, c);
+        T1 = X[6] = GETU32(W + 24);
+        ROUND_00_15(6, c, d, e, f, g, h, a, b);
+        T1 = X[7] = GETU32(W + 28);
+        ROUND_00_15(7, b, c, d, e, f, g, h, a);
+        T1 = X[8] = GETU32(W + 32);
+        ROUND_00_15(8, a, b, c, d, e, f, g, h);
+        T1 = X[9] = GETU32(W + 36);
+        ROUND_00_15(9, h, a, b, c, d, e, f, g);
+        T1 = X[10] = GETU32(W + 40);
+        ROUND_00_15(10, g, h, a, b, c, d, e, f);
+        T1 = X[11] = GETU32(W + 44);
+        ROUND_00_15(11, f, g, h, a, b, c, d, e);
+        T1 = X[12] = GETU32(W + 48);
+        ROUND_00_15(12, e, f, g, h, a, b, c, d);
+        T1 = X[13] = GETU32(W + 52);
+        ROUND_00_15(13, d, e, f, g, h, a, b, c);
+        T1 = X[14] = GETU32(W + 56);
+        ROUND_00_15(14, c, d, e, f, g, h, a, b);
+        T1 = X[15] = GETU32(W + 60);
+        ROUND_00_15(15, b, c, d, e, f, g, h, a);
+
+        for (i = 16; i < 64; i += 16)
+        {
+            ROUND_16_63(i, 0, a, b, c, d, e, f, g, h, X);
+            ROUND_16_63(i, 1, h, a, b, c, d, e, f, g, X);
+            ROUND_16_63(i, 2, g, h, a, b, c, d, e, f, X);
+            ROUND_16_63(i, 3, f, g, h, a, b, c, d, e, X);
+            ROUND_16_63(i, 4, e, f, g, h, a, b, c, d, X);
+            ROUND_16_63(i, 5, d, e, f, g, h, a, b, c, X);
+            ROUND_16_63(i, 6, c, d, e, f, g, h, a, b, X);
+            ROUND_16_63(i, 7, b, c, d, e, f, g, h, a, X);
+            ROUND_16_63(i, 8, a, b, c, d, e, f, g, h, X);
+            ROUND_16_63(i, 9, h, a, b, c, d, e, f, g, X);
+            ROUND_16_63(i, 10, g, h, a, b, c, d, e, f, X);
+            ROUND_16_63(i, 11, f, g, h, a, b, c, d, e, X);
+            ROUND_16_63(i, 12, e, f, g, h, a, b, c, d, X);
+            ROUND_16_63(i, 13, d, e, f, g, h, a, b, c, X);
+            ROUND_16_63(i, 14, c, d, e, f, g, h, a, b, X);
+            ROUND_16_63(i, 15, b, c, d, e, f, g, h, a, X);
+        }
+
+        ctx->h[0] += a;
+        ctx->h[1] += b;
+        ctx->h[2] += c;
+        ctx->h[3] += d;
+        ctx->h[4] += e;
+        ctx->h[5] += f;
+        ctx->h[6] += g;
+        ctx->h[7] += h;
+
+        W += 64;
+    }
+}
+
+/**
+ * Compress num blocks into the hash state, using the fastest implementation
+ * supported by this CPU.
+ *
+ * \param ctx   The SHA context to update.
+ * \param in    The blocks to compress.
+ * \param num   The number of 64 byte blocks.
+ */
+static void sha256_block_data_order(
+    SHA256_CTX* ctx, const void* in, size_t num)
+{
+#ifdef SHA256_SHANI_SUPPORTED
+    if (SHA256_shani_available())
+    {
+        SHA256_shani_block_data_order(ctx->h, in, num);
+        return;
+    }
+#endif
+
+    sha256_block_data_order_c(ctx, in, num);
+}
@@ -0,0 +1,120 @@
+/**
+ * \file hash/ref/sha256.h
+ *
+ * Reference implementation of SHA-256, with an optional SHA-NI backend.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef HASH_REF_SHA256_HEADER_GUARD
+#define HASH_REF_SHA256_HEADER_GUARD
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+#define SHA256_DIGEST_LENGTH 32
+#define SHA256_CBLOCK 64
+
+/**
+ * Context data structure for SHA-256.
+ */
+typedef struct SHA256state
+{
+    uint32_t h[8];
+    uint64_t N;
+    uint8_t p[SHA256_CBLOCK];
+    unsigned int num, md_len;
+} SHA256_CTX;
+
+/**
+ * Initialize a SHA context for SHA-256 operation.
+ *
+ * \param c     The SHA context to initialize.
+ */
+void SHA256_Init(SHA256_CTX* c);
+
+/**
+ * Add the given data to a SHA-256 context.
+ *
+ * \param c     The SHA-256 context to update.
+ * \param data  A pointer to the data to digest.
+ * \param len   The length of the data to digest.
+ */
+void SHA256_Update(SHA256_CTX* c, const void* data, size_t len);
+
+/**
+ * Finalize a SHA-256 context and generate the final hash.
+ *
+ * \param c     The SHA-256 context to finalize.
+ * \param md    A pointer to a buffer to hold the SHA-256 hash.  Must be at
+ *              least 32 bytes in length.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int SHA256_Final(SHA256_CTX* c, uint8_t* md);
+
+/**
+ * The size of an exported SHA-256 midstate: the chaining value, the 64-bit
+ * message bit count, the number of buffered bytes, and the partial block, all
+ * in big-endian byte order.
+ */
+#define SHA256_STATE_LENGTH 105
+
+/**
+ * Export the midstate of a SHA-256 context.
+ *
+ * \param c     The SHA context to export.
+ * \param out   A buffer of at least SHA256_STATE_LENGTH bytes to receive the
+ *              midstate.
+ */
+void SHA256_Export(const SHA256_CTX* c, uint8_t* out);
+
+/**
+ * Import a midstate into a SHA-256 context.
+ *
+ * \param c     The SHA context to update.
+ * \param in    The midstate, as written by SHA256_Export().
+ *
+ * \returns 0 on success and non-zero if the midstate is malformed.
+ */
+int SHA256_Import(SHA256_CTX* c, const uint8_t* in);
+
+/**
+ * The SHA-256 round constants.
+ */
+extern const uint32_t SHA256_K256[64];
+
+/* the SHA-NI backend is available on x86 GCC / Clang. */
+#if (defined(__x86_64__) || defined(__i386__)) \
+ && (defined(__GNUC__) || defined(__clang__))
+#define SHA256_SHANI_SUPPORTED
+#endif
+
+#ifdef SHA256_SHANI_SUPPORTED
+/**
+ * Return non-zero if this CPU supports the SHA extensions.
+ */
+int SHA256_shani_available(void);
+
+/**
+ * Compress num consecutive blocks using the SHA extensions.
+ *
+ * \param h     The hash state to update.
+ * \param in    The blocks to compress.
+ * \param num   The number of 64 byte blocks.
+ */
+void SHA256_shani_block_data_order(
+    uint32_t h[8], const void* in, size_t num);
+#endif /*SHA256_SHANI_SUPPORTED*/
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif  //HASH_REF_SHA256_HEADER_GUARD
@@ -0,0 +1,139 @@
+/**
+ * \file hash/ref/sha256_shani.c
+ *
+ * SHA-256 compression using the Intel SHA extensions.
+ *
+ * The state is kept in two registers in the ABEF / CDGH layout expected by
+ * SHA256RNDS2, and each group of four rounds overlaps the message schedule
+ * for a later group using SHA256MSG1 and SHA256MSG2.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "sha256.h"
+
+#ifdef SHA256_SHANI_SUPPORTED
+
+#include <immintrin.h>
+
+#include "../../cpu/cpu_private.h"
+
+#define SHA256_SHANI_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+
+/**
+ * Return non-zero if this CPU supports the SHA extensions.
+ */
+int SHA256_shani_available(void)
+{
+    return
+        vccrypt_cpu_has(
+            VCCRYPT_CPU_SHA | VCCRYPT_CPU_SSSE3 | VCCRYPT_CPU_SSE41);
+}
+
+/* four rounds using the message words in M, with round constants at i. */
+#define SHA256_RNDS4(M, i) \
+    do \
+    { \
+        msg = _mm_add_epi32( \
+            M, _mm_loadu_si128((const __m128i*)(SHA256_K256 + (i)))); \
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg); \
+        msg = _mm_shuffle_epi32(msg, 0x0e); \
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg); \
+    } while (0)
+
+/* finish the schedule for M0 from M3 and M2, and start it for M3 from M0. */
+#define SHA256_SCHEDULE(M0, M1, M2, M3) \
+    do \
+    { \
+        M0 = _mm_add_epi32(M0, _mm_alignr_epi8(M3, M2, 4)); \
+        M0 = _mm_sha256msg2_epu32(M0, M3); \
+        M2 = _mm_sha256msg1_epu32(M2, M3); \
+    } while (0)
+
+/**
+ * Compress num consecutive blocks using the SHA extensions.
+ *
+ * \param h     The hash state to update.
+ * \param in    The blocks to compress.
+ * \param num   The number of 64 byte blocks.
+ */
+SHA256_SHANI_TARGET
+void SHA256_shani_block_data_order(uint32_t h[8], const void* in, size_t num)
+{
+    const uint8_t* data = (const uint8_t*)in;
+    const __m128i bswap =
+        _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i state0, state1, save0, save1, msg, tmp;
+    __m128i m0, m1, m2, m3;
+
+    /* convert the state from ABCD / EFGH into ABEF / CDGH. */
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[0]), 0xb1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[4]), 0x1b);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+
+    while (num--)
+    {
+        save0 = state0;
+        save1 = state1;
+
+        m0 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(data + 0)), bswap);
+        m1 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(data + 16)), bswap);
+        m2 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(data + 32)), bswap);
+        m3 = _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)(data + 48)), bswap);
+
+        /* rounds 0-15 consume the message block directly. */
+        SHA256_RNDS4(m0, 0);
+        SHA256_RNDS4(m1, 4);
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+        SHA256_RNDS4(m2, 8);
+        m1 = _mm_sha256msg1_epu32(m1, m2);
+        SHA256_RNDS4(m3, 12);
+
+        /* rounds 16-63 extend the schedule four words at a time. */
+        SHA256_SCHEDULE(m0, m1, m2, m3);
+        SHA256_RNDS4(m0, 16);
+        SHA256_SCHEDULE(m1, m2, m3, m0);
+        SHA256_RNDS4(m1, 20);
+        SHA256_SCHEDULE(m2, m3, m0, m1);
+        SHA256_RNDS4(m2, 24);
+        SHA256_SCHEDULE(m3, m0, m1, m2);
+        SHA256_RNDS4(m3, 28);
+        SHA256_SCHEDULE(m0, m1, m2, m3);
+        SHA256_RNDS4(m0, 32);
+        SHA256_SCHEDULE(m1, m2, m3, m0);
+        SHA256_RNDS4(m1, 36);
+        SHA256_SCHEDULE(m2, m3, m0, m1);
+        SHA256_RNDS4(m2, 40);
+        SHA256_SCHEDULE(m3, m0, m1, m2);
+        SHA256_RNDS4(m3, 44);
+        SHA256_SCHEDULE(m0, m1, m2, m3);
+        SHA256_RNDS4(m0, 48);
+        SHA256_SCHEDULE(m1, m2, m3, m0);
+        SHA256_RNDS4(m1, 52);
+        SHA256_SCHEDULE(m2, m3, m0, m1);
+        SHA256_RNDS4(m2, 56);
+        SHA256_SCHEDULE(m3, m0, m1, m2);
+        SHA256_RNDS4(m3, 60);
+
+        state0 = _mm_add_epi32(state0, save0);
+        state1 = _mm_add_epi32(state1, save1);
+
+        data += 64;
+    }
+
+    /* convert the state from ABEF / CDGH back into ABCD / EFGH. */
+    tmp = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xf0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+
+    _mm_storeu_si128((__m128i*)&h[0], state0);
+    _mm_storeu_si128((__m128i*)&h[4], state1);
+}
+
+#endif /*SHA256_SHANI_SUPPORTED*/
@@ -12,6 +12,7 @@
 #include <string.h>
 
 #include "sha512.h"
+#include "../../byte_order/byte_order_private.h"
 
 /*
  * By using __asm__ on GCC we avoid the need to compile with gnu11. 
@@ -24,6 +25,8 @@
 
 /* forward decls */
 static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num);
+static void sha512_block_data_order_c(
+    SHA512_CTX* ctx, const void* in, size_t num);
 
 /**
  * Initialize a SHA context for SHA-384 operation.
@@ -323,10 +326,80 @@ void SHA512_256_Update(SHA512_CTX* c, const void* data, size_t len)
     SHA512_Update(c, data, len);
 }
 
+/**
+ * Export the midstate of a SHA-512 family context.
+ *
+ * \param c     The SHA context to export.
+ * \param out   A buffer of at least SHA512_STATE_LENGTH bytes to receive the
+ *              midstate.
+ */
+void SHA512_Export(const SHA512_CTX* c, uint8_t* out)
+{
+    size_t i;
+
+    /* the chaining value, followed by the 128-bit bit count. */
+    for (i = 0; i < 8; ++i)
+    {
+        vccrypt_store_be64(out + 8 * i, c->h[i]);
+    }
+
+    vccrypt_store_be64(out + 64, c->Nh);
+    vccrypt_store_be64(out + 72, c->Nl);
+
+    /* the digest length identifies the algorithm. */
+    out[80] = (uint8_t)c->md_len;
+
+    /* the number of buffered bytes, followed by the partial block. */
+    out[81] = (uint8_t)c->num;
+    memcpy(out + 82, c->u.p, c->num);
+    memset(out + 82 + c->num, 0, sizeof(c->u.p) - c->num);
+}
+
+/**
+ * Import a midstate into a SHA-512 family context.
+ *
+ * The context must already have been initialized for the same algorithm; a
+ * midstate exported by a different member of the family is rejected.
+ *
+ * \param c     The SHA context to update.
+ * \param in    The midstate, as written by SHA512_Export().
+ *
+ * \returns 0 on success and non-zero if the midstate is malformed.
+ */
+int SHA512_Import(SHA512_CTX* c, const uint8_t* in)
+{
+    size_t i;
+    unsigned int num = in[81];
+
+    /* the midstate must come from the same algorithm. */
+    if (in[80] != c->md_len)
+    {
+        return 1;
+    }
+
+    /* a partial block is never a full block. */
+    if (num >= sizeof(c->u.p))
+    {
+        return 1;
+    }
+
+    for (i = 0; i < 8; ++i)
+    {
+        c->h[i] = vccrypt_load_be64(in + 8 * i);
+    }
+
+    c->Nh = vccrypt_load_be64(in + 64);
+    c->Nl = vccrypt_load_be64(in + 72);
+    c->num = num;
+    memcpy(c->u.p, in + 82, num);
+
+    return 0;
+}
+
 /**
  * Constants for the SHA-512 block operation.
  */
-static const uint64_t K512[80] = {
+const uint64_t SHA512_K512[80] = {
     UINT64_C(0x428a2f98d728ae22), UINT64_C(0x7137449123ef65cd),
     UINT64_C(0xb5c0fbcfec4d3b2f), UINT64_C(0xe9b5dba58189dbbc),
     UINT64_C(0x3956c25bf348b538), UINT64_C(0x59f111f1b605d019),
@@ -418,7 +491,8 @@ static const uint64_t K512[80] = {
  * This code should give better results on 32-bit CPU with less than
  * ~24 registers, both size and performance wise...
  */
-static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
+static void sha512_block_data_order_c(
+    SHA512_CTX* ctx, const void* in, size_t num)
 {
     const uint64_t* W = in;
     uint64_t A, E, T;
@@ -443,7 +517,7 @@ static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
             F[0] = A;
             F[4] = E;
             F[8] = T;
-            T += F[7] + Sigma1(E) + Ch(E, F[5], F[6]) + K512[i];
+            T += F[7] + Sigma1(E) + Ch(E, F[5], F[6]) + SHA512_K512[i];
             E = F[3] + T;
             A = T + Sigma0(A) + Maj(A, F[1], F[2]);
         }
@@ -457,7 +531,7 @@ static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
             F[0] = A;
             F[4] = E;
             F[8] = T;
-            T += F[7] + Sigma1(E) + Ch(E, F[5], F[6]) + K512[i];
+            T += F[7] + Sigma1(E) + Ch(E, F[5], F[6]) + SHA512_K512[i];
             E = F[3] + T;
             A = T + Sigma0(A) + Maj(A, F[1], F[2]);
         }
@@ -477,7 +551,8 @@ static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
 
 #elif defined(SMALL_FOOTPRINT)
 
-static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
+static void sha512_block_data_order_c(
+    SHA512_CTX* ctx, const void* in, size_t num)
 {
     const SHA_LONG64* W = in;
     uint64_t a, b, c, d, e, f, g, h, s0, s1, T1, T2;
@@ -498,7 +573,7 @@ static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
         for (i = 0; i < 16; i++)
         {
             T1 = X[i] = PULL64(W[i]);
-            T1 += h + Sigma1(e) + Ch(e, f, g) + K512[i];
+            T1 += h + Sigma1(e) + Ch(e, f, g) + SHA512_K512[i];
             T2 = Sigma0(a) + Maj(a, b, c);
             h = g;
             g = f;
@@ -518,7 +593,7 @@ static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
             s1 = sigma1(s1);
 
             T1 = X[i & 0xf] += s0 + s1 + X[(i + 9) & 0xf];
-            T1 += h + Sigma1(e) + Ch(e, f, g) + K512[i];
+            T1 += h + Sigma1(e) + Ch(e, f, g) + SHA512_K512[i];
             T2 = Sigma0(a) + Maj(a, b, c);
             h = g;
             g = f;
@@ -548,7 +623,7 @@ static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
 #define ROUND_00_15(i, a, b, c, d, e, f, g, h) \
     do \
     { \
-        T1 += h + Sigma1(e) + Ch(e, f, g) + K512[i]; \
+        T1 += h + Sigma1(e) + Ch(e, f, g) + SHA512_K512[i]; \
         h = Sigma0(a) + Maj(a, b, c); \
         d += T1; \
         h += T1; \
@@ -565,7 +640,8 @@ static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
         ROUND_00_15(i + j, a, b, c, d, e, f, g, h); \
     } while (0)
 
-static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
+static void sha512_block_data_order_c(
+    SHA512_CTX* ctx, const void* in, size_t num)
 {
     const uint64_t* W = in;
     uint64_t a, b, c, d, e, f, g, h, s0, s1, T1;
@@ -650,3 +726,24 @@ static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
 }
 
 #endif
+
+/**
+ * Compress num blocks into the hash state, using the fastest implementation
+ * supported by this CPU.
+ *
+ * \param ctx   The SHA context to update.
+ * \param in    The blocks to compress.
+ * \param num   The number of 128 byte blocks.
+ */
+static void sha512_block_data_order(SHA512_CTX* ctx, const void* in, size_t num)
+{
+#ifdef SHA512_AVX2_BMI2_SUPPORTED
+    if (SHA512_avx2_bmi2_available())
+    {
+        SHA512_avx2_bmi2_block_data_order(ctx->h, in, num);
+        return;
+    }
+#endif
+
+    sha512_block_data_order_c(ctx, in, num);
+}
@@ -10,8 +10,14 @@
 #ifndef HASH_REF_SHA512_HEADER_GUARD
 #define HASH_REF_SHA512_HEADER_GUARD
 
+#include <stddef.h>
 #include <stdint.h>
 
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
 /**
  * Context data structure for SHA-512 and SHA-384.
  */
@@ -114,4 +120,105 @@ void SHA512_256_Update(SHA512_CTX* c, const void* _data, size_t len);
  */
 int SHA512_256_Final(SHA512_CTX* c, uint8_t* md);
 
+/**
+ * The size of an exported SHA-512 family midstate: the chaining value, the
+ * 128-bit message bit count, the digest length, the number of buffered bytes,
+ * and the partial block, all in big-endian byte order.
+ */
+#define SHA512_STATE_LENGTH 210
+
+/**
+ * Export the midstate of a SHA-512 family context.
+ *
+ * \param c     The SHA context to export.
+ * \param out   A buffer of at least SHA512_STATE_LENGTH bytes to receive the
+ *              midstate.
+ */
+void SHA512_Export(const SHA512_CTX* c, uint8_t* out);
+
+/**
+ * Import a midstate into a SHA-512 family context.
+ *
+ * The context must already have been initialized for the same algorithm; a
+ * midstate exported by a different member of the family is rejected.
+ *
+ * \param c     The SHA context to update.
+ * \param in    The midstate, as written by SHA512_Export().
+ *
+ * \returns 0 on success and non-zero if the midstate is malformed.
+ */
+int SHA512_Import(SHA512_CTX* c, const uint8_t* in);
+
+/**
+ * The SHA-512 round constants.
+ */
+extern const uint64_t SHA512_K512[80];
+
+/**
+ * The maximum number of messages compressed at once by the multi-buffer
+ * kernels.
+ */
+#define SHA512_MAX_LANES 4
+
+/* SSE2 and AVX2 kernels are available on x86 GCC / Clang. */
+#if (defined(__x86_64__) || defined(__i386__)) \
+ && (defined(__GNUC__) || defined(__clang__))
+#define SHA512_X86_SIMD_SUPPORTED
+#endif
+
+#ifdef SHA512_X86_SIMD_SUPPORTED
+/**
+ * Return non-zero if this CPU and operating system support AVX2.
+ */
+int SHA512_avx2_available(void);
+
+/**
+ * Compress one block for each of four independent messages using AVX2.
+ *
+ * \param state     The lane-interleaved hash state; state[i][l] is word i of
+ *                  lane l.
+ * \param blocks    One 128 byte block per lane.
+ */
+void SHA512_x4_avx2(
+    uint64_t state[8][SHA512_MAX_LANES], const uint8_t* const* blocks);
+
+/**
+ * Compress one block for each of two independent messages using SSE2.
+ *
+ * \param state     The lane-interleaved hash state; only lanes 0 and 1 are
+ *                  used.
+ * \param blocks    One 128 byte block per lane.
+ */
+void SHA512_x2_sse2(
+    uint64_t state[8][SHA512_MAX_LANES], const uint8_t* const* blocks);
+
+/* the single stream AVX2 / BMI2 kernel needs 64-bit general registers. */
+#if defined(__x86_64__)
+#define SHA512_AVX2_BMI2_SUPPORTED
+#endif
+#endif /*SHA512_X86_SIMD_SUPPORTED*/
+
+#ifdef SHA512_AVX2_BMI2_SUPPORTED
+/**
+ * Return non-zero if this CPU and operating system support AVX2 and BMI2.
+ */
+int SHA512_avx2_bmi2_available(void);
+
+/**
+ * Compress num consecutive blocks of a single message using an AVX2 message
+ * schedule and BMI2 rotates.
+ *
+ * \param h     The hash state to update.
+ * \param in    The blocks to compress.
+ * \param num   The number of 128 byte blocks.
+ */
+void SHA512_avx2_bmi2_block_data_order(
+    uint64_t h[8], const void* in, size_t num);
+#endif /*SHA512_AVX2_BMI2_SUPPORTED*/
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
 #endif  //HASH_REF_SHA512_HEADER_GUARD
@@ -0,0 +1,191 @@
+/**
+ * \file hash/ref/sha512_avx2.c
+ *
+ * Four lane multi-buffer SHA-512 compression using AVX2, and the CPU feature
+ * checks for the AVX2 kernels.
+ *
+ * Each 64-bit lane of a 256-bit register holds the corresponding word of an
+ * independent message, so four messages are compressed for roughly the cost
+ * of one.  Message words are byte swapped and transposed into this layout as
+ * the block is loaded.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "sha512.h"
+
+#ifdef SHA512_X86_SIMD_SUPPORTED
+
+#include <immintrin.h>
+
+#include "../../cpu/cpu_private.h"
+
+#define SHA512_AVX2_TARGET __attribute__((target("avx2")))
+
+/**
+ * Return non-zero if this CPU and operating system support AVX2.
+ */
+int SHA512_avx2_available(void)
+{
+    return vccrypt_cpu_has(VCCRYPT_CPU_AVX2);
+}
+
+#ifdef SHA512_AVX2_BMI2_SUPPORTED
+/**
+ * Return non-zero if this CPU and operating system support AVX2 and BMI2.
+ */
+int SHA512_avx2_bmi2_available(void)
+{
+    return vccrypt_cpu_has(VCCRYPT_CPU_AVX2 | VCCRYPT_CPU_BMI2);
+}
+#endif /*SHA512_AVX2_BMI2_SUPPORTED*/
+
+#define ROTR4(x, n) \
+    _mm256_or_si256( \
+        _mm256_srli_epi64((x), (n)), _mm256_slli_epi64((x), 64 - (n)))
+#define SIGMA0_4(x) \
+    _mm256_xor_si256( \
+        _mm256_xor_si256(ROTR4((x), 28), ROTR4((x), 34)), ROTR4((x), 39))
+#define SIGMA1_4(x) \
+    _mm256_xor_si256( \
+        _mm256_xor_si256(ROTR4((x), 14), ROTR4((x), 18)), ROTR4((x), 41))
+#define sigma0_4(x) \
+    _mm256_xor_si256( \
+        _mm256_xor_si256(ROTR4((x), 1), ROTR4((x), 8)), \
+        _mm256_srli_epi64((x), 7))
+#define sigma1_4(x) \
+    _mm256_xor_si256( \
+        _mm256_xor_si256(ROTR4((x), 19), ROTR4((x), 61)), \
+        _mm256_srli_epi64((x), 6))
+#define CH_4(x, y, z) \
+    _mm256_xor_si256(_mm256_and_si256((x), (y)), _mm256_andnot_si256((x), (z)))
+#define MAJ_4(x, y, z) \
+    _mm256_or_si256( \
+        _mm256_and_si256((x), (y)), \
+        _mm256_and_si256((z), _mm256_or_si256((x), (y))))
+
+/*
+ * One round, with the working variables renamed rather than moved.  The
+ * message schedule is extended in place from round 16 on.
+ */
+#define SHA512_ROUND_4(i, a, b, c, d, e, f, g, h) \
+    do \
+    { \
+        if ((i) >= 16) \
+        { \
+            W[(i) & 15] = \
+                _mm256_add_epi64( \
+                    _mm256_add_epi64( \
+                        sigma1_4(W[((i) - 2) & 15]), W[((i) - 7) & 15]), \
+                    _mm256_add_epi64( \
+                        sigma0_4(W[((i) - 15) & 15]), W[(i) & 15])); \
+        } \
+        \
+        T1 = \
+            _mm256_add_epi64( \
+                _mm256_add_epi64( \
+                    _mm256_add_epi64(h, SIGMA1_4(e)), CH_4(e, f, g)), \
+                _mm256_add_epi64( \
+                    _mm256_set1_epi64x((long long)SHA512_K512[i]), \
+                    W[(i) & 15])); \
+        d = _mm256_add_epi64(d, T1); \
+        h = \
+            _mm256_add_epi64( \
+                T1, _mm256_add_epi64(SIGMA0_4(a), MAJ_4(a, b, c))); \
+    } while (0)
+
+/**
+ * Compress one block for each of four independent messages using AVX2.
+ *
+ * \param state     The lane-interleaved hash state; state[i][l] is word i of
+ *                  lane l.
+ * \param blocks    One 128 byte block per lane.
+ */
+void SHA512_AVX2_TARGET SHA512_x4_avx2(
+    uint64_t state[8][SHA512_MAX_LANES], const uint8_t* const* blocks)
+{
+    /* reverse the bytes of each 64-bit word. */
+    const __m256i bswap =
+        _mm256_set_epi8(
+            8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7,
+            8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i W[16];
+    __m256i a, b, c, d, e, f, g, h, T1;
+    __m256i r0, r1, r2, r3, t0, t1, t2, t3;
+    int i;
+
+    /* load and transpose the message words, four at a time. */
+    for (i = 0; i < 16; i += 4)
+    {
+        r0 = _mm256_shuffle_epi8(
+                _mm256_loadu_si256((const __m256i*)(blocks[0] + 8 * i)),
+                bswap);
+        r1 = _mm256_shuffle_epi8(
+                _mm256_loadu_si256((const __m256i*)(blocks[1] + 8 * i)),
+                bswap);
+        r2 = _mm256_shuffle_epi8(
+                _mm256_loadu_si256((const __m256i*)(blocks[2] + 8 * i)),
+                bswap);
+        r3 = _mm256_shuffle_epi8(
+                _mm256_loadu_si256((const __m256i*)(blocks[3] + 8 * i)),
+                bswap);
+
+        t0 = _mm256_unpacklo_epi64(r0, r1);
+        t1 = _mm256_unpackhi_epi64(r0, r1);
+        t2 = _mm256_unpacklo_epi64(r2, r3);
+        t3 = _mm256_unpackhi_epi64(r2, r3);
+
+        W[i + 0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+        W[i + 1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+        W[i + 2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+        W[i + 3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+    }
+
+    a = _mm256_loadu_si256((const __m256i*)state[0]);
+    b = _mm256_loadu_si256((const __m256i*)state[1]);
+    c = _mm256_loadu_si256((const __m256i*)state[2]);
+    d = _mm256_loadu_si256((const __m256i*)state[3]);
+    e = _mm256_loadu_si256((const __m256i*)state[4]);
+    f = _mm256_loadu_si256((const __m256i*)state[5]);
+    g = _mm256_loadu_si256((const __m256i*)state[6]);
+    h = _mm256_loadu_si256((const __m256i*)state[7]);
+
+    for (i = 0; i < 80; i += 8)
+    {
+        SHA512_ROUND_4(i + 0, a, b, c, d, e, f, g, h);
+        SHA512_ROUND_4(i + 1, h, a, b, c, d, e, f, g);
+        SHA512_ROUND_4(i + 2, g, h, a, b, c, d, e, f);
+        SHA512_ROUND_4(i + 3, f, g, h, a, b, c, d, e);
+        SHA512_ROUND_4(i + 4, e, f, g, h, a, b, c, d);
+        SHA512_ROUND_4(i + 5, d, e, f, g, h, a, b, c);
+        SHA512_ROUND_4(i + 6, c, d, e, f, g, h, a, b);
+        SHA512_ROUND_4(i + 7, b, c, d, e, f, g, h, a);
+    }
+
+    _mm256_storeu_si256(
+        (__m256i*)state[0],
+        _mm256_add_epi64(a, _mm256_loadu_si256((const __m256i*)state[0])));
+    _mm256_storeu_si256(
+        (__m256i*)state[1],
+        _mm256_add_epi64(b, _mm256_loadu_si256((const __m256i*)state[1])));
+    _mm256_storeu_si256(
+        (__m256i*)state[2],
+        _mm256_add_epi64(c, _mm256_loadu_si256((const __m256i*)state[2])));
+    _mm256_storeu_si256(
+        (__m256i*)state[3],
+        _mm256_add_epi64(d, _mm256_loadu_si256((const __m256i*)state[3])));
+    _mm256_storeu_si256(
+        (__m256i*)state[4],
+        _mm256_add_epi64(e, _mm256_loadu_si256((const __m256i*)state[4])));
+    _mm256_storeu_si256(
+        (__m256i*)state[5],
+        _mm256_add_epi64(f, _mm256_loadu_si256((const __m256i*)state[5])));
+    _mm256_storeu_si256(
+        (__m256i*)state[6],
+        _mm256_add_epi64(g, _mm256_loadu_si256((const __m256i*)state[6])));
+    _mm256_storeu_si256(
+        (__m256i*)state[7],
+        _mm256_add_epi64(h, _mm256_loadu_si256((const __m256i*)state[7])));
+}
+
+#endif /*SHA512_X86_SIMD_SUPPORTED*/
@@ -0,0 +1,184 @@
+/**
+ * \file hash/ref/sha512_avx2_bmi2.c
+ *
+ * Single stream SHA-512 compression using an AVX2 message schedule and BMI2
+ * rotates.
+ *
+ * The message schedule for each block is expanded four words at a time in
+ * 256-bit registers, with the round constants folded in, a few rounds ahead
+ * of where it is needed.  Because W[t] depends on W[t - 2], each group of four
+ * words is finished in two halves.  The rounds themselves stay in general
+ * registers, where BMI2 provides the non-destructive RORX rotate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "sha512.h"
+
+#ifdef SHA512_AVX2_BMI2_SUPPORTED
+
+#include <immintrin.h>
+
+#define SHA512_AVX2_BMI2_TARGET __attribute__((target("avx2,bmi2")))
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+#define Sigma0(x) (ROTR((x), 28) ^ ROTR((x), 34) ^ ROTR((x), 39))
+#define Sigma1(x) (ROTR((x), 14) ^ ROTR((x), 18) ^ ROTR((x), 41))
+#define Ch(x, y, z) (((x) & (y)) ^ ((~(x)) & (z)))
+#define Maj(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+
+#define ROTR4(x, n) \
+    _mm256_or_si256( \
+        _mm256_srli_epi64((x), (n)), _mm256_slli_epi64((x), 64 - (n)))
+#define sigma0_4(x) \
+    _mm256_xor_si256( \
+        _mm256_xor_si256(ROTR4((x), 1), ROTR4((x), 8)), \
+        _mm256_srli_epi64((x), 7))
+#define sigma1_4(x) \
+    _mm256_xor_si256( \
+        _mm256_xor_si256(ROTR4((x), 19), ROTR4((x), 61)), \
+        _mm256_srli_epi64((x), 6))
+
+/*
+ * Return words 1..4 of the eight consecutive words held in lo and hi.
+ */
+#define SHIFT_WORDS_1(lo, hi) \
+    _mm256_permute4x64_epi64(_mm256_blend_epi32((lo), (hi), 0x03), 0x39)
+
+/*
+ * Expand schedule words W[t] .. W[t + 3] from X0..X3, which hold W[t - 16]
+ * .. W[t - 1], and store them with their round constants.  The low half
+ * depends on W[t - 2] and W[t - 1]; the high half depends on the low half.
+ */
+#define SHA512_SCHEDULE_4(t) \
+    do \
+    { \
+        s = _mm256_add_epi64( \
+                _mm256_add_epi64(X0, sigma0_4(SHIFT_WORDS_1(X0, X1))), \
+                SHIFT_WORDS_1(X2, X3)); \
+        lo = _mm256_add_epi64( \
+                s, sigma1_4(_mm256_permute4x64_epi64(X3, 0xee))); \
+        s = _mm256_blend_epi32( \
+                lo, \
+                _mm256_add_epi64( \
+                    s, sigma1_4(_mm256_permute4x64_epi64(lo, 0x44))), \
+                0xf0); \
+        \
+        X0 = X1; \
+        X1 = X2; \
+        X2 = X3; \
+        X3 = s; \
+        \
+        _mm256_storeu_si256( \
+            (__m256i*)(wk + (t)), \
+            _mm256_add_epi64(s, _mm256_loadu_si256(K + (t) / 4))); \
+    } while (0)
+
+/*
+ * One round, with the working variables renamed rather than moved.  wk holds
+ * the precomputed W[i] + K[i].
+ */
+#define SHA512_ROUND(i, a, b, c, d, e, f, g, h) \
+    do \
+    { \
+        T1 = h + Sigma1(e) + Ch(e, f, g) + wk[i]; \
+        d += T1; \
+        h = T1 + Sigma0(a) + Maj(a, b, c); \
+    } while (0)
+
+/**
+ * Compress num consecutive blocks of a single message using an AVX2 message
+ * schedule and BMI2 rotates.
+ *
+ * \param h     The hash state to update.
+ * \param in    The blocks to compress.
+ * \param num   The number of 128 byte blocks.
+ */
+void SHA512_AVX2_BMI2_TARGET SHA512_avx2_bmi2_block_data_order(
+    uint64_t h[8], const void* in, size_t num)
+{
+    /* reverse the bytes of each 64-bit word. */
+    const __m256i bswap =
+        _mm256_set_epi8(
+            8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7,
+            8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+    const uint8_t* data = (const uint8_t*)in;
+    uint64_t wk[80];
+    __m256i X0, X1, X2, X3, s, lo;
+    uint64_t A, B, C, D, E, F, G, H, T1;
+    int i;
+
+    while (num--)
+    {
+        const __m256i* K = (const __m256i*)SHA512_K512;
+
+        X0 = _mm256_shuffle_epi8(
+                _mm256_loadu_si256((const __m256i*)(data + 0)), bswap);
+        X1 = _mm256_shuffle_epi8(
+                _mm256_loadu_si256((const __m256i*)(data + 32)), bswap);
+        X2 = _mm256_shuffle_epi8(
+                _mm256_loadu_si256((const __m256i*)(data + 64)), bswap);
+        X3 = _mm256_shuffle_epi8(
+                _mm256_loadu_si256((const __m256i*)(data + 96)), bswap);
+
+        _mm256_storeu_si256(
+            (__m256i*)(wk + 0),
+            _mm256_add_epi64(X0, _mm256_loadu_si256(K + 0)));
+        _mm256_storeu_si256(
+            (__m256i*)(wk + 4),
+            _mm256_add_epi64(X1, _mm256_loadu_si256(K + 1)));
+        _mm256_storeu_si256(
+            (__m256i*)(wk + 8),
+            _mm256_add_epi64(X2, _mm256_loadu_si256(K + 2)));
+        _mm256_storeu_si256(
+            (__m256i*)(wk + 12),
+            _mm256_add_epi64(X3, _mm256_loadu_si256(K + 3)));
+
+        A = h[0];
+        B = h[1];
+        C = h[2];
+        D = h[3];
+        E = h[4];
+        F = h[5];
+        G = h[6];
+        H = h[7];
+
+        /* expand the next eight schedule words while running eight rounds,
+         * so that the vector and scalar work overlap. */
+        for (i = 0; i < 80; i += 8)
+        {
+            if (i < 64)
+            {
+                SHA512_SCHEDULE_4(i + 16);
+                SHA512_SCHEDULE_4(i + 20);
+            }
+
+            SHA512_ROUND(i + 0, A, B, C, D, E, F, G, H);
+            SHA512_ROUND(i + 1, H, A, B, C, D, E, F, G);
+            SHA512_ROUND(i + 2, G, H, A, B, C, D, E, F);
+            SHA512_ROUND(i + 3, F, G, H, A, B, C, D, E);
+            SHA512_ROUND(i + 4, E, F, G, H, A, B, C, D);
+            SHA512_ROUND(i + 5, D, E, F, G, H, A, B, C);
+            SHA512_ROUND(i + 6, C, D, E, F, G, H, A, B);
+            SHA512_ROUND(i + 7, B, C, D, E, F, G, H, A);
+        }
+
+        h[0] += A;
+        h[1] += B;
+        h[2] += C;
+        h[3] += D;
+        h[4] += E;
+        h[5] += F;
+        h[6] += G;
+        h[7] += H;
+
+        data += 128;
+    }
+
+    /* the schedule is derived from the message; don't leave it behind. */
+    memset(wk, 0, sizeof(wk));
+}
+
+#endif /*SHA512_AVX2_BMI2_SUPPORTED*/
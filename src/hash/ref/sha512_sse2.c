@@ -0,0 +1,150 @@
+/**
+ * \file hash/ref/sha512_sse2.c
+ *
+ * Two lane multi-buffer SHA-512 compression using SSE2.
+ *
+ * This is the fallback for the AVX2 kernel on CPUs without AVX2.  Each 64-bit
+ * lane of a 128-bit register holds the corresponding word of an independent
+ * message.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "sha512.h"
+
+#ifdef SHA512_X86_SIMD_SUPPORTED
+
+#include <emmintrin.h>
+
+#define SHA512_SSE2_TARGET __attribute__((target("sse2")))
+
+#define ROTR2(x, n) \
+    _mm_or_si128(_mm_srli_epi64((x), (n)), _mm_slli_epi64((x), 64 - (n)))
+#define SIGMA0_2(x) \
+    _mm_xor_si128(_mm_xor_si128(ROTR2((x), 28), ROTR2((x), 34)), ROTR2((x), 39))
+#define SIGMA1_2(x) \
+    _mm_xor_si128(_mm_xor_si128(ROTR2((x), 14), ROTR2((x), 18)), ROTR2((x), 41))
+#define sigma0_2(x) \
+    _mm_xor_si128( \
+        _mm_xor_si128(ROTR2((x), 1), ROTR2((x), 8)), _mm_srli_epi64((x), 7))
+#define sigma1_2(x) \
+    _mm_xor_si128( \
+        _mm_xor_si128(ROTR2((x), 19), ROTR2((x), 61)), _mm_srli_epi64((x), 6))
+#define CH_2(x, y, z) \
+    _mm_xor_si128(_mm_and_si128((x), (y)), _mm_andnot_si128((x), (z)))
+#define MAJ_2(x, y, z) \
+    _mm_or_si128( \
+        _mm_and_si128((x), (y)), _mm_and_si128((z), _mm_or_si128((x), (y))))
+
+/*
+ * One round, with the working variables renamed rather than moved.  The
+ * message schedule is extended in place from round 16 on.
+ */
+#define SHA512_ROUND_2(i, a, b, c, d, e, f, g, h) \
+    do \
+    { \
+        if ((i) >= 16) \
+        { \
+            W[(i) & 15] = \
+                _mm_add_epi64( \
+                    _mm_add_epi64( \
+                        sigma1_2(W[((i) - 2) & 15]), W[((i) - 7) & 15]), \
+                    _mm_add_epi64( \
+                        sigma0_2(W[((i) - 15) & 15]), W[(i) & 15])); \
+        } \
+        \
+        T1 = \
+            _mm_add_epi64( \
+                _mm_add_epi64(_mm_add_epi64(h, SIGMA1_2(e)), CH_2(e, f, g)), \
+                _mm_add_epi64( \
+                    _mm_set1_epi64x((long long)SHA512_K512[i]), \
+                    W[(i) & 15])); \
+        d = _mm_add_epi64(d, T1); \
+        h = _mm_add_epi64(T1, _mm_add_epi64(SIGMA0_2(a), MAJ_2(a, b, c))); \
+    } while (0)
+
+/**
+ * Reverse the bytes of each 64-bit word without SSSE3.
+ */
+static inline __m128i SHA512_SSE2_TARGET sha512_sse2_bswap(__m128i x)
+{
+    x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0x1b), 0x1b);
+
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+
+/**
+ * Compress one block for each of two independent messages using SSE2.
+ *
+ * \param state     The lane-interleaved hash state; only lanes 0 and 1 are
+ *                  used.
+ * \param blocks    One 128 byte block per lane.
+ */
+void SHA512_SSE2_TARGET SHA512_x2_sse2(
+    uint64_t state[8][SHA512_MAX_LANES], const uint8_t* const* blocks)
+{
+    __m128i W[16];
+    __m128i a, b, c, d, e, f, g, h, T1;
+    __m128i r0, r1;
+    int i;
+
+    /* load and transpose the message words, two at a time. */
+    for (i = 0; i < 16; i += 2)
+    {
+        r0 = sha512_sse2_bswap(
+                _mm_loadu_si128((const __m128i*)(blocks[0] + 8 * i)));
+        r1 = sha512_sse2_bswap(
+                _mm_loadu_si128((const __m128i*)(blocks[1] + 8 * i)));
+
+        W[i + 0] = _mm_unpacklo_epi64(r0, r1);
+        W[i + 1] = _mm_unpackhi_epi64(r0, r1);
+    }
+
+    a = _mm_loadu_si128((const __m128i*)state[0]);
+    b = _mm_loadu_si128((const __m128i*)state[1]);
+    c = _mm_loadu_si128((const __m128i*)state[2]);
+    d = _mm_loadu_si128((const __m128i*)state[3]);
+    e = _mm_loadu_si128((const __m128i*)state[4]);
+    f = _mm_loadu_si128((const __m128i*)state[5]);
+    g = _mm_loadu_si128((const __m128i*)state[6]);
+    h = _mm_loadu_si128((const __m128i*)state[7]);
+
+    for (i = 0; i < 80; i += 8)
+    {
+        SHA512_ROUND_2(i + 0, a, b, c, d, e, f, g, h);
+        SHA512_ROUND_2(i + 1, h, a, b, c, d, e, f, g);
+        SHA512_ROUND_2(i + 2, g, h, a, b, c, d, e, f);
+        SHA512_ROUND_2(i + 3, f, g, h, a, b, c, d, e);
+        SHA512_ROUND_2(i + 4, e, f, g, h, a, b, c, d);
+        SHA512_ROUND_2(i + 5, d, e, f, g, h, a, b, c);
+        SHA512_ROUND_2(i + 6, c, d, e, f, g, h, a, b);
+        SHA512_ROUND_2(i + 7, b, c, d, e, f, g, h, a);
+    }
+
+    _mm_storeu_si128(
+        (__m128i*)state[0],
+        _mm_add_epi64(a, _mm_loadu_si128((const __m128i*)state[0])));
+    _mm_storeu_si128(
+        (__m128i*)state[1],
+        _mm_add_epi64(b, _mm_loadu_si128((const __m128i*)state[1])));
+    _mm_storeu_si128(
+        (__m128i*)state[2],
+        _mm_add_epi64(c, _mm_loadu_si128((const __m128i*)state[2])));
+    _mm_storeu_si128(
+        (__m128i*)state[3],
+        _mm_add_epi64(d, _mm_loadu_si128((const __m128i*)state[3])));
+    _mm_storeu_si128(
+        (__m128i*)state[4],
+        _mm_add_epi64(e, _mm_loadu_si128((const __m128i*)state[4])));
+    _mm_storeu_si128(
+        (__m128i*)state[5],
+        _mm_add_epi64(f, _mm_loadu_si128((const __m128i*)state[5])));
+    _mm_storeu_si128(
+        (__m128i*)state[6],
+        _mm_add_epi64(g, _mm_loadu_si128((const __m128i*)state[6])));
+    _mm_storeu_si128(
+        (__m128i*)state[7],
+        _mm_add_epi64(h, _mm_loadu_si128((const __m128i*)state[7])));
+}
+
+#endif /*SHA512_X86_SIMD_SUPPORTED*/
@@ -0,0 +1,92 @@
+/**
+ * \file vccrypt_hash_clone.c
+ *
+ * Initialize a hash context structure as a copy of another.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Initialize a hash algorithm instance as a copy of another.
+ *
+ * The new instance uses the same options as the source instance, and
+ * continues from the data digested into the source instance so far.  Both
+ * instances can then be digested and finalized independently.  This allows a
+ * common prefix to be hashed once and then forked for each message.
+ *
+ * If cloning is successful, then the new instance is owned by the caller and
+ * must be disposed by calling dispose() when no longer needed.
+ *
+ * \param dst           The hash instance to initialize.
+ * \param src           The hash instance to copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_CLONE_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - \ref VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED if the algorithm does not
+ *             support midstate export and import.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_hash_clone(vccrypt_hash_context_t* dst, vccrypt_hash_context_t* src)
+{
+    int retval;
+    vccrypt_hash_options_t* options;
+    uint8_t state[VCCRYPT_HASH_MAX_STATE_SIZE];
+
+    MODEL_ASSERT(NULL != dst);
+    MODEL_ASSERT(NULL != src);
+    MODEL_ASSERT(NULL != src->options);
+    MODEL_ASSERT(dst != src);
+
+    /* sanity check of parameters */
+    if (NULL == dst || NULL == src || NULL == src->options || dst == src)
+    {
+        return VCCRYPT_ERROR_HASH_CLONE_INVALID_ARG;
+    }
+
+    options = src->options;
+
+    /* the midstate is carried across on the stack. */
+    if (0 == options->hash_state_size
+     || options->hash_state_size > sizeof(state)
+     || NULL == options->vccrypt_hash_alg_export_state
+     || NULL == options->vccrypt_hash_alg_import_state)
+    {
+        return VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED;
+    }
+
+    /* capture the source midstate. */
+    retval = options->vccrypt_hash_alg_export_state(src, state);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_state;
+    }
+
+    /* create the new instance. */
+    retval = vccrypt_hash_init(options, dst);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_state;
+    }
+
+    /* continue the new instance from the source midstate. */
+    retval = options->vccrypt_hash_alg_import_state(dst, state);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        dispose((disposable_t*)dst);
+        goto cleanup_state;
+    }
+
+    retval = VCCRYPT_STATUS_SUCCESS;
+
+cleanup_state:
+    memset(state, 0, sizeof(state));
+
+    return retval;
+}
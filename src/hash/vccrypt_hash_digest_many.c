@@ -0,0 +1,135 @@
+/**
+ * \file vccrypt_hash_digest_many.c
+ *
+ * Hash many independent messages in a single call.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/parameters.h>
+
+/* forward decls */
+static int vccrypt_hash_digest_many_serial(
+    vccrypt_hash_options_t* options, vccrypt_hash_job_t* jobs, size_t count);
+
+/**
+ * \brief Hash many independent messages in a single call.
+ *
+ * Each job is hashed exactly as if a new hash instance were initialized with
+ * these options, given the job's message, and finalized into the job's digest
+ * buffer.  Algorithms that support it hash several messages at once in SIMD
+ * lanes, which greatly improves aggregate throughput for batches of short
+ * messages.
+ *
+ * \param options       The options for the hash algorithm to use.
+ * \param jobs          The jobs to hash.
+ * \param count         The number of jobs.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_DIGEST_MANY_INVALID_ARG if an invalid argument
+ *             or job is provided.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_hash_digest_many(
+    vccrypt_hash_options_t* options, vccrypt_hash_job_t* jobs, size_t count)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != jobs || 0 == count);
+
+    /* sanity check of parameters */
+    if (NULL == options || (NULL == jobs && count > 0))
+    {
+        return VCCRYPT_ERROR_HASH_DIGEST_MANY_INVALID_ARG;
+    }
+
+    /* validate every job before hashing any of them. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (NULL == jobs[i].digest
+         || (NULL == jobs[i].data && jobs[i].size > 0))
+        {
+            return VCCRYPT_ERROR_HASH_DIGEST_MANY_INVALID_ARG;
+        }
+    }
+
+    /* use the algorithm's batch method if it has one. */
+    if (NULL != options->vccrypt_hash_alg_digest_many)
+    {
+        return options->vccrypt_hash_alg_digest_many(options, jobs, count);
+    }
+
+    return vccrypt_hash_digest_many_serial(options, jobs, count);
+}
+
+/**
+ * \brief Hash each job in turn using a new hash instance.
+ *
+ * \param options       The options for the hash algorithm to use.
+ * \param jobs          The jobs to hash.
+ * \param count         The number of jobs.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static int vccrypt_hash_digest_many_serial(
+    vccrypt_hash_options_t* options, vccrypt_hash_job_t* jobs, size_t count)
+{
+    int retval;
+    vccrypt_hash_context_t ctx;
+    vccrypt_buffer_t hash;
+
+    if (0 == count)
+    {
+        return VCCRYPT_STATUS_SUCCESS;
+    }
+
+    retval =
+        vccrypt_buffer_init(&hash, options->alloc_opts, options->hash_size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        retval = vccrypt_hash_init(options, &ctx);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto dispose_hash;
+        }
+
+        if (jobs[i].size > 0)
+        {
+            retval = vccrypt_hash_digest(&ctx, jobs[i].data, jobs[i].size);
+            if (VCCRYPT_STATUS_SUCCESS != retval)
+            {
+                goto dispose_ctx;
+            }
+        }
+
+        retval = vccrypt_hash_finalize(&ctx, &hash);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto dispose_ctx;
+        }
+
+        memcpy(jobs[i].digest, hash.data, options->hash_size);
+        dispose((disposable_t*)&ctx);
+    }
+
+    retval = VCCRYPT_STATUS_SUCCESS;
+    goto dispose_hash;
+
+dispose_ctx:
+    dispose((disposable_t*)&ctx);
+
+dispose_hash:
+    dispose((disposable_t*)&hash);
+
+    return retval;
+}
@@ -0,0 +1,62 @@
+/**
+ * \file vccrypt_hash_export_state.c
+ *
+ * Export the midstate of a hash instance.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/hash.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Export the midstate of a hash instance.
+ *
+ * The midstate captures everything digested so far, and can later be imported
+ * into any instance of the same algorithm to continue from this point.  The
+ * hash instance itself is not modified.
+ *
+ * \param context       The hash instance.
+ * \param state_buffer  The buffer to receive the midstate.  Must be at least
+ *                      hash_state_size bytes in length.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_EXPORT_STATE_INVALID_ARG if an invalid
+ *             argument is provided.
+ *      - \ref VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED if the algorithm does not
+ *             support midstate export and import.
+ */
+int vccrypt_hash_export_state(
+    vccrypt_hash_context_t* context, vccrypt_buffer_t* state_buffer)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != state_buffer);
+    MODEL_ASSERT(NULL != state_buffer->data);
+
+    /* sanity check of parameters */
+    if (NULL == context || NULL == context->options || NULL == state_buffer
+     || NULL == state_buffer->data)
+    {
+        return VCCRYPT_ERROR_HASH_EXPORT_STATE_INVALID_ARG;
+    }
+
+    /* the algorithm must support midstate export. */
+    if (0 == context->options->hash_state_size
+     || NULL == context->options->vccrypt_hash_alg_export_state)
+    {
+        return VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED;
+    }
+
+    /* the buffer must be large enough for the midstate. */
+    if (state_buffer->size < context->options->hash_state_size)
+    {
+        return VCCRYPT_ERROR_HASH_EXPORT_STATE_INVALID_ARG;
+    }
+
+    return
+        context->options->vccrypt_hash_alg_export_state(
+            context, (uint8_t*)state_buffer->data);
+}
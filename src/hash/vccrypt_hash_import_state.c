@@ -0,0 +1,61 @@
+/**
+ * \file vccrypt_hash_import_state.c
+ *
+ * Replace the state of a hash instance with an exported midstate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/hash.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Replace the state of a hash instance with an exported midstate.
+ *
+ * The midstate must have been exported from an instance of the same
+ * algorithm.
+ *
+ * \param context       The hash instance.
+ * \param state_buffer  The midstate to import.  Must be at least
+ *                      hash_state_size bytes in length.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG if an invalid
+ *             argument or a malformed midstate is provided.
+ *      - \ref VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED if the algorithm does not
+ *             support midstate export and import.
+ */
+int vccrypt_hash_import_state(
+    vccrypt_hash_context_t* context, const vccrypt_buffer_t* state_buffer)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != state_buffer);
+    MODEL_ASSERT(NULL != state_buffer->data);
+
+    /* sanity check of parameters */
+    if (NULL == context || NULL == context->options || NULL == state_buffer
+     || NULL == state_buffer->data)
+    {
+        return VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG;
+    }
+
+    /* the algorithm must support midstate import. */
+    if (0 == context->options->hash_state_size
+     || NULL == context->options->vccrypt_hash_alg_import_state)
+    {
+        return VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED;
+    }
+
+    /* the buffer must hold a complete midstate. */
+    if (state_buffer->size < context->options->hash_state_size)
+    {
+        return VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG;
+    }
+
+    return
+        context->options->vccrypt_hash_alg_import_state(
+            context, (const uint8_t*)state_buffer->data);
+}
@@ -7,11 +7,15 @@
  */
 
 #include <cbmc/model_assert.h>
+#include <stdbool.h>
 #include <string.h>
 #include <vccrypt/hash.h>
 #include <vpr/parameters.h>
 
 /* forward decls */
+static int vccrypt_hash_init_common(
+    vccrypt_hash_options_t* options, vccrypt_hash_context_t* context,
+    bool embedded);
 static void vccrypt_hash_dispose(void* context);
 
 /**
@@ -32,6 +36,53 @@ static void vccrypt_hash_dispose(void* context);
  */
 int vccrypt_hash_init(
     vccrypt_hash_options_t* options, vccrypt_hash_context_t* context)
+{
+    return vccrypt_hash_init_common(options, context, false);
+}
+
+/**
+ * \brief Initialize a hash algorithm instance with the given options, keeping
+ * the hash state inside the context structure rather than allocating it.
+ *
+ * This behaves like vccrypt_hash_init(), but avoids an allocation and release
+ * per instance for algorithms that support it.  Other algorithms silently
+ * fall back to allocating their state.  Because the instance refers to its
+ * own storage, the context structure must not be moved or copied until it
+ * has been disposed.
+ *
+ * If initialization is successful, then this hash algorithm instance is owned
+ * by the caller and must be disposed by calling dispose() when no longer
+ * needed.
+ *
+ * \param options       The options to use for this algorithm instance.
+ * \param context       The hash instance to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_INIT_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_hash_init_embedded(
+    vccrypt_hash_options_t* options, vccrypt_hash_context_t* context)
+{
+    return vccrypt_hash_init_common(options, context, true);
+}
+
+/**
+ * \brief Initialize a hash algorithm instance, optionally embedding the hash
+ * state in the context structure.
+ *
+ * \param options       The options to use for this algorithm instance.
+ * \param context       The hash instance to initialize.
+ * \param embedded      Set to true to embed the hash state if the algorithm
+ *                      supports it.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccrypt_hash_init_common(
+    vccrypt_hash_options_t* options, vccrypt_hash_context_t* context,
+    bool embedded)
 {
     MODEL_ASSERT(options != NULL);
     MODEL_ASSERT(options->alloc_opts != NULL);
@@ -49,6 +100,13 @@ int vccrypt_hash_init(
     memset(context, 0, sizeof(vccrypt_hash_context_t));
     context->options = options;
 
+    /* point the algorithm at the embedded storage if the state fits. */
+    if (embedded && options->hash_context_state_size > 0
+     && options->hash_context_state_size <= sizeof(context->hash_state_storage))
+    {
+        context->hash_state = context->hash_state_storage;
+    }
+
     /* call the algorithm specific initialization method */
     int ret = options->vccrypt_hash_alg_init(options, context);
     if (ret != 0)
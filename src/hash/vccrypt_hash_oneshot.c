@@ -0,0 +1,79 @@
+/**
+ * \file vccrypt_hash_oneshot.c
+ *
+ * Hash a single message in one call.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Hash a single message, writing the hash to the given pointer.
+ *
+ * This is equivalent to initializing a hash instance, digesting the message,
+ * and finalizing it, but needs no allocation for algorithms that support
+ * vccrypt_hash_init_embedded().
+ *
+ * \param options       The options for the hash algorithm to use.
+ * \param data          The message to hash.  May be NULL if size is 0.
+ * \param size          The size of the message, in bytes.
+ * \param digest        The buffer to receive the hash.  Must be at least
+ *                      hash_size bytes in length.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_HASH_ONESHOT_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_hash_oneshot(
+    vccrypt_hash_options_t* options, const uint8_t* data, size_t size,
+    uint8_t* digest)
+{
+    int retval;
+    vccrypt_hash_context_t ctx;
+    vccrypt_buffer_t out;
+
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != data || 0 == size);
+    MODEL_ASSERT(NULL != digest);
+
+    /* sanity check of parameters */
+    if (NULL == options || (NULL == data && size > 0) || NULL == digest)
+    {
+        return VCCRYPT_ERROR_HASH_ONESHOT_INVALID_ARG;
+    }
+
+    retval = vccrypt_hash_init_embedded(options, &ctx);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (size > 0)
+    {
+        retval = vccrypt_hash_digest(&ctx, data, size);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto dispose_ctx;
+        }
+    }
+
+    /* finalize directly into the caller's buffer; out owns nothing. */
+    memset(&out, 0, sizeof(out));
+    out.size = options->hash_size;
+    out.data = digest;
+
+    retval = vccrypt_hash_finalize(&ctx, &out);
+
+    /* fall-through */
+
+dispose_ctx:
+    dispose((disposable_t*)&ctx);
+
+    return retval;
+}
@@ -0,0 +1,239 @@
+/**
+ * \file vccrypt_hash_register_SHA_2_256.c
+ *
+ * Register SHA-256 and force a link dependency so that this algorithm can be
+ * used at runtime.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/abstract_factory.h>
+#include <vpr/allocator.h>
+#include <vpr/parameters.h>
+
+#include "ref/sha256.h"
+
+/* forward decls */
+static int vccrypt_sha_256_init(void* options, void* context);
+static void vccrypt_sha_256_dispose(void* options, void* context);
+static int vccrypt_sha_256_options_init(
+    void* options, allocator_options_t* alloc_opts);
+static void vccrypt_sha_256_options_dispose(void* disp);
+static int vccrypt_sha_256_digest(
+    void* context, const uint8_t* data, size_t size);
+static int vccrypt_sha_256_finalize(
+    void* context, vccrypt_buffer_t* hash_buffer);
+static int vccrypt_sha_256_export_state(void* context, uint8_t* state);
+static int vccrypt_sha_256_import_state(void* context, const uint8_t* state);
+
+/* static data for this instance */
+static abstract_factory_registration_t sha256_impl;
+static vccrypt_hash_options_t sha256_options;
+static bool sha256_impl_registered = false;
+
+/**
+ * Register SHA-256 for use by the crypto library.
+ */
+void vccrypt_hash_register_SHA_2_256()
+{
+    /* only register once */
+    if (sha256_impl_registered)
+    {
+        return;
+    }
+
+    /* set up the options for SHA-256 */
+    sha256_options.hdr.dispose = &vccrypt_sha_256_options_dispose;
+    sha256_options.alloc_opts = 0; /* allocator handled by init */
+    sha256_options.hash_size = VCCRYPT_HASH_SHA_256_DIGEST_SIZE;
+    sha256_options.hash_block_size = VCCRYPT_HASH_SHA_256_BLOCK_SIZE;
+    sha256_options.hash_state_size = SHA256_STATE_LENGTH;
+    sha256_options.hash_context_state_size = sizeof(SHA256_CTX);
+    sha256_options.vccrypt_hash_alg_init = &vccrypt_sha_256_init;
+    sha256_options.vccrypt_hash_alg_dispose = &vccrypt_sha_256_dispose;
+    sha256_options.vccrypt_hash_alg_digest = &vccrypt_sha_256_digest;
+    sha256_options.vccrypt_hash_alg_finalize = &vccrypt_sha_256_finalize;
+    sha256_options.vccrypt_hash_alg_export_state =
+        &vccrypt_sha_256_export_state;
+    sha256_options.vccrypt_hash_alg_import_state =
+        &vccrypt_sha_256_import_state;
+    sha256_options.vccrypt_hash_alg_options_init =
+        &vccrypt_sha_256_options_init;
+
+    /* set up this registration for the abstract factory. */
+    sha256_impl.interface = VCCRYPT_INTERFACE_HASH;
+    sha256_impl.implementation = VCCRYPT_HASH_ALGORITHM_SHA_2_256;
+    sha256_impl.implementation_features = VCCRYPT_HASH_ALGORITHM_SHA_2_256;
+    sha256_impl.factory = 0;
+    sha256_impl.context = &sha256_options;
+
+    /* register this instance. */
+    abstract_factory_register(&sha256_impl);
+
+    /* only register once */
+    sha256_impl_registered = true;
+}
+
+/**
+ * Algorithm-specific initialization for hash.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_hash_context_t structure.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+static int vccrypt_sha_256_init(void* options, void* context)
+{
+    vccrypt_hash_options_t* opts = (vccrypt_hash_options_t*)options;
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    /* allocate space for the SHA-256 context, unless it is embedded. */
+    if (ctx->hash_state == NULL)
+    {
+        ctx->hash_state = allocate(opts->alloc_opts, sizeof(SHA256_CTX));
+        if (ctx->hash_state == NULL)
+        {
+            return VCCRYPT_ERROR_HASH_INIT_OUT_OF_MEMORY;
+        }
+    }
+
+    /* initialize this context. */
+    SHA256_Init((SHA256_CTX*)ctx->hash_state);
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Algorithm-specific disposal for hash.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_hash_context_t structure.
+ */
+static void vccrypt_sha_256_dispose(void* options, void* context)
+{
+    vccrypt_hash_options_t* opts = (vccrypt_hash_options_t*)options;
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    /* clear the hash state structure, releasing it if allocated. */
+    if (ctx->hash_state != NULL)
+    {
+        memset(ctx->hash_state, 0, sizeof(SHA256_CTX));
+
+        if (ctx->hash_state != (void*)ctx->hash_state_storage)
+        {
+            release(opts->alloc_opts, ctx->hash_state);
+        }
+    }
+}
+
+/**
+ * Digest data for the given hash instance.
+ *
+ * \param context       An opaque pointer to the vccrypt_hash_context_t
+ *                      structure.
+ * \param data          A pointer to raw data to digest.
+ * \param size          The size of the data to digest, in bytes.
+ *
+ * \returns 0 on success and 1 on failure.
+ */
+static int vccrypt_sha_256_digest(
+    void* context, const uint8_t* data, size_t size)
+{
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    SHA256_Update((SHA256_CTX*)ctx->hash_state, data, size);
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Finalize the hash, copying the output data to the given buffer.
+ *
+ * \param context       An opaque pointer to the vccrypt_hash_context_t
+ *                      structure.
+ * \param hash_buffer   The buffer to receive the hash.  Must be large
+ *                      enough for the given hash algorithm.
+ *
+ * \returns 0 on success and 1 on failure.
+ */
+static int vccrypt_sha_256_finalize(
+    void* context, vccrypt_buffer_t* hash_buffer)
+{
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    return SHA256_Final((SHA256_CTX*)ctx->hash_state, hash_buffer->data);
+}
+
+/**
+ * Export the midstate of the given hash instance.
+ *
+ * \param context       An opaque pointer to the vccrypt_hash_context_t
+ *                      structure.
+ * \param state         The buffer to receive the midstate.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int vccrypt_sha_256_export_state(void* context, uint8_t* state)
+{
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    SHA256_Export((SHA256_CTX*)ctx->hash_state, state);
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Import a midstate into the given hash instance.
+ *
+ * \param context       An opaque pointer to the vccrypt_hash_context_t
+ *                      structure.
+ * \param state         The midstate to import.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int vccrypt_sha_256_import_state(void* context, const uint8_t* state)
+{
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    if (0 != SHA256_Import((SHA256_CTX*)ctx->hash_state, state))
+    {
+        return VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG;
+    }
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Implementation specific options init method.
+ *
+ * \param options       The options structure to initialize.
+ * \param alloc_opts    The allocator options structure for this method.
+ *
+ * \returns \ref VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+static int vccrypt_sha_256_options_init(
+    void* UNUSED(options), allocator_options_t* UNUSED(alloc_opts))
+{
+    /* do nothing. */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of this options structure.
+ *
+ * \param disp          The options structure to dispose.
+ */
+static void vccrypt_sha_256_options_dispose(void* disp)
+{
+    MODEL_ASSERT(disp != NULL);
+
+    memset(disp, 0, sizeof(vccrypt_hash_options_t));
+}
@@ -15,7 +15,7 @@
 #include <vpr/allocator.h>
 #include <vpr/parameters.h>
 
-#include "ref/sha512.h"
+#include "hash_private.h"
 
 /* forward decls */
 static int vccrypt_sha_512_256_init(void* options, void* context);
@@ -27,6 +27,12 @@ static int vccrypt_sha_512_256_digest(
     void* context, const uint8_t* data, size_t size);
 static int vccrypt_sha_512_256_finalize(
     void* context, vccrypt_buffer_t* hash_buffer);
+static int vccrypt_sha_512_256_export_state(
+    void* context, uint8_t* state);
+static int vccrypt_sha_512_256_import_state(
+    void* context, const uint8_t* state);
+static int vccrypt_sha_512_256_digest_many(
+    void* options, void* jobs, size_t count);
 
 /* static data for this instance */
 static abstract_factory_registration_t sha512_256_impl;
@@ -51,11 +57,19 @@ void vccrypt_hash_register_SHA_2_512_256()
         VCCRYPT_HASH_SHA_512_256_DIGEST_SIZE;
     sha512_256_options.hash_block_size =
         VCCRYPT_HASH_SHA_512_256_BLOCK_SIZE;
+    sha512_256_options.hash_state_size = SHA512_STATE_LENGTH;
+    sha512_256_options.hash_context_state_size = sizeof(SHA512_CTX);
     sha512_256_options.vccrypt_hash_alg_init = &vccrypt_sha_512_256_init;
     sha512_256_options.vccrypt_hash_alg_dispose = &vccrypt_sha_512_256_dispose;
     sha512_256_options.vccrypt_hash_alg_digest = &vccrypt_sha_512_256_digest;
     sha512_256_options.vccrypt_hash_alg_finalize =
         &vccrypt_sha_512_256_finalize;
+    sha512_256_options.vccrypt_hash_alg_export_state =
+        &vccrypt_sha_512_256_export_state;
+    sha512_256_options.vccrypt_hash_alg_import_state =
+        &vccrypt_sha_512_256_import_state;
+    sha512_256_options.vccrypt_hash_alg_digest_many =
+        &vccrypt_sha_512_256_digest_many;
     sha512_256_options.vccrypt_hash_alg_options_init =
         &vccrypt_sha_512_256_options_init;
 
@@ -88,11 +102,14 @@ static int vccrypt_sha_512_256_init(void* options, void* context)
     vccrypt_hash_options_t* opts = (vccrypt_hash_options_t*)options;
     vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
 
-    /* allocate space for the SHA-512/256 context. */
-    ctx->hash_state = allocate(opts->alloc_opts, sizeof(SHA512_CTX));
+    /* allocate space for the SHA-512/256 context, unless it is embedded. */
     if (ctx->hash_state == NULL)
     {
-        return VCCRYPT_ERROR_HASH_INIT_OUT_OF_MEMORY;
+        ctx->hash_state = allocate(opts->alloc_opts, sizeof(SHA512_CTX));
+        if (ctx->hash_state == NULL)
+        {
+            return VCCRYPT_ERROR_HASH_INIT_OUT_OF_MEMORY;
+        }
     }
 
     /* initialize this context. */
@@ -113,11 +130,15 @@ static void vccrypt_sha_512_256_dispose(void* options, void* context)
     vccrypt_hash_options_t* opts = (vccrypt_hash_options_t*)options;
     vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
 
-    /* clear the hash state structure if allocated. */
+    /* clear the hash state structure, releasing it if allocated. */
     if (ctx->hash_state != NULL)
     {
         memset(ctx->hash_state, 0, sizeof(SHA512_CTX));
-        release(opts->alloc_opts, ctx->hash_state);
+
+        if (ctx->hash_state != (void*)ctx->hash_state_storage)
+        {
+            release(opts->alloc_opts, ctx->hash_state);
+        }
     }
 }
 
@@ -160,6 +181,66 @@ static int vccrypt_sha_512_256_finalize(
     return SHA512_256_Final((SHA512_CTX*)ctx->hash_state, hash_buffer->data);
 }
 
+/**
+ * Hash many independent messages in a single call.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param jobs          An array of vccrypt_hash_job_t jobs.
+ * \param count         The number of jobs.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int vccrypt_sha_512_256_digest_many(
+    void* UNUSED(options), void* jobs, size_t count)
+{
+    return
+        vccrypt_sha512_digest_many(
+            (vccrypt_hash_job_t*)jobs, count, &SHA512_256_Init);
+}
+
+/**
+ * Export the midstate of the given hash instance.
+ *
+ * \param context       An opaque pointer to the vccrypt_hash_context_t
+ *                      structure.
+ * \param state         The buffer to receive the midstate.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int vccrypt_sha_512_256_export_state(
+    void* context, uint8_t* state)
+{
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    SHA512_Export((SHA512_CTX*)ctx->hash_state, state);
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Import a midstate into the given hash instance.
+ *
+ * \param context       An opaque pointer to the vccrypt_hash_context_t
+ *                      structure.
+ * \param state         The midstate to import.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int vccrypt_sha_512_256_import_state(
+    void* context, const uint8_t* state)
+{
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    if (0 != SHA512_Import((SHA512_CTX*)ctx->hash_state, state))
+    {
+        return VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG;
+    }
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
 /**
  * \brief Implementation specific options init method.
  *
@@ -0,0 +1,246 @@
+/**
+ * \file vccrypt_hash_register_SHA_2_512_TREE.c
+ *
+ * Register the SHA-512 tree hash and force a link dependency so that it can
+ * be used at runtime.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/abstract_factory.h>
+#include <vpr/allocator.h>
+#include <vpr/parameters.h>
+
+#include "hash_private.h"
+
+/**
+ * \brief Tree parameters for a single registered selector.
+ */
+typedef struct sha512_tree_params
+{
+    size_t chunk_size;
+    size_t fanout;
+} sha512_tree_params_t;
+
+#define SHA512_TREE_CHUNKS 4
+#define SHA512_TREE_FANOUTS 4
+#define SHA512_TREE_VARIANTS (SHA512_TREE_CHUNKS * SHA512_TREE_FANOUTS)
+
+/* forward decls */
+static int vccrypt_sha_512_tree_init(void* options, void* context);
+static void vccrypt_sha_512_tree_dispose(void* options, void* context);
+static int vccrypt_sha_512_tree_options_init(
+    void* options, allocator_options_t* alloc_opts);
+static void vccrypt_sha_512_tree_options_dispose(void* disp);
+static int vccrypt_sha_512_tree_digest(
+    void* context, const uint8_t* data, size_t size);
+static int vccrypt_sha_512_tree_finalize(
+    void* context, vccrypt_buffer_t* hash_buffer);
+
+/* static data for this instance */
+static const struct
+{
+    uint32_t flag;
+    size_t value;
+} sha512_tree_chunks[SHA512_TREE_CHUNKS] = {
+    { VCCRYPT_HASH_TREE_CHUNK_64K, 64 * 1024 },
+    { VCCRYPT_HASH_TREE_CHUNK_256K, 256 * 1024 },
+    { VCCRYPT_HASH_TREE_CHUNK_1M, 1024 * 1024 },
+    { VCCRYPT_HASH_TREE_CHUNK_4M, 4 * 1024 * 1024 },
+}, sha512_tree_fanouts[SHA512_TREE_FANOUTS] = {
+    { VCCRYPT_HASH_TREE_FANOUT_2, 2 },
+    { VCCRYPT_HASH_TREE_FANOUT_4, 4 },
+    { VCCRYPT_HASH_TREE_FANOUT_8, 8 },
+    { VCCRYPT_HASH_TREE_FANOUT_16, 16 },
+};
+static abstract_factory_registration_t
+    sha512_tree_impl[SHA512_TREE_VARIANTS];
+static vccrypt_hash_options_t sha512_tree_options[SHA512_TREE_VARIANTS];
+static sha512_tree_params_t sha512_tree_params[SHA512_TREE_VARIANTS];
+static bool sha512_tree_impl_registered = false;
+
+/**
+ * Register every chunk size and fan-out of the SHA-512 tree hash for use by
+ * the crypto library.
+ */
+void vccrypt_hash_register_SHA_2_512_TREE()
+{
+    /* only register once */
+    if (sha512_tree_impl_registered)
+    {
+        return;
+    }
+
+    for (size_t c = 0; c < SHA512_TREE_CHUNKS; ++c)
+    {
+        for (size_t f = 0; f < SHA512_TREE_FANOUTS; ++f)
+        {
+            size_t i = c * SHA512_TREE_FANOUTS + f;
+            sha512_tree_params_t* params = &sha512_tree_params[i];
+            vccrypt_hash_options_t* options = &sha512_tree_options[i];
+            uint32_t algorithm =
+                VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE(
+                    sha512_tree_chunks[c].flag, sha512_tree_fanouts[f].flag);
+
+            params->chunk_size = sha512_tree_chunks[c].value;
+            params->fanout = sha512_tree_fanouts[f].value;
+
+            /* set up the options for this variant. */
+            options->hdr.dispose = &vccrypt_sha_512_tree_options_dispose;
+            options->alloc_opts = 0; /* allocator handled by init */
+            options->hash_size = VCCRYPT_HASH_SHA_512_DIGEST_SIZE;
+            options->hash_block_size = params->chunk_size;
+            options->hash_state_size = 0;
+            options->hash_context_state_size = 0;
+            options->vccrypt_hash_alg_init = &vccrypt_sha_512_tree_init;
+            options->vccrypt_hash_alg_dispose = &vccrypt_sha_512_tree_dispose;
+            options->vccrypt_hash_alg_digest = &vccrypt_sha_512_tree_digest;
+            options->vccrypt_hash_alg_finalize =
+                &vccrypt_sha_512_tree_finalize;
+            options->vccrypt_hash_alg_options_init =
+                &vccrypt_sha_512_tree_options_init;
+            options->options_context = params;
+
+            /* set up this registration for the abstract factory. */
+            sha512_tree_impl[i].interface = VCCRYPT_INTERFACE_HASH;
+            sha512_tree_impl[i].implementation = algorithm;
+            sha512_tree_impl[i].implementation_features = algorithm;
+            sha512_tree_impl[i].factory = 0;
+            sha512_tree_impl[i].context = options;
+
+            /* register this instance. */
+            abstract_factory_register(&sha512_tree_impl[i]);
+        }
+    }
+
+    /* only register once */
+    sha512_tree_impl_registered = true;
+}
+
+/**
+ * Algorithm-specific initialization for hash.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_hash_context_t structure.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+static int vccrypt_sha_512_tree_init(void* options, void* context)
+{
+    vccrypt_hash_options_t* opts = (vccrypt_hash_options_t*)options;
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+    sha512_tree_params_t* params =
+        (sha512_tree_params_t*)opts->options_context;
+
+    /* the tree state is too large to embed, so always allocate it. */
+    ctx->hash_state =
+        allocate(opts->alloc_opts, vccrypt_sha512_tree_size(params->fanout));
+    if (ctx->hash_state == NULL)
+    {
+        return VCCRYPT_ERROR_HASH_INIT_OUT_OF_MEMORY;
+    }
+
+    /* initialize this context. */
+    vccrypt_sha512_tree_init(
+        (vccrypt_sha512_tree_t*)ctx->hash_state, opts->alloc_opts,
+        params->chunk_size, params->fanout);
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Algorithm-specific disposal for hash.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_hash_context_t structure.
+ */
+static void vccrypt_sha_512_tree_dispose(void* options, void* context)
+{
+    vccrypt_hash_options_t* opts = (vccrypt_hash_options_t*)options;
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+    sha512_tree_params_t* params =
+        (sha512_tree_params_t*)opts->options_context;
+
+    /* clear and release the hash state structure. */
+    if (ctx->hash_state != NULL)
+    {
+        memset(ctx->hash_state, 0, vccrypt_sha512_tree_size(params->fanout));
+        release(opts->alloc_opts, ctx->hash_state);
+    }
+}
+
+/**
+ * Digest data for the given hash instance.
+ *
+ * \param context       An opaque pointer to the vccrypt_hash_context_t
+ *                      structure.
+ * \param data          A pointer to raw data to digest.
+ * \param size          The size of the data to digest, in bytes.
+ *
+ * \returns 0 on success and 1 on failure.
+ */
+static int vccrypt_sha_512_tree_digest(
+    void* context, const uint8_t* data, size_t size)
+{
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    vccrypt_sha512_tree_update(
+        (vccrypt_sha512_tree_t*)ctx->hash_state, data, size);
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Finalize the hash, copying the output data to the given buffer.
+ *
+ * \param context       An opaque pointer to the vccrypt_hash_context_t
+ *                      structure.
+ * \param hash_buffer   The buffer to receive the hash.  Must be large
+ *                      enough for the given hash algorithm.
+ *
+ * \returns 0 on success and 1 on failure.
+ */
+static int vccrypt_sha_512_tree_finalize(
+    void* context, vccrypt_buffer_t* hash_buffer)
+{
+    vccrypt_hash_context_t* ctx = (vccrypt_hash_context_t*)context;
+
+    vccrypt_sha512_tree_final(
+        (vccrypt_sha512_tree_t*)ctx->hash_state, hash_buffer->data);
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Implementation specific options init method.
+ *
+ * \param options       The options structure to initialize.
+ * \param alloc_opts    The allocator options structure for this method.
+ *
+ * \returns \ref VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+static int vccrypt_sha_512_tree_options_init(
+    void* UNUSED(options), allocator_options_t* UNUSED(alloc_opts))
+{
+    /* do nothing. */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of this options structure.
+ *
+ * \param disp          The options structure to dispose.
+ */
+static void vccrypt_sha_512_tree_options_dispose(void* disp)
+{
+    MODEL_ASSERT(disp != NULL);
+
+    memset(disp, 0, sizeof(vccrypt_hash_options_t));
+}
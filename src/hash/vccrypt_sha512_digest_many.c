@@ -0,0 +1,254 @@
+/**
+ * \file vccrypt_sha512_digest_many.c
+ *
+ * Multi-buffer SHA-512 lane scheduler.
+ *
+ * Each lane hashes one job at a time.  Full blocks are read directly from the
+ * job's message, and the one or two padded final blocks are built in the
+ * lane.  When a lane finishes, its digest is written out and the next job is
+ * started in its place, so that short messages of different lengths keep all
+ * of the lanes busy.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/parameters.h>
+
+#include "hash_private.h"
+
+#define SHA512_BLOCK_SIZE 128
+
+/**
+ * \brief A single lane of the scheduler.
+ */
+typedef struct sha512_lane
+{
+    vccrypt_hash_job_t* job;
+    size_t block;
+    size_t full_blocks;
+    size_t blocks;
+    uint8_t tail[2 * SHA512_BLOCK_SIZE];
+} sha512_lane_t;
+
+/**
+ * \brief Multi-buffer scheduler state.
+ */
+typedef struct sha512_lanes
+{
+    uint64_t state[8][SHA512_MAX_LANES];
+    sha512_lane_t lane[SHA512_MAX_LANES];
+    SHA512_CTX iv;
+    size_t active;
+} sha512_lanes_t;
+
+/**
+ * \brief Compress one block for each lane.
+ */
+typedef void (*sha512_lanes_fn)(
+    uint64_t state[8][SHA512_MAX_LANES], const uint8_t* const* blocks);
+
+/**
+ * \brief Start a job in the next free lane.
+ */
+static void sha512_lane_start(sha512_lanes_t* lanes, vccrypt_hash_job_t* job)
+{
+    size_t l = lanes->active++;
+    sha512_lane_t* lane = &lanes->lane[l];
+    size_t rem = job->size % SHA512_BLOCK_SIZE;
+    size_t tail_blocks = (rem + 17 <= SHA512_BLOCK_SIZE) ? 1 : 2;
+    uint8_t* len = lane->tail + tail_blocks * SHA512_BLOCK_SIZE - 16;
+    uint64_t bits_hi = ((uint64_t)job->size) >> 61;
+    uint64_t bits_lo = ((uint64_t)job->size) << 3;
+
+    lane->job = job;
+    lane->block = 0;
+    lane->full_blocks = job->size / SHA512_BLOCK_SIZE;
+    lane->blocks = lane->full_blocks + tail_blocks;
+
+    /* build the padded final block(s). */
+    memset(lane->tail, 0, sizeof(lane->tail));
+    if (rem > 0)
+    {
+        memcpy(
+            lane->tail, job->data + lane->full_blocks * SHA512_BLOCK_SIZE,
+            rem);
+    }
+    lane->tail[rem] = 0x80;
+    for (int i = 0; i < 8; ++i)
+    {
+        len[i] = (uint8_t)(bits_hi >> (56 - 8 * i));
+        len[8 + i] = (uint8_t)(bits_lo >> (56 - 8 * i));
+    }
+
+    for (int i = 0; i < 8; ++i)
+    {
+        lanes->state[i][l] = lanes->iv.h[i];
+    }
+}
+
+/**
+ * \brief Write out the digest for a lane and free the lane, moving the last
+ * active lane into its place.
+ */
+static void sha512_lane_retire(sha512_lanes_t* lanes, size_t l)
+{
+    sha512_lane_t* lane = &lanes->lane[l];
+    size_t last = --lanes->active;
+
+    for (size_t n = 0; n < lanes->iv.md_len; ++n)
+    {
+        lane->job->digest[n] =
+            (uint8_t)(lanes->state[n / 8][l] >> (56 - 8 * (n % 8)));
+    }
+
+    if (l != last)
+    {
+        memcpy(lane, &lanes->lane[last], sizeof(sha512_lane_t));
+        for (int i = 0; i < 8; ++i)
+        {
+            lanes->state[i][l] = lanes->state[i][last];
+        }
+    }
+
+    memset(&lanes->lane[last], 0, sizeof(sha512_lane_t));
+    for (int i = 0; i < 8; ++i)
+    {
+        lanes->state[i][last] = 0;
+    }
+}
+
+/**
+ * \brief Finish the job in a lane using the scalar implementation.
+ */
+static void sha512_lane_finish(sha512_lanes_t* lanes, size_t l)
+{
+    sha512_lane_t* lane = &lanes->lane[l];
+    size_t offset = lane->block * SHA512_BLOCK_SIZE;
+    SHA512_CTX ctx;
+
+    /* resume from the lane's state at the current block boundary. */
+    memcpy(&ctx, &lanes->iv, sizeof(ctx));
+    for (int i = 0; i < 8; ++i)
+    {
+        ctx.h[i] = lanes->state[i][l];
+    }
+    ctx.Nl = ((uint64_t)offset) << 3;
+    ctx.Nh = ((uint64_t)offset) >> 61;
+
+    SHA512_Update(&ctx, lane->job->data + offset, lane->job->size - offset);
+    SHA512_Final(&ctx, lane->job->digest);
+
+    memset(&ctx, 0, sizeof(ctx));
+    memset(lane, 0, sizeof(sha512_lane_t));
+    lanes->active = 0;
+}
+
+/**
+ * \brief Hash many independent messages with SHA-512 or one of its truncated
+ * variants, compressing several messages at once in SIMD lanes when the CPU
+ * supports it.
+ *
+ * \param jobs          The jobs to hash.
+ * \param count         The number of jobs.
+ * \param init          The SHA-512 family init function, which selects the
+ *                      initial hash value and the digest length.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_sha512_digest_many(
+    vccrypt_hash_job_t* jobs, size_t count, void (*init)(SHA512_CTX*))
+{
+    sha512_lanes_t lanes;
+    sha512_lanes_fn compress = NULL;
+    size_t width = 1;
+    size_t next = 0;
+    const uint8_t* blocks[SHA512_MAX_LANES];
+    static const uint8_t idle[SHA512_BLOCK_SIZE] = { 0 };
+
+    MODEL_ASSERT(NULL != jobs || 0 == count);
+    MODEL_ASSERT(NULL != init);
+
+#ifdef SHA512_X86_SIMD_SUPPORTED
+    if (SHA512_avx2_available())
+    {
+        compress = &SHA512_x4_avx2;
+        width = 4;
+    }
+    else
+    {
+        compress = &SHA512_x2_sse2;
+        width = 2;
+    }
+#endif
+
+    memset(&lanes, 0, sizeof(lanes));
+    init(&lanes.iv);
+
+    /* without lanes to fill, hash each job with the scalar code. */
+    if (NULL == compress || count < 2)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            sha512_lane_start(&lanes, &jobs[i]);
+            sha512_lane_finish(&lanes, 0);
+        }
+
+        return VCCRYPT_STATUS_SUCCESS;
+    }
+
+    while (next < count || lanes.active > 0)
+    {
+        /* fill the free lanes. */
+        while (lanes.active < width && next < count)
+        {
+            sha512_lane_start(&lanes, &jobs[next++]);
+        }
+
+        /* a lone job is faster on the scalar code, unless it is already
+         * part way through its padding. */
+        if (1 == lanes.active && next == count
+         && lanes.lane[0].block <= lanes.lane[0].full_blocks)
+        {
+            sha512_lane_finish(&lanes, 0);
+            break;
+        }
+
+        for (size_t l = 0; l < width; ++l)
+        {
+            sha512_lane_t* lane = &lanes.lane[l];
+
+            if (l >= lanes.active)
+            {
+                blocks[l] = idle;
+            }
+            else if (lane->block < lane->full_blocks)
+            {
+                blocks[l] = lane->job->data + lane->block * SHA512_BLOCK_SIZE;
+            }
+            else
+            {
+                blocks[l] =
+                    lane->tail
+                        + (lane->block - lane->full_blocks) * SHA512_BLOCK_SIZE;
+            }
+        }
+
+        compress(lanes.state, blocks);
+
+        /* retire finished lanes, walking backward so moves are safe. */
+        for (size_t l = lanes.active; l-- > 0;)
+        {
+            if (++lanes.lane[l].block == lanes.lane[l].blocks)
+            {
+                sha512_lane_retire(&lanes, l);
+            }
+        }
+    }
+
+    memset(&lanes, 0, sizeof(lanes));
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,282 @@
+/**
+ * \file vccrypt_sha512_tree.c
+ *
+ * Parallel SHA-512 tree hash.
+ *
+ * The input is split into fixed-size chunks.  Each chunk is hashed as a leaf,
+ * H(0x00 || chunk), and each group of up to fanout consecutive nodes on a
+ * level is hashed into a parent, H(0x01 || child_0 || ... || child_n), until
+ * a single node remains.  A short last group still gets a parent, so the
+ * shape of the tree depends only on the input length.  The root digest is
+ * H(0x02 || top || chunk_size || fanout || length), with each integer encoded
+ * as a 64-bit big-endian value.
+ *
+ * Whole chunks passed to a single update are hashed on the worker pool in
+ * batches.  Parent nodes are cheap next to leaves, so they are hashed on the
+ * calling thread as each batch is folded into the tree.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "hash_private.h"
+#include "../parallel/parallel_private.h"
+#include "../byte_order/byte_order_private.h"
+
+#define SHA512_TREE_LEAF 0x00
+#define SHA512_TREE_PARENT 0x01
+#define SHA512_TREE_ROOT 0x02
+
+/**
+ * \brief Shared state for hashing a batch of leaves.
+ */
+typedef struct sha512_tree_batch
+{
+    const uint8_t* data;
+    size_t chunk_size;
+    uint8_t (*out)[SHA512_DIGEST_LENGTH];
+} sha512_tree_batch_t;
+
+/* forward decls */
+static void sha512_tree_push(
+    vccrypt_sha512_tree_t* tree, size_t level, const uint8_t* node);
+
+/**
+ * \brief Return a pointer to the pending nodes of the given level.
+ */
+static uint8_t* sha512_tree_level(vccrypt_sha512_tree_t* tree, size_t level)
+{
+    return tree->nodes + level * tree->fanout * SHA512_DIGEST_LENGTH;
+}
+
+/**
+ * \brief Start a new SHA-512 context for a node of the given type.
+ */
+static void sha512_tree_node_init(SHA512_CTX* ctx, uint8_t type)
+{
+    SHA512_Init(ctx);
+    SHA512_Update(ctx, &type, 1);
+}
+
+/**
+ * \brief Hash a single leaf of a batch.
+ */
+static void sha512_tree_leaf_job(
+    void* context, size_t UNUSED(worker), size_t job)
+{
+    sha512_tree_batch_t* batch = (sha512_tree_batch_t*)context;
+    SHA512_CTX ctx;
+
+    sha512_tree_node_init(&ctx, SHA512_TREE_LEAF);
+    SHA512_Update(
+        &ctx, batch->data + job * batch->chunk_size, batch->chunk_size);
+    SHA512_Final(&ctx, batch->out[job]);
+
+    memset(&ctx, 0, sizeof(ctx));
+}
+
+/**
+ * \brief Hash the pending group of the given level into its parent.
+ */
+static void sha512_tree_reduce(vccrypt_sha512_tree_t* tree, size_t level)
+{
+    SHA512_CTX ctx;
+    uint8_t parent[SHA512_DIGEST_LENGTH];
+
+    sha512_tree_node_init(&ctx, SHA512_TREE_PARENT);
+    SHA512_Update(
+        &ctx, sha512_tree_level(tree, level),
+        tree->count[level] * SHA512_DIGEST_LENGTH);
+    SHA512_Final(&ctx, parent);
+    tree->count[level] = 0;
+
+    sha512_tree_push(tree, level + 1, parent);
+
+    memset(&ctx, 0, sizeof(ctx));
+    memset(parent, 0, sizeof(parent));
+}
+
+/**
+ * \brief Add a node to the given level, first hashing the level's pending
+ * group into its parent if the group is full.
+ */
+static void sha512_tree_push(
+    vccrypt_sha512_tree_t* tree, size_t level, const uint8_t* node)
+{
+    MODEL_ASSERT(level < VCCRYPT_SHA512_TREE_MAX_LEVELS);
+
+    if (tree->count[level] == tree->fanout)
+    {
+        sha512_tree_reduce(tree, level);
+    }
+
+    memcpy(
+        sha512_tree_level(tree, level)
+            + tree->count[level] * SHA512_DIGEST_LENGTH,
+        node, SHA512_DIGEST_LENGTH);
+    ++tree->count[level];
+
+    if (level >= tree->levels)
+    {
+        tree->levels = level + 1;
+    }
+}
+
+/**
+ * \brief Return the size of a SHA-512 tree hash state with the given fan-out.
+ *
+ * \param fanout        The number of children per parent node.
+ */
+size_t vccrypt_sha512_tree_size(size_t fanout)
+{
+    return
+        sizeof(vccrypt_sha512_tree_t)
+      + VCCRYPT_SHA512_TREE_MAX_LEVELS * fanout * SHA512_DIGEST_LENGTH;
+}
+
+/**
+ * \brief Initialize a SHA-512 tree hash state.
+ *
+ * \param tree          The state to initialize, which must be at least
+ *                      vccrypt_sha512_tree_size(fanout) bytes in size.
+ * \param alloc_opts    The allocator used for worker thread bookkeeping.
+ * \param chunk_size    The leaf chunk size, in bytes.
+ * \param fanout        The number of children per parent node.
+ */
+void vccrypt_sha512_tree_init(
+    vccrypt_sha512_tree_t* tree, allocator_options_t* alloc_opts,
+    size_t chunk_size, size_t fanout)
+{
+    MODEL_ASSERT(NULL != tree);
+    MODEL_ASSERT(chunk_size > 0);
+    MODEL_ASSERT(fanout >= 2);
+
+    memset(tree, 0, vccrypt_sha512_tree_size(fanout));
+    tree->alloc_opts = alloc_opts;
+    tree->chunk_size = chunk_size;
+    tree->fanout = fanout;
+}
+
+/**
+ * \brief Add data to a SHA-512 tree hash.
+ *
+ * Whole chunks in the given data are hashed in parallel on all online
+ * processors, so callers should pass large buffers where possible.
+ *
+ * \param tree          The state to update.
+ * \param data          The data to digest.
+ * \param size          The size of the data, in bytes.
+ */
+void vccrypt_sha512_tree_update(
+    vccrypt_sha512_tree_t* tree, const uint8_t* data, size_t size)
+{
+    sha512_tree_batch_t batch;
+
+    MODEL_ASSERT(NULL != tree);
+    MODEL_ASSERT(NULL != data || 0 == size);
+
+    tree->total += size;
+
+    /* top up the partial leaf left over from the previous update. */
+    if (tree->leaf_fill > 0)
+    {
+        size_t take = tree->chunk_size - tree->leaf_fill;
+        if (take > size)
+            take = size;
+
+        SHA512_Update(&tree->leaf, data, take);
+        tree->leaf_fill += take;
+        data += take;
+        size -= take;
+
+        if (tree->leaf_fill < tree->chunk_size)
+        {
+            return;
+        }
+
+        SHA512_Final(&tree->leaf, tree->batch[0]);
+        sha512_tree_push(tree, 0, tree->batch[0]);
+        tree->leaf_fill = 0;
+    }
+
+    /* hash whole chunks straight from the caller's buffer, in batches. */
+    batch.chunk_size = tree->chunk_size;
+    batch.out = tree->batch;
+    while (size >= tree->chunk_size)
+    {
+        size_t jobs = size / tree->chunk_size;
+        if (jobs > VCCRYPT_SHA512_TREE_BATCH)
+            jobs = VCCRYPT_SHA512_TREE_BATCH;
+
+        batch.data = data;
+        vccrypt_parallel_run(
+            tree->alloc_opts, vccrypt_parallel_thread_count(0, jobs), jobs,
+            &sha512_tree_leaf_job, &batch);
+
+        for (size_t i = 0; i < jobs; ++i)
+        {
+            sha512_tree_push(tree, 0, tree->batch[i]);
+        }
+
+        data += jobs * tree->chunk_size;
+        size -= jobs * tree->chunk_size;
+    }
+
+    /* start a partial leaf with whatever is left. */
+    if (size > 0)
+    {
+        sha512_tree_node_init(&tree->leaf, SHA512_TREE_LEAF);
+        SHA512_Update(&tree->leaf, data, size);
+        tree->leaf_fill = size;
+    }
+}
+
+/**
+ * \brief Finalize a SHA-512 tree hash.
+ *
+ * \param tree          The state to finalize.
+ * \param md            The buffer to receive the 64 byte root digest.
+ */
+void vccrypt_sha512_tree_final(vccrypt_sha512_tree_t* tree, uint8_t* md)
+{
+    SHA512_CTX ctx;
+    uint8_t params[24];
+    size_t level;
+
+    MODEL_ASSERT(NULL != tree);
+    MODEL_ASSERT(NULL != md);
+
+    /* the last leaf is partial, or the only leaf of an empty input. */
+    if (tree->leaf_fill > 0 || 0 == tree->levels)
+    {
+        if (0 == tree->leaf_fill)
+        {
+            sha512_tree_node_init(&tree->leaf, SHA512_TREE_LEAF);
+        }
+
+        SHA512_Final(&tree->leaf, tree->batch[0]);
+        sha512_tree_push(tree, 0, tree->batch[0]);
+        tree->leaf_fill = 0;
+    }
+
+    /* fold the last group of each level into its parent, bottom up. */
+    for (level = 0; level + 1 < tree->levels || tree->count[level] > 1;
+         ++level)
+    {
+        sha512_tree_reduce(tree, level);
+    }
+
+    vccrypt_store_be64(params, tree->chunk_size);
+    vccrypt_store_be64(params + 8, tree->fanout);
+    vccrypt_store_be64(params + 16, tree->total);
+
+    sha512_tree_node_init(&ctx, SHA512_TREE_ROOT);
+    SHA512_Update(&ctx, sha512_tree_level(tree, level), SHA512_DIGEST_LENGTH);
+    SHA512_Update(&ctx, params, sizeof(params));
+    SHA512_Final(&ctx, md);
+
+    memset(&ctx, 0, sizeof(ctx));
+}
@@ -196,7 +196,7 @@ static int vccrypt_curve25519_sha512_256_long_term_secret_create(
 
     /* create hash instance */
     vccrypt_hash_context_t hash;
-    retval = vccrypt_hash_init(&hash_opts, &hash);
+    retval = vccrypt_hash_init_embedded(&hash_opts, &hash);
     if (VCCRYPT_STATUS_SUCCESS != retval)
     {
         goto dispose_hash_opts;
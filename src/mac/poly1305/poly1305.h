@@ -0,0 +1,83 @@
+/**
+ * \file poly1305.h
+ *
+ * \brief The Poly1305 one-time authenticator.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef POLY1305_PRIVATE_HEADER_GUARD
+#define POLY1305_PRIVATE_HEADER_GUARD
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* use 44-bit limbs when the compiler provides a 128-bit product. */
+#if defined(__SIZEOF_INT128__) && !defined(POLY1305_FORCE_32BIT)
+#define POLY1305_64BIT
+#endif
+
+#define POLY1305_BLOCK_SIZE 16
+#define POLY1305_KEY_SIZE 32
+#define POLY1305_TAG_SIZE 16
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * \brief Poly1305 state.
+ *
+ * The accumulator and the clamped r are kept in radix 2^44 limbs on 64-bit
+ * builds and radix 2^26 limbs elsewhere, so that limb products fit in the
+ * widest native multiply.
+ */
+typedef struct POLY1305_STATE
+{
+#ifdef POLY1305_64BIT
+    uint64_t r[3];
+    uint64_t h[3];
+    uint64_t pad[2];
+#else
+    uint32_t r[5];
+    uint32_t h[5];
+    uint32_t pad[4];
+#endif
+    uint8_t buffer[POLY1305_BLOCK_SIZE];
+    size_t leftover;
+} POLY1305_STATE;
+
+/**
+ * Initialize the state with a 32-byte one-time key.
+ */
+void POLY1305_init(POLY1305_STATE* state, const uint8_t key[32]);
+
+/**
+ * Absorb message data.  Whole blocks are handed to the block kernel in a
+ * single call; only a trailing partial block is buffered.
+ */
+void POLY1305_update(POLY1305_STATE* state, const uint8_t* data, size_t size);
+
+/**
+ * Pad the message with zeros up to the next block boundary, as the
+ * ChaCha20-Poly1305 construction requires.
+ */
+void POLY1305_pad16(POLY1305_STATE* state);
+
+/**
+ * Write the 16-byte tag and wipe the state.
+ */
+void POLY1305_finish(POLY1305_STATE* state, uint8_t tag[16]);
+
+/*
+ * Block kernel.  Absorbs size / 16 full blocks.  hibit is 1 for message
+ * blocks and 0 for the final, already padded, partial block.
+ */
+void POLY1305_blocks(
+    POLY1305_STATE* state, const uint8_t* data, size_t size, int hibit);
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*POLY1305_PRIVATE_HEADER_GUARD*/
@@ -0,0 +1,298 @@
+/**
+ * \file poly1305_blocks.c
+ *
+ * Poly1305 key setup, block kernel, and final reduction.
+ *
+ * This follows the well-known "donna" formulation: the accumulator is kept in
+ * partially reduced limbs and carried once per block, and the multiplication
+ * by r uses precomputed 5 * r limbs to fold the modular reduction by
+ * 2^130 - 5 into the product.  The kernel loops over every whole block handed
+ * to it, so callers digesting large buffers pay the call overhead once.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "poly1305.h"
+#include "../../byte_order/byte_order_private.h"
+
+#ifdef POLY1305_64BIT
+
+typedef unsigned __int128 poly1305_u128;
+
+#define MASK44 0xfffffffffffULL
+#define MASK42 0x3ffffffffffULL
+
+/**
+ * Initialize the state with a 32-byte one-time key.
+ */
+void POLY1305_init(POLY1305_STATE* state, const uint8_t key[32])
+{
+    uint64_t t0 = vccrypt_load_le64(key);
+    uint64_t t1 = vccrypt_load_le64(key + 8);
+
+    /* r &= 0x0ffffffc0ffffffc0ffffffc0fffffff */
+    state->r[0] = t0 & 0xffc0fffffffULL;
+    state->r[1] = ((t0 >> 44) | (t1 << 20)) & 0xfffffc0ffffULL;
+    state->r[2] = (t1 >> 24) & 0x00ffffffc0fULL;
+
+    state->h[0] = state->h[1] = state->h[2] = 0;
+
+    state->pad[0] = vccrypt_load_le64(key + 16);
+    state->pad[1] = vccrypt_load_le64(key + 24);
+
+    state->leftover = 0;
+}
+
+/**
+ * Absorb size / 16 full blocks.
+ */
+void POLY1305_blocks(
+    POLY1305_STATE* state, const uint8_t* data, size_t size, int hibit)
+{
+    const uint64_t hi = hibit ? ((uint64_t)1 << 40) : 0;
+    const uint64_t r0 = state->r[0], r1 = state->r[1], r2 = state->r[2];
+    const uint64_t s1 = r1 * (5 << 2), s2 = r2 * (5 << 2);
+    uint64_t h0 = state->h[0], h1 = state->h[1], h2 = state->h[2];
+    poly1305_u128 d0, d1, d2;
+    uint64_t c;
+
+    while (size >= POLY1305_BLOCK_SIZE)
+    {
+        uint64_t t0 = vccrypt_load_le64(data);
+        uint64_t t1 = vccrypt_load_le64(data + 8);
+
+        /* h += m */
+        h0 += t0 & MASK44;
+        h1 += ((t0 >> 44) | (t1 << 20)) & MASK44;
+        h2 += ((t1 >> 24) & MASK42) | hi;
+
+        /* h *= r */
+        d0 = (poly1305_u128)h0 * r0 + (poly1305_u128)h1 * s2
+           + (poly1305_u128)h2 * s1;
+        d1 = (poly1305_u128)h0 * r1 + (poly1305_u128)h1 * r0
+           + (poly1305_u128)h2 * s2;
+        d2 = (poly1305_u128)h0 * r2 + (poly1305_u128)h1 * r1
+           + (poly1305_u128)h2 * r0;
+
+        /* partial h %= p */
+        c = (uint64_t)(d0 >> 44); h0 = (uint64_t)d0 & MASK44;
+        d1 += c; c = (uint64_t)(d1 >> 44); h1 = (uint64_t)d1 & MASK44;
+        d2 += c; c = (uint64_t)(d2 >> 42); h2 = (uint64_t)d2 & MASK42;
+        h0 += c * 5; c = h0 >> 44; h0 &= MASK44;
+        h1 += c;
+
+        data += POLY1305_BLOCK_SIZE;
+        size -= POLY1305_BLOCK_SIZE;
+    }
+
+    state->h[0] = h0;
+    state->h[1] = h1;
+    state->h[2] = h2;
+}
+
+/**
+ * Fully reduce the accumulator, add the pad, and write the tag.
+ */
+static void poly1305_emit(POLY1305_STATE* state, uint8_t tag[16])
+{
+    uint64_t h0 = state->h[0], h1 = state->h[1], h2 = state->h[2];
+    uint64_t g0, g1, g2, c, mask;
+
+    /* fully carry h */
+    c = h1 >> 44; h1 &= MASK44;
+    h2 += c; c = h2 >> 42; h2 &= MASK42;
+    h0 += c * 5; c = h0 >> 44; h0 &= MASK44;
+    h1 += c; c = h1 >> 44; h1 &= MASK44;
+    h2 += c; c = h2 >> 42; h2 &= MASK42;
+    h0 += c * 5; c = h0 >> 44; h0 &= MASK44;
+    h1 += c;
+
+    /* g = h + -p */
+    g0 = h0 + 5; c = g0 >> 44; g0 &= MASK44;
+    g1 = h1 + c; c = g1 >> 44; g1 &= MASK44;
+    g2 = h2 + c - ((uint64_t)1 << 42);
+
+    /* select h if h < p, or g if h >= p, without branching */
+    mask = (g2 >> 63) - 1;
+    g0 &= mask; g1 &= mask; g2 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+
+    /* h += pad */
+    uint64_t t0 = state->pad[0], t1 = state->pad[1];
+    h0 += t0 & MASK44; c = h0 >> 44; h0 &= MASK44;
+    h1 += (((t0 >> 44) | (t1 << 20)) & MASK44) + c; c = h1 >> 44; h1 &= MASK44;
+    h2 += ((t1 >> 24) & MASK42) + c; h2 &= MASK42;
+
+    /* tag = h % 2^128 */
+    vccrypt_store_le64(tag, h0 | (h1 << 44));
+    vccrypt_store_le64(tag + 8, (h1 >> 20) | (h2 << 24));
+}
+
+#else /* 32-bit limbs */
+
+/**
+ * Initialize the state with a 32-byte one-time key.
+ */
+void POLY1305_init(POLY1305_STATE* state, const uint8_t key[32])
+{
+    /* r &= 0x0ffffffc0ffffffc0ffffffc0fffffff */
+    state->r[0] = (vccrypt_load_le32(key + 0)) & 0x3ffffff;
+    state->r[1] = (vccrypt_load_le32(key + 3) >> 2) & 0x3ffff03;
+    state->r[2] = (vccrypt_load_le32(key + 6) >> 4) & 0x3ffc0ff;
+    state->r[3] = (vccrypt_load_le32(key + 9) >> 6) & 0x3f03fff;
+    state->r[4] = (vccrypt_load_le32(key + 12) >> 8) & 0x00fffff;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        state->h[i] = 0;
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        state->pad[i] = vccrypt_load_le32(key + 16 + 4 * i);
+    }
+
+    state->leftover = 0;
+}
+
+/**
+ * Absorb size / 16 full blocks.
+ */
+void POLY1305_blocks(
+    POLY1305_STATE* state, const uint8_t* data, size_t size, int hibit)
+{
+    const uint32_t hi = hibit ? ((uint32_t)1 << 24) : 0;
+    const uint32_t r0 = state->r[0], r1 = state->r[1], r2 = state->r[2],
+                   r3 = state->r[3], r4 = state->r[4];
+    const uint32_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+    uint32_t h0 = state->h[0], h1 = state->h[1], h2 = state->h[2],
+             h3 = state->h[3], h4 = state->h[4];
+    uint64_t d0, d1, d2, d3, d4;
+    uint32_t c;
+
+    while (size >= POLY1305_BLOCK_SIZE)
+    {
+        /* h += m */
+        h0 += (vccrypt_load_le32(data + 0)) & 0x3ffffff;
+        h1 += (vccrypt_load_le32(data + 3) >> 2) & 0x3ffffff;
+        h2 += (vccrypt_load_le32(data + 6) >> 4) & 0x3ffffff;
+        h3 += (vccrypt_load_le32(data + 9) >> 6) & 0x3ffffff;
+        h4 += (vccrypt_load_le32(data + 12) >> 8) | hi;
+
+        /* h *= r */
+        d0 = (uint64_t)h0 * r0 + (uint64_t)h1 * s4 + (uint64_t)h2 * s3
+           + (uint64_t)h3 * s2 + (uint64_t)h4 * s1;
+        d1 = (uint64_t)h0 * r1 + (uint64_t)h1 * r0 + (uint64_t)h2 * s4
+           + (uint64_t)h3 * s3 + (uint64_t)h4 * s2;
+        d2 = (uint64_t)h0 * r2 + (uint64_t)h1 * r1 + (uint64_t)h2 * r0
+           + (uint64_t)h3 * s4 + (uint64_t)h4 * s3;
+        d3 = (uint64_t)h0 * r3 + (uint64_t)h1 * r2 + (uint64_t)h2 * r1
+           + (uint64_t)h3 * r0 + (uint64_t)h4 * s4;
+        d4 = (uint64_t)h0 * r4 + (uint64_t)h1 * r3 + (uint64_t)h2 * r2
+           + (uint64_t)h3 * r1 + (uint64_t)h4 * r0;
+
+        /* partial h %= p */
+        c = (uint32_t)(d0 >> 26); h0 = (uint32_t)d0 & 0x3ffffff;
+        d1 += c; c = (uint32_t)(d1 >> 26); h1 = (uint32_t)d1 & 0x3ffffff;
+        d2 += c; c = (uint32_t)(d2 >> 26); h2 = (uint32_t)d2 & 0x3ffffff;
+        d3 += c; c = (uint32_t)(d3 >> 26); h3 = (uint32_t)d3 & 0x3ffffff;
+        d4 += c; c = (uint32_t)(d4 >> 26); h4 = (uint32_t)d4 & 0x3ffffff;
+        h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+        h1 += c;
+
+        data += POLY1305_BLOCK_SIZE;
+        size -= POLY1305_BLOCK_SIZE;
+    }
+
+    state->h[0] = h0;
+    state->h[1] = h1;
+    state->h[2] = h2;
+    state->h[3] = h3;
+    state->h[4] = h4;
+}
+
+/**
+ * Fully reduce the accumulator, add the pad, and write the tag.
+ */
+static void poly1305_emit(POLY1305_STATE* state, uint8_t tag[16])
+{
+    uint32_t h0 = state->h[0], h1 = state->h[1], h2 = state->h[2],
+             h3 = state->h[3], h4 = state->h[4];
+    uint32_t g0, g1, g2, g3, g4, c, mask;
+    uint64_t f;
+
+    /* fully carry h */
+    c = h1 >> 26; h1 &= 0x3ffffff;
+    h2 += c; c = h2 >> 26; h2 &= 0x3ffffff;
+    h3 += c; c = h3 >> 26; h3 &= 0x3ffffff;
+    h4 += c; c = h4 >> 26; h4 &= 0x3ffffff;
+    h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+    h1 += c;
+
+    /* g = h + -p */
+    g0 = h0 + 5; c = g0 >> 26; g0 &= 0x3ffffff;
+    g1 = h1 + c; c = g1 >> 26; g1 &= 0x3ffffff;
+    g2 = h2 + c; c = g2 >> 26; g2 &= 0x3ffffff;
+    g3 = h3 + c; c = g3 >> 26; g3 &= 0x3ffffff;
+    g4 = h4 + c - ((uint32_t)1 << 26);
+
+    /* select h if h < p, or g if h >= p, without branching */
+    mask = (g4 >> 31) - 1;
+    g0 &= mask; g1 &= mask; g2 &= mask; g3 &= mask; g4 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+    h3 = (h3 & mask) | g3;
+    h4 = (h4 & mask) | g4;
+
+    /* h = h % 2^128 */
+    h0 = h0 | (h1 << 26);
+    h1 = (h1 >> 6) | (h2 << 20);
+    h2 = (h2 >> 12) | (h3 << 14);
+    h3 = (h3 >> 18) | (h4 << 8);
+
+    /* tag = (h + pad) % 2^128 */
+    f = (uint64_t)h0 + state->pad[0]; h0 = (uint32_t)f;
+    f = (uint64_t)h1 + state->pad[1] + (f >> 32); h1 = (uint32_t)f;
+    f = (uint64_t)h2 + state->pad[2] + (f >> 32); h2 = (uint32_t)f;
+    f = (uint64_t)h3 + state->pad[3] + (f >> 32); h3 = (uint32_t)f;
+
+    vccrypt_store_le32(tag, h0);
+    vccrypt_store_le32(tag + 4, h1);
+    vccrypt_store_le32(tag + 8, h2);
+    vccrypt_store_le32(tag + 12, h3);
+}
+
+#endif /*POLY1305_64BIT*/
+
+/**
+ * Write the 16-byte tag and wipe the state.
+ */
+void POLY1305_finish(POLY1305_STATE* state, uint8_t tag[16])
+{
+    volatile uint8_t* p = (volatile uint8_t*)state;
+
+    /* process the final partial block, padded with a single one bit */
+    if (state->leftover > 0)
+    {
+        size_t i = state->leftover;
+        state->buffer[i++] = 1;
+        for (; i < POLY1305_BLOCK_SIZE; ++i)
+        {
+            state->buffer[i] = 0;
+        }
+
+        POLY1305_blocks(state, state->buffer, POLY1305_BLOCK_SIZE, 0);
+    }
+
+    poly1305_emit(state, tag);
+
+    for (size_t i = 0; i < sizeof(POLY1305_STATE); ++i)
+    {
+        p[i] = 0;
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * \file poly1305_update.c
+ *
+ * Poly1305 message buffering.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "poly1305.h"
+
+/**
+ * Absorb message data.
+ */
+void POLY1305_update(POLY1305_STATE* state, const uint8_t* data, size_t size)
+{
+    /* top up a buffered partial block first */
+    if (state->leftover > 0)
+    {
+        size_t want = POLY1305_BLOCK_SIZE - state->leftover;
+        if (want > size)
+        {
+            want = size;
+        }
+
+        memcpy(state->buffer + state->leftover, data, want);
+        state->leftover += want;
+        data += want;
+        size -= want;
+
+        if (state->leftover < POLY1305_BLOCK_SIZE)
+        {
+            return;
+        }
+
+        POLY1305_blocks(state, state->buffer, POLY1305_BLOCK_SIZE, 1);
+        state->leftover = 0;
+    }
+
+    /* hand every whole block to the kernel at once */
+    if (size >= POLY1305_BLOCK_SIZE)
+    {
+        size_t whole = size & ~(size_t)(POLY1305_BLOCK_SIZE - 1);
+        POLY1305_blocks(state, data, whole, 1);
+        data += whole;
+        size -= whole;
+    }
+
+    if (size > 0)
+    {
+        memcpy(state->buffer, data, size);
+        state->leftover = size;
+    }
+}
+
+/**
+ * Pad the message with zeros up to the next block boundary.
+ */
+void POLY1305_pad16(POLY1305_STATE* state)
+{
+    static const uint8_t zeros[POLY1305_BLOCK_SIZE] = { 0 };
+
+    if (state->leftover > 0)
+    {
+        POLY1305_update(
+            state, zeros, POLY1305_BLOCK_SIZE - state->leftover);
+    }
+}
@@ -57,7 +57,7 @@ int vccrypt_hmac_finalize(
 
     /* dispose of the hash and re-initialize */
     dispose((disposable_t*)&state->hash);
-    ret = vccrypt_hash_init(state->hash_options, &state->hash);
+    ret = vccrypt_hash_init_embedded(state->hash_options, &state->hash);
     if (ret != 0)
     {
         goto cleanup_inner;
@@ -53,7 +53,7 @@ int vccrypt_hmac_init(
     state->hash_options = hash_options;
 
     /* create the hash context for this hmac instance. */
-    int ret = vccrypt_hash_init(state->hash_options, &state->hash);
+    int ret = vccrypt_hash_init_embedded(state->hash_options, &state->hash);
     if (ret != 0)
     {
         return ret;
@@ -134,7 +134,7 @@ static int vccrypt_hmac_key_init(
     {
         /* create a hash instance */
         vccrypt_hash_context_t keyhash;
-        ret = vccrypt_hash_init(state->hash_options, &keyhash);
+        ret = vccrypt_hash_init_embedded(state->hash_options, &keyhash);
         if (ret != 0)
         {
             return ret;
@@ -0,0 +1,82 @@
+/**
+ * \file vccrypt_mac_digestv.c
+ *
+ * Digest several segments of data into a mac context structure.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/mac.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Digest several segments of data, in order, for the given MAC
+ * instance.
+ *
+ * This is equivalent to calling vccrypt_mac_digest() for each non-empty
+ * segment, but avoids a dispatch per segment.
+ *
+ * \param context       The MAC instance.
+ * \param segments      The segments to digest.
+ * \param count         The number of segments.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MAC_DIGESTV_INVALID_ARG if an invalid argument or
+ *             segment is provided.
+ *      - a non-zero error code.
+ */
+int vccrypt_mac_digestv(
+    vccrypt_mac_context_t* context, const vccrypt_segment_t* segments,
+    size_t count)
+{
+    int retval;
+
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != context->options->vccrypt_mac_alg_digest);
+    MODEL_ASSERT(NULL != segments || 0 == count);
+
+    /* sanity check of parameters */
+    if (NULL == context || NULL == context->options
+     || NULL == context->options->vccrypt_mac_alg_digest
+     || (NULL == segments && count > 0))
+    {
+        return VCCRYPT_ERROR_MAC_DIGESTV_INVALID_ARG;
+    }
+
+    /* validate every segment before digesting any of them. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (NULL == segments[i].data && segments[i].size > 0)
+        {
+            return VCCRYPT_ERROR_MAC_DIGESTV_INVALID_ARG;
+        }
+    }
+
+    /* use the algorithm's vectored method if it has one. */
+    if (NULL != context->options->vccrypt_mac_alg_digestv)
+    {
+        return
+            context->options->vccrypt_mac_alg_digestv(
+                context, segments, count);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (segments[i].size > 0)
+        {
+            retval =
+                context->options->vccrypt_mac_alg_digest(
+                    context, (const uint8_t*)segments[i].data,
+                    segments[i].size);
+            if (VCCRYPT_STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,224 @@
+/**
+ * \file vccrypt_mac_register_POLY1305.c
+ *
+ * Register Poly1305 for use as a mac algorithm.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/mac.h>
+#include <vpr/abstract_factory.h>
+#include <vpr/parameters.h>
+
+#include "poly1305/poly1305.h"
+
+/* forward decls */
+static int poly1305_alg_init(
+    void* options, void* context, const vccrypt_buffer_t* key);
+static void poly1305_alg_dispose(void* options, void* context);
+static int poly1305_alg_options_init(
+    void* options, allocator_options_t* alloc_opts);
+static void poly1305_alg_option_dispose(void* disp);
+static int poly1305_alg_digest(void* context, const uint8_t* data, size_t size);
+static int poly1305_alg_finalize(void* context, vccrypt_buffer_t* mac_buffer);
+
+/* static data for this instance */
+static abstract_factory_registration_t poly1305_impl;
+static vccrypt_mac_options_t poly1305_options;
+static bool poly1305_impl_registered = false;
+
+/* internal state structure */
+typedef struct poly1305_mac_state
+{
+    POLY1305_STATE state;
+    bool finalized;
+} poly1305_mac_state_t;
+
+/**
+ * Register Poly1305 as a MAC algorithm instance.
+ */
+void vccrypt_mac_register_POLY1305()
+{
+    /* only register once */
+    if (poly1305_impl_registered)
+    {
+        return;
+    }
+
+    /* set up the options for Poly1305 */
+    poly1305_options.hdr.dispose = &poly1305_alg_option_dispose;
+    poly1305_options.alloc_opts = 0; /* allocator handled by init */
+    poly1305_options.key_size = VCCRYPT_MAC_POLY1305_KEY_SIZE;
+    poly1305_options.key_expansion_supported = false;
+    poly1305_options.mac_size = VCCRYPT_MAC_POLY1305_MAC_SIZE;
+    poly1305_options.maximum_message_size = SIZE_MAX;
+    poly1305_options.vccrypt_mac_alg_init = &poly1305_alg_init;
+    poly1305_options.vccrypt_mac_alg_dispose = &poly1305_alg_dispose;
+    poly1305_options.vccrypt_mac_alg_digest = &poly1305_alg_digest;
+    poly1305_options.vccrypt_mac_alg_finalize = &poly1305_alg_finalize;
+    poly1305_options.vccrypt_mac_alg_options_init = &poly1305_alg_options_init;
+
+    /* set up this registration for the abstract factory. */
+    poly1305_impl.interface = VCCRYPT_INTERFACE_MAC;
+    poly1305_impl.implementation = VCCRYPT_MAC_ALGORITHM_POLY1305;
+    poly1305_impl.implementation_features = VCCRYPT_MAC_ALGORITHM_POLY1305;
+    poly1305_impl.factory = 0;
+    poly1305_impl.context = &poly1305_options;
+
+    /* register this instance */
+    abstract_factory_register(&poly1305_impl);
+
+    /* only register once */
+    poly1305_impl_registered = true;
+}
+
+/**
+ * Algorithm-specific initialization for Poly1305.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_mac_context_t structure.
+ * \param key       The 32 byte one-time key to use for this instance.
+ *
+ * \returns 0 on success and non-zero on error.
+*/
+static int poly1305_alg_init(
+    void* options, void* context, const vccrypt_buffer_t* key)
+{
+    vccrypt_mac_options_t* opts = (vccrypt_mac_options_t*)options;
+    vccrypt_mac_context_t* ctx = (vccrypt_mac_context_t*)context;
+    MODEL_ASSERT(opts != NULL);
+    MODEL_ASSERT(opts->alloc_opts != NULL);
+    MODEL_ASSERT(ctx != NULL);
+
+    /* Poly1305 has no key expansion; the key must be exactly 32 bytes. */
+    if (key->size != VCCRYPT_MAC_POLY1305_KEY_SIZE)
+    {
+        return VCCRYPT_ERROR_MAC_INIT_INVALID_KEY_MAC;
+    }
+
+    /* allocate space for our state structure */
+    ctx->mac_state = allocate(opts->alloc_opts, sizeof(poly1305_mac_state_t));
+    poly1305_mac_state_t* state = (poly1305_mac_state_t*)ctx->mac_state;
+    if (state == NULL)
+    {
+        return VCCRYPT_ERROR_MAC_INIT_OUT_OF_MEMORY;
+    }
+
+    POLY1305_init(&state->state, (const uint8_t*)key->data);
+    state->finalized = false;
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Algorithm-specific disposal for Poly1305.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_mac_context_t structure.
+ */
+static void poly1305_alg_dispose(void* options, void* context)
+{
+    vccrypt_mac_options_t* opts = (vccrypt_mac_options_t*)options;
+    MODEL_ASSERT(opts != NULL);
+    MODEL_ASSERT(opts->alloc_opts != NULL);
+    vccrypt_mac_context_t* ctx = (vccrypt_mac_context_t*)context;
+    MODEL_ASSERT(ctx != NULL);
+    poly1305_mac_state_t* state = (poly1305_mac_state_t*)ctx->mac_state;
+    MODEL_ASSERT(state != NULL);
+
+    /* the state holds the one-time key. */
+    memset(state, 0, sizeof(poly1305_mac_state_t));
+
+    /* release this data structure */
+    release(opts->alloc_opts, state);
+}
+
+/**
+ * Digest data for this Poly1305 instance.
+ *
+ * \param context       An opaque pointer to the vccrypt_mac_context_t
+ *                      structure.
+ * \param data          A pointer to raw data to digest.
+ * \param size          The size of the data to digest, in bytes.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int poly1305_alg_digest(void* context, const uint8_t* data, size_t size)
+{
+    vccrypt_mac_context_t* ctx = (vccrypt_mac_context_t*)context;
+    MODEL_ASSERT(ctx != NULL);
+    poly1305_mac_state_t* state = (poly1305_mac_state_t*)ctx->mac_state;
+    MODEL_ASSERT(state != NULL);
+
+    /* the key is consumed by finalize. */
+    if (state->finalized)
+    {
+        return VCCRYPT_ERROR_MAC_DIGEST_INVALID_ARG;
+    }
+
+    POLY1305_update(&state->state, data, size);
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Finalize the message authentication code, copying the output data to the
+ * given buffer.  The one-time key is wiped, so a new context must be created
+ * for the next message.
+ *
+ * \param context       An opaque pointer to the vccrypt_mac_context_t
+ *                      structure.
+ * \param mac_buffer    The buffer to receive the MAC.  Must be exactly
+ *                      VCCRYPT_MAC_POLY1305_MAC_SIZE bytes.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+static int poly1305_alg_finalize(void* context, vccrypt_buffer_t* mac_buffer)
+{
+    vccrypt_mac_context_t* ctx = (vccrypt_mac_context_t*)context;
+    MODEL_ASSERT(ctx != NULL);
+    poly1305_mac_state_t* state = (poly1305_mac_state_t*)ctx->mac_state;
+    MODEL_ASSERT(state != NULL);
+    MODEL_ASSERT(mac_buffer->size == VCCRYPT_MAC_POLY1305_MAC_SIZE);
+
+    if (state->finalized
+     || mac_buffer->size != VCCRYPT_MAC_POLY1305_MAC_SIZE)
+    {
+        return VCCRYPT_ERROR_MAC_FINALIZE_INVALID_ARG;
+    }
+
+    POLY1305_finish(&state->state, (uint8_t*)mac_buffer->data);
+    state->finalized = true;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Implementation specific options init method.
+ *
+ * \param options       The options structure to initialize.
+ * \param alloc_opts    The allocator options structure for this method.
+ *
+ * \returns \ref VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+static int poly1305_alg_options_init(
+    void* UNUSED(options), allocator_options_t* UNUSED(alloc_opts))
+{
+    /* do nothing. */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of the options structure.
+ *
+ * \param disp      the options structure to dispose.
+ */
+static void poly1305_alg_option_dispose(void* disp)
+{
+    MODEL_ASSERT(disp != NULL);
+
+    memset(disp, 0, sizeof(vccrypt_mac_options_t));
+}
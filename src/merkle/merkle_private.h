@@ -0,0 +1,98 @@
+/**
+ * \file merkle_private.h
+ *
+ * \brief Private Merkle tree helpers.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCRYPT_MERKLE_PRIVATE_HEADER_GUARD
+#define VCCRYPT_MERKLE_PRIVATE_HEADER_GUARD
+
+#include <vccrypt/hash.h>
+#include <vccrypt/merkle.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief Domain separation prefix for leaf hashes.
+ */
+#define VCCRYPT_MERKLE_LEAF_PREFIX 0x00
+
+/**
+ * \brief Domain separation prefix for interior node hashes.
+ */
+#define VCCRYPT_MERKLE_NODE_PREFIX 0x01
+
+/**
+ * \brief The maximum number of leaves hashed in a single batch.
+ */
+#define VCCRYPT_MERKLE_BATCH_LEAVES 64
+
+/**
+ * \brief The number of bytes of prefixed leaf data copied into a batch.
+ * Longer leaves are hashed on their own, without a copy.
+ */
+#define VCCRYPT_MERKLE_BATCH_BYTES (64 * 1024)
+
+/**
+ * \brief Scratch space for hashing a batch of leaves.
+ */
+typedef struct vccrypt_merkle_batch
+{
+    vccrypt_hash_job_t jobs[VCCRYPT_MERKLE_BATCH_LEAVES];
+    uint8_t digests[VCCRYPT_MERKLE_BATCH_LEAVES][VCCRYPT_MERKLE_MAX_HASH_SIZE];
+    uint8_t arena[VCCRYPT_MERKLE_BATCH_BYTES];
+} vccrypt_merkle_batch_t;
+
+/**
+ * \brief Hash a single leaf as H(0x00 || data).
+ *
+ * \param hash_options  The hash algorithm to use.
+ * \param data          The leaf data.  May be NULL if size is 0.
+ * \param size          The size of the leaf data, in bytes.
+ * \param digest        The buffer to receive the leaf hash.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_merkle_hash_leaf(
+    vccrypt_hash_options_t* hash_options, const void* data, size_t size,
+    uint8_t* digest);
+
+/**
+ * \brief Hash an interior node as H(0x01 || left || right).
+ *
+ * \param hash_options  The hash algorithm to use.
+ * \param left          The left child hash.
+ * \param right         The right child hash.
+ * \param digest        The buffer to receive the node hash.  May alias either
+ *                      child.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_merkle_hash_node(
+    vccrypt_hash_options_t* hash_options, const uint8_t* left,
+    const uint8_t* right, uint8_t* digest);
+
+/**
+ * \brief Append a leaf hash to a tree, hashing the perfect subtrees that it
+ * completes and updating the frontier.
+ *
+ * On failure, the tree is unchanged.
+ *
+ * \param tree          The tree to update.
+ * \param leaf          The leaf hash.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_merkle_push(vccrypt_merkle_tree_t* tree, const uint8_t* leaf);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCRYPT_MERKLE_PRIVATE_HEADER_GUARD
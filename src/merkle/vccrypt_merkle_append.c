@@ -0,0 +1,58 @@
+/**
+ * \file vccrypt_merkle_append.c
+ *
+ * Append a single leaf to a Merkle tree.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "merkle_private.h"
+
+/**
+ * \brief Append a single leaf to a Merkle tree.
+ *
+ * \param tree          The tree to update.
+ * \param data          The leaf data.  May be NULL if size is 0.
+ * \param size          The size of the leaf data, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG if an invalid argument
+ *             is provided.
+ *      - \ref VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY if the node array could not
+ *             be grown.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_merkle_append(
+    vccrypt_merkle_tree_t* tree, const void* data, size_t size)
+{
+    int retval;
+    uint8_t leaf[VCCRYPT_MERKLE_MAX_HASH_SIZE];
+
+    MODEL_ASSERT(NULL != tree);
+    MODEL_ASSERT(NULL != data || 0 == size);
+
+    /* sanity check of parameters */
+    if (NULL == tree || NULL == tree->hash_options
+     || (NULL == data && size > 0))
+    {
+        return VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG;
+    }
+
+    retval = vccrypt_merkle_hash_leaf(tree->hash_options, data, size, leaf);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_leaf;
+    }
+
+    retval = vccrypt_merkle_push(tree, leaf);
+
+cleanup_leaf:
+    memset(leaf, 0, sizeof(leaf));
+
+    return retval;
+}
@@ -0,0 +1,145 @@
+/**
+ * \file vccrypt_merkle_append_many.c
+ *
+ * Append several leaves to a Merkle tree, hashing them in batches.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "merkle_private.h"
+
+/* forward decls */
+static size_t vccrypt_merkle_fill_batch(
+    vccrypt_merkle_batch_t* batch, const vccrypt_segment_t* leaves,
+    size_t count);
+
+/**
+ * \brief Append several leaves to a Merkle tree, in order.
+ *
+ * Short leaves are hashed in batches with vccrypt_hash_digest_many(), so
+ * algorithms with a multi-buffer implementation hash several leaves at once.
+ * All leaves are validated before any are appended.  If hashing fails part way
+ * through, the leaves before the failing batch remain appended.
+ *
+ * \param tree          The tree to update.
+ * \param leaves        The leaves to append.
+ * \param count         The number of leaves.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG if an invalid argument
+ *             or leaf is provided.
+ *      - \ref VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY if the node array could not
+ *             be grown.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_merkle_append_many(
+    vccrypt_merkle_tree_t* tree, const vccrypt_segment_t* leaves,
+    size_t count)
+{
+    int retval = VCCRYPT_STATUS_SUCCESS;
+    vccrypt_merkle_batch_t* batch;
+    size_t i = 0;
+
+    MODEL_ASSERT(NULL != tree);
+    MODEL_ASSERT(NULL != leaves || 0 == count);
+
+    /* sanity check of parameters */
+    if (NULL == tree || NULL == tree->hash_options || NULL == tree->batch
+     || (NULL == leaves && count > 0))
+    {
+        return VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG;
+    }
+
+    /* validate every leaf before appending any of them. */
+    for (size_t j = 0; j < count; ++j)
+    {
+        if (NULL == leaves[j].data && leaves[j].size > 0)
+        {
+            return VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG;
+        }
+    }
+
+    batch = (vccrypt_merkle_batch_t*)tree->batch;
+    while (i < count)
+    {
+        size_t n = vccrypt_merkle_fill_batch(batch, leaves + i, count - i);
+
+        /* a leaf too long to copy is hashed in place. */
+        if (0 == n)
+        {
+            retval =
+                vccrypt_merkle_hash_leaf(
+                    tree->hash_options, leaves[i].data, leaves[i].size,
+                    batch->digests[0]);
+            n = 1;
+        }
+        else
+        {
+            retval =
+                vccrypt_hash_digest_many(tree->hash_options, batch->jobs, n);
+        }
+
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        for (size_t j = 0; j < n; ++j)
+        {
+            retval = vccrypt_merkle_push(tree, batch->digests[j]);
+            if (VCCRYPT_STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        i += n;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Copy as many leaves as fit into a batch, each behind its leaf prefix,
+ * and set up a hash job for each.
+ *
+ * \param batch         The batch to fill.
+ * \param leaves        The remaining leaves.
+ * \param count         The number of remaining leaves.
+ *
+ * \returns the number of leaves in the batch, which is 0 if the first leaf is
+ *          too long to copy.
+ */
+static size_t vccrypt_merkle_fill_batch(
+    vccrypt_merkle_batch_t* batch, const vccrypt_segment_t* leaves,
+    size_t count)
+{
+    size_t used = 0;
+    size_t n = 0;
+
+    while (n < count && n < VCCRYPT_MERKLE_BATCH_LEAVES
+        && leaves[n].size < VCCRYPT_MERKLE_BATCH_BYTES - used)
+    {
+        uint8_t* message = batch->arena + used;
+
+        message[0] = VCCRYPT_MERKLE_LEAF_PREFIX;
+        if (leaves[n].size > 0)
+        {
+            memcpy(message + 1, leaves[n].data, leaves[n].size);
+        }
+
+        batch->jobs[n].data = message;
+        batch->jobs[n].size = 1 + leaves[n].size;
+        batch->jobs[n].digest = batch->digests[n];
+
+        used += 1 + leaves[n].size;
+        ++n;
+    }
+
+    return n;
+}
@@ -0,0 +1,72 @@
+/**
+ * \file vccrypt_merkle_hash_leaf.c
+ *
+ * Hash a single Merkle tree leaf.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "merkle_private.h"
+
+/**
+ * \brief Hash a single leaf as H(0x00 || data).
+ *
+ * \param hash_options  The hash algorithm to use.
+ * \param data          The leaf data.  May be NULL if size is 0.
+ * \param size          The size of the leaf data, in bytes.
+ * \param digest        The buffer to receive the leaf hash.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_merkle_hash_leaf(
+    vccrypt_hash_options_t* hash_options, const void* data, size_t size,
+    uint8_t* digest)
+{
+    int retval;
+    vccrypt_hash_context_t ctx;
+    vccrypt_buffer_t out;
+    const uint8_t prefix = VCCRYPT_MERKLE_LEAF_PREFIX;
+
+    MODEL_ASSERT(NULL != hash_options);
+    MODEL_ASSERT(NULL != data || 0 == size);
+    MODEL_ASSERT(NULL != digest);
+
+    retval = vccrypt_hash_init_embedded(hash_options, &ctx);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = vccrypt_hash_digest(&ctx, &prefix, 1);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto dispose_ctx;
+    }
+
+    if (size > 0)
+    {
+        retval = vccrypt_hash_digest(&ctx, (const uint8_t*)data, size);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto dispose_ctx;
+        }
+    }
+
+    /* finalize directly into the caller's buffer; out owns nothing. */
+    memset(&out, 0, sizeof(out));
+    out.size = hash_options->hash_size;
+    out.data = digest;
+
+    retval = vccrypt_hash_finalize(&ctx, &out);
+
+    memset(&out, 0, sizeof(out));
+
+dispose_ctx:
+    dispose((disposable_t*)&ctx);
+
+    return retval;
+}
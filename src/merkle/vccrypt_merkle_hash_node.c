@@ -0,0 +1,51 @@
+/**
+ * \file vccrypt_merkle_hash_node.c
+ *
+ * Hash a Merkle tree interior node.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "merkle_private.h"
+
+/**
+ * \brief Hash an interior node as H(0x01 || left || right).
+ *
+ * \param hash_options  The hash algorithm to use.
+ * \param left          The left child hash.
+ * \param right         The right child hash.
+ * \param digest        The buffer to receive the node hash.  May alias either
+ *                      child.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_merkle_hash_node(
+    vccrypt_hash_options_t* hash_options, const uint8_t* left,
+    const uint8_t* right, uint8_t* digest)
+{
+    int retval;
+    size_t hash_size = hash_options->hash_size;
+    uint8_t node[1 + 2 * VCCRYPT_MERKLE_MAX_HASH_SIZE];
+
+    MODEL_ASSERT(NULL != hash_options);
+    MODEL_ASSERT(hash_size <= VCCRYPT_MERKLE_MAX_HASH_SIZE);
+    MODEL_ASSERT(NULL != left);
+    MODEL_ASSERT(NULL != right);
+    MODEL_ASSERT(NULL != digest);
+
+    /* both children fit in a single message, hashed without allocating. */
+    node[0] = VCCRYPT_MERKLE_NODE_PREFIX;
+    memcpy(node + 1, left, hash_size);
+    memcpy(node + 1 + hash_size, right, hash_size);
+
+    retval =
+        vccrypt_hash_oneshot(hash_options, node, 1 + 2 * hash_size, digest);
+
+    memset(node, 0, sizeof(node));
+
+    return retval;
+}
@@ -0,0 +1,99 @@
+/**
+ * \file vccrypt_merkle_init.c
+ *
+ * Initialize an empty Merkle tree.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/allocator.h>
+#include <vpr/parameters.h>
+
+#include "merkle_private.h"
+
+/* forward decls */
+static void vccrypt_merkle_dispose(void* disp);
+
+/**
+ * \brief Initialize an empty Merkle tree.
+ *
+ * If initialization is successful, then this tree is owned by the caller and
+ * must be disposed by calling dispose() when no longer needed.  The hash
+ * options must outlive the tree.
+ *
+ * \param tree          The tree to initialize.
+ * \param hash_options  The hash algorithm to use.  Its hash size must be no
+ *                      larger than \ref VCCRYPT_MERKLE_MAX_HASH_SIZE.
+ * \param retain_nodes  If true, the tree keeps every node so that inclusion
+ *                      proofs can be generated.  Otherwise, only the cached
+ *                      frontier is kept, and the tree uses a fixed amount of
+ *                      memory.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_INIT_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - \ref VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY if the tree's scratch space
+ *             could not be allocated.
+ */
+int vccrypt_merkle_init(
+    vccrypt_merkle_tree_t* tree, vccrypt_hash_options_t* hash_options,
+    bool retain_nodes)
+{
+    MODEL_ASSERT(NULL != tree);
+    MODEL_ASSERT(NULL != hash_options);
+
+    /* sanity check of parameters */
+    if (NULL == tree || NULL == hash_options
+     || 0 == hash_options->hash_size
+     || hash_options->hash_size > VCCRYPT_MERKLE_MAX_HASH_SIZE)
+    {
+        return VCCRYPT_ERROR_MERKLE_INIT_INVALID_ARG;
+    }
+
+    memset(tree, 0, sizeof(vccrypt_merkle_tree_t));
+    tree->hdr.dispose = &vccrypt_merkle_dispose;
+    tree->hash_options = hash_options;
+    tree->retain_nodes = retain_nodes;
+
+    tree->batch =
+        allocate(hash_options->alloc_opts, sizeof(vccrypt_merkle_batch_t));
+    if (NULL == tree->batch)
+    {
+        return VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY;
+    }
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * \brief Dispose of a Merkle tree, wiping and releasing its storage.
+ *
+ * \param disp          The tree to dispose.
+ */
+static void vccrypt_merkle_dispose(void* disp)
+{
+    vccrypt_merkle_tree_t* tree = (vccrypt_merkle_tree_t*)disp;
+    allocator_options_t* alloc_opts = tree->hash_options->alloc_opts;
+
+    MODEL_ASSERT(NULL != tree);
+
+    if (NULL != tree->nodes)
+    {
+        memset(
+            tree->nodes, 0,
+            tree->node_count * tree->hash_options->hash_size);
+        release(alloc_opts, tree->nodes);
+    }
+
+    if (NULL != tree->batch)
+    {
+        memset(tree->batch, 0, sizeof(vccrypt_merkle_batch_t));
+        release(alloc_opts, tree->batch);
+    }
+
+    memset(tree, 0, sizeof(vccrypt_merkle_tree_t));
+}
@@ -0,0 +1,216 @@
+/**
+ * \file vccrypt_merkle_proof.c
+ *
+ * Generate an inclusion proof from a Merkle tree.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "merkle_private.h"
+
+/* forward decls */
+static uint64_t vccrypt_merkle_split(uint64_t size);
+static size_t vccrypt_merkle_popcount(uint64_t value);
+static int vccrypt_merkle_subtree(
+    vccrypt_merkle_tree_t* tree, uint64_t start, uint64_t size,
+    uint8_t* digest);
+
+/**
+ * \brief Generate an inclusion proof for a leaf against the current root.
+ *
+ * The proof is the list of sibling hashes from the leaf up to the root, as
+ * defined by RFC 9162.  The proof buffer is initialized by this function, and
+ * on success is owned by the caller and must be disposed by calling dispose().
+ * Its size is the number of sibling hashes times the hash size.
+ *
+ * \param tree          The tree, which must retain its nodes.
+ * \param index         The index of the leaf.
+ * \param proof         The buffer to initialize with the proof.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_PROOF_INVALID_ARG if an invalid argument is
+ *             provided or the leaf index is out of range.
+ *      - \ref VCCRYPT_ERROR_MERKLE_PROOF_UNSUPPORTED if the tree does not
+ *             retain its nodes.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_merkle_proof(
+    vccrypt_merkle_tree_t* tree, uint64_t index, vccrypt_buffer_t* proof)
+{
+    int retval = VCCRYPT_STATUS_SUCCESS;
+    size_t hash_size;
+    uint8_t siblings[VCCRYPT_MERKLE_MAX_HEIGHT][VCCRYPT_MERKLE_MAX_HASH_SIZE];
+    size_t count = 0;
+    uint64_t start = 0;
+    uint64_t size;
+
+    MODEL_ASSERT(NULL != tree);
+    MODEL_ASSERT(NULL != proof);
+
+    /* sanity check of parameters */
+    if (NULL == tree || NULL == tree->hash_options || NULL == proof
+     || index >= tree->size)
+    {
+        return VCCRYPT_ERROR_MERKLE_PROOF_INVALID_ARG;
+    }
+
+    if (!tree->retain_nodes)
+    {
+        return VCCRYPT_ERROR_MERKLE_PROOF_UNSUPPORTED;
+    }
+
+    hash_size = tree->hash_options->hash_size;
+
+    /* walk down from the root, collecting the sibling of each subtree. */
+    size = tree->size;
+    while (size > 1)
+    {
+        uint64_t split = vccrypt_merkle_split(size);
+
+        if (index - start < split)
+        {
+            retval =
+                vccrypt_merkle_subtree(
+                    tree, start + split, size - split, siblings[count]);
+            size = split;
+        }
+        else
+        {
+            retval =
+                vccrypt_merkle_subtree(tree, start, split, siblings[count]);
+            start += split;
+            size -= split;
+        }
+
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto cleanup_siblings;
+        }
+
+        ++count;
+    }
+
+    /* a single leaf tree has an empty proof, but the buffer still needs an
+     * allocation to own. */
+    retval =
+        vccrypt_buffer_init(
+            proof, tree->hash_options->alloc_opts,
+            (count > 0 ? count : 1) * hash_size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_siblings;
+    }
+
+    /* the proof lists siblings from the leaf upward. */
+    proof->size = count * hash_size;
+    for (size_t i = 0; i < count; ++i)
+    {
+        memcpy(
+            (uint8_t*)proof->data + i * hash_size, siblings[count - 1 - i],
+            hash_size);
+    }
+
+cleanup_siblings:
+    memset(siblings, 0, sizeof(siblings));
+
+    return retval;
+}
+
+/**
+ * \brief Return the largest power of two smaller than size, which must be at
+ * least 2.
+ */
+static uint64_t vccrypt_merkle_split(uint64_t size)
+{
+    uint64_t split = 1;
+
+    while (split < size - split)
+    {
+        split <<= 1;
+    }
+
+    return split;
+}
+
+/**
+ * \brief Return the number of set bits in a value.
+ */
+static size_t vccrypt_merkle_popcount(uint64_t value)
+{
+    size_t count = 0;
+
+    while (value)
+    {
+        value &= value - 1;
+        ++count;
+    }
+
+    return count;
+}
+
+/**
+ * \brief Compute the hash of the subtree over leaves [start, start + size).
+ *
+ * Perfect subtrees are read from the node array.  The position of the root of
+ * a perfect subtree of 2^h leaves starting at leaf m is the number of nodes in
+ * the forest of the first m leaves, 2m - popcount(m), plus the 2^(h+1) - 2
+ * nodes of the subtree that come before its root in post-order.  Other
+ * subtrees are split as in the tree itself and hashed.
+ *
+ * \param tree          The tree.
+ * \param start         The first leaf of the subtree, which is a multiple of
+ *                      the largest power of two no larger than size.
+ * \param size          The number of leaves in the subtree.
+ * \param digest        The buffer to receive the subtree hash.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+static int vccrypt_merkle_subtree(
+    vccrypt_merkle_tree_t* tree, uint64_t start, uint64_t size,
+    uint8_t* digest)
+{
+    int retval;
+    size_t hash_size = tree->hash_options->hash_size;
+    uint8_t right[VCCRYPT_MERKLE_MAX_HASH_SIZE];
+    uint64_t split;
+
+    if (0 == (size & (size - 1)))
+    {
+        uint64_t pos =
+            2 * start - vccrypt_merkle_popcount(start) + 2 * size - 2;
+
+        MODEL_ASSERT(pos < tree->node_count);
+
+        memcpy(digest, tree->nodes + pos * hash_size, hash_size);
+
+        return VCCRYPT_STATUS_SUCCESS;
+    }
+
+    split = vccrypt_merkle_split(size);
+
+    retval = vccrypt_merkle_subtree(tree, start, split, digest);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        vccrypt_merkle_subtree(tree, start + split, size - split, right);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_right;
+    }
+
+    retval =
+        vccrypt_merkle_hash_node(tree->hash_options, digest, right, digest);
+
+cleanup_right:
+    memset(right, 0, sizeof(right));
+
+    return retval;
+}
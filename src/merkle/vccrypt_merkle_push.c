@@ -0,0 +1,144 @@
+/**
+ * \file vccrypt_merkle_push.c
+ *
+ * Append a leaf hash to a Merkle tree.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/allocator.h>
+#include <vpr/parameters.h>
+
+#include "merkle_private.h"
+
+/* forward decls */
+static int vccrypt_merkle_reserve(vccrypt_merkle_tree_t* tree, size_t count);
+
+/**
+ * \brief Append a leaf hash to a tree, hashing the perfect subtrees that it
+ * completes and updating the frontier.
+ *
+ * On failure, the tree is unchanged.
+ *
+ * \param tree          The tree to update.
+ * \param leaf          The leaf hash.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_merkle_push(vccrypt_merkle_tree_t* tree, const uint8_t* leaf)
+{
+    int retval = VCCRYPT_STATUS_SUCCESS;
+    size_t hash_size = tree->hash_options->hash_size;
+    uint8_t path[VCCRYPT_MERKLE_MAX_HEIGHT][VCCRYPT_MERKLE_MAX_HASH_SIZE];
+    uint64_t index = tree->size;
+    size_t height = 0;
+
+    MODEL_ASSERT(NULL != tree);
+    MODEL_ASSERT(NULL != leaf);
+
+    /* the frontier has no room for a subtree of height 64. */
+    if (UINT64_MAX == tree->size)
+    {
+        return VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG;
+    }
+
+    /* each trailing one bit of the index is a subtree that is now complete. */
+    memcpy(path[0], leaf, hash_size);
+    while (index & 1)
+    {
+        retval =
+            vccrypt_merkle_hash_node(
+                tree->hash_options, tree->frontier[height], path[height],
+                path[height + 1]);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto cleanup_path;
+        }
+
+        ++height;
+        index >>= 1;
+    }
+
+    /* the leaf and its new ancestors are next in post-order. */
+    if (tree->retain_nodes)
+    {
+        retval = vccrypt_merkle_reserve(tree, height + 1);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto cleanup_path;
+        }
+
+        for (size_t h = 0; h <= height; ++h)
+        {
+            memcpy(
+                tree->nodes + (tree->node_count + h) * hash_size, path[h],
+                hash_size);
+        }
+
+        tree->node_count += height + 1;
+    }
+
+    memcpy(tree->frontier[height], path[height], hash_size);
+    ++tree->size;
+
+cleanup_path:
+    memset(path, 0, sizeof(path));
+
+    return retval;
+}
+
+/**
+ * \brief Make room for count more nodes in the node array.
+ *
+ * \param tree          The tree to update.
+ * \param count         The number of nodes to make room for.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+static int vccrypt_merkle_reserve(vccrypt_merkle_tree_t* tree, size_t count)
+{
+    allocator_options_t* alloc_opts = tree->hash_options->alloc_opts;
+    size_t hash_size = tree->hash_options->hash_size;
+    size_t capacity = tree->node_capacity;
+    uint8_t* nodes;
+
+    if (tree->node_count + count <= capacity)
+    {
+        return VCCRYPT_STATUS_SUCCESS;
+    }
+
+    /* double the array, so that appends are amortized constant time. */
+    if (capacity < VCCRYPT_MERKLE_MAX_HEIGHT)
+    {
+        capacity = VCCRYPT_MERKLE_MAX_HEIGHT;
+    }
+    while (capacity < tree->node_count + count)
+    {
+        if (capacity > SIZE_MAX / 2 / hash_size)
+        {
+            return VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY;
+        }
+
+        capacity *= 2;
+    }
+
+    nodes = (uint8_t*)allocate(alloc_opts, capacity * hash_size);
+    if (NULL == nodes)
+    {
+        return VCCRYPT_ERROR_MERKLE_OUT_OF_MEMORY;
+    }
+
+    if (NULL != tree->nodes)
+    {
+        memcpy(nodes, tree->nodes, tree->node_count * hash_size);
+        memset(tree->nodes, 0, tree->node_count * hash_size);
+        release(alloc_opts, tree->nodes);
+    }
+
+    tree->nodes = nodes;
+    tree->node_capacity = capacity;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
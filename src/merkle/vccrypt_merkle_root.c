@@ -0,0 +1,80 @@
+/**
+ * \file vccrypt_merkle_root.c
+ *
+ * Compute the root of a Merkle tree.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "merkle_private.h"
+
+/**
+ * \brief Compute the root of a Merkle tree from its cached frontier.
+ *
+ * \param tree          The tree.
+ * \param root          The buffer to receive the root.  Must be at least the
+ *                      hash size of the tree's hash algorithm.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_MERKLE_ROOT_INVALID_ARG if an invalid argument is
+ *             provided.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_merkle_root(vccrypt_merkle_tree_t* tree, vccrypt_buffer_t* root)
+{
+    int retval;
+    size_t hash_size;
+    uint8_t* out;
+    bool empty = true;
+
+    MODEL_ASSERT(NULL != tree);
+    MODEL_ASSERT(NULL != root);
+
+    /* sanity check of parameters */
+    if (NULL == tree || NULL == tree->hash_options || NULL == root
+     || NULL == root->data || root->size < tree->hash_options->hash_size)
+    {
+        return VCCRYPT_ERROR_MERKLE_ROOT_INVALID_ARG;
+    }
+
+    hash_size = tree->hash_options->hash_size;
+    out = (uint8_t*)root->data;
+
+    /* the root of an empty tree is the hash of the empty string. */
+    if (0 == tree->size)
+    {
+        return vccrypt_hash_oneshot(tree->hash_options, NULL, 0, out);
+    }
+
+    /* fold the frontier from the rightmost, smallest subtree leftward. */
+    for (size_t h = 0; h < VCCRYPT_MERKLE_MAX_HEIGHT; ++h)
+    {
+        if (0 == (tree->size & ((uint64_t)1 << h)))
+        {
+            continue;
+        }
+
+        if (empty)
+        {
+            memcpy(out, tree->frontier[h], hash_size);
+            empty = false;
+            continue;
+        }
+
+        retval =
+            vccrypt_merkle_hash_node(
+                tree->hash_options, tree->frontier[h], out, out);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* success */
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,131 @@
+/**
+ * \file vccrypt_merkle_verify.c
+ *
+ * Verify a Merkle tree inclusion proof.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/compare.h>
+#include <vpr/parameters.h>
+
+#include "merkle_private.h"
+
+/**
+ * \brief Verify that a leaf is included in a Merkle tree with the given root.
+ *
+ * This follows the verification algorithm in RFC 9162, section 2.1.3.2.
+ *
+ * \param hash_options  The hash algorithm used to build the tree.
+ * \param index         The index of the leaf.
+ * \param tree_size     The number of leaves in the tree.
+ * \param data          The leaf data.  May be NULL if size is 0.
+ * \param size          The size of the leaf data, in bytes.
+ * \param proof         The inclusion proof.
+ * \param root          The expected root.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS if the proof is valid.
+ *      - \ref VCCRYPT_ERROR_MERKLE_VERIFY_INVALID_ARG if an invalid argument
+ *             is provided.
+ *      - \ref VCCRYPT_ERROR_MERKLE_VERIFY_FAILED if the proof does not
+ *             match the leaf, its position, or the root.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_merkle_verify(
+    vccrypt_hash_options_t* hash_options, uint64_t index, uint64_t tree_size,
+    const void* data, size_t size, const vccrypt_buffer_t* proof,
+    const vccrypt_buffer_t* root)
+{
+    int retval;
+    size_t hash_size;
+    size_t count;
+    const uint8_t* path;
+    uint8_t digest[VCCRYPT_MERKLE_MAX_HASH_SIZE];
+    uint64_t fn = index;
+    uint64_t sn;
+
+    MODEL_ASSERT(NULL != hash_options);
+    MODEL_ASSERT(NULL != data || 0 == size);
+    MODEL_ASSERT(NULL != proof);
+    MODEL_ASSERT(NULL != root);
+
+    /* sanity check of parameters */
+    if (NULL == hash_options || 0 == hash_options->hash_size
+     || hash_options->hash_size > VCCRYPT_MERKLE_MAX_HASH_SIZE
+     || (NULL == data && size > 0)
+     || NULL == proof || (NULL == proof->data && proof->size > 0)
+     || 0 != proof->size % hash_options->hash_size
+     || NULL == root || NULL == root->data
+     || root->size < hash_options->hash_size)
+    {
+        return VCCRYPT_ERROR_MERKLE_VERIFY_INVALID_ARG;
+    }
+
+    if (index >= tree_size)
+    {
+        return VCCRYPT_ERROR_MERKLE_VERIFY_FAILED;
+    }
+
+    hash_size = hash_options->hash_size;
+    count = proof->size / hash_size;
+    path = (const uint8_t*)proof->data;
+    sn = tree_size - 1;
+
+    retval = vccrypt_merkle_hash_leaf(hash_options, data, size, digest);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_digest;
+    }
+
+    for (size_t i = 0; i < count; ++i, path += hash_size)
+    {
+        /* the proof is longer than the path to the root. */
+        if (0 == sn)
+        {
+            retval = VCCRYPT_ERROR_MERKLE_VERIFY_FAILED;
+            goto cleanup_digest;
+        }
+
+        if ((fn & 1) || fn == sn)
+        {
+            /* the sibling is on the left. */
+            retval =
+                vccrypt_merkle_hash_node(hash_options, path, digest, digest);
+
+            /* skip the levels where this node has no right sibling. */
+            while (0 == (fn & 1) && 0 != fn)
+            {
+                fn >>= 1;
+                sn >>= 1;
+            }
+        }
+        else
+        {
+            /* the sibling is on the right. */
+            retval =
+                vccrypt_merkle_hash_node(hash_options, digest, path, digest);
+        }
+
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto cleanup_digest;
+        }
+
+        fn >>= 1;
+        sn >>= 1;
+    }
+
+    /* the proof must reach the root, and match it. */
+    if (0 != sn || 0 != crypto_memcmp(digest, root->data, hash_size))
+    {
+        retval = VCCRYPT_ERROR_MERKLE_VERIFY_FAILED;
+    }
+
+cleanup_digest:
+    memset(digest, 0, sizeof(digest));
+
+    return retval;
+}
@@ -0,0 +1,69 @@
+/**
+ * \file parallel_private.h
+ *
+ * \brief Private worker pool used to split bulk operations across threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCRYPT_PARALLEL_PRIVATE_HEADER_GUARD
+#define VCCRYPT_PARALLEL_PRIVATE_HEADER_GUARD
+
+#include <stddef.h>
+#include <vpr/allocator.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief A single job run by the worker pool.
+ *
+ * \param context       The user context passed to vccrypt_parallel_run().
+ * \param worker        The index of the worker running this job, in the range
+ *                      [0, threads).  Jobs run by the same worker never run
+ *                      concurrently, so this can index per-worker state.
+ * \param job           The index of the job to run, in the range [0, jobs).
+ */
+typedef void (*vccrypt_parallel_job_t)(
+    void* context, size_t worker, size_t job);
+
+/**
+ * \brief Resolve the number of worker threads to use for a set of jobs.
+ *
+ * \param threads       The requested number of threads, or 0 to use the
+ *                      number of online processors.
+ * \param jobs          The number of jobs to run.
+ *
+ * \returns the number of workers that vccrypt_parallel_run() will use.  This
+ *          is at least 1 and never more than the number of jobs.  It is always
+ *          1 on platforms without thread support.
+ */
+size_t vccrypt_parallel_thread_count(size_t threads, size_t jobs);
+
+/**
+ * \brief Run jobs 0 through jobs - 1 on a pool of worker threads.
+ *
+ * The calling thread acts as worker 0.  Jobs are handed out dynamically, so
+ * uneven jobs are balanced across workers.  If a worker thread cannot be
+ * created, the remaining workers pick up its share, so every job is always run
+ * exactly once before this function returns.
+ *
+ * \param alloc_opts    The allocator to use for thread bookkeeping.
+ * \param threads       The number of workers, as returned by
+ *                      vccrypt_parallel_thread_count().
+ * \param jobs          The number of jobs to run.
+ * \param job           The job callback.
+ * \param context       The user context passed to each job.
+ */
+void vccrypt_parallel_run(
+    allocator_options_t* alloc_opts, size_t threads, size_t jobs,
+    vccrypt_parallel_job_t job, void* context);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCRYPT_PARALLEL_PRIVATE_HEADER_GUARD
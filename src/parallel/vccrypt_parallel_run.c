@@ -0,0 +1,176 @@
+/**
+ * \file vccrypt_parallel_run.c
+ *
+ * Run a set of jobs on a pool of worker threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+/* pthreads is a POSIX interface. */
+#define _POSIX_C_SOURCE 200809L
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/os.h>
+#include <vpr/parameters.h>
+
+#include "parallel_private.h"
+
+#if defined(VCCRYPT_OS_UNIX)
+#include <pthread.h>
+#endif
+
+/**
+ * Shared state for a single vccrypt_parallel_run() call.
+ */
+typedef struct parallel_pool
+{
+    size_t jobs;
+    size_t next_job;
+    vccrypt_parallel_job_t job;
+    void* context;
+    int threaded;
+#if defined(VCCRYPT_OS_UNIX)
+    pthread_mutex_t lock;
+#endif
+} parallel_pool_t;
+
+/**
+ * Per-thread startup data.
+ */
+typedef struct parallel_worker
+{
+    parallel_pool_t* pool;
+    size_t worker;
+#if defined(VCCRYPT_OS_UNIX)
+    pthread_t thread;
+#endif
+    int started;
+} parallel_worker_t;
+
+/**
+ * Claim the next job index, or return pool->jobs when all jobs are claimed.
+ */
+static size_t parallel_next_job(parallel_pool_t* pool)
+{
+    size_t job;
+
+#if defined(VCCRYPT_OS_UNIX)
+    if (pool->threaded)
+        pthread_mutex_lock(&pool->lock);
+#endif
+
+    job = pool->next_job;
+    if (job < pool->jobs)
+        ++pool->next_job;
+
+#if defined(VCCRYPT_OS_UNIX)
+    if (pool->threaded)
+        pthread_mutex_unlock(&pool->lock);
+#endif
+
+    return job;
+}
+
+/**
+ * Run jobs until none are left.
+ */
+static void parallel_drain(parallel_pool_t* pool, size_t worker)
+{
+    size_t job;
+
+    while ((job = parallel_next_job(pool)) < pool->jobs)
+    {
+        pool->job(pool->context, worker, job);
+    }
+}
+
+#if defined(VCCRYPT_OS_UNIX)
+/**
+ * Worker thread entry point.
+ */
+static void* parallel_thread_main(void* arg)
+{
+    parallel_worker_t* worker = (parallel_worker_t*)arg;
+
+    parallel_drain(worker->pool, worker->worker);
+
+    return NULL;
+}
+#endif
+
+/**
+ * \brief Run jobs 0 through jobs - 1 on a pool of worker threads.
+ *
+ * The calling thread acts as worker 0.  Jobs are handed out dynamically, so
+ * uneven jobs are balanced across workers.  If a worker thread cannot be
+ * created, the remaining workers pick up its share, so every job is always run
+ * exactly once before this function returns.
+ *
+ * \param alloc_opts    The allocator to use for thread bookkeeping.
+ * \param threads       The number of workers, as returned by
+ *                      vccrypt_parallel_thread_count().
+ * \param jobs          The number of jobs to run.
+ * \param job           The job callback.
+ * \param context       The user context passed to each job.
+ */
+void vccrypt_parallel_run(
+    allocator_options_t* alloc_opts, size_t threads, size_t jobs,
+    vccrypt_parallel_job_t job, void* context)
+{
+    parallel_pool_t pool;
+    parallel_worker_t* workers = NULL;
+
+    MODEL_ASSERT(NULL != job);
+
+    memset(&pool, 0, sizeof(pool));
+    pool.jobs = jobs;
+    pool.job = job;
+    pool.context = context;
+
+#if defined(VCCRYPT_OS_UNIX)
+    if (threads > 1 && NULL != alloc_opts)
+    {
+        workers = (parallel_worker_t*)
+            allocate(alloc_opts, (threads - 1) * sizeof(parallel_worker_t));
+    }
+
+    if (NULL != workers && 0 == pthread_mutex_init(&pool.lock, NULL))
+    {
+        pool.threaded = 1;
+
+        /* start the helper threads; the caller is worker 0. */
+        for (size_t i = 0; i < threads - 1; ++i)
+        {
+            workers[i].pool = &pool;
+            workers[i].worker = i + 1;
+            workers[i].started =
+                (0 == pthread_create(
+                            &workers[i].thread, NULL, &parallel_thread_main,
+                            &workers[i]));
+        }
+
+        parallel_drain(&pool, 0);
+
+        for (size_t i = 0; i < threads - 1; ++i)
+        {
+            if (workers[i].started)
+                pthread_join(workers[i].thread, NULL);
+        }
+
+        pthread_mutex_destroy(&pool.lock);
+        release(alloc_opts, workers);
+
+        return;
+    }
+
+    if (NULL != workers)
+        release(alloc_opts, workers);
+#else
+    (void)alloc_opts;
+    (void)threads;
+#endif
+
+    /* no threads available; run every job on the calling thread. */
+    parallel_drain(&pool, 0);
+}
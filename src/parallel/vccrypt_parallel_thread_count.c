@@ -0,0 +1,52 @@
+/**
+ * \file vccrypt_parallel_thread_count.c
+ *
+ * Resolve the number of worker threads for a parallel operation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+/* sysconf() is a POSIX interface. */
+#define _POSIX_C_SOURCE 200809L
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/os.h>
+#include <vpr/parameters.h>
+
+#include "parallel_private.h"
+
+#if defined(VCCRYPT_OS_UNIX)
+#include <unistd.h>
+#endif
+
+/**
+ * \brief Resolve the number of worker threads to use for a set of jobs.
+ *
+ * \param threads       The requested number of threads, or 0 to use the
+ *                      number of online processors.
+ * \param jobs          The number of jobs to run.
+ *
+ * \returns the number of workers that vccrypt_parallel_run() will use.  This
+ *          is at least 1 and never more than the number of jobs.  It is always
+ *          1 on platforms without thread support.
+ */
+size_t vccrypt_parallel_thread_count(size_t threads, size_t jobs)
+{
+#if defined(VCCRYPT_OS_UNIX)
+    if (0 == threads)
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cpus > 0) ? (size_t)cpus : 1;
+    }
+#else
+    threads = 1;
+#endif
+
+    if (threads > jobs)
+        threads = jobs;
+
+    if (threads < 1)
+        threads = 1;
+
+    return threads;
+}
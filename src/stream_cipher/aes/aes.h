@@ -1,10 +1,27 @@
 #ifndef AES_PRIVATE_HEADER_GUARD
 #define AES_PRIVATE_HEADER_GUARD
 
+#include <stddef.h>
 #include <stdint.h>
 
 #define AES_MAXNR 56
 
+/* maximum number of independent lanes accepted by AES_encrypt_lanes(). */
+#define AES_MAX_LANES 8
+
+/* AES-NI is available as a runtime-selected backend on x86 GCC / Clang. */
+#if (defined(__x86_64__) || defined(__i386__)) \
+ && (defined(__GNUC__) || defined(__clang__))
+#define AES_AESNI_SUPPORTED
+#endif
+
+/**
+ * \brief AES implementation selectors.
+ */
+#define AES_IMPL_PORTABLE 0
+#define AES_IMPL_AESNI 1
+#define AES_IMPL_BITSLICE 2
+
 #define GETU32(pt) ( \
     ((uint32_t)(pt)[0] << 24) ^ ((uint32_t)(pt)[1] << 16) ^ ((uint32_t)(pt)[2] << 8) ^ ((uint32_t)(pt)[3]))
 
@@ -16,16 +33,106 @@
         (ct)[3] = (uint8_t)(st); \
     }
 
+/*
+ * Compile-time unrolling helpers used to generate kernels specialized for a
+ * fixed number of rounds.  AES_UNROLL_n(A, x, b) expands to A(x, b) through
+ * A(x, b + n - 1).
+ */
+#define AES_UNROLL_1(A, x, b) A(x, b)
+#define AES_UNROLL_2(A, x, b) \
+    AES_UNROLL_1(A, x, b) AES_UNROLL_1(A, x, (b) + 1)
+#define AES_UNROLL_4(A, x, b) \
+    AES_UNROLL_2(A, x, b) AES_UNROLL_2(A, x, (b) + 2)
+#define AES_UNROLL_5(A, x, b) \
+    AES_UNROLL_4(A, x, b) AES_UNROLL_1(A, x, (b) + 4)
+#define AES_UNROLL_6(A, x, b) \
+    AES_UNROLL_4(A, x, b) AES_UNROLL_2(A, x, (b) + 4)
+#define AES_UNROLL_7(A, x, b) \
+    AES_UNROLL_6(A, x, b) AES_UNROLL_1(A, x, (b) + 6)
+#define AES_UNROLL_13(A, x, b) \
+    AES_UNROLL_7(A, x, b) AES_UNROLL_6(A, x, (b) + 7)
+#define AES_UNROLL_14(A, x, b) \
+    AES_UNROLL_7(A, x, b) AES_UNROLL_7(A, x, (b) + 7)
+#define AES_UNROLL_20(A, x, b) \
+    AES_UNROLL_14(A, x, b) AES_UNROLL_6(A, x, (b) + 14)
+#define AES_UNROLL_27(A, x, b) \
+    AES_UNROLL_14(A, x, b) AES_UNROLL_13(A, x, (b) + 14)
+#define AES_UNROLL_41(A, x, b) \
+    AES_UNROLL_14(A, x, b) AES_UNROLL_27(A, x, (b) + 14)
+#define AES_UNROLL_55(A, x, b) \
+    AES_UNROLL_14(A, x, b) AES_UNROLL_41(A, x, (b) + 14)
+
 #ifdef __cplusplus
 extern "C" {
 #endif /*__cplusplus*/
 
+/*
+ * The round keys are the last member so that an AES_KEY can be stored in a
+ * buffer of AES_key_size(rounds) bytes.  Backends never touch round keys past
+ * key->rounds, so a truncated AES_KEY must only be copied with AES_key_size().
+ */
 typedef struct aes_key
 {
-    uint32_t rd_key[4 * (AES_MAXNR + 1)];
     int rounds;
+    int impl;
+    uint32_t rd_key[4 * (AES_MAXNR + 1)];
 } AES_KEY;
 
+/**
+ * Return the number of rounds used for the given key size and round
+ * multiplier, or 0 if the key size is invalid.
+ */
+int AES_rounds(const int bits, const int roundMult);
+
+/**
+ * Return the number of bytes of an AES_KEY used by a schedule with the given
+ * number of rounds.
+ */
+size_t AES_key_size(const int rounds);
+
+/**
+ * Return the fastest AES implementation supported by this CPU.
+ */
+int AES_impl_default(void);
+
+/**
+ * Return the preferred AES implementation for bulk encryption, such as CTR
+ * keystream generation.  Without hardware support, the constant-time bitsliced
+ * code is only preferred over the T-table code when the library is built with
+ * VCCRYPT_AES_CONSTANT_TIME.
+ */
+int AES_impl_default_bulk(void);
+
+/**
+ * Return non-zero if the given AES implementation is supported by this CPU.
+ */
+int AES_impl_supported(int impl);
+
+/**
+ * Expand the cipher key into the encryption key schedule using the given
+ * implementation.
+ */
+int AES_set_encrypt_key_impl(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    const int impl, AES_KEY* key);
+
+/**
+ * Expand the cipher key into the decryption key schedule using the given
+ * implementation.
+ */
+int AES_set_decrypt_key_impl(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    const int impl, AES_KEY* key);
+
+/**
+ * Expand the cipher key into the encryption (encrypt != 0) or decryption key
+ * schedule using the given implementation, reusing a previously expanded
+ * schedule if the key schedule cache is enabled.
+ */
+int AES_set_key_cached(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    const int impl, const int encrypt, AES_KEY* key);
+
 /**
  * Expand the cipher key into the encryption key schedule.
  */
@@ -52,6 +159,85 @@ void AES_encrypt(const unsigned char* in, unsigned char* out, const AES_KEY* key
  */
 void AES_decrypt(const unsigned char* in, unsigned char* out, const AES_KEY* key);
 
+/*
+ * Encrypt a run of independent blocks
+ * in and out must either be identical or not overlap
+ */
+void AES_encrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key);
+
+/*
+ * Decrypt a run of independent blocks
+ * in and out must either be identical or not overlap
+ */
+void AES_decrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key);
+
+/*
+ * Encrypt one block per lane in place, each lane under its own key
+ * blocks holds lanes consecutive blocks; lanes must be at most AES_MAX_LANES
+ */
+void AES_encrypt_lanes(
+    unsigned char* blocks, const AES_KEY* const* keys, size_t lanes);
+
+/*
+ * Return non-zero if AES_encrypt_lanes() interleaves this key schedule with
+ * the other lanes, rather than encrypting its lane one block at a time
+ */
+int AES_lanes_supported(const AES_KEY* key);
+
+/*
+ * Portable T-table backend.
+ */
+int AES_portable_set_encrypt_key(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    AES_KEY* key);
+int AES_portable_set_decrypt_key(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    AES_KEY* key);
+void AES_portable_encrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key);
+void AES_portable_decrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key);
+
+/*
+ * Constant-time bitsliced backend.  Only AES-256 encryption schedules are
+ * supported.  Round keys are stored in a compressed bitsliced form.
+ */
+int AES_bitslice_set_encrypt_key(
+    const unsigned char* userKey, const int roundMult, AES_KEY* key);
+void AES_bitslice_encrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key);
+void AES_bitslice_encrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key);
+
+#ifdef AES_AESNI_SUPPORTED
+/*
+ * AES-NI backend.  Only AES-256 schedules are supported.  Round keys are
+ * stored in byte order rather than as big-endian words.
+ */
+int AES_aesni_available(void);
+int AES_aesni_set_encrypt_key(
+    const unsigned char* userKey, const int roundMult, AES_KEY* key);
+int AES_aesni_set_decrypt_key(
+    const unsigned char* userKey, const int roundMult, AES_KEY* key);
+void AES_aesni_encrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key);
+void AES_aesni_decrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key);
+void AES_aesni_encrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key);
+void AES_aesni_decrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key);
+void AES_aesni_encrypt_lanes(
+    unsigned char* blocks, const AES_KEY* const* keys, size_t lanes);
+#endif /*AES_AESNI_SUPPORTED*/
+
 #ifdef __cplusplus
 }
 #endif /*__cplusplus*/
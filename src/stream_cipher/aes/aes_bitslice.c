@@ -0,0 +1,800 @@
+/**
+ * \file aes_bitslice.c
+ *
+ * Constant-time bitsliced AES backend for CPUs without AES instructions,
+ * derived from the aes_ct and aes_ct64 implementations in BearSSL.
+ *
+ * Each of the eight state words holds one bit of every state byte.  On 64-bit
+ * targets four blocks are processed in parallel in 64-bit words (aes_ct64);
+ * on 32-bit targets, such as ARMv7 and Cortex-M4, two blocks are processed in
+ * 32-bit words (aes_ct), so that the state fits in registers without multiword
+ * arithmetic.  Define VCCRYPT_AES_BITSLICE_32 to use the 32-bit variant on a
+ * 64-bit target.
+ *
+ * The S-box is computed with the Boyar-Peralta circuit ("A new combinational
+ * logic minimization technique with applications to cryptology",
+ * https://eprint.iacr.org/2009/191.pdf), so there are no secret-dependent
+ * table lookups or branches.  The whole backend needs no tables beyond the key
+ * schedule.
+ *
+ * Round keys are kept in a compressed bitsliced form of 16 bytes per round,
+ * which fits exactly in AES_KEY's rd_key array, and are expanded to the
+ * eight-word form one round at a time during encryption.
+ *
+ * Only encryption is bitsliced; CTR mode never needs the inverse cipher.
+ * Decryption schedules requested for this backend use the T-table code.
+ *
+ * \copyright 2016 Thomas Pornin (released under the MIT license), with
+ * modifications copyright 2026 Velo Payments, Inc.  All rights reserved.
+ *
+ * Copyright (c) 2016 Thomas Pornin <pornin@bolet.org>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "aes.h"
+#include "../../byte_order/byte_order_private.h"
+
+/* 32-bit targets use two blocks in 32-bit words. */
+#if !defined(VCCRYPT_AES_BITSLICE_32) && UINTPTR_MAX <= 0xFFFFFFFF
+#define VCCRYPT_AES_BITSLICE_32
+#endif
+
+#ifdef VCCRYPT_AES_BITSLICE_32
+typedef uint32_t bitslice_word_t;
+#define BITSLICE_WORD_BITS 32
+#else
+typedef uint64_t bitslice_word_t;
+#define BITSLICE_WORD_BITS 64
+#endif
+
+/* the number of blocks encrypted in parallel. */
+#define BITSLICE_BLOCKS (BITSLICE_WORD_BITS / 16)
+
+/**
+ * Apply the AES S-box to each byte of the bitsliced state.
+ *
+ * Variables x* (input) and s* (output) are numbered in "reverse" order: x0 is
+ * the high bit and x7 is the low bit.
+ */
+static void bitslice_sbox(bitslice_word_t* q)
+{
+    bitslice_word_t x0, x1, x2, x3, x4, x5, x6, x7;
+    bitslice_word_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    bitslice_word_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    bitslice_word_t y20, y21;
+    bitslice_word_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    bitslice_word_t z10, z11, z12, z13, z14, z15, z16, z17;
+    bitslice_word_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    bitslice_word_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    bitslice_word_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    bitslice_word_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    bitslice_word_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    bitslice_word_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    bitslice_word_t t60, t61, t62, t63, t64, t65, t66, t67;
+    bitslice_word_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* top linear transformation. */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* non-linear section. */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* bottom linear transformation. */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/*
+ * Swap bit groups between two words; used to transpose to and from the
+ * bitsliced representation.  The masks are truncated to the word size.
+ */
+#define BITSLICE_SWAPN(cl, ch, s, x, y) \
+    do \
+    { \
+        bitslice_word_t a, b; \
+        a = (x); \
+        b = (y); \
+        (x) = (a & (bitslice_word_t)cl) | ((b & (bitslice_word_t)cl) << (s)); \
+        (y) = ((a & (bitslice_word_t)ch) >> (s)) | (b & (bitslice_word_t)ch); \
+    } while (0)
+
+#define BITSLICE_SWAP2(x, y) \
+    BITSLICE_SWAPN(0x5555555555555555, 0xAAAAAAAAAAAAAAAA, 1, x, y)
+#define BITSLICE_SWAP4(x, y) \
+    BITSLICE_SWAPN(0x3333333333333333, 0xCCCCCCCCCCCCCCCC, 2, x, y)
+#define BITSLICE_SWAP8(x, y) \
+    BITSLICE_SWAPN(0x0F0F0F0F0F0F0F0F, 0xF0F0F0F0F0F0F0F0, 4, x, y)
+
+/**
+ * Transpose the state to or from the bitsliced representation.  This
+ * operation is its own inverse.
+ */
+static void bitslice_ortho(bitslice_word_t* q)
+{
+    BITSLICE_SWAP2(q[0], q[1]);
+    BITSLICE_SWAP2(q[2], q[3]);
+    BITSLICE_SWAP2(q[4], q[5]);
+    BITSLICE_SWAP2(q[6], q[7]);
+
+    BITSLICE_SWAP4(q[0], q[2]);
+    BITSLICE_SWAP4(q[1], q[3]);
+    BITSLICE_SWAP4(q[4], q[6]);
+    BITSLICE_SWAP4(q[5], q[7]);
+
+    BITSLICE_SWAP8(q[0], q[4]);
+    BITSLICE_SWAP8(q[1], q[5]);
+    BITSLICE_SWAP8(q[2], q[6]);
+    BITSLICE_SWAP8(q[3], q[7]);
+}
+
+#ifdef VCCRYPT_AES_BITSLICE_32
+
+/**
+ * Load two blocks and transpose them into the bitsliced state.  The words of
+ * the first block go to the even state words, and those of the second block to
+ * the odd state words.
+ */
+static void bitslice_load(bitslice_word_t* q, const uint8_t* in)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        q[2 * i] = vccrypt_load_le32(in + 4 * i);
+        q[2 * i + 1] = vccrypt_load_le32(in + 16 + 4 * i);
+    }
+
+    bitslice_ortho(q);
+}
+
+/**
+ * Transpose the bitsliced state back and store its two blocks.
+ */
+static void bitslice_store(uint8_t* out, bitslice_word_t* q)
+{
+    bitslice_ortho(q);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        vccrypt_store_le32(out + 4 * i, q[2 * i]);
+        vccrypt_store_le32(out + 16 + 4 * i, q[2 * i + 1]);
+    }
+}
+
+/**
+ * Apply the S-box to each byte of a word, in constant time.
+ */
+static uint32_t bitslice_sub_word(uint32_t x)
+{
+    bitslice_word_t q[8];
+
+    for (int i = 0; i < 8; ++i)
+    {
+        q[i] = x;
+    }
+
+    bitslice_ortho(q);
+    bitslice_sbox(q);
+    bitslice_ortho(q);
+
+    return q[0];
+}
+
+/**
+ * Compress one round key, given as four words, to four words of bitsliced key
+ * material.
+ */
+static void bitslice_compress_round_key(uint32_t* comp, const uint32_t* w)
+{
+    bitslice_word_t q[8];
+
+    for (int i = 0; i < 4; ++i)
+    {
+        q[2 * i] = w[i];
+        q[2 * i + 1] = w[i];
+    }
+
+    bitslice_ortho(q);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        comp[i] = (q[2 * i] & 0x55555555) | (q[2 * i + 1] & 0xAAAAAAAA);
+    }
+
+    memset(q, 0, sizeof(q));
+}
+
+/**
+ * Expand one compressed round key into the eight-word bitsliced form.
+ */
+static inline void bitslice_round_key(
+    bitslice_word_t* sk, const AES_KEY* key, int round)
+{
+    const uint32_t* comp = key->rd_key + 4 * round;
+
+    for (int u = 0; u < 4; ++u)
+    {
+        uint32_t x = comp[u] & 0x55555555;
+        uint32_t y = comp[u] & 0xAAAAAAAA;
+
+        sk[2 * u + 0] = x | (x << 1);
+        sk[2 * u + 1] = y | (y >> 1);
+    }
+}
+
+/**
+ * ShiftRows on the bitsliced state.
+ */
+static inline void bitslice_shift_rows(bitslice_word_t* q)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        uint32_t x = q[i];
+
+        q[i] =
+            (x & 0x000000FF)
+          | ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6)
+          | ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4)
+          | ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
+    }
+}
+
+#else /* 64-bit words */
+
+/**
+ * Spread one block, given as four little-endian words, over two state words.
+ */
+static void bitslice_interleave_in(
+    uint64_t* q0, uint64_t* q1, const uint32_t* w)
+{
+    uint64_t x0, x1, x2, x3;
+
+    x0 = w[0];
+    x1 = w[1];
+    x2 = w[2];
+    x3 = w[3];
+    x0 |= (x0 << 16);
+    x1 |= (x1 << 16);
+    x2 |= (x2 << 16);
+    x3 |= (x3 << 16);
+    x0 &= (uint64_t)0x0000FFFF0000FFFF;
+    x1 &= (uint64_t)0x0000FFFF0000FFFF;
+    x2 &= (uint64_t)0x0000FFFF0000FFFF;
+    x3 &= (uint64_t)0x0000FFFF0000FFFF;
+    x0 |= (x0 << 8);
+    x1 |= (x1 << 8);
+    x2 |= (x2 << 8);
+    x3 |= (x3 << 8);
+    x0 &= (uint64_t)0x00FF00FF00FF00FF;
+    x1 &= (uint64_t)0x00FF00FF00FF00FF;
+    x2 &= (uint64_t)0x00FF00FF00FF00FF;
+    x3 &= (uint64_t)0x00FF00FF00FF00FF;
+    *q0 = x0 | (x2 << 8);
+    *q1 = x1 | (x3 << 8);
+}
+
+/**
+ * Gather one block, as four little-endian words, from two state words.
+ */
+static void bitslice_interleave_out(uint32_t* w, uint64_t q0, uint64_t q1)
+{
+    uint64_t x0, x1, x2, x3;
+
+    x0 = q0 & (uint64_t)0x00FF00FF00FF00FF;
+    x1 = q1 & (uint64_t)0x00FF00FF00FF00FF;
+    x2 = (q0 >> 8) & (uint64_t)0x00FF00FF00FF00FF;
+    x3 = (q1 >> 8) & (uint64_t)0x00FF00FF00FF00FF;
+    x0 |= (x0 >> 8);
+    x1 |= (x1 >> 8);
+    x2 |= (x2 >> 8);
+    x3 |= (x3 >> 8);
+    x0 &= (uint64_t)0x0000FFFF0000FFFF;
+    x1 &= (uint64_t)0x0000FFFF0000FFFF;
+    x2 &= (uint64_t)0x0000FFFF0000FFFF;
+    x3 &= (uint64_t)0x0000FFFF0000FFFF;
+    w[0] = (uint32_t)x0 | (uint32_t)(x0 >> 16);
+    w[1] = (uint32_t)x1 | (uint32_t)(x1 >> 16);
+    w[2] = (uint32_t)x2 | (uint32_t)(x2 >> 16);
+    w[3] = (uint32_t)x3 | (uint32_t)(x3 >> 16);
+}
+
+/**
+ * Expand one compressed round key into the eight-word bitsliced form.
+ */
+static inline void bitslice_round_key(
+    bitslice_word_t* sk, const AES_KEY* key, int round)
+{
+    uint64_t comp[2];
+
+    memcpy(comp, key->rd_key + 4 * round, sizeof(comp));
+
+    for (int u = 0; u < 2; ++u)
+    {
+        uint64_t x0, x1, x2, x3;
+
+        x0 = x1 = x2 = x3 = comp[u];
+        x0 &= (uint64_t)0x1111111111111111;
+        x1 &= (uint64_t)0x2222222222222222;
+        x2 &= (uint64_t)0x4444444444444444;
+        x3 &= (uint64_t)0x8888888888888888;
+        x1 >>= 1;
+        x2 >>= 2;
+        x3 >>= 3;
+        sk[4 * u + 0] = (x0 << 4) - x0;
+        sk[4 * u + 1] = (x1 << 4) - x1;
+        sk[4 * u + 2] = (x2 << 4) - x2;
+        sk[4 * u + 3] = (x3 << 4) - x3;
+    }
+}
+
+/**
+ * ShiftRows on the bitsliced state.
+ */
+static inline void bitslice_shift_rows(bitslice_word_t* q)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        uint64_t x = q[i];
+
+        q[i] =
+            (x & (uint64_t)0x000000000000FFFF)
+          | ((x & (uint64_t)0x00000000FFF00000) >> 4)
+          | ((x & (uint64_t)0x00000000000F0000) << 12)
+          | ((x & (uint64_t)0x0000FF0000000000) >> 8)
+          | ((x & (uint64_t)0x000000FF00000000) << 8)
+          | ((x & (uint64_t)0xF000000000000000) >> 12)
+          | ((x & (uint64_t)0x0FFF000000000000) << 4);
+    }
+}
+
+/**
+ * Load four blocks and transpose them into the bitsliced state.
+ */
+static void bitslice_load(bitslice_word_t* q, const uint8_t* in)
+{
+    uint32_t w[4];
+
+    for (int i = 0; i < 4; ++i)
+    {
+        for (int j = 0; j < 4; ++j)
+        {
+            w[j] = vccrypt_load_le32(in + 16 * i + 4 * j);
+        }
+
+        bitslice_interleave_in(&q[i], &q[i + 4], w);
+    }
+
+    bitslice_ortho(q);
+    memset(w, 0, sizeof(w));
+}
+
+/**
+ * Transpose the bitsliced state back and store its four blocks.
+ */
+static void bitslice_store(uint8_t* out, bitslice_word_t* q)
+{
+    uint32_t w[4];
+
+    bitslice_ortho(q);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        bitslice_interleave_out(w, q[i], q[i + 4]);
+
+        for (int j = 0; j < 4; ++j)
+        {
+            vccrypt_store_le32(out + 16 * i + 4 * j, w[j]);
+        }
+    }
+
+    memset(w, 0, sizeof(w));
+}
+
+/**
+ * Apply the S-box to each byte of a word, in constant time.
+ */
+static uint32_t bitslice_sub_word(uint32_t x)
+{
+    bitslice_word_t q[8];
+
+    memset(q, 0, sizeof(q));
+    q[0] = x;
+    bitslice_ortho(q);
+    bitslice_sbox(q);
+    bitslice_ortho(q);
+
+    return (uint32_t)q[0];
+}
+
+/**
+ * Compress one round key, given as four words, to two 64-bit words of
+ * bitsliced key material.
+ */
+static void bitslice_compress_round_key(uint32_t* comp, const uint32_t* w)
+{
+    bitslice_word_t q[8];
+    uint64_t out[2];
+
+    bitslice_interleave_in(&q[0], &q[4], w);
+    q[1] = q[0];
+    q[2] = q[0];
+    q[3] = q[0];
+    q[5] = q[4];
+    q[6] = q[4];
+    q[7] = q[4];
+    bitslice_ortho(q);
+
+    out[0] =
+        (q[0] & (uint64_t)0x1111111111111111)
+      | (q[1] & (uint64_t)0x2222222222222222)
+      | (q[2] & (uint64_t)0x4444444444444444)
+      | (q[3] & (uint64_t)0x8888888888888888);
+    out[1] =
+        (q[4] & (uint64_t)0x1111111111111111)
+      | (q[5] & (uint64_t)0x2222222222222222)
+      | (q[6] & (uint64_t)0x4444444444444444)
+      | (q[7] & (uint64_t)0x8888888888888888);
+
+    memcpy(comp, out, sizeof(out));
+    memset(q, 0, sizeof(q));
+    memset(out, 0, sizeof(out));
+}
+
+#endif /* VCCRYPT_AES_BITSLICE_32 */
+
+/**
+ * Map the round multiplier to the number of AES-256 rounds, using the same
+ * defaulting rules as the portable implementation.
+ */
+static int bitslice_rounds(const int roundMult)
+{
+    switch (roundMult)
+    {
+        case 4:
+            return 56;
+        case 3:
+            return 42;
+        case 2:
+            return 28;
+        case 1:
+        default:
+            return 14;
+    }
+}
+
+/**
+ * Expand an AES-256 cipher key into the compressed bitsliced encryption key
+ * schedule.
+ */
+int AES_bitslice_set_encrypt_key(
+    const unsigned char* userKey, const int roundMult, AES_KEY* key)
+{
+    uint32_t skey[4 * (AES_MAXNR + 1)];
+    uint32_t tmp;
+    uint32_t rcon = 0x01;
+    int nkf, i, j;
+
+    if (!userKey || !key)
+        return -1;
+
+    key->rounds = bitslice_rounds(roundMult);
+    key->impl = AES_IMPL_BITSLICE;
+    nkf = 4 * (key->rounds + 1);
+
+    /* standard AES-256 schedule, extended with the continued rcon sequence. */
+    for (i = 0; i < 8; ++i)
+    {
+        skey[i] = vccrypt_load_le32(userKey + 4 * i);
+    }
+
+    tmp = skey[7];
+    for (i = 8, j = 0; i < nkf; ++i)
+    {
+        if (0 == j)
+        {
+            tmp = (tmp << 24) | (tmp >> 8);
+            tmp = bitslice_sub_word(tmp) ^ rcon;
+            rcon = ((rcon << 1) ^ (0x1b & -(rcon >> 7))) & 0xff;
+        }
+        else if (4 == j)
+        {
+            tmp = bitslice_sub_word(tmp);
+        }
+
+        tmp ^= skey[i - 8];
+        skey[i] = tmp;
+
+        if (++j == 8)
+            j = 0;
+    }
+
+    /* compress each round key to 16 bytes of bitsliced key material. */
+    for (i = 0; i <= key->rounds; ++i)
+    {
+        bitslice_compress_round_key(key->rd_key + 4 * i, skey + 4 * i);
+    }
+
+    memset(skey, 0, sizeof(skey));
+
+    return 0;
+}
+
+/**
+ * XOR a round key into the state.
+ */
+static inline void bitslice_add_round_key(
+    bitslice_word_t* q, const bitslice_word_t* sk)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        q[i] ^= sk[i];
+    }
+}
+
+/**
+ * Rotate a state word by half its width.
+ */
+static inline bitslice_word_t bitslice_rotr_half(bitslice_word_t x)
+{
+    return
+        (x << (BITSLICE_WORD_BITS / 2)) | (x >> (BITSLICE_WORD_BITS / 2));
+}
+
+/**
+ * MixColumns on the bitsliced state.  Each row occupies a quarter of a word.
+ */
+static inline void bitslice_mix_columns(bitslice_word_t* q)
+{
+    bitslice_word_t q0, q1, q2, q3, q4, q5, q6, q7;
+    bitslice_word_t r0, r1, r2, r3, r4, r5, r6, r7;
+    const int ROW = BITSLICE_WORD_BITS / 4;
+
+    q0 = q[0];
+    q1 = q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = q[5];
+    q6 = q[6];
+    q7 = q[7];
+    r0 = (q0 >> ROW) | (q0 << (3 * ROW));
+    r1 = (q1 >> ROW) | (q1 << (3 * ROW));
+    r2 = (q2 >> ROW) | (q2 << (3 * ROW));
+    r3 = (q3 >> ROW) | (q3 << (3 * ROW));
+    r4 = (q4 >> ROW) | (q4 << (3 * ROW));
+    r5 = (q5 >> ROW) | (q5 << (3 * ROW));
+    r6 = (q6 >> ROW) | (q6 << (3 * ROW));
+    r7 = (q7 >> ROW) | (q7 << (3 * ROW));
+
+    q[0] = q7 ^ r7 ^ r0 ^ bitslice_rotr_half(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ bitslice_rotr_half(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ bitslice_rotr_half(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ bitslice_rotr_half(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ bitslice_rotr_half(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ bitslice_rotr_half(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ bitslice_rotr_half(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ bitslice_rotr_half(q7 ^ r7);
+}
+
+/**
+ * Encrypt BITSLICE_BLOCKS blocks in parallel.
+ */
+static void bitslice_encrypt_group(
+    const uint8_t* in, uint8_t* out, const AES_KEY* key)
+{
+    bitslice_word_t q[8];
+    bitslice_word_t sk[8];
+    int i;
+
+    bitslice_load(q, in);
+
+    bitslice_round_key(sk, key, 0);
+    bitslice_add_round_key(q, sk);
+    for (i = 1; i < key->rounds; ++i)
+    {
+        bitslice_sbox(q);
+        bitslice_shift_rows(q);
+        bitslice_mix_columns(q);
+        bitslice_round_key(sk, key, i);
+        bitslice_add_round_key(q, sk);
+    }
+    bitslice_sbox(q);
+    bitslice_shift_rows(q);
+    bitslice_round_key(sk, key, key->rounds);
+    bitslice_add_round_key(q, sk);
+
+    bitslice_store(out, q);
+
+    memset(q, 0, sizeof(q));
+    memset(sk, 0, sizeof(sk));
+}
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+void AES_bitslice_encrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key)
+{
+    AES_bitslice_encrypt_blocks(in, out, 1, key);
+}
+
+/*
+ * Encrypt a run of independent blocks
+ * in and out must either be identical or not overlap
+ */
+void AES_bitslice_encrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key)
+{
+    uint8_t tmp[16 * BITSLICE_BLOCKS];
+
+    while (blocks >= BITSLICE_BLOCKS)
+    {
+        bitslice_encrypt_group(in, out, key);
+        in += sizeof(tmp);
+        out += sizeof(tmp);
+        blocks -= BITSLICE_BLOCKS;
+    }
+
+    /* pad a partial group out to a full group. */
+    if (blocks > 0)
+    {
+        memset(tmp, 0, sizeof(tmp));
+        memcpy(tmp, in, 16 * blocks);
+        bitslice_encrypt_group(tmp, tmp, key);
+        memcpy(out, tmp, 16 * blocks);
+        memset(tmp, 0, sizeof(tmp));
+    }
+}
@@ -37,6 +37,7 @@
 #endif
 #endif
 
+#include <cbmc/model_assert.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -2448,7 +2449,7 @@ static const uint32_t rcon[] = {
 /**
  * Expand the cipher key into the encryption key schedule.
  */
-int AES_set_encrypt_key(
+int AES_portable_set_encrypt_key(
     const unsigned char* userKey, const int bits, const int roundMult,
     AES_KEY* key)
 {
@@ -2463,6 +2464,7 @@ int AES_set_encrypt_key(
         return -2;
 
     rk = key->rd_key;
+    key->impl = AES_IMPL_PORTABLE;
 
     if (bits == 128)
     {
@@ -2584,7 +2586,7 @@ int AES_set_encrypt_key(
 /**
  * Expand the cipher key into the decryption key schedule.
  */
-int AES_set_decrypt_key(
+int AES_portable_set_decrypt_key(
     const unsigned char* userKey, const int bits, const int roundMult,
     AES_KEY* key)
 {
@@ -2593,7 +2595,7 @@ int AES_set_decrypt_key(
     uint32_t temp;
 
     /* first, start with an encryption schedule */
-    status = AES_set_encrypt_key(userKey, bits, roundMult, key);
+    status = AES_portable_set_encrypt_key(userKey, bits, roundMult, key);
     if (status < 0)
         return status;
 
@@ -2644,237 +2646,254 @@ int AES_set_decrypt_key(
 }
 
 /*
- * Encrypt a single block
- * in and out can overlap
+ * One pair of full encryption rounds, starting with round 2p + 1.  The state
+ * moves from s to t and back to s.
  */
-void AES_encrypt(const unsigned char* in, unsigned char* out, const AES_KEY* key)
-{
-    const uint32_t* rk;
-    uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
-    int r;
+#define AES_TE_PAIR(rk, p) \
+    AES_TE_ROUND(t, s, rk, 8 * (p) + 4) \
+    AES_TE_ROUND(s, t, rk, 8 * (p) + 8)
 
-    rk = key->rd_key;
+/*
+ * One full encryption round from state s into state d, with round key k.
+ */
+#define AES_TE_ROUND(d, s, rk, k) \
+    d##0 = \
+        Te0[(s##0 >> 24)] ^ \
+        Te1[(s##1 >> 16) & 0xff] ^ \
+        Te2[(s##2 >> 8) & 0xff] ^ \
+        Te3[(s##3)&0xff] ^ \
+        (rk)[(k) + 0]; \
+    d##1 = \
+        Te0[(s##1 >> 24)] ^ \
+        Te1[(s##2 >> 16) & 0xff] ^ \
+        Te2[(s##3 >> 8) & 0xff] ^ \
+        Te3[(s##0)&0xff] ^ \
+        (rk)[(k) + 1]; \
+    d##2 = \
+        Te0[(s##2 >> 24)] ^ \
+        Te1[(s##3 >> 16) & 0xff] ^ \
+        Te2[(s##0 >> 8) & 0xff] ^ \
+        Te3[(s##1)&0xff] ^ \
+        (rk)[(k) + 2]; \
+    d##3 = \
+        Te0[(s##3 >> 24)] ^ \
+        Te1[(s##0 >> 16) & 0xff] ^ \
+        Te2[(s##1 >> 8) & 0xff] ^ \
+        Te3[(s##2)&0xff] ^ \
+        (rk)[(k) + 3];
 
-    /*
-	 * map byte array block to cipher state
-	 * and add initial round key:
-	 */
-    s0 = GETU32(in) ^ rk[0];
-    s1 = GETU32(in + 4) ^ rk[1];
-    s2 = GETU32(in + 8) ^ rk[2];
-    s3 = GETU32(in + 12) ^ rk[3];
+/*
+ * One pair of full decryption rounds, starting with round 2p + 1.
+ */
+#define AES_TD_PAIR(rk, p) \
+    AES_TD_ROUND(t, s, rk, 8 * (p) + 4) \
+    AES_TD_ROUND(s, t, rk, 8 * (p) + 8)
 
-    /*
-     * Nr - 1 full rounds:
-     */
-    r = key->rounds >> 1;
-    for (;;)
-    {
-        t0 =
-            Te0[(s0 >> 24)] ^
-            Te1[(s1 >> 16) & 0xff] ^
-            Te2[(s2 >> 8) & 0xff] ^
-            Te3[(s3)&0xff] ^
-            rk[4];
-        t1 =
-            Te0[(s1 >> 24)] ^
-            Te1[(s2 >> 16) & 0xff] ^
-            Te2[(s3 >> 8) & 0xff] ^
-            Te3[(s0)&0xff] ^
-            rk[5];
-        t2 =
-            Te0[(s2 >> 24)] ^
-            Te1[(s3 >> 16) & 0xff] ^
-            Te2[(s0 >> 8) & 0xff] ^
-            Te3[(s1)&0xff] ^
-            rk[6];
-        t3 =
-            Te0[(s3 >> 24)] ^
-            Te1[(s0 >> 16) & 0xff] ^
-            Te2[(s1 >> 8) & 0xff] ^
-            Te3[(s2)&0xff] ^
-            rk[7];
+/*
+ * One full decryption round from state s into state d, with round key k.
+ */
+#define AES_TD_ROUND(d, s, rk, k) \
+    d##0 = \
+        Td0[(s##0 >> 24)] ^ \
+        Td1[(s##3 >> 16) & 0xff] ^ \
+        Td2[(s##2 >> 8) & 0xff] ^ \
+        Td3[(s##1)&0xff] ^ \
+        (rk)[(k) + 0]; \
+    d##1 = \
+        Td0[(s##1 >> 24)] ^ \
+        Td1[(s##0 >> 16) & 0xff] ^ \
+        Td2[(s##3 >> 8) & 0xff] ^ \
+        Td3[(s##2)&0xff] ^ \
+        (rk)[(k) + 1]; \
+    d##2 = \
+        Td0[(s##2 >> 24)] ^ \
+        Td1[(s##1 >> 16) & 0xff] ^ \
+        Td2[(s##0 >> 8) & 0xff] ^ \
+        Td3[(s##3)&0xff] ^ \
+        (rk)[(k) + 2]; \
+    d##3 = \
+        Td0[(s##3 >> 24)] ^ \
+        Td1[(s##2 >> 16) & 0xff] ^ \
+        Td2[(s##1 >> 8) & 0xff] ^ \
+        Td3[(s##0)&0xff] ^ \
+        (rk)[(k) + 3];
 
-        rk += 8;
-        if (--r == 0)
-        {
-            break;
-        }
+/*
+ * Generate a single block encryption kernel for a fixed, even number of
+ * rounds.  PAIRS unrolls the (rounds / 2 - 1) leading pairs of full rounds;
+ * the last full round and the final round follow.
+ */
+#define AES_PORTABLE_ENCRYPT_KERNEL(rounds, PAIRS) \
+static void aes_portable_encrypt_##rounds( \
+    const unsigned char* in, unsigned char* out, const uint32_t* rk) \
+{ \
+    uint32_t s0, s1, s2, s3, t0, t1, t2, t3; \
+    \
+    s0 = GETU32(in) ^ rk[0]; \
+    s1 = GETU32(in + 4) ^ rk[1]; \
+    s2 = GETU32(in + 8) ^ rk[2]; \
+    s3 = GETU32(in + 12) ^ rk[3]; \
+    \
+    PAIRS(AES_TE_PAIR, rk, 0) \
+    AES_TE_ROUND(t, s, rk, 4 * ((rounds) - 1)) \
+    \
+    rk += 4 * (rounds); \
+    s0 = \
+        (Te2[(t0 >> 24)] & 0xff000000) ^ \
+        (Te3[(t1 >> 16) & 0xff] & 0x00ff0000) ^ \
+        (Te0[(t2 >> 8) & 0xff] & 0x0000ff00) ^ \
+        (Te1[(t3)&0xff] & 0x000000ff) ^ \
+        rk[0]; \
+    PUTU32(out, s0); \
+    s1 = \
+        (Te2[(t1 >> 24)] & 0xff000000) ^ \
+        (Te3[(t2 >> 16) & 0xff] & 0x00ff0000) ^ \
+        (Te0[(t3 >> 8) & 0xff] & 0x0000ff00) ^ \
+        (Te1[(t0)&0xff] & 0x000000ff) ^ \
+        rk[1]; \
+    PUTU32(out + 4, s1); \
+    s2 = \
+        (Te2[(t2 >> 24)] & 0xff000000) ^ \
+        (Te3[(t3 >> 16) & 0xff] & 0x00ff0000) ^ \
+        (Te0[(t0 >> 8) & 0xff] & 0x0000ff00) ^ \
+        (Te1[(t1)&0xff] & 0x000000ff) ^ \
+        rk[2]; \
+    PUTU32(out + 8, s2); \
+    s3 = \
+        (Te2[(t3 >> 24)] & 0xff000000) ^ \
+        (Te3[(t0 >> 16) & 0xff] & 0x00ff0000) ^ \
+        (Te0[(t1 >> 8) & 0xff] & 0x0000ff00) ^ \
+        (Te1[(t2)&0xff] & 0x000000ff) ^ \
+        rk[3]; \
+    PUTU32(out + 12, s3); \
+}
 
-        s0 =
-            Te0[(t0 >> 24)] ^
-            Te1[(t1 >> 16) & 0xff] ^
-            Te2[(t2 >> 8) & 0xff] ^
-            Te3[(t3)&0xff] ^
-            rk[0];
-        s1 =
-            Te0[(t1 >> 24)] ^
-            Te1[(t2 >> 16) & 0xff] ^
-            Te2[(t3 >> 8) & 0xff] ^
-            Te3[(t0)&0xff] ^
-            rk[1];
-        s2 =
-            Te0[(t2 >> 24)] ^
-            Te1[(t3 >> 16) & 0xff] ^
-            Te2[(t0 >> 8) & 0xff] ^
-            Te3[(t1)&0xff] ^
-            rk[2];
-        s3 =
-            Te0[(t3 >> 24)] ^
-            Te1[(t0 >> 16) & 0xff] ^
-            Te2[(t1 >> 8) & 0xff] ^
-            Te3[(t2)&0xff] ^
-            rk[3];
-    }
+/*
+ * Generate a single block decryption kernel for a fixed, even number of
+ * rounds.
+ */
+#define AES_PORTABLE_DECRYPT_KERNEL(rounds, PAIRS) \
+static void aes_portable_decrypt_##rounds( \
+    const unsigned char* in, unsigned char* out, const uint32_t* rk) \
+{ \
+    uint32_t s0, s1, s2, s3, t0, t1, t2, t3; \
+    \
+    s0 = GETU32(in) ^ rk[0]; \
+    s1 = GETU32(in + 4) ^ rk[1]; \
+    s2 = GETU32(in + 8) ^ rk[2]; \
+    s3 = GETU32(in + 12) ^ rk[3]; \
+    \
+    PAIRS(AES_TD_PAIR, rk, 0) \
+    AES_TD_ROUND(t, s, rk, 4 * ((rounds) - 1)) \
+    \
+    rk += 4 * (rounds); \
+    s0 = \
+        (((uint32_t)Td4[(t0 >> 24)]) << 24) ^ \
+        (Td4[(t3 >> 16) & 0xff] << 16) ^ \
+        (Td4[(t2 >> 8) & 0xff] << 8) ^ \
+        (Td4[(t1)&0xff]) ^ \
+        rk[0]; \
+    PUTU32(out, s0); \
+    s1 = \
+        (((uint32_t)Td4[(t1 >> 24)]) << 24) ^ \
+        (Td4[(t0 >> 16) & 0xff] << 16) ^ \
+        (Td4[(t3 >> 8) & 0xff] << 8) ^ \
+        (Td4[(t2)&0xff]) ^ \
+        rk[1]; \
+    PUTU32(out + 4, s1); \
+    s2 = \
+        (((uint32_t)Td4[(t2 >> 24)]) << 24) ^ \
+        (Td4[(t1 >> 16) & 0xff] << 16) ^ \
+        (Td4[(t0 >> 8) & 0xff] << 8) ^ \
+        (Td4[(t3)&0xff]) ^ \
+        rk[2]; \
+    PUTU32(out + 8, s2); \
+    s3 = \
+        (((uint32_t)Td4[(t3 >> 24)]) << 24) ^ \
+        (Td4[(t2 >> 16) & 0xff] << 16) ^ \
+        (Td4[(t1 >> 8) & 0xff] << 8) ^ \
+        (Td4[(t0)&0xff]) ^ \
+        rk[3]; \
+    PUTU32(out + 12, s3); \
+}
 
-    /*
-	 * apply last round and
-	 * map cipher state to byte array block:
-	 */
-    s0 =
-        (Te2[(t0 >> 24)] & 0xff000000) ^
-        (Te3[(t1 >> 16) & 0xff] & 0x00ff0000) ^
-        (Te0[(t2 >> 8) & 0xff] & 0x0000ff00) ^
-        (Te1[(t3)&0xff] & 0x000000ff) ^
-        rk[0];
-    PUTU32(out, s0);
-    s1 =
-        (Te2[(t1 >> 24)] & 0xff000000) ^
-        (Te3[(t2 >> 16) & 0xff] & 0x00ff0000) ^
-        (Te0[(t3 >> 8) & 0xff] & 0x0000ff00) ^
-        (Te1[(t0)&0xff] & 0x000000ff) ^
-        rk[1];
-    PUTU32(out + 4, s1);
-    s2 =
-        (Te2[(t2 >> 24)] & 0xff000000) ^
-        (Te3[(t3 >> 16) & 0xff] & 0x00ff0000) ^
-        (Te0[(t0 >> 8) & 0xff] & 0x0000ff00) ^
-        (Te1[(t1)&0xff] & 0x000000ff) ^
-        rk[2];
-    PUTU32(out + 8, s2);
-    s3 =
-        (Te2[(t3 >> 24)] & 0xff000000) ^
-        (Te3[(t0 >> 16) & 0xff] & 0x00ff0000) ^
-        (Te0[(t1 >> 8) & 0xff] & 0x0000ff00) ^
-        (Te1[(t2)&0xff] & 0x000000ff) ^
-        rk[3];
-    PUTU32(out + 12, s3);
+/*
+ * Fully unrolled kernels for AES-128, AES-192, and the AES-256 FIPS, 2X, 3X,
+ * and 4X schedules.
+ */
+AES_PORTABLE_ENCRYPT_KERNEL(10, AES_UNROLL_4)
+AES_PORTABLE_ENCRYPT_KERNEL(12, AES_UNROLL_5)
+AES_PORTABLE_ENCRYPT_KERNEL(14, AES_UNROLL_6)
+AES_PORTABLE_ENCRYPT_KERNEL(28, AES_UNROLL_13)
+AES_PORTABLE_ENCRYPT_KERNEL(42, AES_UNROLL_20)
+AES_PORTABLE_ENCRYPT_KERNEL(56, AES_UNROLL_27)
+AES_PORTABLE_DECRYPT_KERNEL(10, AES_UNROLL_4)
+AES_PORTABLE_DECRYPT_KERNEL(12, AES_UNROLL_5)
+AES_PORTABLE_DECRYPT_KERNEL(14, AES_UNROLL_6)
+AES_PORTABLE_DECRYPT_KERNEL(28, AES_UNROLL_13)
+AES_PORTABLE_DECRYPT_KERNEL(42, AES_UNROLL_20)
+AES_PORTABLE_DECRYPT_KERNEL(56, AES_UNROLL_27)
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+void AES_portable_encrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key)
+{
+    /* select the unrolled kernel for the round count of this schedule. */
+    switch (key->rounds)
+    {
+        case 10:
+            aes_portable_encrypt_10(in, out, key->rd_key);
+            return;
+        case 12:
+            aes_portable_encrypt_12(in, out, key->rd_key);
+            return;
+        case 14:
+            aes_portable_encrypt_14(in, out, key->rd_key);
+            return;
+        case 28:
+            aes_portable_encrypt_28(in, out, key->rd_key);
+            return;
+        case 42:
+            aes_portable_encrypt_42(in, out, key->rd_key);
+            return;
+        default:
+            MODEL_ASSERT(56 == key->rounds);
+            aes_portable_encrypt_56(in, out, key->rd_key);
+            return;
+    }
 }
 
 /*
  * Decrypt a single block
  * in and out can overlap
  */
-void AES_decrypt(const unsigned char* in, unsigned char* out, const AES_KEY* key)
+void AES_portable_decrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key)
 {
-    const uint32_t* rk;
-    uint32_t s0, s1, s2, s3, t0, t1, t2, t3;
-    int r;
-
-    rk = key->rd_key;
-
-    /*
-	 * map byte array block to cipher state
-	 * and add initial round key:
-	 */
-    s0 = GETU32(in) ^ rk[0];
-    s1 = GETU32(in + 4) ^ rk[1];
-    s2 = GETU32(in + 8) ^ rk[2];
-    s3 = GETU32(in + 12) ^ rk[3];
-
-    /*
-     * Nr - 1 full rounds:
-     */
-    r = key->rounds >> 1;
-    for (;;)
+    /* select the unrolled kernel for the round count of this schedule. */
+    switch (key->rounds)
     {
-        t0 =
-            Td0[(s0 >> 24)] ^
-            Td1[(s3 >> 16) & 0xff] ^
-            Td2[(s2 >> 8) & 0xff] ^
-            Td3[(s1)&0xff] ^
-            rk[4];
-        t1 =
-            Td0[(s1 >> 24)] ^
-            Td1[(s0 >> 16) & 0xff] ^
-            Td2[(s3 >> 8) & 0xff] ^
-            Td3[(s2)&0xff] ^
-            rk[5];
-        t2 =
-            Td0[(s2 >> 24)] ^
-            Td1[(s1 >> 16) & 0xff] ^
-            Td2[(s0 >> 8) & 0xff] ^
-            Td3[(s3)&0xff] ^
-            rk[6];
-        t3 =
-            Td0[(s3 >> 24)] ^
-            Td1[(s2 >> 16) & 0xff] ^
-            Td2[(s1 >> 8) & 0xff] ^
-            Td3[(s0)&0xff] ^
-            rk[7];
-
-        rk += 8;
-        if (--r == 0)
-        {
-            break;
-        }
-
-        s0 =
-            Td0[(t0 >> 24)] ^
-            Td1[(t3 >> 16) & 0xff] ^
-            Td2[(t2 >> 8) & 0xff] ^
-            Td3[(t1)&0xff] ^
-            rk[0];
-        s1 =
-            Td0[(t1 >> 24)] ^
-            Td1[(t0 >> 16) & 0xff] ^
-            Td2[(t3 >> 8) & 0xff] ^
-            Td3[(t2)&0xff] ^
-            rk[1];
-        s2 =
-            Td0[(t2 >> 24)] ^
-            Td1[(t1 >> 16) & 0xff] ^
-            Td2[(t0 >> 8) & 0xff] ^
-            Td3[(t3)&0xff] ^
-            rk[2];
-        s3 =
-            Td0[(t3 >> 24)] ^
-            Td1[(t2 >> 16) & 0xff] ^
-            Td2[(t1 >> 8) & 0xff] ^
-            Td3[(t0)&0xff] ^
-            rk[3];
+        case 10:
+            aes_portable_decrypt_10(in, out, key->rd_key);
+            return;
+        case 12:
+            aes_portable_decrypt_12(in, out, key->rd_key);
+            return;
+        case 14:
+            aes_portable_decrypt_14(in, out, key->rd_key);
+            return;
+        case 28:
+            aes_portable_decrypt_28(in, out, key->rd_key);
+            return;
+        case 42:
+            aes_portable_decrypt_42(in, out, key->rd_key);
+            return;
+        default:
+            MODEL_ASSERT(56 == key->rounds);
+            aes_portable_decrypt_56(in, out, key->rd_key);
+            return;
     }
-
-    /*
-	 * apply last round and
-	 * map cipher state to byte array block:
-	 */
-    s0 =
-        (((uint32_t)Td4[(t0 >> 24)]) << 24) ^
-        (Td4[(t3 >> 16) & 0xff] << 16) ^
-        (Td4[(t2 >> 8) & 0xff] << 8) ^
-        (Td4[(t1)&0xff]) ^
-        rk[0];
-    PUTU32(out, s0);
-    s1 =
-        (((uint32_t)Td4[(t1 >> 24)]) << 24) ^
-        (Td4[(t0 >> 16) & 0xff] << 16) ^
-        (Td4[(t3 >> 8) & 0xff] << 8) ^
-        (Td4[(t2)&0xff]) ^
-        rk[1];
-    PUTU32(out + 4, s1);
-    s2 =
-        (((uint32_t)Td4[(t2 >> 24)]) << 24) ^
-        (Td4[(t1 >> 16) & 0xff] << 16) ^
-        (Td4[(t0 >> 8) & 0xff] << 8) ^
-        (Td4[(t3)&0xff]) ^
-        rk[2];
-    PUTU32(out + 8, s2);
-    s3 =
-        (((uint32_t)Td4[(t3 >> 24)]) << 24) ^
-        (Td4[(t2 >> 16) & 0xff] << 16) ^
-        (Td4[(t1 >> 8) & 0xff] << 8) ^
-        (Td4[(t0)&0xff]) ^
-        rk[3];
-    PUTU32(out + 12, s3);
 }
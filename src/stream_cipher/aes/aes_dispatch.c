@@ -0,0 +1,299 @@
+/**
+ * \file aes_dispatch.c
+ *
+ * Runtime selection between the T-table, bitsliced, and hardware AES backends.
+ *
+ * The backend is chosen when a key schedule is expanded and is recorded in the
+ * AES_KEY, so that block operations only need to check the key.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "aes.h"
+
+/**
+ * Return the number of rounds used for the given key size and round
+ * multiplier, or 0 if the key size is invalid.
+ */
+int AES_rounds(const int bits, const int roundMult)
+{
+    switch (bits)
+    {
+        case 128:
+            return 10;
+
+        case 192:
+            return 12;
+
+        case 256:
+            return (roundMult >= 2 && roundMult <= 4) ? 14 * roundMult : 14;
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Return the number of bytes of an AES_KEY used by a schedule with the given
+ * number of rounds.
+ */
+size_t AES_key_size(const int rounds)
+{
+    return offsetof(AES_KEY, rd_key) + 16 * (size_t)(rounds + 1);
+}
+
+/**
+ * Return non-zero if the given AES implementation is supported by this CPU.
+ */
+int AES_impl_supported(int impl)
+{
+    switch (impl)
+    {
+        case AES_IMPL_PORTABLE:
+        case AES_IMPL_BITSLICE:
+            return 1;
+
+#ifdef AES_AESNI_SUPPORTED
+        case AES_IMPL_AESNI:
+            return AES_aesni_available();
+#endif
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Return the fastest AES implementation supported by this CPU.
+ */
+int AES_impl_default(void)
+{
+    if (AES_impl_supported(AES_IMPL_AESNI))
+        return AES_IMPL_AESNI;
+
+    return AES_IMPL_PORTABLE;
+}
+
+/**
+ * Return the preferred AES implementation for bulk encryption, such as CTR
+ * keystream generation.  Without hardware support, this is the faster T-table
+ * code unless the library is built with VCCRYPT_AES_CONSTANT_TIME, in which
+ * case the slower but constant-time bitsliced code is used instead.
+ */
+int AES_impl_default_bulk(void)
+{
+    if (AES_impl_supported(AES_IMPL_AESNI))
+        return AES_IMPL_AESNI;
+
+#ifdef VCCRYPT_AES_CONSTANT_TIME
+    return AES_IMPL_BITSLICE;
+#else
+    return AES_IMPL_PORTABLE;
+#endif
+}
+
+/**
+ * Expand the cipher key into the encryption key schedule using the given
+ * implementation.
+ */
+int AES_set_encrypt_key_impl(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    const int impl, AES_KEY* key)
+{
+    if (!AES_impl_supported(impl))
+        return -3;
+
+#ifdef AES_AESNI_SUPPORTED
+    /* the hardware schedule is only used for AES-256. */
+    if (AES_IMPL_AESNI == impl && 256 == bits)
+        return AES_aesni_set_encrypt_key(userKey, roundMult, key);
+#endif
+
+    /* the bitsliced schedule is only used for AES-256. */
+    if (AES_IMPL_BITSLICE == impl && 256 == bits)
+        return AES_bitslice_set_encrypt_key(userKey, roundMult, key);
+
+    return AES_portable_set_encrypt_key(userKey, bits, roundMult, key);
+}
+
+/**
+ * Expand the cipher key into the decryption key schedule using the given
+ * implementation.
+ */
+int AES_set_decrypt_key_impl(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    const int impl, AES_KEY* key)
+{
+    if (!AES_impl_supported(impl))
+        return -3;
+
+#ifdef AES_AESNI_SUPPORTED
+    /* the hardware schedule is only used for AES-256. */
+    if (AES_IMPL_AESNI == impl && 256 == bits)
+        return AES_aesni_set_decrypt_key(userKey, roundMult, key);
+#endif
+
+    /* there is no bitsliced inverse cipher; use the T-table code. */
+
+    return AES_portable_set_decrypt_key(userKey, bits, roundMult, key);
+}
+
+/**
+ * Expand the cipher key into the encryption key schedule.
+ */
+int AES_set_encrypt_key(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    AES_KEY* key)
+{
+    return
+        AES_set_encrypt_key_impl(
+            userKey, bits, roundMult, AES_impl_default(), key);
+}
+
+/**
+ * Expand the cipher key into the decryption key schedule.
+ */
+int AES_set_decrypt_key(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    AES_KEY* key)
+{
+    return
+        AES_set_decrypt_key_impl(
+            userKey, bits, roundMult, AES_impl_default(), key);
+}
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+void AES_encrypt(const unsigned char* in, unsigned char* out, const AES_KEY* key)
+{
+#ifdef AES_AESNI_SUPPORTED
+    if (AES_IMPL_AESNI == key->impl)
+    {
+        AES_aesni_encrypt(in, out, key);
+        return;
+    }
+#endif
+
+    if (AES_IMPL_BITSLICE == key->impl)
+    {
+        AES_bitslice_encrypt(in, out, key);
+        return;
+    }
+
+    AES_portable_encrypt(in, out, key);
+}
+
+/*
+ * Decrypt a single block
+ * in and out can overlap
+ */
+void AES_decrypt(const unsigned char* in, unsigned char* out, const AES_KEY* key)
+{
+#ifdef AES_AESNI_SUPPORTED
+    if (AES_IMPL_AESNI == key->impl)
+    {
+        AES_aesni_decrypt(in, out, key);
+        return;
+    }
+#endif
+
+    AES_portable_decrypt(in, out, key);
+}
+
+/*
+ * Encrypt a run of independent blocks
+ * in and out must either be identical or not overlap
+ */
+void AES_encrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key)
+{
+#ifdef AES_AESNI_SUPPORTED
+    if (AES_IMPL_AESNI == key->impl)
+    {
+        AES_aesni_encrypt_blocks(in, out, blocks, key);
+        return;
+    }
+#endif
+
+    if (AES_IMPL_BITSLICE == key->impl)
+    {
+        AES_bitslice_encrypt_blocks(in, out, blocks, key);
+        return;
+    }
+
+    while (blocks--)
+    {
+        AES_portable_encrypt(in, out, key);
+        in += 16;
+        out += 16;
+    }
+}
+
+/*
+ * Encrypt one block per lane in place, each lane under its own key
+ * blocks holds lanes consecutive blocks; lanes must be at most AES_MAX_LANES
+ */
+void AES_encrypt_lanes(
+    unsigned char* blocks, const AES_KEY* const* keys, size_t lanes)
+{
+    size_t i;
+
+#ifdef AES_AESNI_SUPPORTED
+    /* the lanes can only be interleaved if every schedule is for AES-NI. */
+    for (i = 0; i < lanes && AES_lanes_supported(keys[i]); ++i)
+        ;
+
+    if (i == lanes)
+    {
+        AES_aesni_encrypt_lanes(blocks, keys, lanes);
+        return;
+    }
+#endif
+
+    for (i = 0; i < lanes; ++i)
+    {
+        AES_encrypt(blocks + 16 * i, blocks + 16 * i, keys[i]);
+    }
+}
+
+/*
+ * Return non-zero if AES_encrypt_lanes() interleaves this key schedule with
+ * the other lanes, rather than encrypting its lane one block at a time
+ */
+int AES_lanes_supported(const AES_KEY* key)
+{
+#ifdef AES_AESNI_SUPPORTED
+    return AES_IMPL_AESNI == key->impl;
+#else
+    (void)key;
+
+    return 0;
+#endif
+}
+
+/*
+ * Decrypt a run of independent blocks
+ * in and out must either be identical or not overlap
+ */
+void AES_decrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key)
+{
+#ifdef AES_AESNI_SUPPORTED
+    if (AES_IMPL_AESNI == key->impl)
+    {
+        AES_aesni_decrypt_blocks(in, out, blocks, key);
+        return;
+    }
+#endif
+
+    while (blocks--)
+    {
+        AES_portable_decrypt(in, out, key);
+        in += 16;
+        out += 16;
+    }
+}
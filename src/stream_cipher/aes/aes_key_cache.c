@@ -0,0 +1,451 @@
+/**
+ * \file aes_key_cache.c
+ *
+ * Opt-in, bounded, thread-safe cache of expanded AES key schedules.
+ *
+ * Entries are located by a SipHash-2-4 tag of the key material and schedule
+ * parameters, keyed with a secret drawn from the PRNG when the cache is
+ * enabled, and are then verified against the full key with a constant-time
+ * comparison.  The cache is set associative: the tag selects a set of up to
+ * AES_KEY_CACHE_WAYS slots, so a lookup only touches the tags of one set.
+ * The tags live in a compact array of their own, apart from the much larger
+ * key schedules.  A miss expands the key without holding the lock and inserts
+ * it afterwards, so that a slow expansion doesn't stall other threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+/* pthreads is a POSIX interface. */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <string.h>
+#include <vccrypt/compare.h>
+#include <vccrypt/key_schedule_cache.h>
+#include <vccrypt/os.h>
+
+#include "aes.h"
+#include "../../byte_order/byte_order_private.h"
+
+#if defined(VCCRYPT_OS_UNIX)
+#include <pthread.h>
+#endif
+
+#define AES_KEY_CACHE_MAX_KEY_BYTES 32
+
+/* the number of slots in each set. */
+#define AES_KEY_CACHE_WAYS 8
+
+/**
+ * The tag and age of a cached key schedule.  A last_used value of zero marks
+ * an empty slot.
+ */
+typedef struct aes_key_cache_slot
+{
+    uint64_t tag;
+    uint64_t last_used;
+} aes_key_cache_slot_t;
+
+/**
+ * A single cached key schedule, stored at the same index as its slot.
+ */
+typedef struct aes_key_cache_entry
+{
+    int bits;
+    int round_mult;
+    int impl;
+    int encrypt;
+    unsigned char user_key[AES_KEY_CACHE_MAX_KEY_BYTES];
+    AES_KEY key;
+} aes_key_cache_entry_t;
+
+/**
+ * Process-wide cache state.
+ */
+typedef struct aes_key_cache
+{
+    allocator_options_t* alloc_opts;
+    aes_key_cache_slot_t* slots;
+    aes_key_cache_entry_t* entries;
+    size_t sets;
+    size_t ways;
+    uint64_t secret[2];
+    uint64_t tick;
+    size_t hits;
+    size_t misses;
+} aes_key_cache_t;
+
+static aes_key_cache_t aes_key_cache;
+
+/* bumped whenever the cache is cleared, so a late insert can be dropped. */
+static uint64_t aes_key_cache_generation = 0;
+
+/* checked without the lock so that a disabled cache costs nothing. */
+static volatile int aes_key_cache_enabled = 0;
+
+#if defined(VCCRYPT_OS_UNIX)
+static pthread_mutex_t aes_key_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+#define ROTL64(x, b) (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+
+#define SIPROUND \
+    do { \
+        v0 += v1; v1 = ROTL64(v1, 13); v1 ^= v0; v0 = ROTL64(v0, 32); \
+        v2 += v3; v3 = ROTL64(v3, 16); v3 ^= v2; \
+        v0 += v3; v3 = ROTL64(v3, 21); v3 ^= v0; \
+        v2 += v1; v1 = ROTL64(v1, 17); v1 ^= v2; v2 = ROTL64(v2, 32); \
+    } while (0)
+
+/**
+ * Compute SipHash-2-4 of the given message.
+ */
+static uint64_t siphash24(
+    const uint64_t secret[2], const unsigned char* in, size_t size)
+{
+    uint64_t v0 = secret[0] ^ 0x736f6d6570736575ULL;
+    uint64_t v1 = secret[1] ^ 0x646f72616e646f6dULL;
+    uint64_t v2 = secret[0] ^ 0x6c7967656e657261ULL;
+    uint64_t v3 = secret[1] ^ 0x7465646279746573ULL;
+    uint64_t b = ((uint64_t)size) << 56;
+    size_t full = size & ~(size_t)7;
+    uint64_t m;
+
+    for (size_t i = 0; i < full; i += 8)
+    {
+        m = vccrypt_load_le64(in + i);
+        v3 ^= m;
+        SIPROUND;
+        SIPROUND;
+        v0 ^= m;
+    }
+
+    for (size_t i = 0; i < (size & 7); ++i)
+        b |= ((uint64_t)in[full + i]) << (8 * i);
+
+    v3 ^= b;
+    SIPROUND;
+    SIPROUND;
+    v0 ^= b;
+
+    v2 ^= 0xff;
+    SIPROUND;
+    SIPROUND;
+    SIPROUND;
+    SIPROUND;
+
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+/**
+ * Compute the cache tag for a key schedule request.
+ */
+static uint64_t aes_key_cache_tag(
+    const unsigned char* userKey, int key_bytes, int roundMult, int impl,
+    int encrypt)
+{
+    unsigned char msg[AES_KEY_CACHE_MAX_KEY_BYTES + 4];
+    uint64_t tag;
+
+    memcpy(msg, userKey, key_bytes);
+    msg[key_bytes + 0] = (unsigned char)key_bytes;
+    msg[key_bytes + 1] = (unsigned char)roundMult;
+    msg[key_bytes + 2] = (unsigned char)impl;
+    msg[key_bytes + 3] = (unsigned char)(encrypt ? 1 : 0);
+
+    tag = siphash24(aes_key_cache.secret, msg, key_bytes + 4);
+
+    memset(msg, 0, sizeof(msg));
+
+    return tag;
+}
+
+/**
+ * Lock the cache.
+ */
+static void aes_key_cache_acquire(void)
+{
+#if defined(VCCRYPT_OS_UNIX)
+    pthread_mutex_lock(&aes_key_cache_lock);
+#endif
+}
+
+/**
+ * Unlock the cache.
+ */
+static void aes_key_cache_release(void)
+{
+#if defined(VCCRYPT_OS_UNIX)
+    pthread_mutex_unlock(&aes_key_cache_lock);
+#endif
+}
+
+/**
+ * Wipe and release all entries.  Must be called with the lock held.
+ */
+static void aes_key_cache_clear(void)
+{
+    size_t count = aes_key_cache.sets * aes_key_cache.ways;
+
+    if (NULL != aes_key_cache.entries)
+    {
+        memset(
+            aes_key_cache.entries, 0, count * sizeof(aes_key_cache_entry_t));
+        release(aes_key_cache.alloc_opts, aes_key_cache.entries);
+    }
+
+    if (NULL != aes_key_cache.slots)
+    {
+        memset(aes_key_cache.slots, 0, count * sizeof(aes_key_cache_slot_t));
+        release(aes_key_cache.alloc_opts, aes_key_cache.slots);
+    }
+
+    memset(&aes_key_cache, 0, sizeof(aes_key_cache));
+    aes_key_cache_enabled = 0;
+    ++aes_key_cache_generation;
+}
+
+/**
+ * Find the slot holding the given key schedule, or choose the slot that it
+ * should replace.  Must be called with the lock held.
+ *
+ * Only the set selected by the tag is searched.  On a match, *found is set to
+ * 1 and the matching index is returned.  Otherwise, *found is set to 0 and the
+ * index of an empty or the least recently used slot in the set is returned.
+ */
+static size_t aes_key_cache_find(
+    uint64_t tag, const unsigned char* userKey, int bits, int roundMult,
+    int impl, int encrypt, int* found)
+{
+    size_t first = (size_t)(tag % aes_key_cache.sets) * aes_key_cache.ways;
+    size_t victim = first;
+
+    for (size_t i = first; i < first + aes_key_cache.ways; ++i)
+    {
+        const aes_key_cache_slot_t* slot = &aes_key_cache.slots[i];
+        const aes_key_cache_entry_t* entry = &aes_key_cache.entries[i];
+
+        if (0 != slot->last_used && slot->tag == tag
+         && entry->bits == bits && entry->round_mult == roundMult
+         && entry->impl == impl && entry->encrypt == encrypt
+         && 0 == crypto_memcmp(entry->user_key, userKey, bits / 8))
+        {
+            *found = 1;
+            return i;
+        }
+
+        if (slot->last_used < aes_key_cache.slots[victim].last_used)
+            victim = i;
+    }
+
+    *found = 0;
+    return victim;
+}
+
+/**
+ * \brief Enable the AES key schedule cache.
+ *
+ * \param prng          The PRNG used to generate the secret key for the
+ *                      keyed hash that indexes the cache.
+ * \param alloc_opts    The allocator used for the cache entries.
+ * \param capacity      The maximum number of key schedules to cache.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_key_schedule_cache_enable(
+    vccrypt_prng_context_t* prng, allocator_options_t* alloc_opts,
+    size_t capacity)
+{
+#if defined(VCCRYPT_OS_UNIX)
+    unsigned char secret[16];
+    aes_key_cache_slot_t* slots;
+    aes_key_cache_entry_t* entries;
+    size_t ways, sets;
+    int retval;
+
+    if (NULL == prng || NULL == alloc_opts || 0 == capacity
+     || capacity > VCCRYPT_KEY_SCHEDULE_CACHE_MAX_CAPACITY)
+    {
+        return VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_INVALID_ARG;
+    }
+
+    retval = vccrypt_prng_read_c(prng, secret, sizeof(secret));
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+        return retval;
+
+    /* use whole sets only, so the cache never exceeds the capacity. */
+    ways = capacity < AES_KEY_CACHE_WAYS ? capacity : AES_KEY_CACHE_WAYS;
+    sets = capacity / ways;
+
+    slots = (aes_key_cache_slot_t*)
+        allocate(alloc_opts, sets * ways * sizeof(aes_key_cache_slot_t));
+    if (NULL == slots)
+    {
+        memset(secret, 0, sizeof(secret));
+        return VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_OUT_OF_MEMORY;
+    }
+
+    entries = (aes_key_cache_entry_t*)
+        allocate(alloc_opts, sets * ways * sizeof(aes_key_cache_entry_t));
+    if (NULL == entries)
+    {
+        release(alloc_opts, slots);
+        memset(secret, 0, sizeof(secret));
+        return VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_OUT_OF_MEMORY;
+    }
+
+    memset(slots, 0, sets * ways * sizeof(aes_key_cache_slot_t));
+    memset(entries, 0, sets * ways * sizeof(aes_key_cache_entry_t));
+
+    aes_key_cache_acquire();
+
+    aes_key_cache_clear();
+    aes_key_cache.alloc_opts = alloc_opts;
+    aes_key_cache.slots = slots;
+    aes_key_cache.entries = entries;
+    aes_key_cache.sets = sets;
+    aes_key_cache.ways = ways;
+    aes_key_cache.secret[0] = vccrypt_load_le64(secret);
+    aes_key_cache.secret[1] = vccrypt_load_le64(secret + 8);
+    aes_key_cache_enabled = 1;
+
+    aes_key_cache_release();
+
+    memset(secret, 0, sizeof(secret));
+
+    return VCCRYPT_STATUS_SUCCESS;
+#else
+    (void)prng;
+    (void)alloc_opts;
+    (void)capacity;
+
+    return VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_UNSUPPORTED;
+#endif
+}
+
+/**
+ * \brief Disable the AES key schedule cache, wiping and releasing all entries.
+ */
+void vccrypt_key_schedule_cache_disable()
+{
+    aes_key_cache_acquire();
+    aes_key_cache_clear();
+    aes_key_cache_release();
+}
+
+/**
+ * \brief Read the hit and miss counters of the key schedule cache.
+ *
+ * \param hits          Set to the number of cache hits.  May be NULL.
+ * \param misses        Set to the number of cache misses.  May be NULL.
+ */
+void vccrypt_key_schedule_cache_stats(size_t* hits, size_t* misses)
+{
+    aes_key_cache_acquire();
+
+    if (NULL != hits)
+        *hits = aes_key_cache.hits;
+
+    if (NULL != misses)
+        *misses = aes_key_cache.misses;
+
+    aes_key_cache_release();
+}
+
+/**
+ * Expand the cipher key into an encryption or decryption key schedule using
+ * the given implementation, reusing a cached schedule when the key schedule
+ * cache is enabled.
+ */
+int AES_set_key_cached(
+    const unsigned char* userKey, const int bits, const int roundMult,
+    const int impl, const int encrypt, AES_KEY* key)
+{
+    int key_bytes = bits / 8;
+    aes_key_cache_entry_t* entry;
+    uint64_t generation;
+    uint64_t tag;
+    size_t index;
+    int found;
+    int retval;
+
+    /* fast path: the cache is disabled or the request can't be cached. */
+    if (!aes_key_cache_enabled || NULL == userKey || NULL == key
+     || (128 != bits && 192 != bits && 256 != bits))
+    {
+        goto uncached;
+    }
+
+    aes_key_cache_acquire();
+
+    /* the cache may have been disabled since the unlocked check. */
+    if (NULL == aes_key_cache.slots)
+    {
+        aes_key_cache_release();
+        goto uncached;
+    }
+
+    generation = aes_key_cache_generation;
+    tag = aes_key_cache_tag(userKey, key_bytes, roundMult, impl, encrypt);
+    index =
+        aes_key_cache_find(
+            tag, userKey, bits, roundMult, impl, encrypt, &found);
+    if (found)
+    {
+        entry = &aes_key_cache.entries[index];
+        aes_key_cache.slots[index].last_used = ++aes_key_cache.tick;
+        memcpy(key, &entry->key, AES_key_size(entry->key.rounds));
+        ++aes_key_cache.hits;
+        aes_key_cache_release();
+
+        return 0;
+    }
+
+    aes_key_cache_release();
+
+    /* expand the key without the lock, so other lookups aren't held up. */
+    retval =
+        encrypt
+            ? AES_set_encrypt_key_impl(userKey, bits, roundMult, impl, key)
+            : AES_set_decrypt_key_impl(userKey, bits, roundMult, impl, key);
+    if (0 != retval)
+        return retval;
+
+    aes_key_cache_acquire();
+
+    /* drop the insert if the cache was disabled or re-enabled meanwhile. */
+    if (generation == aes_key_cache_generation)
+    {
+        /* another thread may have inserted the same key in the meantime. */
+        index =
+            aes_key_cache_find(
+                tag, userKey, bits, roundMult, impl, encrypt, &found);
+        if (!found)
+        {
+            entry = &aes_key_cache.entries[index];
+            memset(entry, 0, sizeof(aes_key_cache_entry_t));
+            entry->bits = bits;
+            entry->round_mult = roundMult;
+            entry->impl = impl;
+            entry->encrypt = encrypt;
+            memcpy(entry->user_key, userKey, key_bytes);
+            memcpy(&entry->key, key, AES_key_size(key->rounds));
+            aes_key_cache.slots[index].tag = tag;
+        }
+
+        aes_key_cache.slots[index].last_used = ++aes_key_cache.tick;
+        ++aes_key_cache.misses;
+    }
+
+    aes_key_cache_release();
+
+    return 0;
+
+uncached:
+    return
+        encrypt
+            ? AES_set_encrypt_key_impl(userKey, bits, roundMult, impl, key)
+            : AES_set_decrypt_key_impl(userKey, bits, roundMult, impl, key);
+}
@@ -0,0 +1,461 @@
+/**
+ * \file aes_ni.c
+ *
+ * AES-NI backend for AES-256 and its extended round schedules.
+ *
+ * The key schedule is expanded with AESKEYGENASSIST, using the same extended
+ * rcon sequence as the portable implementation, so that the 2X, 3X, and 4X
+ * variants produce identical ciphertext on both backends.  Decryption uses the
+ * equivalent inverse cipher, with AESIMC applied to the inner round keys.
+ *
+ * Block operations are generated as fully unrolled kernels for each of the
+ * four round counts and selected from the round count recorded in the key.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "aes.h"
+
+#ifdef AES_AESNI_SUPPORTED
+
+#include <cbmc/model_assert.h>
+#include <wmmintrin.h>
+
+#include "../../cpu/cpu_private.h"
+
+#define AESNI_TARGET __attribute__((target("aes,sse2")))
+
+/**
+ * Return non-zero if this CPU supports the AES-NI instruction set.
+ */
+int AES_aesni_available(void)
+{
+    return vccrypt_cpu_has(VCCRYPT_CPU_AESNI);
+}
+
+/**
+ * Map the round multiplier to the number of AES-256 rounds, using the same
+ * defaulting rules as the portable implementation.
+ */
+static int aesni_rounds(const int roundMult)
+{
+    switch (roundMult)
+    {
+        case 4:
+            return 56;
+        case 3:
+            return 42;
+        case 2:
+            return 28;
+        case 1:
+        default:
+            return 14;
+    }
+}
+
+/**
+ * Derive the next even round key from the previous two round keys.
+ */
+static inline __m128i AESNI_TARGET aesni_key_256_even(
+    __m128i prev, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, 0xff);
+    prev = _mm_xor_si128(prev, _mm_slli_si128(prev, 4));
+    prev = _mm_xor_si128(prev, _mm_slli_si128(prev, 4));
+    prev = _mm_xor_si128(prev, _mm_slli_si128(prev, 4));
+
+    return _mm_xor_si128(prev, assist);
+}
+
+/**
+ * Derive the next odd round key from the previous two round keys.
+ */
+static inline __m128i AESNI_TARGET aesni_key_256_odd(
+    __m128i even, __m128i prev)
+{
+    __m128i assist =
+        _mm_shuffle_epi32(_mm_aeskeygenassist_si128(even, 0x00), 0xaa);
+    prev = _mm_xor_si128(prev, _mm_slli_si128(prev, 4));
+    prev = _mm_xor_si128(prev, _mm_slli_si128(prev, 4));
+    prev = _mm_xor_si128(prev, _mm_slli_si128(prev, 4));
+
+    return _mm_xor_si128(prev, assist);
+}
+
+/*
+ * One step of the AES-256 key schedule.  AESKEYGENASSIST requires an
+ * immediate rcon, so the schedule is unrolled over the extended rcon sequence.
+ */
+#define AESNI_KEY_256_STEP(i, rcon) \
+    t1 = aesni_key_256_even(t1, _mm_aeskeygenassist_si128(t3, rcon)); \
+    _mm_storeu_si128(rk + 2 * (i) + 2, t1); \
+    if ((i) + 1 == steps) \
+        goto done; \
+    t3 = aesni_key_256_odd(t1, t3); \
+    _mm_storeu_si128(rk + 2 * (i) + 3, t3);
+
+/**
+ * Expand an AES-256 cipher key into the encryption key schedule.
+ */
+int AESNI_TARGET AES_aesni_set_encrypt_key(
+    const unsigned char* userKey, const int roundMult, AES_KEY* key)
+{
+    __m128i* rk;
+    __m128i t1, t3;
+    int steps;
+
+    if (!userKey || !key)
+        return -1;
+
+    key->rounds = aesni_rounds(roundMult);
+    key->impl = AES_IMPL_AESNI;
+    steps = key->rounds / 2;
+
+    rk = (__m128i*)key->rd_key;
+    t1 = _mm_loadu_si128((const __m128i*)userKey);
+    t3 = _mm_loadu_si128((const __m128i*)(userKey + 16));
+    _mm_storeu_si128(rk + 0, t1);
+    _mm_storeu_si128(rk + 1, t3);
+
+    AESNI_KEY_256_STEP(0, 0x01);
+    AESNI_KEY_256_STEP(1, 0x02);
+    AESNI_KEY_256_STEP(2, 0x04);
+    AESNI_KEY_256_STEP(3, 0x08);
+    AESNI_KEY_256_STEP(4, 0x10);
+    AESNI_KEY_256_STEP(5, 0x20);
+    AESNI_KEY_256_STEP(6, 0x40);
+    AESNI_KEY_256_STEP(7, 0x80);
+    AESNI_KEY_256_STEP(8, 0x1b);
+    AESNI_KEY_256_STEP(9, 0x36);
+    AESNI_KEY_256_STEP(10, 0x6c);
+    AESNI_KEY_256_STEP(11, 0xd8);
+    AESNI_KEY_256_STEP(12, 0xab);
+    AESNI_KEY_256_STEP(13, 0x4d);
+    AESNI_KEY_256_STEP(14, 0x9a);
+    AESNI_KEY_256_STEP(15, 0x2f);
+    AESNI_KEY_256_STEP(16, 0x5e);
+    AESNI_KEY_256_STEP(17, 0xbc);
+    AESNI_KEY_256_STEP(18, 0x63);
+    AESNI_KEY_256_STEP(19, 0xc6);
+    AESNI_KEY_256_STEP(20, 0x97);
+    AESNI_KEY_256_STEP(21, 0x35);
+    AESNI_KEY_256_STEP(22, 0x6a);
+    AESNI_KEY_256_STEP(23, 0xd4);
+    AESNI_KEY_256_STEP(24, 0xb3);
+    AESNI_KEY_256_STEP(25, 0x7d);
+    AESNI_KEY_256_STEP(26, 0xfa);
+    AESNI_KEY_256_STEP(27, 0xef);
+
+done:
+    return 0;
+}
+
+/**
+ * Expand an AES-256 cipher key into the decryption key schedule.
+ */
+int AESNI_TARGET AES_aesni_set_decrypt_key(
+    const unsigned char* userKey, const int roundMult, AES_KEY* key)
+{
+    __m128i* rk;
+    __m128i tmp;
+    int i, j, status;
+
+    /* first, start with an encryption schedule */
+    status = AES_aesni_set_encrypt_key(userKey, roundMult, key);
+    if (status < 0)
+        return status;
+
+    rk = (__m128i*)key->rd_key;
+
+    /* invert the order of the round keys. */
+    for (i = 0, j = key->rounds; i < j; ++i, --j)
+    {
+        tmp = _mm_loadu_si128(rk + i);
+        _mm_storeu_si128(rk + i, _mm_loadu_si128(rk + j));
+        _mm_storeu_si128(rk + j, tmp);
+    }
+
+    /* apply the inverse MixColumn transform to all but the first and last. */
+    for (i = 1; i < key->rounds; ++i)
+    {
+        _mm_storeu_si128(rk + i, _mm_aesimc_si128(_mm_loadu_si128(rk + i)));
+    }
+
+    return 0;
+}
+
+/*
+ * Apply one round step to all eight lanes of a pipelined block group.
+ */
+#define AESNI_LANES_8(op, k) \
+    s0 = op(s0, k); \
+    s1 = op(s1, k); \
+    s2 = op(s2, k); \
+    s3 = op(s3, k); \
+    s4 = op(s4, k); \
+    s5 = op(s5, k); \
+    s6 = op(s6, k); \
+    s7 = op(s7, k);
+
+/*
+ * Apply round i to the single block state s.
+ */
+#define AESNI_ROUND_1(op, i) \
+    s = op(s, _mm_loadu_si128(rk + (i)));
+
+/*
+ * Apply round i to all eight lanes of a pipelined block group.
+ */
+#define AESNI_ROUND_8(op, i) \
+    k = _mm_loadu_si128(rk + (i)); \
+    AESNI_LANES_8(op, k)
+
+/*
+ * Generate fully unrolled single block and block run kernels for one
+ * direction and a fixed number of rounds.  INNER unrolls rounds 1 through
+ * rounds - 1.
+ */
+#define AESNI_KERNEL(dir, op, oplast, rounds, INNER) \
+static inline void AESNI_TARGET aesni_##dir##_##rounds( \
+    const unsigned char* in, unsigned char* out, const __m128i* rk) \
+{ \
+    __m128i s; \
+    \
+    s = _mm_xor_si128( \
+        _mm_loadu_si128((const __m128i*)in), _mm_loadu_si128(rk)); \
+    INNER(AESNI_ROUND_1, op, 1) \
+    AESNI_ROUND_1(oplast, rounds) \
+    _mm_storeu_si128((__m128i*)out, s); \
+} \
+\
+static void AESNI_TARGET aesni_##dir##_blocks_##rounds( \
+    const unsigned char* in, unsigned char* out, size_t blocks, \
+    const __m128i* rk) \
+{ \
+    const __m128i* src; \
+    __m128i* dst; \
+    __m128i k, s0, s1, s2, s3, s4, s5, s6, s7; \
+    \
+    while (blocks >= 8) \
+    { \
+        src = (const __m128i*)in; \
+        dst = (__m128i*)out; \
+        \
+        s0 = _mm_loadu_si128(src + 0); \
+        s1 = _mm_loadu_si128(src + 1); \
+        s2 = _mm_loadu_si128(src + 2); \
+        s3 = _mm_loadu_si128(src + 3); \
+        s4 = _mm_loadu_si128(src + 4); \
+        s5 = _mm_loadu_si128(src + 5); \
+        s6 = _mm_loadu_si128(src + 6); \
+        s7 = _mm_loadu_si128(src + 7); \
+        \
+        AESNI_ROUND_8(_mm_xor_si128, 0) \
+        INNER(AESNI_ROUND_8, op, 1) \
+        AESNI_ROUND_8(oplast, rounds) \
+        \
+        _mm_storeu_si128(dst + 0, s0); \
+        _mm_storeu_si128(dst + 1, s1); \
+        _mm_storeu_si128(dst + 2, s2); \
+        _mm_storeu_si128(dst + 3, s3); \
+        _mm_storeu_si128(dst + 4, s4); \
+        _mm_storeu_si128(dst + 5, s5); \
+        _mm_storeu_si128(dst + 6, s6); \
+        _mm_storeu_si128(dst + 7, s7); \
+        \
+        in += 8 * 16; \
+        out += 8 * 16; \
+        blocks -= 8; \
+    } \
+    \
+    while (blocks--) \
+    { \
+        aesni_##dir##_##rounds(in, out, rk); \
+        in += 16; \
+        out += 16; \
+    } \
+}
+
+/*
+ * Kernels for the AES-256 FIPS, 2X, 3X, and 4X schedules.
+ */
+AESNI_KERNEL(encrypt, _mm_aesenc_si128, _mm_aesenclast_si128, 14, AES_UNROLL_13)
+AESNI_KERNEL(encrypt, _mm_aesenc_si128, _mm_aesenclast_si128, 28, AES_UNROLL_27)
+AESNI_KERNEL(encrypt, _mm_aesenc_si128, _mm_aesenclast_si128, 42, AES_UNROLL_41)
+AESNI_KERNEL(encrypt, _mm_aesenc_si128, _mm_aesenclast_si128, 56, AES_UNROLL_55)
+AESNI_KERNEL(decrypt, _mm_aesdec_si128, _mm_aesdeclast_si128, 14, AES_UNROLL_13)
+AESNI_KERNEL(decrypt, _mm_aesdec_si128, _mm_aesdeclast_si128, 28, AES_UNROLL_27)
+AESNI_KERNEL(decrypt, _mm_aesdec_si128, _mm_aesdeclast_si128, 42, AES_UNROLL_41)
+AESNI_KERNEL(decrypt, _mm_aesdec_si128, _mm_aesdeclast_si128, 56, AES_UNROLL_55)
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+void AESNI_TARGET AES_aesni_encrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key)
+{
+    const __m128i* rk = (const __m128i*)key->rd_key;
+
+    /* select the unrolled kernel for the round count of this schedule. */
+    switch (key->rounds)
+    {
+        case 14:
+            aesni_encrypt_14(in, out, rk);
+            return;
+        case 28:
+            aesni_encrypt_28(in, out, rk);
+            return;
+        case 42:
+            aesni_encrypt_42(in, out, rk);
+            return;
+        default:
+            MODEL_ASSERT(56 == key->rounds);
+            aesni_encrypt_56(in, out, rk);
+            return;
+    }
+}
+
+/*
+ * Decrypt a single block
+ * in and out can overlap
+ */
+void AESNI_TARGET AES_aesni_decrypt(
+    const unsigned char* in, unsigned char* out, const AES_KEY* key)
+{
+    const __m128i* rk = (const __m128i*)key->rd_key;
+
+    /* select the unrolled kernel for the round count of this schedule. */
+    switch (key->rounds)
+    {
+        case 14:
+            aesni_decrypt_14(in, out, rk);
+            return;
+        case 28:
+            aesni_decrypt_28(in, out, rk);
+            return;
+        case 42:
+            aesni_decrypt_42(in, out, rk);
+            return;
+        default:
+            MODEL_ASSERT(56 == key->rounds);
+            aesni_decrypt_56(in, out, rk);
+            return;
+    }
+}
+
+/*
+ * Encrypt a run of independent blocks
+ * in and out must either be identical or not overlap
+ *
+ * Eight blocks are kept in flight so that the AESENC latency of one block is
+ * hidden behind the others.
+ */
+void AESNI_TARGET AES_aesni_encrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key)
+{
+    const __m128i* rk = (const __m128i*)key->rd_key;
+
+    /* select the unrolled kernel for the round count of this schedule. */
+    switch (key->rounds)
+    {
+        case 14:
+            aesni_encrypt_blocks_14(in, out, blocks, rk);
+            return;
+        case 28:
+            aesni_encrypt_blocks_28(in, out, blocks, rk);
+            return;
+        case 42:
+            aesni_encrypt_blocks_42(in, out, blocks, rk);
+            return;
+        default:
+            MODEL_ASSERT(56 == key->rounds);
+            aesni_encrypt_blocks_56(in, out, blocks, rk);
+            return;
+    }
+}
+
+/*
+ * Decrypt a run of independent blocks
+ * in and out must either be identical or not overlap
+ *
+ * As with encryption, eight blocks are kept in flight to hide the AESDEC
+ * latency.
+ */
+void AESNI_TARGET AES_aesni_decrypt_blocks(
+    const unsigned char* in, unsigned char* out, size_t blocks,
+    const AES_KEY* key)
+{
+    const __m128i* rk = (const __m128i*)key->rd_key;
+
+    /* select the unrolled kernel for the round count of this schedule. */
+    switch (key->rounds)
+    {
+        case 14:
+            aesni_decrypt_blocks_14(in, out, blocks, rk);
+            return;
+        case 28:
+            aesni_decrypt_blocks_28(in, out, blocks, rk);
+            return;
+        case 42:
+            aesni_decrypt_blocks_42(in, out, blocks, rk);
+            return;
+        default:
+            MODEL_ASSERT(56 == key->rounds);
+            aesni_decrypt_blocks_56(in, out, blocks, rk);
+            return;
+    }
+}
+
+/*
+ * Encrypt one block per lane in place, each lane under its own key
+ * blocks holds lanes consecutive blocks; lanes must be at most AES_MAX_LANES
+ *
+ * This is the multi-buffer counterpart of AES_aesni_encrypt_blocks(): each
+ * round is applied to every lane before moving to the next round, so that
+ * independent messages keep the AESENC pipeline full.  Lanes with fewer
+ * rounds finish early.
+ */
+void AESNI_TARGET AES_aesni_encrypt_lanes(
+    unsigned char* blocks, const AES_KEY* const* keys, size_t lanes)
+{
+    __m128i s[AES_MAX_LANES];
+    int rounds = 0;
+    size_t l;
+    int i;
+
+    for (l = 0; l < lanes; ++l)
+    {
+        s[l] = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i*)(blocks + 16 * l)),
+            _mm_loadu_si128((const __m128i*)keys[l]->rd_key));
+
+        if (keys[l]->rounds > rounds)
+            rounds = keys[l]->rounds;
+    }
+
+    for (i = 1; i <= rounds; ++i)
+    {
+        for (l = 0; l < lanes; ++l)
+        {
+            const __m128i* rk = (const __m128i*)keys[l]->rd_key;
+
+            if (i < keys[l]->rounds)
+            {
+                s[l] = _mm_aesenc_si128(s[l], _mm_loadu_si128(rk + i));
+            }
+            else if (i == keys[l]->rounds)
+            {
+                s[l] = _mm_aesenclast_si128(s[l], _mm_loadu_si128(rk + i));
+            }
+        }
+    }
+
+    for (l = 0; l < lanes; ++l)
+    {
+        _mm_storeu_si128((__m128i*)(blocks + 16 * l), s[l]);
+    }
+}
+
+#endif /*AES_AESNI_SUPPORTED*/
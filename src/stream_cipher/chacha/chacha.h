@@ -0,0 +1,107 @@
+/**
+ * \file chacha.h
+ *
+ * \brief The ChaCha20 block function and its vectorized backends.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef CHACHA_PRIVATE_HEADER_GUARD
+#define CHACHA_PRIVATE_HEADER_GUARD
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* SSE2 and AVX2 are available as runtime-selected backends on x86. */
+#if (defined(__x86_64__) || defined(__i386__)) \
+ && (defined(__GNUC__) || defined(__clang__))
+#define CHACHA_SSE2_SUPPORTED
+#define CHACHA_AVX2_SUPPORTED
+#endif
+
+/* NEON is part of the baseline on little-endian ARM builds that enable it. */
+#if defined(__ARM_NEON) \
+ && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define CHACHA_NEON_SUPPORTED
+#endif
+
+/**
+ * \brief ChaCha implementation selectors.
+ */
+#define CHACHA_IMPL_PORTABLE 0
+#define CHACHA_IMPL_SSE2 1
+#define CHACHA_IMPL_AVX2 2
+#define CHACHA_IMPL_NEON 3
+
+#define CHACHA_BLOCK_SIZE 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/**
+ * Return the fastest ChaCha implementation supported by this CPU.
+ */
+int CHACHA_impl_default(void);
+
+/**
+ * Return non-zero if the given ChaCha implementation is supported by this CPU.
+ */
+int CHACHA_impl_supported(int impl);
+
+/**
+ * Set up the ChaCha20 input state from a 256-bit key, a 32-bit block counter,
+ * and a 96-bit nonce, as specified in RFC 8439.
+ */
+void CHACHA_init(
+    uint32_t state[16], const uint8_t key[32], uint32_t counter,
+    const uint8_t nonce[12]);
+
+/**
+ * Set the 32-bit block counter and the 96-bit nonce of an input state,
+ * leaving the key in place.
+ */
+void CHACHA_set_nonce(
+    uint32_t state[16], uint32_t counter, const uint8_t nonce[12]);
+
+/*
+ * XOR the keystream for the given number of 64 byte blocks into in, writing
+ * the result to out, and advance the block counter in state[12].  in and out
+ * must either be identical or not overlap.
+ */
+void CHACHA_xor_blocks(
+    int impl, uint32_t state[16], const uint8_t* in, uint8_t* out,
+    size_t blocks);
+
+/*
+ * Portable backend.  Processes every block.
+ */
+void CHACHA_portable_xor_blocks(
+    uint32_t state[16], const uint8_t* in, uint8_t* out, size_t blocks);
+
+/*
+ * Vectorized backends.  Each processes as many whole groups of its native
+ * width as fit in blocks, and returns the number of blocks processed.
+ */
+#ifdef CHACHA_SSE2_SUPPORTED
+int CHACHA_sse2_available(void);
+size_t CHACHA_sse2_xor_blocks(
+    uint32_t state[16], const uint8_t* in, uint8_t* out, size_t blocks);
+#endif /*CHACHA_SSE2_SUPPORTED*/
+
+#ifdef CHACHA_AVX2_SUPPORTED
+int CHACHA_avx2_available(void);
+size_t CHACHA_avx2_xor_blocks(
+    uint32_t state[16], const uint8_t* in, uint8_t* out, size_t blocks);
+#endif /*CHACHA_AVX2_SUPPORTED*/
+
+#ifdef CHACHA_NEON_SUPPORTED
+size_t CHACHA_neon_xor_blocks(
+    uint32_t state[16], const uint8_t* in, uint8_t* out, size_t blocks);
+#endif /*CHACHA_NEON_SUPPORTED*/
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*CHACHA_PRIVATE_HEADER_GUARD*/
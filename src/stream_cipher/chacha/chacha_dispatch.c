@@ -0,0 +1,102 @@
+/**
+ * \file chacha_dispatch.c
+ *
+ * Runtime selection between the portable and vectorized ChaCha20 backends.
+ *
+ * Wider backends process as many whole groups as they can, and the remaining
+ * blocks fall through to the next narrower backend.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chacha.h"
+
+/**
+ * Return non-zero if the given ChaCha implementation is supported by this CPU.
+ */
+int CHACHA_impl_supported(int impl)
+{
+    switch (impl)
+    {
+        case CHACHA_IMPL_PORTABLE:
+            return 1;
+
+#ifdef CHACHA_SSE2_SUPPORTED
+        case CHACHA_IMPL_SSE2:
+            return CHACHA_sse2_available();
+#endif
+
+#ifdef CHACHA_AVX2_SUPPORTED
+        case CHACHA_IMPL_AVX2:
+            return CHACHA_avx2_available() && CHACHA_sse2_available();
+#endif
+
+#ifdef CHACHA_NEON_SUPPORTED
+        case CHACHA_IMPL_NEON:
+            return 1;
+#endif
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Return the fastest ChaCha implementation supported by this CPU.
+ */
+int CHACHA_impl_default(void)
+{
+    if (CHACHA_impl_supported(CHACHA_IMPL_AVX2))
+        return CHACHA_IMPL_AVX2;
+
+    if (CHACHA_impl_supported(CHACHA_IMPL_SSE2))
+        return CHACHA_IMPL_SSE2;
+
+    if (CHACHA_impl_supported(CHACHA_IMPL_NEON))
+        return CHACHA_IMPL_NEON;
+
+    return CHACHA_IMPL_PORTABLE;
+}
+
+/**
+ * XOR the keystream for the given number of blocks into in, writing the result
+ * to out, and advance the block counter.
+ */
+void CHACHA_xor_blocks(
+    int impl, uint32_t state[16], const uint8_t* in, uint8_t* out,
+    size_t blocks)
+{
+    size_t n = 0;
+
+#ifdef CHACHA_AVX2_SUPPORTED
+    /* AVX2 takes groups of eight, then leaves the rest to SSE2. */
+    if (CHACHA_IMPL_AVX2 == impl)
+    {
+        n = CHACHA_avx2_xor_blocks(state, in, out, blocks);
+        impl = CHACHA_IMPL_SSE2;
+    }
+#endif
+
+#ifdef CHACHA_SSE2_SUPPORTED
+    if (CHACHA_IMPL_SSE2 == impl)
+    {
+        n += CHACHA_sse2_xor_blocks(
+            state, in + CHACHA_BLOCK_SIZE * n, out + CHACHA_BLOCK_SIZE * n,
+            blocks - n);
+    }
+#endif
+
+#ifdef CHACHA_NEON_SUPPORTED
+    if (CHACHA_IMPL_NEON == impl)
+    {
+        n = CHACHA_neon_xor_blocks(state, in, out, blocks);
+    }
+#endif
+
+    (void)impl;
+
+    /* the portable backend finishes whatever the vector backends left. */
+    CHACHA_portable_xor_blocks(
+        state, in + CHACHA_BLOCK_SIZE * n, out + CHACHA_BLOCK_SIZE * n,
+        blocks - n);
+}
@@ -0,0 +1,106 @@
+/**
+ * \file chacha_neon.c
+ *
+ * ChaCha20 over four blocks at a time using ARM NEON.
+ *
+ * This uses the same word-sliced layout as the SSE2 backend.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chacha.h"
+
+#ifdef CHACHA_NEON_SUPPORTED
+
+#include <arm_neon.h>
+
+#define ROTL(v, n) vorrq_u32(vshlq_n_u32((v), (n)), vshrq_n_u32((v), 32 - (n)))
+
+#define ROTL16(v) vreinterpretq_u32_u16(vrev32q_u16(vreinterpretq_u16_u32(v)))
+
+#define QR(a, b, c, d) \
+    a = vaddq_u32(a, b); d = veorq_u32(d, a); d = ROTL16(d); \
+    c = vaddq_u32(c, d); b = veorq_u32(b, c); b = ROTL(b, 12); \
+    a = vaddq_u32(a, b); d = veorq_u32(d, a); d = ROTL(d, 8); \
+    c = vaddq_u32(c, d); b = veorq_u32(b, c); b = ROTL(b, 7)
+
+/**
+ * Transpose four word-sliced vectors into four 16-byte rows, one per block,
+ * and XOR them into the input at the given byte offset of each block.
+ */
+static inline void neon_store4(
+    uint32x4_t a, uint32x4_t b, uint32x4_t c, uint32x4_t d,
+    const uint8_t* in, uint8_t* out, size_t offset)
+{
+    uint32x4x2_t ab = vtrnq_u32(a, b);
+    uint32x4x2_t cd = vtrnq_u32(c, d);
+    uint32x4_t row[4];
+
+    row[0] = vcombine_u32(vget_low_u32(ab.val[0]), vget_low_u32(cd.val[0]));
+    row[1] = vcombine_u32(vget_low_u32(ab.val[1]), vget_low_u32(cd.val[1]));
+    row[2] = vcombine_u32(vget_high_u32(ab.val[0]), vget_high_u32(cd.val[0]));
+    row[3] = vcombine_u32(vget_high_u32(ab.val[1]), vget_high_u32(cd.val[1]));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        size_t pos = i * CHACHA_BLOCK_SIZE + offset;
+        uint8x16_t m = vld1q_u8(in + pos);
+        vst1q_u8(out + pos, veorq_u8(m, vreinterpretq_u8_u32(row[i])));
+    }
+}
+
+/**
+ * XOR the keystream for as many groups of four blocks as fit in blocks.
+ */
+size_t CHACHA_neon_xor_blocks(
+    uint32_t state[16], const uint8_t* in, uint8_t* out, size_t blocks)
+{
+    static const uint32_t lane_offsets[4] = { 0, 1, 2, 3 };
+    size_t done = 0;
+    uint32x4_t s[16], x[16];
+
+    for (int i = 0; i < 16; ++i)
+    {
+        s[i] = vdupq_n_u32(state[i]);
+    }
+
+    for (; blocks - done >= 4; done += 4)
+    {
+        s[12] = vaddq_u32(vdupq_n_u32(state[12]), vld1q_u32(lane_offsets));
+
+        for (int i = 0; i < 16; ++i)
+        {
+            x[i] = s[i];
+        }
+
+        for (int i = 0; i < 10; ++i)
+        {
+            QR(x[0], x[4], x[8], x[12]);
+            QR(x[1], x[5], x[9], x[13]);
+            QR(x[2], x[6], x[10], x[14]);
+            QR(x[3], x[7], x[11], x[15]);
+            QR(x[0], x[5], x[10], x[15]);
+            QR(x[1], x[6], x[11], x[12]);
+            QR(x[2], x[7], x[8], x[13]);
+            QR(x[3], x[4], x[9], x[14]);
+        }
+
+        for (int i = 0; i < 16; ++i)
+        {
+            x[i] = vaddq_u32(x[i], s[i]);
+        }
+
+        neon_store4(x[0], x[1], x[2], x[3], in, out, 0);
+        neon_store4(x[4], x[5], x[6], x[7], in, out, 16);
+        neon_store4(x[8], x[9], x[10], x[11], in, out, 32);
+        neon_store4(x[12], x[13], x[14], x[15], in, out, 48);
+
+        state[12] += 4;
+        in += 4 * CHACHA_BLOCK_SIZE;
+        out += 4 * CHACHA_BLOCK_SIZE;
+    }
+
+    return done;
+}
+
+#endif /*CHACHA_NEON_SUPPORTED*/
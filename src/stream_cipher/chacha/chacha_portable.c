@@ -0,0 +1,92 @@
+/**
+ * \file chacha_portable.c
+ *
+ * Portable ChaCha20 block function.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "chacha.h"
+#include "../../byte_order/byte_order_private.h"
+
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d) \
+    a += b; d ^= a; d = ROTL32(d, 16); \
+    c += d; b ^= c; b = ROTL32(b, 12); \
+    a += b; d ^= a; d = ROTL32(d, 8); \
+    c += d; b ^= c; b = ROTL32(b, 7)
+
+/**
+ * Set up the ChaCha20 input state from a 256-bit key, a 32-bit block counter,
+ * and a 96-bit nonce, as specified in RFC 8439.
+ */
+void CHACHA_init(
+    uint32_t state[16], const uint8_t key[32], uint32_t counter,
+    const uint8_t nonce[12])
+{
+    /* "expand 32-byte k" */
+    state[0] = 0x61707865;
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        state[4 + i] = vccrypt_load_le32(key + 4 * i);
+    }
+
+    CHACHA_set_nonce(state, counter, nonce);
+}
+
+/**
+ * Set the 32-bit block counter and the 96-bit nonce of an input state.
+ */
+void CHACHA_set_nonce(
+    uint32_t state[16], uint32_t counter, const uint8_t nonce[12])
+{
+    state[12] = counter;
+    state[13] = vccrypt_load_le32(nonce);
+    state[14] = vccrypt_load_le32(nonce + 4);
+    state[15] = vccrypt_load_le32(nonce + 8);
+}
+
+/**
+ * XOR the keystream for the given number of blocks, one block at a time.
+ */
+void CHACHA_portable_xor_blocks(
+    uint32_t state[16], const uint8_t* in, uint8_t* out, size_t blocks)
+{
+    uint32_t x[16];
+
+    while (blocks--)
+    {
+        memcpy(x, state, sizeof(x));
+
+        for (int i = 0; i < 10; ++i)
+        {
+            QUARTERROUND(x[0], x[4], x[8], x[12]);
+            QUARTERROUND(x[1], x[5], x[9], x[13]);
+            QUARTERROUND(x[2], x[6], x[10], x[14]);
+            QUARTERROUND(x[3], x[7], x[11], x[15]);
+            QUARTERROUND(x[0], x[5], x[10], x[15]);
+            QUARTERROUND(x[1], x[6], x[11], x[12]);
+            QUARTERROUND(x[2], x[7], x[8], x[13]);
+            QUARTERROUND(x[3], x[4], x[9], x[14]);
+        }
+
+        for (int i = 0; i < 16; ++i)
+        {
+            vccrypt_store_le32(
+                out + 4 * i, vccrypt_load_le32(in + 4 * i) ^ (x[i] + state[i]));
+        }
+
+        ++state[12];
+        in += CHACHA_BLOCK_SIZE;
+        out += CHACHA_BLOCK_SIZE;
+    }
+
+    memset(x, 0, sizeof(x));
+}
@@ -0,0 +1,123 @@
+/**
+ * \file chacha_sse2.c
+ *
+ * ChaCha20 over four blocks at a time using SSE2.
+ *
+ * The state is held word-sliced: each of the sixteen vectors carries the same
+ * state word for four consecutive blocks, so that every quarter round operates
+ * on all four blocks at once.  The result is transposed back to block order
+ * before being XORed into the input.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "chacha.h"
+
+#ifdef CHACHA_SSE2_SUPPORTED
+
+#include <emmintrin.h>
+
+#include "../../cpu/cpu_private.h"
+
+#define SSE2_TARGET __attribute__((target("sse2")))
+
+/**
+ * Return non-zero if this CPU supports SSE2.
+ */
+int CHACHA_sse2_available(void)
+{
+    return vccrypt_cpu_has(VCCRYPT_CPU_SSE2);
+}
+
+#define ROTL(v, n) \
+    _mm_or_si128(_mm_slli_epi32((v), (n)), _mm_srli_epi32((v), 32 - (n)))
+
+#define QR(a, b, c, d) \
+    a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = ROTL(d, 16); \
+    c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = ROTL(b, 12); \
+    a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = ROTL(d, 8); \
+    c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = ROTL(b, 7)
+
+/**
+ * Transpose four word-sliced vectors into four 16-byte rows, one per block,
+ * and XOR them into the input at the given byte offset of each block.
+ */
+static inline void SSE2_TARGET sse2_store4(
+    __m128i a, __m128i b, __m128i c, __m128i d,
+    const uint8_t* in, uint8_t* out, size_t offset)
+{
+    __m128i t0 = _mm_unpacklo_epi32(a, b);
+    __m128i t1 = _mm_unpacklo_epi32(c, d);
+    __m128i t2 = _mm_unpackhi_epi32(a, b);
+    __m128i t3 = _mm_unpackhi_epi32(c, d);
+    __m128i row[4];
+
+    row[0] = _mm_unpacklo_epi64(t0, t1);
+    row[1] = _mm_unpackhi_epi64(t0, t1);
+    row[2] = _mm_unpacklo_epi64(t2, t3);
+    row[3] = _mm_unpackhi_epi64(t2, t3);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        size_t pos = i * CHACHA_BLOCK_SIZE + offset;
+        __m128i m = _mm_loadu_si128((const __m128i*)(in + pos));
+        _mm_storeu_si128((__m128i*)(out + pos), _mm_xor_si128(m, row[i]));
+    }
+}
+
+/**
+ * XOR the keystream for as many groups of four blocks as fit in blocks.
+ */
+size_t SSE2_TARGET CHACHA_sse2_xor_blocks(
+    uint32_t state[16], const uint8_t* in, uint8_t* out, size_t blocks)
+{
+    size_t done = 0;
+    __m128i s[16], x[16];
+
+    for (int i = 0; i < 16; ++i)
+    {
+        s[i] = _mm_set1_epi32((int)state[i]);
+    }
+
+    for (; blocks - done >= 4; done += 4)
+    {
+        s[12] =
+            _mm_add_epi32(
+                _mm_set1_epi32((int)state[12]), _mm_set_epi32(3, 2, 1, 0));
+
+        for (int i = 0; i < 16; ++i)
+        {
+            x[i] = s[i];
+        }
+
+        for (int i = 0; i < 10; ++i)
+        {
+            QR(x[0], x[4], x[8], x[12]);
+            QR(x[1], x[5], x[9], x[13]);
+            QR(x[2], x[6], x[10], x[14]);
+            QR(x[3], x[7], x[11], x[15]);
+            QR(x[0], x[5], x[10], x[15]);
+            QR(x[1], x[6], x[11], x[12]);
+            QR(x[2], x[7], x[8], x[13]);
+            QR(x[3], x[4], x[9], x[14]);
+        }
+
+        for (int i = 0; i < 16; ++i)
+        {
+            x[i] = _mm_add_epi32(x[i], s[i]);
+        }
+
+        sse2_store4(x[0], x[1], x[2], x[3], in, out, 0);
+        sse2_store4(x[4], x[5], x[6], x[7], in, out, 16);
+        sse2_store4(x[8], x[9], x[10], x[11], in, out, 32);
+        sse2_store4(x[12], x[13], x[14], x[15], in, out, 48);
+
+        state[12] += 4;
+        in += 4 * CHACHA_BLOCK_SIZE;
+        out += 4 * CHACHA_BLOCK_SIZE;
+    }
+
+    return done;
+}
+
+#endif /*CHACHA_SSE2_SUPPORTED*/
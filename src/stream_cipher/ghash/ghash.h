@@ -0,0 +1,94 @@
+/**
+ * \file ghash.h
+ *
+ * \brief GHASH, the universal hash used by AES-GCM.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef GHASH_PRIVATE_HEADER_GUARD
+#define GHASH_PRIVATE_HEADER_GUARD
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* PCLMULQDQ is available as a runtime-selected backend on x86 GCC / Clang. */
+#if (defined(__x86_64__) || defined(__i386__)) \
+ && (defined(__GNUC__) || defined(__clang__))
+#define GHASH_CLMUL_SUPPORTED
+#endif
+
+/**
+ * \brief GHASH implementation selectors.
+ */
+#define GHASH_IMPL_TABLE 0
+#define GHASH_IMPL_CLMUL 1
+
+/**
+ * \brief The number of blocks the carry-less multiply backend folds into a
+ * single reduction.
+ */
+#define GHASH_CLMUL_AGGREGATE 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*__cplusplus*/
+
+/*
+ * The expanded hash key.  The table backend stores the sixteen 4-bit multiples
+ * of H as big-endian (hi, lo) word pairs.  The carry-less multiply backend
+ * stores H, H^2, H^3, and H^4 in byte-reversed order.
+ */
+typedef struct ghash_key
+{
+    int impl;
+    union
+    {
+        uint64_t table[16][2];
+        uint8_t powers[GHASH_CLMUL_AGGREGATE][16];
+    } u;
+} GHASH_KEY;
+
+/**
+ * Return the fastest GHASH implementation supported by this CPU.
+ */
+int GHASH_impl_default(void);
+
+/**
+ * Return non-zero if the given GHASH implementation is supported by this CPU.
+ */
+int GHASH_impl_supported(int impl);
+
+/**
+ * Expand the hash key H = E(K, 0^128) for the given implementation.
+ */
+void GHASH_init(GHASH_KEY* key, const uint8_t H[16], int impl);
+
+/**
+ * Absorb the given number of full 16 byte blocks into the hash state X.
+ */
+void GHASH_update(
+    const GHASH_KEY* key, uint8_t X[16], const uint8_t* in, size_t blocks);
+
+/*
+ * Constant-time 4-bit table backend.
+ */
+void GHASH_table_init(GHASH_KEY* key, const uint8_t H[16]);
+void GHASH_table_update(
+    const GHASH_KEY* key, uint8_t X[16], const uint8_t* in, size_t blocks);
+
+#ifdef GHASH_CLMUL_SUPPORTED
+/*
+ * PCLMULQDQ backend.
+ */
+int GHASH_clmul_available(void);
+void GHASH_clmul_init(GHASH_KEY* key, const uint8_t H[16]);
+void GHASH_clmul_update(
+    const GHASH_KEY* key, uint8_t X[16], const uint8_t* in, size_t blocks);
+#endif /*GHASH_CLMUL_SUPPORTED*/
+
+#ifdef __cplusplus
+}
+#endif /*__cplusplus*/
+
+#endif /*GHASH_PRIVATE_HEADER_GUARD*/
@@ -0,0 +1,185 @@
+/**
+ * \file ghash_clmul.c
+ *
+ * GHASH using the PCLMULQDQ carry-less multiply instruction.
+ *
+ * Blocks are byte-reversed on load so that the bit-reflected GCM field maps
+ * onto ordinary carry-less multiplication, following the Intel carry-less
+ * multiplication white paper.  The bulk path folds four blocks at a time using
+ * H, H^2, H^3, and H^4, summing the unreduced 256-bit products and performing a
+ * single reduction per group.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "ghash.h"
+
+#ifdef GHASH_CLMUL_SUPPORTED
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#include "../../cpu/cpu_private.h"
+
+#define CLMUL_TARGET __attribute__((target("pclmul,ssse3,sse2")))
+
+/**
+ * Return non-zero if this CPU supports PCLMULQDQ and SSSE3.
+ */
+int GHASH_clmul_available(void)
+{
+    return vccrypt_cpu_has(VCCRYPT_CPU_PCLMULQDQ | VCCRYPT_CPU_SSSE3);
+}
+
+/**
+ * Reverse the bytes of a block.
+ */
+static inline __m128i CLMUL_TARGET clmul_bswap(__m128i x)
+{
+    const __m128i mask =
+        _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    return _mm_shuffle_epi8(x, mask);
+}
+
+/**
+ * Compute the unreduced 256-bit carry-less product of a and b.
+ */
+static inline void CLMUL_TARGET clmul_mul(
+    __m128i a, __m128i b, __m128i* lo, __m128i* hi)
+{
+    __m128i l = _mm_clmulepi64_si128(a, b, 0x00);
+    __m128i m =
+        _mm_xor_si128(
+            _mm_clmulepi64_si128(a, b, 0x10),
+            _mm_clmulepi64_si128(a, b, 0x01));
+    __m128i h = _mm_clmulepi64_si128(a, b, 0x11);
+
+    *lo = _mm_xor_si128(l, _mm_slli_si128(m, 8));
+    *hi = _mm_xor_si128(h, _mm_srli_si128(m, 8));
+}
+
+/**
+ * Shift the 256-bit product left by one bit to account for the reflected
+ * representation, then reduce it modulo x^128 + x^7 + x^2 + x + 1.
+ */
+static inline __m128i CLMUL_TARGET clmul_reduce(__m128i lo, __m128i hi)
+{
+    __m128i t7, t8, t9;
+
+    /* shift the 256-bit value left by one. */
+    t7 = _mm_srli_epi32(lo, 31);
+    t8 = _mm_srli_epi32(hi, 31);
+    lo = _mm_slli_epi32(lo, 1);
+    hi = _mm_slli_epi32(hi, 1);
+    t9 = _mm_srli_si128(t7, 12);
+    t8 = _mm_slli_si128(t8, 4);
+    t7 = _mm_slli_si128(t7, 4);
+    lo = _mm_or_si128(lo, t7);
+    hi = _mm_or_si128(hi, t8);
+    hi = _mm_or_si128(hi, t9);
+
+    /* first phase of the reduction. */
+    t7 = _mm_slli_epi32(lo, 31);
+    t8 = _mm_slli_epi32(lo, 30);
+    t9 = _mm_slli_epi32(lo, 25);
+    t7 = _mm_xor_si128(t7, t8);
+    t7 = _mm_xor_si128(t7, t9);
+    t8 = _mm_srli_si128(t7, 4);
+    t7 = _mm_slli_si128(t7, 12);
+    lo = _mm_xor_si128(lo, t7);
+
+    /* second phase of the reduction. */
+    t9 = _mm_srli_epi32(lo, 1);
+    t7 = _mm_srli_epi32(lo, 2);
+    t9 = _mm_xor_si128(t9, t7);
+    t7 = _mm_srli_epi32(lo, 7);
+    t9 = _mm_xor_si128(t9, t7);
+    t9 = _mm_xor_si128(t9, t8);
+    lo = _mm_xor_si128(lo, t9);
+
+    return _mm_xor_si128(hi, lo);
+}
+
+/**
+ * Multiply a by b in the byte-reversed field representation.
+ */
+static inline __m128i CLMUL_TARGET clmul_gfmul(__m128i a, __m128i b)
+{
+    __m128i lo, hi;
+
+    clmul_mul(a, b, &lo, &hi);
+
+    return clmul_reduce(lo, hi);
+}
+
+/**
+ * Expand the hash key into the powers of H.
+ */
+void CLMUL_TARGET GHASH_clmul_init(GHASH_KEY* key, const uint8_t H[16])
+{
+    __m128i h = clmul_bswap(_mm_loadu_si128((const __m128i*)H));
+    __m128i p = h;
+
+    key->impl = GHASH_IMPL_CLMUL;
+
+    _mm_storeu_si128((__m128i*)key->u.powers[0], h);
+    for (int i = 1; i < GHASH_CLMUL_AGGREGATE; ++i)
+    {
+        p = clmul_gfmul(p, h);
+        _mm_storeu_si128((__m128i*)key->u.powers[i], p);
+    }
+}
+
+/**
+ * Absorb the given number of full 16 byte blocks into the hash state X.
+ */
+void CLMUL_TARGET GHASH_clmul_update(
+    const GHASH_KEY* key, uint8_t X[16], const uint8_t* in, size_t blocks)
+{
+    __m128i x = clmul_bswap(_mm_loadu_si128((const __m128i*)X));
+    __m128i h1 = _mm_loadu_si128((const __m128i*)key->u.powers[0]);
+    __m128i h2 = _mm_loadu_si128((const __m128i*)key->u.powers[1]);
+    __m128i h3 = _mm_loadu_si128((const __m128i*)key->u.powers[2]);
+    __m128i h4 = _mm_loadu_si128((const __m128i*)key->u.powers[3]);
+    __m128i lo, hi, l, h;
+
+    /* (X + C1) H^4 + C2 H^3 + C3 H^2 + C4 H, with one reduction. */
+    while (blocks >= 4)
+    {
+        __m128i c1 = clmul_bswap(_mm_loadu_si128((const __m128i*)(in + 0)));
+        __m128i c2 = clmul_bswap(_mm_loadu_si128((const __m128i*)(in + 16)));
+        __m128i c3 = clmul_bswap(_mm_loadu_si128((const __m128i*)(in + 32)));
+        __m128i c4 = clmul_bswap(_mm_loadu_si128((const __m128i*)(in + 48)));
+
+        clmul_mul(_mm_xor_si128(x, c1), h4, &lo, &hi);
+        clmul_mul(c2, h3, &l, &h);
+        lo = _mm_xor_si128(lo, l);
+        hi = _mm_xor_si128(hi, h);
+        clmul_mul(c3, h2, &l, &h);
+        lo = _mm_xor_si128(lo, l);
+        hi = _mm_xor_si128(hi, h);
+        clmul_mul(c4, h1, &l, &h);
+        lo = _mm_xor_si128(lo, l);
+        hi = _mm_xor_si128(hi, h);
+
+        x = clmul_reduce(lo, hi);
+
+        in += 64;
+        blocks -= 4;
+    }
+
+    while (blocks--)
+    {
+        __m128i c = clmul_bswap(_mm_loadu_si128((const __m128i*)in));
+
+        x = clmul_gfmul(_mm_xor_si128(x, c), h1);
+
+        in += 16;
+    }
+
+    _mm_storeu_si128((__m128i*)X, clmul_bswap(x));
+}
+
+#endif /*GHASH_CLMUL_SUPPORTED*/
@@ -0,0 +1,75 @@
+/**
+ * \file ghash_dispatch.c
+ *
+ * Runtime selection between the table and carry-less multiply GHASH backends.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "ghash.h"
+
+/**
+ * Return non-zero if the given GHASH implementation is supported by this CPU.
+ */
+int GHASH_impl_supported(int impl)
+{
+    switch (impl)
+    {
+        case GHASH_IMPL_TABLE:
+            return 1;
+
+#ifdef GHASH_CLMUL_SUPPORTED
+        case GHASH_IMPL_CLMUL:
+            return GHASH_clmul_available();
+#endif
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Return the fastest GHASH implementation supported by this CPU.
+ */
+int GHASH_impl_default(void)
+{
+    if (GHASH_impl_supported(GHASH_IMPL_CLMUL))
+        return GHASH_IMPL_CLMUL;
+
+    return GHASH_IMPL_TABLE;
+}
+
+/**
+ * Expand the hash key H = E(K, 0^128) for the given implementation.
+ */
+void GHASH_init(GHASH_KEY* key, const uint8_t H[16], int impl)
+{
+#ifdef GHASH_CLMUL_SUPPORTED
+    if (GHASH_IMPL_CLMUL == impl && GHASH_clmul_available())
+    {
+        GHASH_clmul_init(key, H);
+        return;
+    }
+#else
+    (void)impl;
+#endif
+
+    GHASH_table_init(key, H);
+}
+
+/**
+ * Absorb the given number of full 16 byte blocks into the hash state X.
+ */
+void GHASH_update(
+    const GHASH_KEY* key, uint8_t X[16], const uint8_t* in, size_t blocks)
+{
+#ifdef GHASH_CLMUL_SUPPORTED
+    if (GHASH_IMPL_CLMUL == key->impl)
+    {
+        GHASH_clmul_update(key, X, in, blocks);
+        return;
+    }
+#endif
+
+    GHASH_table_update(key, X, in, blocks);
+}
@@ -0,0 +1,148 @@
+/**
+ * \file ghash_table.c
+ *
+ * Portable GHASH using Shoup's 4-bit multiplication tables.
+ *
+ * Each block is multiplied by H one nibble at a time, using a 16 entry table of
+ * the multiples of H and a 16 entry reduction table.  Both tables are indexed
+ * by bits of the hash state, which depends on the message and the key, so
+ * every lookup reads all sixteen entries and selects the wanted one with a
+ * mask.  This keeps the fallback free of secret-dependent memory accesses.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <string.h>
+
+#include "../stream_cipher_private.h"
+#include "ghash.h"
+
+/* reduction constants for the four bits shifted out of Z each step. */
+static const uint64_t ghash_rem_4bit[16] = {
+    0x0000ULL << 48, 0x1C20ULL << 48, 0x3840ULL << 48, 0x2460ULL << 48,
+    0x7080ULL << 48, 0x6CA0ULL << 48, 0x48C0ULL << 48, 0x54E0ULL << 48,
+    0xE100ULL << 48, 0xFD20ULL << 48, 0xD940ULL << 48, 0xC560ULL << 48,
+    0x9180ULL << 48, 0x8DA0ULL << 48, 0xA9C0ULL << 48, 0xB5E0ULL << 48
+};
+
+/**
+ * Return an all-ones mask if a == b, and zero otherwise, without branching.
+ */
+static inline uint64_t ct_eq_mask(uint64_t a, uint64_t b)
+{
+    uint64_t d = a ^ b;
+
+    return ((d | (0 - d)) >> 63) - 1;
+}
+
+/**
+ * Select table[index] by scanning every entry.
+ */
+static inline void ct_lookup(
+    const uint64_t table[16][2], uint64_t index, uint64_t* hi, uint64_t* lo)
+{
+    uint64_t h = 0, l = 0;
+
+    for (uint64_t i = 0; i < 16; ++i)
+    {
+        uint64_t mask = ct_eq_mask(i, index);
+
+        h |= table[i][0] & mask;
+        l |= table[i][1] & mask;
+    }
+
+    *hi = h;
+    *lo = l;
+}
+
+/**
+ * Select ghash_rem_4bit[index] by scanning every entry.
+ */
+static inline uint64_t ct_rem(uint64_t index)
+{
+    uint64_t r = 0;
+
+    for (uint64_t i = 0; i < 16; ++i)
+    {
+        r |= ghash_rem_4bit[i] & ct_eq_mask(i, index);
+    }
+
+    return r;
+}
+
+/**
+ * Expand the hash key into the 4-bit multiplication table.
+ */
+void GHASH_table_init(GHASH_KEY* key, const uint8_t H[16])
+{
+    uint64_t hi = vccrypt_load_be64(H);
+    uint64_t lo = vccrypt_load_be64(H + 8);
+
+    memset(key, 0, sizeof(GHASH_KEY));
+    key->impl = GHASH_IMPL_TABLE;
+
+    /* table[8] = H, and each halving index multiplies by x. */
+    for (int i = 8; i > 0; i >>= 1)
+    {
+        key->u.table[i][0] = hi;
+        key->u.table[i][1] = lo;
+
+        uint64_t reduce = (0 - (lo & 1)) & 0xE100000000000000ULL;
+        lo = (hi << 63) | (lo >> 1);
+        hi = (hi >> 1) ^ reduce;
+    }
+
+    /* the remaining entries are sums of the powers of two. */
+    for (int i = 2; i < 16; i <<= 1)
+    {
+        for (int j = 1; j < i; ++j)
+        {
+            key->u.table[i + j][0] = key->u.table[i][0] ^ key->u.table[j][0];
+            key->u.table[i + j][1] = key->u.table[i][1] ^ key->u.table[j][1];
+        }
+    }
+}
+
+/**
+ * Absorb the given number of full 16 byte blocks into the hash state X.
+ */
+void GHASH_table_update(
+    const GHASH_KEY* key, uint8_t X[16], const uint8_t* in, size_t blocks)
+{
+    uint8_t Xi[16];
+    uint64_t zhi, zlo, thi, tlo, rem;
+
+    memcpy(Xi, X, sizeof(Xi));
+
+    while (blocks--)
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            Xi[i] ^= in[i];
+        }
+
+        /* multiply Xi by H, from the last nibble to the first. */
+        zhi = zlo = 0;
+        for (int i = 15; i >= 0; --i)
+        {
+            for (int shift = 0; shift <= 4; shift += 4)
+            {
+                rem = zlo & 0xF;
+                zlo = (zhi << 60) | (zlo >> 4);
+                zhi = (zhi >> 4) ^ ct_rem(rem);
+
+                ct_lookup(key->u.table, (Xi[i] >> shift) & 0xF, &thi, &tlo);
+                zhi ^= thi;
+                zlo ^= tlo;
+            }
+        }
+
+        vccrypt_store_be64(Xi, zhi);
+        vccrypt_store_be64(Xi + 8, zlo);
+
+        in += 16;
+    }
+
+    memcpy(X, Xi, sizeof(Xi));
+    memset(Xi, 0, sizeof(Xi));
+}
@@ -9,9 +9,16 @@
 #ifndef VCCRYPT_STREAM_CIPHER_PRIVATE_HEADER_GUARD
 #define VCCRYPT_STREAM_CIPHER_PRIVATE_HEADER_GUARD
 
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
 #include <vccrypt/stream_cipher.h>
 
+#include "../byte_order/byte_order_private.h"
+#include "../mac/poly1305/poly1305.h"
 #include "aes/aes.h"
+#include "chacha/chacha.h"
+#include "ghash/ghash.h"
 
 /* make this header C++ friendly. */
 #ifdef __cplusplus
@@ -27,6 +34,49 @@ extern "C" {
 
 #define VCCRYPT_AES_CTR_ALG_AES_256_KEY_SIZE 32
 
+/* number of counter blocks generated per batch in the bulk encrypt path. */
+#define VCCRYPT_AES_CTR_ALG_BATCH_BLOCKS 8
+
+/* size of the region each worker encrypts per job in the parallel path. */
+#define VCCRYPT_AES_CTR_ALG_PARALLEL_CHUNK_SIZE (1024 * 1024)
+
+/* precomputed keystream is generated in batches of this many blocks. */
+#define VCCRYPT_AES_CTR_ALG_RING_BATCH_BLOCKS 64
+
+/* size of the bounce buffer used when a file cannot be memory mapped. */
+#define VCCRYPT_STREAM_FILE_CHUNK_SIZE (1024 * 1024)
+
+/* size of each window of a memory mapped file that is processed at once. */
+#define VCCRYPT_STREAM_FILE_MAP_WINDOW_SIZE (16 * 1024 * 1024)
+
+#define VCCRYPT_AES_GCM_ALG_IV_SIZE 12
+#define VCCRYPT_AES_GCM_ALG_TAG_SIZE 16
+
+/* GCM increments a 32-bit block counter, and counter value 1 masks the tag. */
+#define VCCRYPT_AES_GCM_ALG_MAX_MESSAGE_SIZE \
+    ((((uint64_t)1 << 32) - 2) * 16)
+
+/* processing phases of an AES GCM context. */
+#define VCCRYPT_AES_GCM_PHASE_NONE 0
+#define VCCRYPT_AES_GCM_PHASE_AAD 1
+#define VCCRYPT_AES_GCM_PHASE_TEXT 2
+#define VCCRYPT_AES_GCM_PHASE_DONE 3
+
+#define VCCRYPT_CHACHA20_ALG_KEY_SIZE 32
+#define VCCRYPT_CHACHA20_ALG_IV_SIZE 12
+#define VCCRYPT_CHACHA20_POLY1305_ALG_TAG_SIZE 16
+
+/* number of blocks generated per batch, matching the widest vector backend. */
+#define VCCRYPT_CHACHA20_ALG_BATCH_BLOCKS 16
+
+/* ChaCha20 has a 32-bit block counter of 64 byte blocks. */
+#define VCCRYPT_CHACHA20_ALG_MAX_MESSAGE_SIZE \
+    (((uint64_t)1 << 32) * CHACHA_BLOCK_SIZE)
+
+/* block 0 of each message supplies the Poly1305 key. */
+#define VCCRYPT_CHACHA20_POLY1305_ALG_MAX_MESSAGE_SIZE \
+    ((((uint64_t)1 << 32) - 1) * CHACHA_BLOCK_SIZE)
+
 /**
  * AES CTR Mode specific options data.
  */
@@ -37,15 +87,85 @@ typedef struct aes_ctr_options_data
 
 /**
  * AES CTR Mode specific context data.
+ *
+ * The key schedule is the last member, so that this structure can be stored in
+ * vccrypt_aes_ctr_alg_storage_size() bytes, sized to the actual round count.
+ *
+ * When keystream precomputation is enabled, ring holds ring_count bytes of
+ * keystream, starting at ring_head, for the blocks following ctr.  Both are
+ * always a multiple of the block size, so blocks never wrap.
  */
 typedef struct aes_ctr_context_data
 {
-    AES_KEY key;
     uint8_t ctr[16];
     uint8_t stream[16];
     size_t count;
+    size_t size;
+    bool owned;
+
+    /* optional ring of precomputed keystream for the blocks after ctr. */
+    uint8_t* ring;
+    size_t ring_size;
+    size_t ring_head;
+    size_t ring_count;
+
+    AES_KEY key;
 } aes_ctr_context_data_t;
 
+/**
+ * AES GCM Mode specific context data.
+ *
+ * As with AES CTR, the key schedule is the last member, so that this structure
+ * can be stored in vccrypt_aes_gcm_alg_storage_size() bytes.
+ */
+typedef struct aes_gcm_context_data
+{
+    GHASH_KEY hkey;
+    uint8_t ghash[16];
+    uint8_t partial[16];
+    size_t partial_count;
+    uint8_t tag_mask[16];
+    uint8_t ctr[16];
+    uint8_t stream[16];
+    size_t count;
+    uint64_t aad_size;
+    uint64_t text_size;
+    int phase;
+    size_t size;
+    bool owned;
+    AES_KEY key;
+} aes_gcm_context_data_t;
+
+/**
+ * ChaCha20 specific options data.
+ */
+typedef struct chacha20_options_data
+{
+    bool aead;
+} chacha20_options_data_t;
+
+/**
+ * ChaCha20 and ChaCha20-Poly1305 specific context data.
+ *
+ * The key is held in words 4-11 of the input state, and text_size tracks the
+ * position in the message.  The phase and the Poly1305 state are only used
+ * when aead is set; the phases are shared with AES GCM.
+ */
+typedef struct chacha20_context_data
+{
+    uint32_t state[16];
+    uint8_t stream[CHACHA_BLOCK_SIZE];
+    size_t count;
+    int impl;
+    bool aead;
+    POLY1305_STATE poly;
+    uint64_t aad_size;
+    uint64_t text_size;
+    int phase;
+    size_t size;
+    bool owned;
+} chacha20_context_data_t;
+
 /**
  * Increment the 128-bit counter by one.
  *
@@ -54,6 +174,78 @@ typedef struct aes_ctr_context_data
 void vccrypt_aes_ctr_incr(
     uint8_t* ctr);
 
+/**
+ * Encrypt or decrypt the contents of one file descriptor into another.
+ *
+ * Regular files are memory mapped and processed directly between the two
+ * mappings.  Other descriptors, or files that cannot be mapped, are processed
+ * using chunked reads and writes.  Either way, processing starts at each
+ * descriptor's current position and leaves it just past the processed data.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param iv            The IV to use when encrypting.  Ignored when
+ *                      decrypting.
+ * \param iv_size       The size of the IV in bytes.
+ * \param input_fd      The descriptor to read from.
+ * \param output_fd     The descriptor to write to.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_file_transform(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    int input_fd, int output_fd, bool encrypt);
+
+/**
+ * Encrypt or decrypt a list of input segments into a list of output segments.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param input         The input segments.
+ * \param input_count   The number of input segments.
+ * \param output        The output segments.
+ * \param output_count  The number of output segments.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_transformv(
+    vccrypt_stream_context_t* context, const vccrypt_stream_iovec_t* input,
+    size_t input_count, const vccrypt_stream_iovec_t* output,
+    size_t output_count, bool encrypt);
+
+/**
+ * Encrypt or decrypt many independent messages in a single call.
+ *
+ * \param jobs          The jobs to process.
+ * \param count         The number of jobs.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_transform_many(
+    vccrypt_stream_job_t* jobs, size_t count, bool encrypt);
+
+/**
+ * Discard any precomputed keystream after the counter has been moved, then
+ * regenerate it from the new position.
+ *
+ * \param ctx           The AES CTR stream context.
+ */
+void vccrypt_aes_ctr_ring_restart(vccrypt_stream_context_t* ctx);
+
+/**
+ * Top up the ring of precomputed keystream, if enabled.
+ *
+ * \param ctx           The AES CTR stream context.
+ */
+void vccrypt_aes_ctr_ring_fill(vccrypt_stream_context_t* ctx);
+
 /**
  * Algorithm-specific initialization for stream cipher.
  *
@@ -66,6 +258,31 @@ void vccrypt_aes_ctr_incr(
 int vccrypt_aes_ctr_alg_init(
     void* options, void* context, const vccrypt_buffer_t* key);
 
+/**
+ * Return the number of bytes of context storage needed by this algorithm.
+ *
+ * \param options   Opaque pointer to this options structure.
+ *
+ * \returns the storage size in bytes.
+ */
+size_t vccrypt_aes_ctr_alg_storage_size(void* options);
+
+/**
+ * Algorithm-specific initialization for stream cipher using caller-provided
+ * storage.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param key           The key to use for this instance.
+ * \param storage       The storage for the cipher state.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_ctr_alg_init_with_storage(
+    void* options, void* context, const vccrypt_buffer_t* key, void* storage,
+    size_t storage_size);
+
 /**
  * Algorithm-specific disposal for stream cipher.
  *
@@ -161,6 +378,70 @@ int vccrypt_aes_ctr_alg_encrypt(
     void* options, void* context, const void* input, size_t size,
     void* output, size_t* offset);
 
+/**
+ * Encrypt a large region of data using multiple threads.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_stream_context_t
+ *                      structure.
+ * \param iv            The IV for this stream.
+ * \param iv_size       The size of the IV in bytes.
+ * \param input_offset  The offset of input within the stream.
+ * \param input         A pointer to the input to encrypt.
+ * \param size          The size of the input, in bytes.
+ * \param output        The output buffer where data is written.  There must
+ *                      be at least *offset + size bytes available in this
+ *                      buffer.
+ * \param offset        A pointer to the current offset in the buffer.  Will
+ *                      be incremented by size.
+ * \param threads       The number of threads to use, or 0 to use one thread
+ *                      per online processor.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_ctr_alg_encrypt_parallel(
+    void* options, void* context, const void* iv, size_t iv_size,
+    size_t input_offset, const void* input, size_t size, void* output,
+    size_t* offset, size_t threads);
+
+/**
+ * Encrypt many independent messages, interleaving their AES rounds.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param jobs          An array of vccrypt_stream_job_t jobs, each of which
+ *                      uses a started AES CTR context.
+ * \param count         The number of jobs.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_aes_ctr_alg_encrypt_many(
+    void* options, void* jobs, size_t count);
+
+/**
+ * Enable, resize, or disable keystream precomputation.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_stream_context_t
+ *                      structure.
+ * \param size          The number of bytes of keystream to keep ready, or 0
+ *                      to disable precomputation.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_aes_ctr_alg_precompute_enable(
+    void* options, void* context, size_t size);
+
+/**
+ * Top up the precomputed keystream.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_stream_context_t
+ *                      structure.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_aes_ctr_alg_precompute(void* options, void* context);
+
 /**
  * \brief Implementation specific options init method.
  *
@@ -179,6 +460,474 @@ int vccrypt_aes_ctr_alg_options_init(
  */
 void vccrypt_aes_ctr_alg_options_dispose(void* disp);
 
+/**
+ * Algorithm-specific initialization for AES GCM.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param key       The key to use for this instance.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_gcm_alg_init(
+    void* options, void* context, const vccrypt_buffer_t* key);
+
+/**
+ * Return the number of bytes of context storage needed by AES GCM.
+ *
+ * \param options   Opaque pointer to this options structure.
+ *
+ * \returns the storage size in bytes.
+ */
+size_t vccrypt_aes_gcm_alg_storage_size(void* options);
+
+/**
+ * Algorithm-specific initialization for AES GCM using caller-provided storage.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param key           The key to use for this instance.
+ * \param storage       The storage for the cipher state.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_gcm_alg_init_with_storage(
+    void* options, void* context, const vccrypt_buffer_t* key, void* storage,
+    size_t storage_size);
+
+/**
+ * Algorithm-specific disposal for AES GCM.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ */
+void vccrypt_aes_gcm_alg_dispose(void* options, void* context);
+
+/**
+ * Algorithm-specific start for AES GCM encryption.  Writes the IV to the
+ * output buffer.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param iv        The 12 byte IV to use for this message.
+ * \param ivSize    The size of the IV in bytes.
+ * \param output    The output buffer to initialize.
+ * \param offset    Pointer to the current offset of the buffer.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_gcm_alg_start_encryption(
+    void* options, void* context, const void* iv, size_t ivSize,
+    void* output, size_t* offset);
+
+/**
+ * Algorithm-specific start for AES GCM decryption.  Reads the IV from the input
+ * buffer.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param input     The input buffer to read the IV from.
+ * \param offset    Pointer to the current offset of the buffer.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_gcm_alg_start_decryption(
+    void* options, void* context, const void* input, size_t* offset);
+
+/**
+ * Algorithm-specific continuation of AES GCM.  Because the tag covers the
+ * whole message, GCM can only be restarted at the beginning of a message.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param iv        The 12 byte IV for this message.
+ * \param ivSize    The size of the IV in bytes.
+ * \param offset    The offset to continue from, which must be 0.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_gcm_alg_continue(
+    void* options, void* context, const void* iv, size_t ivSize,
+    size_t offset);
+
+/**
+ * Encrypt data using AES GCM, authenticating the ciphertext.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param input         A pointer to the plaintext input to encrypt.
+ * \param size          The size of the plaintext input, in bytes.
+ * \param output        The output buffer where data is written.
+ * \param offset        A pointer to the current offset in the buffer.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_alg_encrypt(
+    void* options, void* context, const void* input, size_t size,
+    void* output, size_t* offset);
+
+/**
+ * Decrypt data using AES GCM, authenticating the ciphertext.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param input         A pointer to the ciphertext input to decrypt.
+ * \param size          The size of the ciphertext input, in bytes.
+ * \param output        The output buffer where data is written.
+ * \param offset        A pointer to the current offset in the buffer.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_alg_decrypt(
+    void* options, void* context, const void* input, size_t size,
+    void* output, size_t* offset);
+
+/**
+ * Authenticate additional data with AES GCM.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param aad           The additional data.
+ * \param size          The size of the additional data, in bytes.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_alg_authenticate(
+    void* options, void* context, const void* aad, size_t size);
+
+/**
+ * Finish an AES GCM encryption, writing the tag to the output buffer.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param output        The output buffer where the tag is written.
+ * \param offset        A pointer to the current offset in the buffer.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_alg_finalize(
+    void* options, void* context, void* output, size_t* offset);
+
+/**
+ * Finish an AES GCM decryption, comparing the tag in constant time.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param tag           The expected tag.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_alg_verify(void* options, void* context, const void* tag);
+
+/**
+ * Reset an AES GCM context to the start of a message with the given IV.
+ *
+ * \param ctx_data      The GCM context data.
+ * \param iv            The 12 byte IV.
+ */
+void vccrypt_aes_gcm_reset(aes_gcm_context_data_t* ctx_data, const void* iv);
+
+/**
+ * Absorb message bytes into the GCM hash, buffering any partial block.
+ *
+ * \param ctx_data      The GCM context data.
+ * \param data          The data to hash.
+ * \param size          The size of the data, in bytes.
+ */
+void vccrypt_aes_gcm_ghash(
+    aes_gcm_context_data_t* ctx_data, const uint8_t* data, size_t size);
+
+/**
+ * Zero-pad and absorb any buffered partial block into the GCM hash.
+ *
+ * \param ctx_data      The GCM context data.
+ */
+void vccrypt_aes_gcm_ghash_flush(aes_gcm_context_data_t* ctx_data);
+
+/**
+ * Encrypt or decrypt data with the GCM counter, hashing the ciphertext.
+ *
+ * \param ctx_data      The GCM context data.
+ * \param input         The input data.
+ * \param size          The size of the input data, in bytes.
+ * \param output        The output buffer.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_crypt(
+    aes_gcm_context_data_t* ctx_data, const uint8_t* input, size_t size,
+    uint8_t* output, bool encrypt);
+
+/**
+ * Compute the GCM tag for the message processed so far.
+ *
+ * \param ctx_data      The GCM context data.
+ * \param tag           The buffer to receive the 16 byte tag.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_compute_tag(
+    aes_gcm_context_data_t* ctx_data, uint8_t* tag);
+
+/**
+ * Algorithm-specific initialization for ChaCha20.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param key       The key to use for this instance.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_chacha20_alg_init(
+    void* options, void* context, const vccrypt_buffer_t* key);
+
+/**
+ * Return the number of bytes of context storage needed by ChaCha20.
+ *
+ * \param options   Opaque pointer to this options structure.
+ *
+ * \returns the storage size in bytes.
+ */
+size_t vccrypt_chacha20_alg_storage_size(void* options);
+
+/**
+ * Algorithm-specific initialization for ChaCha20 using caller-provided storage.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param key           The key to use for this instance.
+ * \param storage       The storage for the cipher state.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_chacha20_alg_init_with_storage(
+    void* options, void* context, const vccrypt_buffer_t* key, void* storage,
+    size_t storage_size);
+
+/**
+ * Algorithm-specific disposal for ChaCha20.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ */
+void vccrypt_chacha20_alg_dispose(void* options, void* context);
+
+/**
+ * Algorithm-specific start for ChaCha20 encryption.  Writes the nonce to the
+ * output buffer.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param iv        The 12 byte nonce to use for this message.
+ * \param ivSize    The size of the nonce in bytes.
+ * \param output    The output buffer to initialize.
+ * \param offset    Pointer to the current offset of the buffer.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_chacha20_alg_start_encryption(
+    void* options, void* context, const void* iv, size_t ivSize,
+    void* output, size_t* offset);
+
+/**
+ * Algorithm-specific start for ChaCha20 decryption.  Reads the nonce from the
+ * input buffer.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param input     The input buffer to read the nonce from.
+ * \param offset    Pointer to the current offset of the buffer.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_chacha20_alg_start_decryption(
+    void* options, void* context, const void* input, size_t* offset);
+
+/**
+ * Algorithm-specific continuation of ChaCha20 encryption or decryption.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param iv        The 12 byte nonce for this message.
+ * \param ivSize    The size of the nonce in bytes.
+ * \param offset    The offset to continue from.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_chacha20_alg_continue(
+    void* options, void* context, const void* iv, size_t ivSize,
+    size_t offset);
+
+/**
+ * Encrypt data using ChaCha20.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param input         A pointer to the plaintext input to encrypt.
+ * \param size          The size of the plaintext input, in bytes.
+ * \param output        The output buffer where data is written.
+ * \param offset        A pointer to the current offset in the buffer.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_alg_encrypt(
+    void* options, void* context, const void* input, size_t size,
+    void* output, size_t* offset);
+
+/**
+ * Decrypt data using ChaCha20.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param input         A pointer to the ciphertext input to decrypt.
+ * \param size          The size of the ciphertext input, in bytes.
+ * \param output        The output buffer where data is written.
+ * \param offset        A pointer to the current offset in the buffer.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_alg_decrypt(
+    void* options, void* context, const void* input, size_t size,
+    void* output, size_t* offset);
+
+/**
+ * Authenticate additional data with ChaCha20-Poly1305.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param aad           The additional data.
+ * \param size          The size of the additional data, in bytes.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_poly1305_alg_authenticate(
+    void* options, void* context, const void* aad, size_t size);
+
+/**
+ * Finish a ChaCha20-Poly1305 encryption, writing the tag to the output buffer.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param output        The output buffer where the tag is written.
+ * \param offset        A pointer to the current offset in the buffer.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_poly1305_alg_finalize(
+    void* options, void* context, void* output, size_t* offset);
+
+/**
+ * Finish a ChaCha20-Poly1305 decryption, comparing the tag in constant time.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param tag           The expected tag.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_poly1305_alg_verify(
+    void* options, void* context, const void* tag);
+
+/**
+ * Reset a ChaCha20 context to the given block of a message.  For
+ * ChaCha20-Poly1305, this also derives the one-time Poly1305 key.
+ *
+ * \param ctx_data      The ChaCha20 context data.
+ * \param iv            The 12 byte nonce.
+ * \param offset        The byte offset within the message to seek to.
+ */
+void vccrypt_chacha20_reset(
+    chacha20_context_data_t* ctx_data, const void* iv, uint64_t offset);
+
+/**
+ * Encrypt or decrypt data with ChaCha20, authenticating the ciphertext if this
+ * is a ChaCha20-Poly1305 context.
+ *
+ * \param ctx_data      The ChaCha20 context data.
+ * \param input         The input data.
+ * \param size          The size of the input data, in bytes.
+ * \param output        The output buffer.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_crypt(
+    chacha20_context_data_t* ctx_data, const uint8_t* input, size_t size,
+    uint8_t* output, bool encrypt);
+
+/**
+ * Compute the Poly1305 tag for the message processed so far.
+ *
+ * \param ctx_data      The ChaCha20 context data.
+ * \param tag           The buffer to receive the 16 byte tag.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_poly1305_compute_tag(
+    chacha20_context_data_t* ctx_data, uint8_t* tag);
+
+/**
+ * Advance a 128-bit big-endian counter by the given number of blocks.
+ */
+static inline void vccrypt_ctr128_add(uint8_t* ctr, uint64_t blocks)
+{
+    uint64_t hi = vccrypt_load_be64(ctr);
+    uint64_t lo = vccrypt_load_be64(ctr + 8) + blocks;
+
+    if (lo < blocks)
+        ++hi;
+
+    vccrypt_store_be64(ctr, hi);
+    vccrypt_store_be64(ctr + 8, lo);
+}
+
+/**
+ * Fill count blocks with the 128-bit big-endian counters following ctr, and
+ * leave ctr set to the last counter written.
+ */
+static inline void vccrypt_ctr128_fill(
+    uint8_t* blocks, uint8_t* ctr, size_t count)
+{
+    uint64_t hi = vccrypt_load_be64(ctr);
+    uint64_t lo = vccrypt_load_be64(ctr + 8);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        /* 128-bit increment, carrying into the high half. */
+        if (0 == ++lo)
+            ++hi;
+
+        vccrypt_store_be64(blocks + 16 * i, hi);
+        vccrypt_store_be64(blocks + 16 * i + 8, lo);
+    }
+
+    vccrypt_store_be64(ctr, hi);
+    vccrypt_store_be64(ctr + 8, lo);
+}
+
+/**
+ * Fill count blocks with the counters following ctr, incrementing only the low
+ * 32 bits as GCM requires, and leave ctr set to the last counter written.
+ */
+static inline void vccrypt_ctr32_fill(
+    uint8_t* blocks, uint8_t* ctr, size_t count)
+{
+    uint32_t c = vccrypt_load_be32(ctr + 12);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint8_t* block = blocks + 16 * i;
+
+        memcpy(block, ctr, 12);
+        vccrypt_store_be32(block + 12, ++c);
+    }
+
+    vccrypt_store_be32(ctr + 12, c);
+}
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
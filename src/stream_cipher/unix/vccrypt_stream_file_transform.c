@@ -0,0 +1,505 @@
+/**
+ * \file vccrypt_stream_file_transform.c
+ *
+ * Encrypt or decrypt a file descriptor into another file descriptor using a
+ * stream cipher, memory mapping regular files where possible.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+/* mmap, posix_madvise, ftruncate, and friends are POSIX interfaces. */
+#define _POSIX_C_SOURCE 200809L
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <vccrypt/os.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/allocator.h>
+#include <vpr/parameters.h>
+
+#include "../stream_cipher_private.h"
+
+#if defined(VCCRYPT_OS_UNIX)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+/* forward decls */
+static int file_transform_mapped(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    int input_fd, const struct stat* in_st, int output_fd,
+    const struct stat* out_st, bool encrypt, bool* mapped);
+static int file_transform_buffered(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    int input_fd, int output_fd, const struct stat* out_st, bool encrypt);
+static uint8_t* map_window(
+    int fd, off_t pos, size_t size, int prot, void** map, size_t* map_size);
+static void unmap_window(void** map, size_t* map_size);
+static ssize_t read_full(int fd, uint8_t* buf, size_t size);
+static int write_full(int fd, const uint8_t* buf, size_t size);
+
+/**
+ * Encrypt or decrypt the contents of one file descriptor into another.
+ *
+ * Both paths read the input from its current position to the end of file and
+ * write the output at its current position, leaving both positions just past
+ * the data that was processed.  A regular output file ends where the output
+ * does.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param iv            The IV to use when encrypting.  Ignored when
+ *                      decrypting.
+ * \param iv_size       The size of the IV in bytes.
+ * \param input_fd      The descriptor to read from.
+ * \param output_fd     The descriptor to write to.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if the cipher produces an
+ *        authentication tag, which this file format has no room for.
+ *      - \ref VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG if both descriptors refer
+ *        to the same file.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_file_transform(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    int input_fd, int output_fd, bool encrypt)
+{
+    struct stat in_st, out_st;
+    bool mapped = false;
+    int retval;
+
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(!encrypt || NULL != iv);
+
+    /* the file format carries no tag, so AEAD output would be unverified. */
+    if (context->options->tag_size > 0)
+        return VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED;
+
+    if (0 != fstat(input_fd, &in_st) || 0 != fstat(output_fd, &out_st))
+        return VCCRYPT_ERROR_STREAM_FILE_IO;
+
+    /* transforming a file onto itself would overwrite unread input. */
+    if (in_st.st_dev == out_st.st_dev && in_st.st_ino == out_st.st_ino)
+        return VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG;
+
+    /* regular files are mapped and processed in place. */
+    retval =
+        file_transform_mapped(
+            context, iv, iv_size, input_fd, &in_st, output_fd, &out_st,
+            encrypt, &mapped);
+    if (mapped)
+        return retval;
+
+    /* anything else (pipes, sockets, unmappable files) is streamed. */
+    return
+        file_transform_buffered(
+            context, iv, iv_size, input_fd, output_fd, &out_st, encrypt);
+}
+
+/**
+ * Attempt to transform the input by memory mapping both files.
+ *
+ * The body is processed in windows of VCCRYPT_STREAM_FILE_MAP_WINDOW_SIZE
+ * bytes, each mapped, hinted as sequential, and unmapped in turn, so that the
+ * address space and page cache used stay bounded however large the file is.
+ * The first window also holds the IV header.
+ *
+ * If either descriptor is not a regular file or the first window cannot be
+ * mapped, *mapped is left false and neither file nor either position has been
+ * changed, so the caller can fall back to the buffered path.  If the output
+ * was grown and a later step fails, its original size is restored.
+ */
+static int file_transform_mapped(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    int input_fd, const struct stat* in_st, int output_fd,
+    const struct stat* out_st, bool encrypt, bool* mapped)
+{
+    size_t header_size = context->options->IV_size;
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    size_t in_size, body_size, done, window, in_lead, out_lead;
+    size_t in_window, out_window, in_offset, out_offset;
+    size_t in_map_size = 0, out_map_size = 0;
+    off_t in_pos, out_pos, out_end, in_next, out_next;
+    void* in_map = NULL;
+    void* out_map = NULL;
+    uint8_t* in;
+    uint8_t* out;
+    bool grown = false;
+    int flags, retval;
+
+    if (!S_ISREG(in_st->st_mode) || !S_ISREG(out_st->st_mode))
+        return VCCRYPT_STATUS_SUCCESS;
+
+    /* appending writes ignore the file position, so leave them to write(). */
+    flags = fcntl(output_fd, F_GETFL);
+    if (flags < 0 || (flags & O_APPEND))
+        return VCCRYPT_STATUS_SUCCESS;
+
+    in_pos = lseek(input_fd, 0, SEEK_CUR);
+    out_pos = lseek(output_fd, 0, SEEK_CUR);
+    if (in_pos < 0 || out_pos < 0)
+        return VCCRYPT_STATUS_SUCCESS;
+
+    /* only the input from the current position onward is transformed. */
+    in_size = 0;
+    if (in_st->st_size > in_pos)
+    {
+        if ((uintmax_t)(in_st->st_size - in_pos)
+                > (uintmax_t)(SIZE_MAX - header_size - page_size))
+            return VCCRYPT_STATUS_SUCCESS;
+
+        in_size = (size_t)(in_st->st_size - in_pos);
+    }
+
+    /* the header precedes the body in the output when encrypting, and in the
+     * input when decrypting. */
+    if (encrypt)
+    {
+        body_size = in_size;
+        in_lead = 0;
+        out_lead = header_size;
+    }
+    else
+    {
+        /* from here on, errors are final; don't retry with buffered I/O. */
+        if (in_size < header_size)
+        {
+            *mapped = true;
+            return VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG;
+        }
+
+        body_size = in_size - header_size;
+        in_lead = header_size;
+        out_lead = 0;
+    }
+
+    out_end = out_pos + (off_t)(out_lead + body_size);
+
+    /* grow the output to fit; it is only shrunk once the output is written. */
+    if (out_end > out_st->st_size)
+    {
+        if (0 != ftruncate(output_fd, out_end))
+        {
+            *mapped = true;
+            return VCCRYPT_ERROR_STREAM_FILE_IO;
+        }
+
+        grown = true;
+    }
+
+    in_next = in_pos;
+    out_next = out_pos;
+    done = 0;
+    do
+    {
+        window = body_size - done;
+        if (window > VCCRYPT_STREAM_FILE_MAP_WINDOW_SIZE)
+            window = VCCRYPT_STREAM_FILE_MAP_WINDOW_SIZE;
+
+        /* the first window also covers the header. */
+        in_window = (0 == done ? in_lead : 0) + window;
+        out_window = (0 == done ? out_lead : 0) + window;
+
+        in = NULL;
+        if (in_window > 0)
+        {
+            in =
+                map_window(
+                    input_fd, in_next, in_window, PROT_READ, &in_map,
+                    &in_map_size);
+        }
+
+        out = NULL;
+        if (NULL != in || 0 == in_window)
+        {
+            if (out_window > 0)
+            {
+                out =
+                    map_window(
+                        output_fd, out_next, out_window,
+                        PROT_READ | PROT_WRITE, &out_map, &out_map_size);
+            }
+        }
+
+        if ((in_window > 0 && NULL == in) || (out_window > 0 && NULL == out))
+        {
+            /* nothing is written yet, so the buffered path can take over. */
+            if (0 == done && !*mapped)
+            {
+                retval = VCCRYPT_STATUS_SUCCESS;
+                goto cleanup;
+            }
+
+            retval = VCCRYPT_ERROR_STREAM_FILE_IO;
+            goto cleanup;
+        }
+
+        *mapped = true;
+        in_offset = 0;
+        out_offset = 0;
+
+        /* write or read the IV header. */
+        if (0 == done)
+        {
+            retval =
+                encrypt
+                    ? vccrypt_stream_start_encryption(
+                        context, iv, iv_size, out, &out_offset)
+                    : vccrypt_stream_start_decryption(
+                        context, in, &in_offset);
+            if (VCCRYPT_STATUS_SUCCESS != retval)
+                goto cleanup;
+        }
+
+        /* process this window directly between the two mappings. */
+        if (window > 0)
+        {
+            retval =
+                encrypt
+                    ? vccrypt_stream_encrypt(
+                        context, in + in_offset, window, out, &out_offset)
+                    : vccrypt_stream_decrypt(
+                        context, in + in_offset, window, out, &out_offset);
+            if (VCCRYPT_STATUS_SUCCESS != retval)
+                goto cleanup;
+        }
+
+        unmap_window(&in_map, &in_map_size);
+        unmap_window(&out_map, &out_map_size);
+
+        in_next += (off_t)in_window;
+        out_next += (off_t)out_window;
+        done += window;
+    } while (done < body_size);
+
+    /* end the output file with the output, and advance both positions. */
+    if ((out_end < out_st->st_size && 0 != ftruncate(output_fd, out_end))
+     || lseek(input_fd, in_pos + (off_t)in_size, SEEK_SET) < 0
+     || lseek(output_fd, out_end, SEEK_SET) < 0)
+    {
+        retval = VCCRYPT_ERROR_STREAM_FILE_IO;
+        goto cleanup;
+    }
+
+    retval = VCCRYPT_STATUS_SUCCESS;
+
+cleanup:
+    unmap_window(&out_map, &out_map_size);
+    unmap_window(&in_map, &in_map_size);
+
+    /* on failure or fallback, don't leave the output grown. */
+    if ((VCCRYPT_STATUS_SUCCESS != retval || !*mapped) && grown
+     && 0 != ftruncate(output_fd, out_st->st_size))
+    {
+        *mapped = true;
+        retval = VCCRYPT_ERROR_STREAM_FILE_IO;
+    }
+
+    return retval;
+}
+
+/**
+ * Map size bytes of a file starting at pos, hinting that they will be accessed
+ * sequentially.
+ *
+ * The mapping starts on the page boundary at or before pos.  On success, *map
+ * and *map_size describe the whole mapping, for unmap_window().
+ *
+ * \returns a pointer to the byte at pos, or NULL if the mapping failed.
+ */
+static uint8_t* map_window(
+    int fd, off_t pos, size_t size, int prot, void** map, size_t* map_size)
+{
+    off_t base = pos & ~((off_t)sysconf(_SC_PAGESIZE) - 1);
+    size_t lead = (size_t)(pos - base);
+    void* m;
+
+    m = mmap(NULL, lead + size, prot, MAP_SHARED, fd, base);
+    if (MAP_FAILED == m)
+        return NULL;
+
+    posix_madvise(m, lead + size, POSIX_MADV_SEQUENTIAL);
+
+    *map = m;
+    *map_size = lead + size;
+
+    return (uint8_t*)m + lead;
+}
+
+/**
+ * Unmap a window mapped by map_window(), if there is one.
+ */
+static void unmap_window(void** map, size_t* map_size)
+{
+    if (NULL != *map)
+    {
+        munmap(*map, *map_size);
+        *map = NULL;
+        *map_size = 0;
+    }
+}
+
+/**
+ * Transform the input using chunked reads and writes.
+ */
+static int file_transform_buffered(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    int input_fd, int output_fd, const struct stat* out_st, bool encrypt)
+{
+    allocator_options_t* alloc_opts = context->options->alloc_opts;
+    size_t header_size = context->options->IV_size;
+    size_t offset = 0;
+    ssize_t read_size;
+    off_t out_end;
+    uint8_t* buf;
+    int retval;
+
+    MODEL_ASSERT(header_size <= VCCRYPT_STREAM_FILE_CHUNK_SIZE);
+
+    buf = (uint8_t*)allocate(alloc_opts, VCCRYPT_STREAM_FILE_CHUNK_SIZE);
+    if (NULL == buf)
+        return VCCRYPT_ERROR_STREAM_FILE_OUT_OF_MEMORY;
+
+    /* write or read the IV header. */
+    if (encrypt)
+    {
+        retval =
+            vccrypt_stream_start_encryption(context, iv, iv_size, buf, &offset);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            goto cleanup;
+
+        retval = write_full(output_fd, buf, header_size);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            goto cleanup;
+    }
+    else
+    {
+        read_size = read_full(input_fd, buf, header_size);
+        if (read_size < 0)
+        {
+            retval = VCCRYPT_ERROR_STREAM_FILE_IO;
+            goto cleanup;
+        }
+        else if ((size_t)read_size < header_size)
+        {
+            retval = VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG;
+            goto cleanup;
+        }
+
+        retval = vccrypt_stream_start_decryption(context, buf, &offset);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            goto cleanup;
+    }
+
+    /* process the body one chunk at a time, in place. */
+    for (;;)
+    {
+        read_size = read_full(input_fd, buf, VCCRYPT_STREAM_FILE_CHUNK_SIZE);
+        if (read_size < 0)
+        {
+            retval = VCCRYPT_ERROR_STREAM_FILE_IO;
+            goto cleanup;
+        }
+        else if (0 == read_size)
+        {
+            break;
+        }
+
+        offset = 0;
+        retval =
+            encrypt
+                ? vccrypt_stream_encrypt(
+                    context, buf, (size_t)read_size, buf, &offset)
+                : vccrypt_stream_decrypt(
+                    context, buf, (size_t)read_size, buf, &offset);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            goto cleanup;
+
+        retval = write_full(output_fd, buf, (size_t)read_size);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            goto cleanup;
+    }
+
+    /* as with the mapped path, a regular output file ends with the output. */
+    if (S_ISREG(out_st->st_mode))
+    {
+        out_end = lseek(output_fd, 0, SEEK_CUR);
+        if (out_end < 0 || 0 != ftruncate(output_fd, out_end))
+        {
+            retval = VCCRYPT_ERROR_STREAM_FILE_IO;
+            goto cleanup;
+        }
+    }
+
+    retval = VCCRYPT_STATUS_SUCCESS;
+
+cleanup:
+    memset(buf, 0, VCCRYPT_STREAM_FILE_CHUNK_SIZE);
+    release(alloc_opts, buf);
+
+    return retval;
+}
+
+/**
+ * Read until size bytes have been read or end of file is reached.
+ *
+ * \returns the number of bytes read, or -1 on error.
+ */
+static ssize_t read_full(int fd, uint8_t* buf, size_t size)
+{
+    size_t total = 0;
+
+    while (total < size)
+    {
+        ssize_t rv = read(fd, buf + total, size - total);
+        if (rv < 0)
+        {
+            if (EINTR == errno)
+                continue;
+
+            return -1;
+        }
+        else if (0 == rv)
+        {
+            break;
+        }
+
+        total += (size_t)rv;
+    }
+
+    return (ssize_t)total;
+}
+
+/**
+ * Write all size bytes.
+ */
+static int write_full(int fd, const uint8_t* buf, size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t rv = write(fd, buf, size);
+        if (rv < 0)
+        {
+            if (EINTR == errno)
+                continue;
+
+            return VCCRYPT_ERROR_STREAM_FILE_IO;
+        }
+
+        buf += rv;
+        size -= (size_t)rv;
+    }
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+#endif /*defined(VCCRYPT_OS_UNIX)*/
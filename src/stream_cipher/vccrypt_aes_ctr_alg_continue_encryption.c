@@ -49,5 +49,8 @@ int vccrypt_aes_ctr_alg_continue_encryption(
     AES_encrypt(ctx_data->ctr, ctx_data->stream, &ctx_data->key);
     ctx_data->count = input_offset % 16;
 
+    /* any precomputed keystream belonged to the old position. */
+    vccrypt_aes_ctr_ring_restart(ctx);
+
     return VCCRYPT_STATUS_SUCCESS;
 }
@@ -24,6 +24,18 @@ void vccrypt_aes_ctr_alg_dispose(void* UNUSED(options), void* context)
     aes_ctr_context_data_t* ctx_data =
         (aes_ctr_context_data_t*)ctx->stream_state;
 
-    memset(ctx_data, 0, sizeof(aes_ctr_context_data_t));
-    release(ctx->options->alloc_opts, ctx_data);
+    bool owned = ctx_data->owned;
+
+    /* unused precomputed keystream is as sensitive as the key. */
+    if (NULL != ctx_data->ring)
+    {
+        memset(ctx_data->ring, 0, ctx_data->ring_size);
+        release(ctx->options->alloc_opts, ctx_data->ring);
+    }
+
+    memset(ctx_data, 0, ctx_data->size);
+
+    /* caller-provided storage is wiped but not released. */
+    if (owned)
+        release(ctx->options->alloc_opts, ctx_data);
 }
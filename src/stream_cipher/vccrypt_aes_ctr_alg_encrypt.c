@@ -3,14 +3,96 @@
  *
  * Encrypt data using the given AES CTR mode stream.
  *
- * \copyright 2018 Velo Payments, Inc.  All rights reserved.
+ * \copyright 2018-2026 Velo Payments, Inc.  All rights reserved.
  */
 
 #include <cbmc/model_assert.h>
+#include <string.h>
 #include <vpr/parameters.h>
 
 #include "stream_cipher_private.h"
 
+#define BATCH_SIZE (VCCRYPT_AES_CTR_ALG_BATCH_BLOCKS * 16)
+
+/**
+ * XOR a run of bytes with the keystream a word at a time.  Input and output may
+ * be identical.
+ */
+static inline void xor_words(
+    uint8_t* out, const uint8_t* in, const uint8_t* stream, size_t size)
+{
+    uint64_t a, b;
+
+    while (size >= sizeof(uint64_t))
+    {
+        memcpy(&a, in, sizeof(a));
+        memcpy(&b, stream, sizeof(b));
+        a ^= b;
+        memcpy(out, &a, sizeof(a));
+
+        in += sizeof(uint64_t);
+        out += sizeof(uint64_t);
+        stream += sizeof(uint64_t);
+        size -= sizeof(uint64_t);
+    }
+
+    while (size--)
+    {
+        *(out++) = *(in++) ^ *(stream++);
+    }
+}
+
+/**
+ * Encrypt as much as possible using precomputed keystream from the ring, which
+ * reduces to a memory XOR.  Consumed keystream is wiped as it is used.
+ */
+static inline void drain_ring(
+    aes_ctr_context_data_t* ctx_data, const uint8_t** in, uint8_t** out,
+    size_t* size)
+{
+    while (*size > 0 && ctx_data->ring_count > 0)
+    {
+        uint8_t* block = ctx_data->ring + ctx_data->ring_head;
+        size_t n = ctx_data->ring_size - ctx_data->ring_head;
+        size_t used;
+
+        if (n > ctx_data->ring_count)
+            n = ctx_data->ring_count;
+
+        if (*size >= 16)
+        {
+            /* whole blocks are XORed straight out of the ring. */
+            used = *size - (*size % 16);
+            if (used > n)
+                used = n;
+
+            xor_words(*out, *in, block, used);
+            memcpy(ctx_data->stream, block + used - 16, 16);
+            ctx_data->count = 16;
+            *in += used;
+            *out += used;
+            *size -= used;
+        }
+        else
+        {
+            /* a partial block becomes the current keystream block. */
+            used = 16;
+            memcpy(ctx_data->stream, block, 16);
+            xor_words(*out, *in, ctx_data->stream, *size);
+            ctx_data->count = *size;
+            *in += *size;
+            *out += *size;
+            *size = 0;
+        }
+
+        vccrypt_ctr128_add(ctx_data->ctr, used / 16);
+        memset(block, 0, used);
+        ctx_data->ring_head =
+            (ctx_data->ring_head + used) % ctx_data->ring_size;
+        ctx_data->ring_count -= used;
+    }
+}
+
 /**
  * Encrypt data using the stream cipher.
  *
@@ -34,25 +116,63 @@ int vccrypt_aes_ctr_alg_encrypt(
     vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
     aes_ctr_context_data_t* ctx_data =
         (aes_ctr_context_data_t*)ctx->stream_state;
+    uint8_t keystream[BATCH_SIZE];
+    size_t n;
 
     const uint8_t* in = (const uint8_t*)input;
     uint8_t* out = (uint8_t*)output;
     out += *offset;
+    *offset += size;
 
-    while (size--)
+    /* drain any keystream left over from the previous call. */
+    if (ctx_data->count < 16)
     {
-        /* generate more stream bytes if needed */
-        if (ctx_data->count >= 16)
-        {
-            ctx_data->count = 0;
-            vccrypt_aes_ctr_incr(ctx_data->ctr);
-            AES_encrypt(ctx_data->ctr, ctx_data->stream, &ctx_data->key);
-        }
+        n = 16 - ctx_data->count;
+        if (n > size)
+            n = size;
+
+        xor_words(out, in, ctx_data->stream + ctx_data->count, n);
+        ctx_data->count += n;
+        in += n;
+        out += n;
+        size -= n;
+    }
 
-        /* encrypt a byte and update the output offset */
-        *(out++) = *(in++) ^ ctx_data->stream[ctx_data->count++];
-        ++(*offset);
+    /* precomputed keystream turns the rest into a memory XOR. */
+    if (NULL != ctx_data->ring)
+    {
+        drain_ring(ctx_data, &in, &out, &size);
     }
 
+    /* bulk path: generate a batch of keystream blocks at once. */
+    while (size >= 16)
+    {
+        n = size / 16;
+        if (n > VCCRYPT_AES_CTR_ALG_BATCH_BLOCKS)
+            n = VCCRYPT_AES_CTR_ALG_BATCH_BLOCKS;
+
+        vccrypt_ctr128_fill(keystream, ctx_data->ctr, n);
+        AES_encrypt_blocks(keystream, keystream, n, &ctx_data->key);
+        xor_words(out, in, keystream, 16 * n);
+
+        /* the last block of the batch is the current, fully used block. */
+        memcpy(ctx_data->stream, keystream + 16 * (n - 1), 16);
+
+        in += 16 * n;
+        out += 16 * n;
+        size -= 16 * n;
+    }
+
+    /* tail: generate one more block and encrypt the remaining bytes. */
+    if (size > 0)
+    {
+        vccrypt_aes_ctr_incr(ctx_data->ctr);
+        AES_encrypt(ctx_data->ctr, ctx_data->stream, &ctx_data->key);
+        xor_words(out, in, ctx_data->stream, size);
+        ctx_data->count = size;
+    }
+
+    memset(keystream, 0, sizeof(keystream));
+
     return VCCRYPT_STATUS_SUCCESS;
 }
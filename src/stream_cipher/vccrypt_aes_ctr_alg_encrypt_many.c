@@ -0,0 +1,256 @@
+/**
+ * \file vccrypt_aes_ctr_alg_encrypt_many.c
+ *
+ * Encrypt many independent messages using AES CTR mode, interleaving their AES
+ * rounds across lanes.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * A job that currently owns a lane.
+ */
+typedef struct aes_ctr_lane
+{
+    vccrypt_stream_job_t* job;
+    aes_ctr_context_data_t* ctx_data;
+    const uint8_t* in;
+    uint8_t* out;
+    size_t blocks;
+    size_t tail;
+} aes_ctr_lane_t;
+
+/**
+ * Start a job, setting *queued to true if it still has full blocks to put in
+ * a lane.
+ *
+ * Leftover keystream from a previous call is drained first.  Jobs too short to
+ * need a lane, and jobs whose key schedule can't be interleaved, are finished
+ * on the spot by the batched single stream path.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+static int aes_ctr_lane_start(
+    void* options, vccrypt_stream_job_t* job, aes_ctr_lane_t* lane,
+    bool* queued)
+{
+    aes_ctr_context_data_t* ctx_data =
+        (aes_ctr_context_data_t*)job->context->stream_state;
+    const uint8_t* in = (const uint8_t*)job->input;
+    size_t size = job->size;
+    size_t n;
+    int retval;
+
+    *queued = false;
+
+    if (0 == size)
+        return VCCRYPT_STATUS_SUCCESS;
+
+    /* precomputed keystream is already just a memory XOR, and a schedule
+     * that can't be interleaved is faster in the batched path. */
+    if (NULL != ctx_data->ring || !AES_lanes_supported(&ctx_data->key))
+    {
+        return
+            vccrypt_aes_ctr_alg_encrypt(
+                options, job->context, in, size, job->output, &job->offset);
+    }
+
+    /* use up the rest of the current keystream block. */
+    if (ctx_data->count < 16)
+    {
+        n = 16 - ctx_data->count;
+        if (n > size)
+            n = size;
+
+        retval =
+            vccrypt_aes_ctr_alg_encrypt(
+                options, job->context, in, n, job->output, &job->offset);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            return retval;
+
+        in += n;
+        size -= n;
+    }
+
+    /* a partial block is finished by the single stream path. */
+    if (size < 16)
+    {
+        if (size > 0)
+        {
+            return
+                vccrypt_aes_ctr_alg_encrypt(
+                    options, job->context, in, size, job->output,
+                    &job->offset);
+        }
+
+        return VCCRYPT_STATUS_SUCCESS;
+    }
+
+    lane->job = job;
+    lane->ctx_data = ctx_data;
+    lane->in = in;
+    lane->out = (uint8_t*)job->output + job->offset;
+    lane->blocks = size / 16;
+    lane->tail = size % 16;
+    *queued = true;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Finish the job in a lane, handing its remaining blocks and tail to the
+ * single stream path.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+static int aes_ctr_lane_finish(void* options, aes_ctr_lane_t* lane)
+{
+    vccrypt_stream_job_t* job = lane->job;
+    size_t done = (size_t)(lane->out - ((uint8_t*)job->output + job->offset));
+    size_t rest = 16 * lane->blocks + lane->tail;
+
+    job->offset += done;
+
+    if (rest > 0)
+    {
+        return
+            vccrypt_aes_ctr_alg_encrypt(
+                options, job->context, lane->in, rest, job->output,
+                &job->offset);
+    }
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
+
+/**
+ * Return true if the given job uses the context of one of the active lanes.
+ */
+static bool aes_ctr_lane_busy(
+    const vccrypt_stream_job_t* job, const aes_ctr_lane_t* lanes,
+    size_t active)
+{
+    for (size_t l = 0; l < active; ++l)
+    {
+        if (lanes[l].job->context == job->context)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * Encrypt many independent messages, interleaving their AES rounds.
+ *
+ * Each lane holds one message.  Every step generates the next keystream block
+ * for every lane in a single AES_encrypt_lanes() call, so that the rounds of
+ * one message run in the shadow of the others.  As a message runs out of full
+ * blocks, the next waiting message takes over its lane.  A message that uses
+ * the same context as an active lane waits until that lane is finished, so
+ * that jobs sharing a context are encrypted one after another, in order.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param jobs          An array of vccrypt_stream_job_t jobs, each of which
+ *                      uses a started AES CTR context.
+ * \param count         The number of jobs.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_aes_ctr_alg_encrypt_many(
+    void* options, void* jobs, size_t count)
+{
+    vccrypt_stream_job_t* job = (vccrypt_stream_job_t*)jobs;
+    aes_ctr_lane_t lanes[AES_MAX_LANES];
+    const AES_KEY* keys[AES_MAX_LANES];
+    uint8_t keystream[AES_MAX_LANES * 16];
+    size_t active = 0, next = 0;
+    bool queued;
+    int retval = VCCRYPT_STATUS_SUCCESS;
+
+    MODEL_ASSERT(NULL != job || 0 == count);
+
+    for (;;)
+    {
+        /* fill the free lanes from the waiting jobs, in order. */
+        while (active < AES_MAX_LANES && next < count
+            && !aes_ctr_lane_busy(&job[next], lanes, active))
+        {
+            retval =
+                aes_ctr_lane_start(
+                    options, &job[next], &lanes[active], &queued);
+            if (VCCRYPT_STATUS_SUCCESS != retval)
+                goto cleanup;
+
+            if (queued)
+                ++active;
+
+            ++next;
+        }
+
+        /* a lone job is better served by the batched single stream path. */
+        if (active < 2)
+        {
+            if (1 == active)
+            {
+                active = 0;
+                retval = aes_ctr_lane_finish(options, &lanes[0]);
+                if (VCCRYPT_STATUS_SUCCESS != retval)
+                    goto cleanup;
+            }
+
+            /* a job that waited on the lone lane can start now. */
+            if (next < count)
+                continue;
+
+            break;
+        }
+
+        for (size_t l = 0; l < active; ++l)
+        {
+            vccrypt_aes_ctr_incr(lanes[l].ctx_data->ctr);
+            memcpy(keystream + 16 * l, lanes[l].ctx_data->ctr, 16);
+            keys[l] = &lanes[l].ctx_data->key;
+        }
+
+        AES_encrypt_lanes(keystream, keys, active);
+
+        for (size_t l = 0; l < active; )
+        {
+            aes_ctr_lane_t* lane = &lanes[l];
+
+            for (int i = 0; i < 16; ++i)
+                lane->out[i] = lane->in[i] ^ keystream[16 * l + i];
+
+            memcpy(lane->ctx_data->stream, keystream + 16 * l, 16);
+            lane->ctx_data->count = 16;
+            lane->in += 16;
+            lane->out += 16;
+
+            if (0 == --lane->blocks)
+            {
+                /* retire this lane, moving the last lane into its slot. */
+                retval = aes_ctr_lane_finish(options, lane);
+                if (VCCRYPT_STATUS_SUCCESS != retval)
+                    goto cleanup;
+
+                memmove(
+                    keystream + 16 * l, keystream + 16 * (active - 1), 16);
+                lanes[l] = lanes[--active];
+            }
+            else
+            {
+                ++l;
+            }
+        }
+    }
+
+cleanup:
+    memset(keystream, 0, sizeof(keystream));
+
+    return retval;
+}
@@ -0,0 +1,152 @@
+/**
+ * \file vccrypt_aes_ctr_alg_encrypt_parallel.c
+ *
+ * Encrypt a large region using AES CTR mode on multiple threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+#include "../parallel/parallel_private.h"
+
+/**
+ * Shared state for a single parallel encryption.
+ */
+typedef struct aes_ctr_parallel
+{
+    vccrypt_stream_options_t* options;
+    aes_ctr_context_data_t* workers;
+    const uint8_t* iv;
+    size_t iv_size;
+    size_t input_offset;
+    const uint8_t* input;
+    size_t size;
+    uint8_t* output;
+} aes_ctr_parallel_t;
+
+/**
+ * Encrypt a single chunk on the given worker's counter state.
+ */
+static void aes_ctr_parallel_job(void* context, size_t worker, size_t job)
+{
+    aes_ctr_parallel_t* par = (aes_ctr_parallel_t*)context;
+    vccrypt_stream_context_t wctx;
+    size_t begin = job * VCCRYPT_AES_CTR_ALG_PARALLEL_CHUNK_SIZE;
+    size_t len = par->size - begin;
+    size_t woffset = begin;
+
+    if (len > VCCRYPT_AES_CTR_ALG_PARALLEL_CHUNK_SIZE)
+        len = VCCRYPT_AES_CTR_ALG_PARALLEL_CHUNK_SIZE;
+
+    /* each worker owns a private copy of the key and counter state. */
+    memset(&wctx, 0, sizeof(wctx));
+    wctx.options = par->options;
+    wctx.stream_state = &par->workers[worker];
+
+    /* neither call can fail once the IV size has been checked. */
+    vccrypt_aes_ctr_alg_continue_encryption(
+        par->options, &wctx, par->iv, par->iv_size,
+        par->input_offset + begin);
+    vccrypt_aes_ctr_alg_encrypt(
+        par->options, &wctx, par->input + begin, len, par->output, &woffset);
+}
+
+/**
+ * Encrypt a large region of data using multiple threads.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_stream_context_t
+ *                      structure.
+ * \param iv            The IV for this stream.
+ * \param iv_size       The size of the IV in bytes.
+ * \param input_offset  The offset of input within the stream.
+ * \param input         A pointer to the input to encrypt.
+ * \param size          The size of the input, in bytes.
+ * \param output        The output buffer where data is written.  There must
+ *                      be at least *offset + size bytes available in this
+ *                      buffer.
+ * \param offset        A pointer to the current offset in the buffer.  Will
+ *                      be incremented by size.
+ * \param threads       The number of threads to use, or 0 to use one thread
+ *                      per online processor.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_aes_ctr_alg_encrypt_parallel(
+    void* options, void* context, const void* iv, size_t iv_size,
+    size_t input_offset, const void* input, size_t size, void* output,
+    size_t* offset, size_t threads)
+{
+    vccrypt_stream_options_t* opt = (vccrypt_stream_options_t*)options;
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    aes_ctr_context_data_t* ctx_data =
+        (aes_ctr_context_data_t*)ctx->stream_state;
+    aes_ctr_parallel_t par;
+    size_t jobs, workers;
+
+    MODEL_ASSERT(NULL != opt);
+    MODEL_ASSERT(NULL != ctx);
+    MODEL_ASSERT(NULL != ctx_data);
+    MODEL_ASSERT(NULL != iv);
+    MODEL_ASSERT(NULL != offset);
+
+    if (VCCRYPT_AES_CTR_ALG_IV_SIZE != iv_size)
+        return VCCRYPT_ERROR_STREAM_PARALLEL_INVALID_ARG;
+
+    jobs =
+        (size + VCCRYPT_AES_CTR_ALG_PARALLEL_CHUNK_SIZE - 1)
+            / VCCRYPT_AES_CTR_ALG_PARALLEL_CHUNK_SIZE;
+    workers = vccrypt_parallel_thread_count(threads, jobs);
+
+    /* small regions are not worth the thread overhead. */
+    if (workers < 2)
+    {
+        vccrypt_aes_ctr_alg_continue_encryption(
+            options, context, iv, iv_size, input_offset);
+
+        if (0 == size)
+            return VCCRYPT_STATUS_SUCCESS;
+
+        return vccrypt_aes_ctr_alg_encrypt(
+            options, context, input, size, output, offset);
+    }
+
+    memset(&par, 0, sizeof(par));
+    par.options = opt;
+    par.iv = (const uint8_t*)iv;
+    par.iv_size = iv_size;
+    par.input_offset = input_offset;
+    par.input = (const uint8_t*)input;
+    par.size = size;
+    par.output = (uint8_t*)output + *offset;
+    par.workers = (aes_ctr_context_data_t*)
+        allocate(opt->alloc_opts, workers * sizeof(aes_ctr_context_data_t));
+    if (NULL == par.workers)
+        return VCCRYPT_ERROR_STREAM_PARALLEL_OUT_OF_MEMORY;
+
+    for (size_t i = 0; i < workers; ++i)
+    {
+        memset(&par.workers[i], 0, sizeof(aes_ctr_context_data_t));
+        memcpy(
+            &par.workers[i].key, &ctx_data->key,
+            AES_key_size(ctx_data->key.rounds));
+    }
+
+    vccrypt_parallel_run(
+        opt->alloc_opts, workers, jobs, &aes_ctr_parallel_job, &par);
+
+    /* leave the caller's context positioned at the end of the region. */
+    vccrypt_aes_ctr_alg_continue_encryption(
+        options, context, iv, iv_size, input_offset + size);
+    *offset += size;
+
+    /* the worker copies hold the expanded key; wipe them. */
+    memset(par.workers, 0, workers * sizeof(aes_ctr_context_data_t));
+    release(opt->alloc_opts, par.workers);
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
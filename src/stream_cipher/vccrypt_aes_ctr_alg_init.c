@@ -25,27 +25,30 @@ int vccrypt_aes_ctr_alg_init(
     void* options, void* context, const vccrypt_buffer_t* key)
 {
     vccrypt_stream_options_t* opt = (vccrypt_stream_options_t*)options;
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    size_t size = vccrypt_aes_ctr_alg_storage_size(options);
+    int retval;
 
     MODEL_ASSERT(NULL != opt->alloc_opts);
 
     if (NULL == opt->alloc_opts)
         return VCCRYPT_ERROR_STREAM_INIT_OUT_OF_MEMORY;
 
-    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
-    aes_ctr_options_data_t* opt_data = (aes_ctr_options_data_t*)opt->data;
-    aes_ctr_context_data_t* ctx_data = (aes_ctr_context_data_t*)
-        allocate(opt->alloc_opts, sizeof(aes_ctr_context_data_t));
-    ctx->stream_state = ctx_data;
-
-    memset(ctx_data, 0, sizeof(aes_ctr_context_data_t));
-    if (0 !=
-        AES_set_encrypt_key(
-            key->data, 256, opt_data->round_multiplier, &ctx_data->key))
+    /* allocate only as much of the key schedule as this round count uses. */
+    void* storage = allocate(opt->alloc_opts, size);
+    if (NULL == storage)
+        return VCCRYPT_ERROR_STREAM_INIT_OUT_OF_MEMORY;
+
+    retval =
+        vccrypt_aes_ctr_alg_init_with_storage(
+            options, context, key, storage, size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
     {
-        memset(ctx_data, 0, sizeof(aes_ctr_context_data_t));
-        release(opt->alloc_opts, ctx_data);
-        return VCCRYPT_ERROR_STREAM_INIT_BAD_ENCRYPTION_KEY;
+        release(opt->alloc_opts, storage);
+        return retval;
     }
 
+    ((aes_ctr_context_data_t*)ctx->stream_state)->owned = true;
+
     return VCCRYPT_STATUS_SUCCESS;
 }
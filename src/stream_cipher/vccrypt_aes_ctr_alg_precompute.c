@@ -0,0 +1,37 @@
+/**
+ * \file vccrypt_aes_ctr_alg_precompute.c
+ *
+ * Top up the precomputed AES CTR keystream.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Top up the precomputed keystream.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_stream_context_t
+ *                      structure.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_aes_ctr_alg_precompute(void* UNUSED(options), void* context)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    aes_ctr_context_data_t* ctx_data =
+        (aes_ctr_context_data_t*)ctx->stream_state;
+
+    if (NULL == ctx_data->ring)
+    {
+        return VCCRYPT_ERROR_STREAM_PRECOMPUTE_INVALID_ARG;
+    }
+
+    vccrypt_aes_ctr_ring_fill(ctx);
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
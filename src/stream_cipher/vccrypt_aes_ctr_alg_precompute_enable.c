@@ -0,0 +1,69 @@
+/**
+ * \file vccrypt_aes_ctr_alg_precompute_enable.c
+ *
+ * Enable, resize, or disable AES CTR keystream precomputation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Enable, resize, or disable keystream precomputation.
+ *
+ * The ring is filled straight away from the current stream position, and is
+ * refilled whenever the stream is started or continued.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       An opaque pointer to the vccrypt_stream_context_t
+ *                      structure.
+ * \param size          The number of bytes of keystream to keep ready, or 0
+ *                      to disable precomputation.
+ *
+ * \returns VCCRYPT_STATUS_SUCCESS on success and non-zero on failure.
+ */
+int vccrypt_aes_ctr_alg_precompute_enable(
+    void* UNUSED(options), void* context, size_t size)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    aes_ctr_context_data_t* ctx_data =
+        (aes_ctr_context_data_t*)ctx->stream_state;
+    uint8_t* ring = NULL;
+
+    if (size > VCCRYPT_STREAM_PRECOMPUTE_MAX_SIZE)
+    {
+        return VCCRYPT_ERROR_STREAM_PRECOMPUTE_INVALID_ARG;
+    }
+
+    /* the ring holds whole blocks. */
+    size = (size + 15) & ~(size_t)15;
+
+    if (size > 0)
+    {
+        ring = (uint8_t*)allocate(ctx->options->alloc_opts, size);
+        if (NULL == ring)
+        {
+            return VCCRYPT_ERROR_STREAM_PRECOMPUTE_OUT_OF_MEMORY;
+        }
+    }
+
+    /* wipe and release the old ring. */
+    if (NULL != ctx_data->ring)
+    {
+        memset(ctx_data->ring, 0, ctx_data->ring_size);
+        release(ctx->options->alloc_opts, ctx_data->ring);
+    }
+
+    ctx_data->ring = ring;
+    ctx_data->ring_size = size;
+    ctx_data->ring_head = 0;
+    ctx_data->ring_count = 0;
+
+    vccrypt_aes_ctr_ring_restart(ctx);
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -39,6 +39,9 @@ int vccrypt_aes_ctr_alg_start_decryption(
     AES_encrypt(ctx_data->ctr, ctx_data->stream, &ctx_data->key);
     ctx_data->count = 0;
 
+    /* any precomputed keystream belonged to the old position. */
+    vccrypt_aes_ctr_ring_restart(ctx);
+
     /* update offset */
     *offset = VCCRYPT_AES_CTR_ALG_IV_SIZE;
 
@@ -49,6 +49,9 @@ int vccrypt_aes_ctr_alg_start_encryption(
     AES_encrypt(ctx_data->ctr, ctx_data->stream, &ctx_data->key);
     ctx_data->count = 0;
 
+    /* any precomputed keystream belonged to the old position. */
+    vccrypt_aes_ctr_ring_restart(ctx);
+
     /* write iv to output. */
     memcpy(output, iv, ivSize);
     *offset = ivSize;
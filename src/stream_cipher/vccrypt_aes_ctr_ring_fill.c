@@ -0,0 +1,54 @@
+/**
+ * \file vccrypt_aes_ctr_ring_fill.c
+ *
+ * Top up the ring of precomputed AES CTR keystream.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Top up the ring of precomputed keystream, if enabled.
+ *
+ * The free space after the last precomputed block is filled with the
+ * keystream for the following counters, in batches that go through the AES
+ * pipeline at once.
+ *
+ * \param ctx           The AES CTR stream context.
+ */
+void vccrypt_aes_ctr_ring_fill(vccrypt_stream_context_t* ctx)
+{
+    aes_ctr_context_data_t* ctx_data =
+        (aes_ctr_context_data_t*)ctx->stream_state;
+    uint8_t next[16];
+
+    if (NULL == ctx_data->ring)
+        return;
+
+    /* the ring holds the blocks after ctr; skip to the last one generated. */
+    memcpy(next, ctx_data->ctr, sizeof(next));
+    vccrypt_ctr128_add(next, ctx_data->ring_count / 16);
+
+    while (ctx_data->ring_count < ctx_data->ring_size)
+    {
+        size_t tail =
+            (ctx_data->ring_head + ctx_data->ring_count) % ctx_data->ring_size;
+        size_t n = (ctx_data->ring_size - ctx_data->ring_count) / 16;
+        uint8_t* blocks = ctx_data->ring + tail;
+
+        /* stop at the end of the buffer, and keep each batch in cache. */
+        if (n > (ctx_data->ring_size - tail) / 16)
+            n = (ctx_data->ring_size - tail) / 16;
+        if (n > VCCRYPT_AES_CTR_ALG_RING_BATCH_BLOCKS)
+            n = VCCRYPT_AES_CTR_ALG_RING_BATCH_BLOCKS;
+
+        vccrypt_ctr128_fill(blocks, next, n);
+        AES_encrypt_blocks(blocks, blocks, n, &ctx_data->key);
+        ctx_data->ring_count += 16 * n;
+    }
+}
@@ -0,0 +1,34 @@
+/**
+ * \file vccrypt_aes_ctr_ring_restart.c
+ *
+ * Discard and regenerate the precomputed AES CTR keystream.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Discard any precomputed keystream after the counter has been moved, then
+ * regenerate it from the new position.
+ *
+ * \param ctx           The AES CTR stream context.
+ */
+void vccrypt_aes_ctr_ring_restart(vccrypt_stream_context_t* ctx)
+{
+    aes_ctr_context_data_t* ctx_data =
+        (aes_ctr_context_data_t*)ctx->stream_state;
+
+    if (NULL == ctx_data->ring)
+        return;
+
+    memset(ctx_data->ring, 0, ctx_data->ring_size);
+    ctx_data->ring_head = 0;
+    ctx_data->ring_count = 0;
+
+    vccrypt_aes_ctr_ring_fill(ctx);
+}
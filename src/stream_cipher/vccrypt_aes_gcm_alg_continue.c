@@ -0,0 +1,44 @@
+/**
+ * \file vccrypt_aes_gcm_alg_continue.c
+ *
+ * Continue an AES GCM mode encryption or decryption.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Algorithm-specific continuation of AES GCM.
+ *
+ * The tag covers the whole message, so a GCM stream cannot be resumed in the
+ * middle.  Continuing from offset 0 restarts the message with the given IV, and
+ * any other offset is rejected.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param iv        The 12 byte IV for this message.
+ * \param ivSize    The size of the IV in bytes.
+ * \param offset    The offset to continue from, which must be 0.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_gcm_alg_continue(
+    void* UNUSED(options), void* context, const void* iv, size_t ivSize,
+    size_t offset)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+
+    if (VCCRYPT_AES_GCM_ALG_IV_SIZE != ivSize || 0 != offset)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+    }
+
+    vccrypt_aes_gcm_reset((aes_gcm_context_data_t*)ctx->stream_state, iv);
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,47 @@
+/**
+ * \file vccrypt_aes_gcm_alg_decrypt.c
+ *
+ * Decrypt data using AES GCM mode.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Decrypt data using AES GCM, authenticating the ciphertext.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param input         A pointer to the ciphertext input to decrypt.
+ * \param size          The size of the ciphertext input, in bytes.
+ * \param output        The output buffer where data is written.  There must
+ *                      be at least *offset + size bytes available in this
+ *                      buffer.
+ * \param offset        A pointer to the current offset in the buffer.  Will
+ *                      be incremented by size.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_alg_decrypt(
+    void* UNUSED(options), void* context, const void* input, size_t size,
+    void* output, size_t* offset)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    int retval;
+
+    retval =
+        vccrypt_aes_gcm_crypt(
+            (aes_gcm_context_data_t*)ctx->stream_state,
+            (const uint8_t*)input, size, (uint8_t*)output + *offset, false);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+        return retval;
+
+    *offset += size;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,70 @@
+/**
+ * \file vccrypt_aes_gcm_alg_init_with_storage.c
+ *
+ * Initialize an AES GCM mode stream cipher instance in caller-provided storage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Algorithm-specific initialization for AES GCM using caller-provided storage.
+ *
+ * The GHASH key H is the encryption of the all-zero block, and is expanded for
+ * the fastest GHASH backend this CPU supports.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param key           The key to use for this instance.
+ * \param storage       The storage for the cipher state.  Must be at least
+ *                      vccrypt_aes_gcm_alg_storage_size() bytes.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_gcm_alg_init_with_storage(
+    void* options, void* context, const vccrypt_buffer_t* key, void* storage,
+    size_t storage_size)
+{
+    vccrypt_stream_options_t* opt = (vccrypt_stream_options_t*)options;
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    aes_ctr_options_data_t* opt_data = (aes_ctr_options_data_t*)opt->data;
+    aes_gcm_context_data_t* ctx_data = (aes_gcm_context_data_t*)storage;
+    size_t size = vccrypt_aes_gcm_alg_storage_size(options);
+    uint8_t H[16];
+
+    MODEL_ASSERT(NULL != storage);
+    MODEL_ASSERT(storage_size >= size);
+
+    if (NULL == storage || storage_size < size)
+        return VCCRYPT_ERROR_STREAM_INIT_INVALID_ARG;
+
+    memset(ctx_data, 0, size);
+    ctx_data->size = size;
+    ctx_data->owned = false;
+    ctx_data->phase = VCCRYPT_AES_GCM_PHASE_NONE;
+
+    if (0 !=
+        AES_set_key_cached(
+            key->data, 256, opt_data->round_multiplier,
+            AES_impl_default_bulk(), 1, &ctx_data->key))
+    {
+        memset(ctx_data, 0, size);
+        return VCCRYPT_ERROR_STREAM_INIT_BAD_ENCRYPTION_KEY;
+    }
+
+    /* derive the hash key. */
+    memset(H, 0, sizeof(H));
+    AES_encrypt(H, H, &ctx_data->key);
+    GHASH_init(&ctx_data->hkey, H, GHASH_impl_default());
+    memset(H, 0, sizeof(H));
+
+    ctx->stream_state = ctx_data;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,37 @@
+/**
+ * \file vccrypt_aes_gcm_alg_start_decryption.c
+ *
+ * Start an AES GCM mode decryption.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Algorithm-specific start for AES GCM decryption.  Reads the IV from the input
+ * buffer.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param input     The input buffer to read the IV from.
+ * \param offset    Pointer to the current offset of the buffer.  Will be set to
+ *                  the IV size.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_aes_gcm_alg_start_decryption(
+    void* UNUSED(options), void* context, const void* input, size_t* offset)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+
+    vccrypt_aes_gcm_reset((aes_gcm_context_data_t*)ctx->stream_state, input);
+
+    *offset = VCCRYPT_AES_GCM_ALG_IV_SIZE;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
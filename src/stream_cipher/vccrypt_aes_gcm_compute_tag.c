@@ -0,0 +1,64 @@
+/**
+ * \file vccrypt_aes_gcm_compute_tag.c
+ *
+ * Compute the AES GCM tag.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Compute the GCM tag for the message processed so far.
+ *
+ * The final hash block holds the big-endian 64-bit bit lengths of the
+ * additional data and the text.  The tag is the hash masked with E(K, J0).
+ * The context must be restarted before it can process another message.
+ *
+ * \param ctx_data      The GCM context data.
+ * \param tag           The buffer to receive the 16 byte tag.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_compute_tag(
+    aes_gcm_context_data_t* ctx_data, uint8_t* tag)
+{
+    uint8_t lengths[16];
+    uint64_t aad_bits, text_bits;
+
+    MODEL_ASSERT(NULL != ctx_data);
+    MODEL_ASSERT(NULL != tag);
+
+    if (VCCRYPT_AES_GCM_PHASE_AAD != ctx_data->phase
+     && VCCRYPT_AES_GCM_PHASE_TEXT != ctx_data->phase)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+    }
+
+    vccrypt_aes_gcm_ghash_flush(ctx_data);
+
+    aad_bits = ctx_data->aad_size * 8;
+    text_bits = ctx_data->text_size * 8;
+    for (int i = 7; i >= 0; --i)
+    {
+        lengths[i] = (uint8_t)(aad_bits & 0xFF);
+        lengths[8 + i] = (uint8_t)(text_bits & 0xFF);
+        aad_bits >>= 8;
+        text_bits >>= 8;
+    }
+
+    GHASH_update(&ctx_data->hkey, ctx_data->ghash, lengths, 1);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        tag[i] = ctx_data->ghash[i] ^ ctx_data->tag_mask[i];
+    }
+
+    ctx_data->phase = VCCRYPT_AES_GCM_PHASE_DONE;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,138 @@
+/**
+ * \file vccrypt_aes_gcm_crypt.c
+ *
+ * Encrypt or decrypt data with the AES GCM counter and hash the ciphertext.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+#define BATCH_SIZE (VCCRYPT_AES_CTR_ALG_BATCH_BLOCKS * 16)
+
+static inline void xor_words(
+    uint8_t* out, const uint8_t* in, const uint8_t* stream, size_t size)
+{
+    uint64_t a, b;
+
+    while (size >= sizeof(uint64_t))
+    {
+        memcpy(&a, in, sizeof(a));
+        memcpy(&b, stream, sizeof(b));
+        a ^= b;
+        memcpy(out, &a, sizeof(a));
+
+        in += sizeof(uint64_t);
+        out += sizeof(uint64_t);
+        stream += sizeof(uint64_t);
+        size -= sizeof(uint64_t);
+    }
+
+    while (size--)
+    {
+        *(out++) = *(in++) ^ *(stream++);
+    }
+}
+
+/**
+ * Encrypt or decrypt data with the GCM counter, hashing the ciphertext.
+ *
+ * The ciphertext is hashed batch by batch, while it is still in cache.  When
+ * decrypting, each batch is hashed before it is decrypted, so that in-place
+ * decryption hashes the ciphertext rather than the plaintext.
+ *
+ * \param ctx_data      The GCM context data.
+ * \param input         The input data.
+ * \param size          The size of the input data, in bytes.
+ * \param output        The output buffer.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_aes_gcm_crypt(
+    aes_gcm_context_data_t* ctx_data, const uint8_t* input, size_t size,
+    uint8_t* output, bool encrypt)
+{
+    uint8_t keystream[BATCH_SIZE];
+    size_t n;
+
+    MODEL_ASSERT(NULL != ctx_data);
+
+    /* the additional data ends at the first byte of text. */
+    if (VCCRYPT_AES_GCM_PHASE_AAD == ctx_data->phase)
+    {
+        vccrypt_aes_gcm_ghash_flush(ctx_data);
+        ctx_data->phase = VCCRYPT_AES_GCM_PHASE_TEXT;
+    }
+
+    if (VCCRYPT_AES_GCM_PHASE_TEXT != ctx_data->phase
+     || size > VCCRYPT_AES_GCM_ALG_MAX_MESSAGE_SIZE - ctx_data->text_size)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+    }
+
+    ctx_data->text_size += size;
+
+    /* drain any keystream left over from the previous call. */
+    if (ctx_data->count < 16)
+    {
+        n = 16 - ctx_data->count;
+        if (n > size)
+            n = size;
+
+        if (!encrypt)
+            vccrypt_aes_gcm_ghash(ctx_data, input, n);
+        xor_words(output, input, ctx_data->stream + ctx_data->count, n);
+        if (encrypt)
+            vccrypt_aes_gcm_ghash(ctx_data, output, n);
+
+        ctx_data->count += n;
+        input += n;
+        output += n;
+        size -= n;
+    }
+
+    /* bulk path: a batch of keystream, then the hash of that batch. */
+    while (size >= 16)
+    {
+        n = size / 16;
+        if (n > VCCRYPT_AES_CTR_ALG_BATCH_BLOCKS)
+            n = VCCRYPT_AES_CTR_ALG_BATCH_BLOCKS;
+
+        vccrypt_ctr32_fill(keystream, ctx_data->ctr, n);
+        AES_encrypt_blocks(keystream, keystream, n, &ctx_data->key);
+
+        if (!encrypt)
+            vccrypt_aes_gcm_ghash(ctx_data, input, 16 * n);
+        xor_words(output, input, keystream, 16 * n);
+        if (encrypt)
+            vccrypt_aes_gcm_ghash(ctx_data, output, 16 * n);
+
+        input += 16 * n;
+        output += 16 * n;
+        size -= 16 * n;
+    }
+
+    /* tail: generate one more block and process the remaining bytes. */
+    if (size > 0)
+    {
+        vccrypt_ctr32_fill(keystream, ctx_data->ctr, 1);
+        AES_encrypt(keystream, ctx_data->stream, &ctx_data->key);
+
+        if (!encrypt)
+            vccrypt_aes_gcm_ghash(ctx_data, input, size);
+        xor_words(output, input, ctx_data->stream, size);
+        if (encrypt)
+            vccrypt_aes_gcm_ghash(ctx_data, output, size);
+
+        ctx_data->count = size;
+    }
+
+    memset(keystream, 0, sizeof(keystream));
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
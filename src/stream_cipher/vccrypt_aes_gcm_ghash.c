@@ -0,0 +1,63 @@
+/**
+ * \file vccrypt_aes_gcm_ghash.c
+ *
+ * Absorb message bytes into the AES GCM hash.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Absorb message bytes into the GCM hash, buffering any partial block.
+ *
+ * \param ctx_data      The GCM context data.
+ * \param data          The data to hash.
+ * \param size          The size of the data, in bytes.
+ */
+void vccrypt_aes_gcm_ghash(
+    aes_gcm_context_data_t* ctx_data, const uint8_t* data, size_t size)
+{
+    size_t n;
+
+    MODEL_ASSERT(NULL != ctx_data);
+
+    /* top up a buffered partial block first. */
+    if (ctx_data->partial_count > 0)
+    {
+        n = 16 - ctx_data->partial_count;
+        if (n > size)
+            n = size;
+
+        memcpy(ctx_data->partial + ctx_data->partial_count, data, n);
+        ctx_data->partial_count += n;
+        data += n;
+        size -= n;
+
+        if (ctx_data->partial_count < 16)
+            return;
+
+        GHASH_update(&ctx_data->hkey, ctx_data->ghash, ctx_data->partial, 1);
+        ctx_data->partial_count = 0;
+    }
+
+    /* hash whole blocks directly from the caller's buffer. */
+    n = size / 16;
+    if (n > 0)
+    {
+        GHASH_update(&ctx_data->hkey, ctx_data->ghash, data, n);
+        data += 16 * n;
+        size -= 16 * n;
+    }
+
+    /* buffer the remainder. */
+    if (size > 0)
+    {
+        memcpy(ctx_data->partial, data, size);
+        ctx_data->partial_count = size;
+    }
+}
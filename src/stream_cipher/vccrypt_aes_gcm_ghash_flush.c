@@ -0,0 +1,33 @@
+/**
+ * \file vccrypt_aes_gcm_ghash_flush.c
+ *
+ * Flush a buffered partial block into the AES GCM hash.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Zero-pad and absorb any buffered partial block into the GCM hash.
+ *
+ * \param ctx_data      The GCM context data.
+ */
+void vccrypt_aes_gcm_ghash_flush(aes_gcm_context_data_t* ctx_data)
+{
+    MODEL_ASSERT(NULL != ctx_data);
+
+    if (ctx_data->partial_count > 0)
+    {
+        memset(
+            ctx_data->partial + ctx_data->partial_count, 0,
+            16 - ctx_data->partial_count);
+        GHASH_update(&ctx_data->hkey, ctx_data->ghash, ctx_data->partial, 1);
+        memset(ctx_data->partial, 0, sizeof(ctx_data->partial));
+        ctx_data->partial_count = 0;
+    }
+}
@@ -0,0 +1,44 @@
+/**
+ * \file vccrypt_aes_gcm_reset.c
+ *
+ * Reset an AES GCM mode context to the start of a message.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Reset an AES GCM context to the start of a message with the given IV.
+ *
+ * With a 96-bit IV, the pre-counter block J0 is IV || 0^31 || 1.  E(K, J0)
+ * masks the tag, and the message keystream starts at J0 + 1.
+ *
+ * \param ctx_data      The GCM context data.
+ * \param iv            The 12 byte IV.
+ */
+void vccrypt_aes_gcm_reset(aes_gcm_context_data_t* ctx_data, const void* iv)
+{
+    MODEL_ASSERT(NULL != ctx_data);
+    MODEL_ASSERT(NULL != iv);
+
+    memcpy(ctx_data->ctr, iv, VCCRYPT_AES_GCM_ALG_IV_SIZE);
+    ctx_data->ctr[12] = 0;
+    ctx_data->ctr[13] = 0;
+    ctx_data->ctr[14] = 0;
+    ctx_data->ctr[15] = 1;
+    AES_encrypt(ctx_data->ctr, ctx_data->tag_mask, &ctx_data->key);
+
+    memset(ctx_data->ghash, 0, sizeof(ctx_data->ghash));
+    memset(ctx_data->partial, 0, sizeof(ctx_data->partial));
+    memset(ctx_data->stream, 0, sizeof(ctx_data->stream));
+    ctx_data->partial_count = 0;
+    ctx_data->count = 16;
+    ctx_data->aad_size = 0;
+    ctx_data->text_size = 0;
+    ctx_data->phase = VCCRYPT_AES_GCM_PHASE_AAD;
+}
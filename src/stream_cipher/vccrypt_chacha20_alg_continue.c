@@ -0,0 +1,59 @@
+/**
+ * \file vccrypt_chacha20_alg_continue.c
+ *
+ * Continue a ChaCha20 encryption or decryption.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Algorithm-specific continuation of ChaCha20.
+ *
+ * Plain ChaCha20 seeks directly to the block holding the given offset, which
+ * must lie within the 2^32 blocks addressable by its 32-bit block counter.  As
+ * with AES GCM, a ChaCha20-Poly1305 message can only be restarted from offset
+ * 0, because the tag covers the whole message.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param iv        The 12 byte nonce for this message.
+ * \param ivSize    The size of the nonce in bytes.
+ * \param offset    The offset to continue from.
+ *
+ * \returns 0 on success and non-zero on error.
+ *      - \ref VCCRYPT_ERROR_STREAM_MESSAGE_SIZE_EXCEEDED if the offset is past
+ *        the end of the ChaCha20 keystream.
+ */
+int vccrypt_chacha20_alg_continue(
+    void* UNUSED(options), void* context, const void* iv, size_t ivSize,
+    size_t offset)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    chacha20_context_data_t* ctx_data =
+        (chacha20_context_data_t*)ctx->stream_state;
+
+    if (VCCRYPT_CHACHA20_ALG_IV_SIZE != ivSize)
+    {
+        return VCCRYPT_ERROR_STREAM_START_ENCRYPTION_INVALID_ARG;
+    }
+
+    if (ctx_data->aead && 0 != offset)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+    }
+
+    if ((uint64_t)offset > VCCRYPT_CHACHA20_ALG_MAX_MESSAGE_SIZE)
+    {
+        return VCCRYPT_ERROR_STREAM_MESSAGE_SIZE_EXCEEDED;
+    }
+
+    vccrypt_chacha20_reset(ctx_data, iv, offset);
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
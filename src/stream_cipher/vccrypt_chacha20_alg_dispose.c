@@ -0,0 +1,38 @@
+/**
+ * \file vccrypt_chacha20_alg_dispose.c
+ *
+ * Dispose of a ChaCha20 stream cipher instance.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Algorithm-specific disposal for ChaCha20.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ */
+void vccrypt_chacha20_alg_dispose(void* options, void* context)
+{
+    vccrypt_stream_options_t* opt = (vccrypt_stream_options_t*)options;
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    chacha20_context_data_t* ctx_data =
+        (chacha20_context_data_t*)ctx->stream_state;
+
+    MODEL_ASSERT(NULL != opt->alloc_opts);
+    MODEL_ASSERT(NULL != ctx_data);
+
+    bool owned = ctx_data->owned;
+
+    memset(ctx_data, 0, ctx_data->size);
+
+    /* caller-provided storage is wiped but not released. */
+    if (owned)
+        release(opt->alloc_opts, ctx_data);
+}
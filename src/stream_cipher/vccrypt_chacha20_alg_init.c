@@ -0,0 +1,53 @@
+/**
+ * \file vccrypt_chacha20_alg_init.c
+ *
+ * Initialize a ChaCha20 stream cipher instance.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Algorithm-specific initialization for ChaCha20.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param key       The key to use for this instance.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_chacha20_alg_init(
+    void* options, void* context, const vccrypt_buffer_t* key)
+{
+    vccrypt_stream_options_t* opt = (vccrypt_stream_options_t*)options;
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    size_t size = vccrypt_chacha20_alg_storage_size(options);
+    int retval;
+
+    MODEL_ASSERT(NULL != opt->alloc_opts);
+
+    if (NULL == opt->alloc_opts)
+        return VCCRYPT_ERROR_STREAM_INIT_OUT_OF_MEMORY;
+
+    void* storage = allocate(opt->alloc_opts, size);
+    if (NULL == storage)
+        return VCCRYPT_ERROR_STREAM_INIT_OUT_OF_MEMORY;
+
+    retval =
+        vccrypt_chacha20_alg_init_with_storage(
+            options, context, key, storage, size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        release(opt->alloc_opts, storage);
+        return retval;
+    }
+
+    ((chacha20_context_data_t*)ctx->stream_state)->owned = true;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
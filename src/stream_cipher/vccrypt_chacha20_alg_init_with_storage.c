@@ -0,0 +1,65 @@
+/**
+ * \file vccrypt_chacha20_alg_init_with_storage.c
+ *
+ * Initialize a ChaCha20 stream cipher instance in caller-provided storage.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Algorithm-specific initialization for ChaCha20 using caller-provided storage.
+ *
+ * The key is loaded into the input state here, and the fastest ChaCha backend
+ * this CPU supports is selected.  The counter and nonce are set when a message
+ * is started.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param key           The key to use for this instance.
+ * \param storage       The storage for the cipher state.  Must be at least
+ *                      vccrypt_chacha20_alg_storage_size() bytes.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_chacha20_alg_init_with_storage(
+    void* options, void* context, const vccrypt_buffer_t* key, void* storage,
+    size_t storage_size)
+{
+    static const uint8_t zero_nonce[VCCRYPT_CHACHA20_ALG_IV_SIZE] = { 0 };
+    vccrypt_stream_options_t* opt = (vccrypt_stream_options_t*)options;
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    chacha20_options_data_t* opt_data = (chacha20_options_data_t*)opt->data;
+    chacha20_context_data_t* ctx_data = (chacha20_context_data_t*)storage;
+    size_t size = vccrypt_chacha20_alg_storage_size(options);
+
+    MODEL_ASSERT(NULL != storage);
+    MODEL_ASSERT(storage_size >= size);
+
+    if (NULL == storage || storage_size < size)
+        return VCCRYPT_ERROR_STREAM_INIT_INVALID_ARG;
+
+    if (NULL == key || VCCRYPT_CHACHA20_ALG_KEY_SIZE != key->size)
+        return VCCRYPT_ERROR_STREAM_INIT_BAD_ENCRYPTION_KEY;
+
+    memset(ctx_data, 0, size);
+    ctx_data->size = size;
+    ctx_data->owned = false;
+    ctx_data->aead = opt_data->aead;
+    ctx_data->impl = CHACHA_impl_default();
+    ctx_data->phase = VCCRYPT_AES_GCM_PHASE_NONE;
+    ctx_data->count = CHACHA_BLOCK_SIZE;
+
+    CHACHA_init(
+        ctx_data->state, (const uint8_t*)key->data, 0, zero_nonce);
+
+    ctx->stream_state = ctx_data;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
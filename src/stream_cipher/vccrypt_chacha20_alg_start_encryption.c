@@ -0,0 +1,49 @@
+/**
+ * \file vccrypt_chacha20_alg_start_encryption.c
+ *
+ * Start a ChaCha20 encryption.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Algorithm-specific start for ChaCha20 encryption.  Writes the nonce to the
+ * output buffer.
+ *
+ * \param options   Opaque pointer to this options structure.
+ * \param context   Opaque pointer to vccrypt_stream_context_t structure.
+ * \param iv        The 12 byte nonce to use for this message.  MUST ONLY BE
+ *                  USED ONCE PER KEY, EVER.
+ * \param ivSize    The size of the nonce in bytes.
+ * \param output    The output buffer to initialize.
+ * \param offset    Pointer to the current offset of the buffer.  Will be set to
+ *                  the nonce size.
+ *
+ * \returns 0 on success and non-zero on error.
+ */
+int vccrypt_chacha20_alg_start_encryption(
+    void* UNUSED(options), void* context, const void* iv, size_t ivSize,
+    void* output, size_t* offset)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+
+    MODEL_ASSERT(VCCRYPT_CHACHA20_ALG_IV_SIZE == ivSize);
+    if (VCCRYPT_CHACHA20_ALG_IV_SIZE != ivSize)
+    {
+        return VCCRYPT_ERROR_STREAM_START_ENCRYPTION_INVALID_ARG;
+    }
+
+    vccrypt_chacha20_reset((chacha20_context_data_t*)ctx->stream_state, iv, 0);
+
+    /* write iv to output. */
+    memcpy(output, iv, ivSize);
+    *offset = ivSize;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
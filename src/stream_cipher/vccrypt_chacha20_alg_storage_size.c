@@ -0,0 +1,25 @@
+/**
+ * \file vccrypt_chacha20_alg_storage_size.c
+ *
+ * Compute the context storage size for a ChaCha20 stream cipher.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stddef.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Return the number of bytes of context storage needed by ChaCha20.
+ *
+ * \param options   Opaque pointer to this options structure.
+ *
+ * \returns the storage size in bytes.
+ */
+size_t vccrypt_chacha20_alg_storage_size(void* UNUSED(options))
+{
+    return sizeof(chacha20_context_data_t);
+}
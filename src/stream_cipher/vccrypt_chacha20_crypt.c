@@ -0,0 +1,134 @@
+/**
+ * \file vccrypt_chacha20_crypt.c
+ *
+ * Encrypt or decrypt data with ChaCha20, authenticating the ciphertext with
+ * Poly1305 for ChaCha20-Poly1305.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Encrypt or decrypt data with ChaCha20.
+ *
+ * Whole blocks are XORed in place by the vectorized ChaCha backend.  For
+ * ChaCha20-Poly1305, the text is processed in batches so that each batch of
+ * ciphertext is authenticated while it is still in cache; when decrypting,
+ * each batch is authenticated before it is decrypted, so that in-place
+ * decryption authenticates the ciphertext rather than the plaintext.
+ *
+ * The position in the message is tracked in both modes, and a call that would
+ * run past the end of the keystream fails before the 32-bit block counter can
+ * wrap around and reuse it.
+ *
+ * \param ctx_data      The ChaCha20 context data.
+ * \param input         The input data.
+ * \param size          The size of the input data, in bytes.
+ * \param output        The output buffer.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns 0 on success and non-zero on failure.
+ *      - \ref VCCRYPT_ERROR_STREAM_MESSAGE_SIZE_EXCEEDED if plain ChaCha20
+ *        would run past the end of the keystream.
+ */
+int vccrypt_chacha20_crypt(
+    chacha20_context_data_t* ctx_data, const uint8_t* input, size_t size,
+    uint8_t* output, bool encrypt)
+{
+    const bool mac_input = ctx_data->aead && !encrypt;
+    const bool mac_output = ctx_data->aead && encrypt;
+    size_t n;
+
+    MODEL_ASSERT(NULL != ctx_data);
+
+    if (ctx_data->aead)
+    {
+        /* the additional data ends at the first byte of text. */
+        if (VCCRYPT_AES_GCM_PHASE_AAD == ctx_data->phase)
+        {
+            POLY1305_pad16(&ctx_data->poly);
+            ctx_data->phase = VCCRYPT_AES_GCM_PHASE_TEXT;
+        }
+
+        if (VCCRYPT_AES_GCM_PHASE_TEXT != ctx_data->phase
+         || size >
+                VCCRYPT_CHACHA20_POLY1305_ALG_MAX_MESSAGE_SIZE
+                    - ctx_data->text_size)
+        {
+            return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+        }
+    }
+    else if (size > VCCRYPT_CHACHA20_ALG_MAX_MESSAGE_SIZE - ctx_data->text_size)
+    {
+        return VCCRYPT_ERROR_STREAM_MESSAGE_SIZE_EXCEEDED;
+    }
+
+    ctx_data->text_size += size;
+
+    /* drain any keystream left over from the previous call. */
+    if (ctx_data->count < CHACHA_BLOCK_SIZE)
+    {
+        n = CHACHA_BLOCK_SIZE - ctx_data->count;
+        if (n > size)
+            n = size;
+
+        if (mac_input)
+            POLY1305_update(&ctx_data->poly, input, n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            output[i] = input[i] ^ ctx_data->stream[ctx_data->count + i];
+        }
+        if (mac_output)
+            POLY1305_update(&ctx_data->poly, output, n);
+
+        ctx_data->count += n;
+        input += n;
+        output += n;
+        size -= n;
+    }
+
+    /* bulk path: whole blocks straight through the ChaCha backend. */
+    while (size >= CHACHA_BLOCK_SIZE)
+    {
+        n = size / CHACHA_BLOCK_SIZE;
+        if (ctx_data->aead && n > VCCRYPT_CHACHA20_ALG_BATCH_BLOCKS)
+            n = VCCRYPT_CHACHA20_ALG_BATCH_BLOCKS;
+
+        if (mac_input)
+            POLY1305_update(&ctx_data->poly, input, CHACHA_BLOCK_SIZE * n);
+        CHACHA_xor_blocks(ctx_data->impl, ctx_data->state, input, output, n);
+        if (mac_output)
+            POLY1305_update(&ctx_data->poly, output, CHACHA_BLOCK_SIZE * n);
+
+        input += CHACHA_BLOCK_SIZE * n;
+        output += CHACHA_BLOCK_SIZE * n;
+        size -= CHACHA_BLOCK_SIZE * n;
+    }
+
+    /* tail: generate one more block and process the remaining bytes. */
+    if (size > 0)
+    {
+        memset(ctx_data->stream, 0, sizeof(ctx_data->stream));
+        CHACHA_xor_blocks(
+            ctx_data->impl, ctx_data->state, ctx_data->stream,
+            ctx_data->stream, 1);
+
+        if (mac_input)
+            POLY1305_update(&ctx_data->poly, input, size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            output[i] = input[i] ^ ctx_data->stream[i];
+        }
+        if (mac_output)
+            POLY1305_update(&ctx_data->poly, output, size);
+
+        ctx_data->count = size;
+    }
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/**
+ * \file vccrypt_chacha20_poly1305_alg_authenticate.c
+ *
+ * Authenticate additional data with ChaCha20-Poly1305.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Authenticate additional data with ChaCha20-Poly1305.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param aad           The additional data.
+ * \param size          The size of the additional data, in bytes.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_poly1305_alg_authenticate(
+    void* UNUSED(options), void* context, const void* aad, size_t size)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    chacha20_context_data_t* ctx_data =
+        (chacha20_context_data_t*)ctx->stream_state;
+
+    /* additional data must precede the text. */
+    if (VCCRYPT_AES_GCM_PHASE_AAD != ctx_data->phase)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+    }
+
+    POLY1305_update(&ctx_data->poly, (const uint8_t*)aad, size);
+    ctx_data->aad_size += size;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/**
+ * \file vccrypt_chacha20_poly1305_alg_finalize.c
+ *
+ * Finish a ChaCha20-Poly1305 encryption.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Finish a ChaCha20-Poly1305 encryption, writing the tag to the output buffer.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param output        The output buffer where the tag is written.
+ * \param offset        A pointer to the current offset in the buffer.  Will be
+ *                      incremented by the tag size.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_poly1305_alg_finalize(
+    void* UNUSED(options), void* context, void* output, size_t* offset)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    int retval;
+
+    retval =
+        vccrypt_chacha20_poly1305_compute_tag(
+            (chacha20_context_data_t*)ctx->stream_state,
+            (uint8_t*)output + *offset);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+        return retval;
+
+    *offset += VCCRYPT_CHACHA20_POLY1305_ALG_TAG_SIZE;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
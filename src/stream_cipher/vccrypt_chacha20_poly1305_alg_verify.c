@@ -0,0 +1,46 @@
+/**
+ * \file vccrypt_chacha20_poly1305_alg_verify.c
+ *
+ * Finish a ChaCha20-Poly1305 decryption.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/compare.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Finish a ChaCha20-Poly1305 decryption, comparing the tag in constant time.
+ *
+ * \param options       Opaque pointer to this options structure.
+ * \param context       Opaque pointer to vccrypt_stream_context_t structure.
+ * \param tag           The expected tag.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_poly1305_alg_verify(
+    void* UNUSED(options), void* context, const void* tag)
+{
+    vccrypt_stream_context_t* ctx = (vccrypt_stream_context_t*)context;
+    uint8_t computed[VCCRYPT_CHACHA20_POLY1305_ALG_TAG_SIZE];
+    int retval;
+
+    retval =
+        vccrypt_chacha20_poly1305_compute_tag(
+            (chacha20_context_data_t*)ctx->stream_state, computed);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+        return retval;
+
+    if (0 != crypto_memcmp(computed, tag, sizeof(computed)))
+    {
+        retval = VCCRYPT_ERROR_STREAM_AEAD_AUTHENTICATION_FAILED;
+    }
+
+    memset(computed, 0, sizeof(computed));
+
+    return retval;
+}
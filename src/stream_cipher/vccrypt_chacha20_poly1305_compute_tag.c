@@ -0,0 +1,61 @@
+/**
+ * \file vccrypt_chacha20_poly1305_compute_tag.c
+ *
+ * Compute the ChaCha20-Poly1305 tag.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Compute the Poly1305 tag for the message processed so far.
+ *
+ * The additional data and the ciphertext are each zero-padded to a 16 byte
+ * boundary, followed by their little-endian 64-bit byte lengths.  The context
+ * must be restarted before it can process another message.
+ *
+ * \param ctx_data      The ChaCha20 context data.
+ * \param tag           The buffer to receive the 16 byte tag.
+ *
+ * \returns 0 on success and non-zero on failure.
+ */
+int vccrypt_chacha20_poly1305_compute_tag(
+    chacha20_context_data_t* ctx_data, uint8_t* tag)
+{
+    uint8_t lengths[16];
+    uint64_t aad_size = ctx_data->aad_size;
+    uint64_t text_size = ctx_data->text_size;
+
+    MODEL_ASSERT(NULL != ctx_data);
+    MODEL_ASSERT(NULL != tag);
+
+    if (!ctx_data->aead
+     || (VCCRYPT_AES_GCM_PHASE_AAD != ctx_data->phase
+      && VCCRYPT_AES_GCM_PHASE_TEXT != ctx_data->phase))
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+    }
+
+    /* pads the additional data, or the text if any was processed. */
+    POLY1305_pad16(&ctx_data->poly);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        lengths[i] = (uint8_t)(aad_size & 0xFF);
+        lengths[8 + i] = (uint8_t)(text_size & 0xFF);
+        aad_size >>= 8;
+        text_size >>= 8;
+    }
+
+    POLY1305_update(&ctx_data->poly, lengths, sizeof(lengths));
+    POLY1305_finish(&ctx_data->poly, tag);
+
+    ctx_data->phase = VCCRYPT_AES_GCM_PHASE_DONE;
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,74 @@
+/**
+ * \file vccrypt_chacha20_reset.c
+ *
+ * Reset a ChaCha20 context to a position within a message.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Reset a ChaCha20 context to the given byte offset of a message.
+ *
+ * Plain ChaCha20 starts at block counter 0.  For ChaCha20-Poly1305, as in
+ * RFC 8439 section 2.6, the first 32 bytes of block 0 are the one-time
+ * Poly1305 key, and the text starts at block counter 1.
+ *
+ * \param ctx_data      The ChaCha20 context data.
+ * \param iv            The 12 byte nonce.
+ * \param offset        The byte offset within the message to seek to.  Must
+ *                      be 0 for ChaCha20-Poly1305, and no greater than
+ *                      VCCRYPT_CHACHA20_ALG_MAX_MESSAGE_SIZE otherwise.
+ */
+void vccrypt_chacha20_reset(
+    chacha20_context_data_t* ctx_data, const void* iv, uint64_t offset)
+{
+    MODEL_ASSERT(NULL != ctx_data);
+    MODEL_ASSERT(NULL != iv);
+    MODEL_ASSERT(!ctx_data->aead || 0 == offset);
+    MODEL_ASSERT(offset <= VCCRYPT_CHACHA20_ALG_MAX_MESSAGE_SIZE);
+
+    ctx_data->aad_size = 0;
+    ctx_data->text_size = offset;
+
+    if (ctx_data->aead)
+    {
+        CHACHA_set_nonce(ctx_data->state, 0, (const uint8_t*)iv);
+
+        memset(ctx_data->stream, 0, sizeof(ctx_data->stream));
+        CHACHA_xor_blocks(
+            ctx_data->impl, ctx_data->state, ctx_data->stream,
+            ctx_data->stream, 1);
+        POLY1305_init(&ctx_data->poly, ctx_data->stream);
+        memset(ctx_data->stream, 0, sizeof(ctx_data->stream));
+
+        ctx_data->count = CHACHA_BLOCK_SIZE;
+        ctx_data->phase = VCCRYPT_AES_GCM_PHASE_AAD;
+
+        return;
+    }
+
+    /* offset is bounded, so only the end of the keystream wraps to block 0. */
+    CHACHA_set_nonce(
+        ctx_data->state, (uint32_t)(offset / CHACHA_BLOCK_SIZE),
+        (const uint8_t*)iv);
+    ctx_data->count = (size_t)(offset % CHACHA_BLOCK_SIZE);
+
+    /* a seek into the middle of a block needs that block's keystream. */
+    if (ctx_data->count > 0)
+    {
+        memset(ctx_data->stream, 0, sizeof(ctx_data->stream));
+        CHACHA_xor_blocks(
+            ctx_data->impl, ctx_data->state, ctx_data->stream,
+            ctx_data->stream, 1);
+    }
+    else
+    {
+        ctx_data->count = CHACHA_BLOCK_SIZE;
+    }
+}
@@ -0,0 +1,47 @@
+/**
+ * \file vccrypt_stream_authenticate.c
+ *
+ * Generic method for authenticating additional data with a stream cipher.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Authenticate additional data with an authenticated stream cipher.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param aad           The additional data.
+ * \param size          The size of the additional data, in bytes.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if this stream cipher does
+ *             not authenticate messages.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG if an argument is invalid
+ *             or if data has already been encrypted or decrypted.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_authenticate(
+    vccrypt_stream_context_t* context, const void* aad, size_t size)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+
+    if (NULL == context || NULL == context->options
+     || (NULL == aad && 0 != size))
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+    }
+
+    if (NULL == context->options->vccrypt_stream_alg_authenticate)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED;
+    }
+
+    return context->options->vccrypt_stream_alg_authenticate(
+        context->options, context, aad, size);
+}
@@ -0,0 +1,48 @@
+/**
+ * \file vccrypt_stream_decrypt_file.c
+ *
+ * Generic method for decrypting a file using a stream cipher.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <vccrypt/os.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * \brief Decrypt the contents of one file into another.
+ *
+ * The IV is read from the header at the input's current position, and the
+ * decrypted body is written at the output's current position.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param input_fd      The file descriptor to read from.
+ * \param output_fd     The file descriptor to write to.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_decrypt_file(
+    vccrypt_stream_context_t* context, int input_fd, int output_fd)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+
+#if defined(VCCRYPT_OS_UNIX)
+    return
+        vccrypt_stream_file_transform(
+            context, NULL, 0, input_fd, output_fd, false);
+#else
+    (void)context;
+    (void)input_fd;
+    (void)output_fd;
+
+    return VCCRYPT_ERROR_STREAM_FILE_UNSUPPORTED;
+#endif
+}
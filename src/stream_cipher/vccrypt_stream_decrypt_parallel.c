@@ -0,0 +1,68 @@
+/**
+ * \file vccrypt_stream_decrypt_parallel.c
+ *
+ * Generic method for decrypting a large region using multiple threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Decrypt a large region of data using multiple threads.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param iv            The IV for this stream.
+ * \param iv_size       The size of the IV in bytes.
+ * \param input_offset  The offset of input within the ciphertext stream.
+ * \param input         A pointer to the ciphertext input to decrypt.
+ * \param size          The size of the ciphertext input, in bytes.
+ * \param output        The output buffer where data is written.  There must
+ *                      be at least *offset + size bytes available in this
+ *                      buffer.
+ * \param offset        A pointer to the current offset in the buffer.  Will
+ *                      be incremented by size.
+ * \param threads       The number of threads to use, or 0 to use one thread
+ *                      per online processor.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_decrypt_parallel(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    size_t input_offset, const void* input, size_t size, void* output,
+    size_t* offset, size_t threads)
+{
+    int retval;
+
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != iv);
+    MODEL_ASSERT(NULL != input);
+    MODEL_ASSERT(NULL != output);
+    MODEL_ASSERT(NULL != offset);
+
+    /* use the algorithm's parallel implementation if it has one. */
+    if (NULL != context->options->vccrypt_stream_alg_decrypt_parallel)
+    {
+        return context->options->vccrypt_stream_alg_decrypt_parallel(
+            context->options, context, iv, iv_size, input_offset, input, size,
+            output, offset, threads);
+    }
+
+    /* otherwise, decrypt the region serially. */
+    retval =
+        context->options->vccrypt_stream_alg_continue_decryption(
+            context->options, context, iv, iv_size, input_offset);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+        return retval;
+
+    if (0 == size)
+        return VCCRYPT_STATUS_SUCCESS;
+
+    return context->options->vccrypt_stream_alg_decrypt(
+        context->options, context, input, size, output, offset);
+}
@@ -0,0 +1,74 @@
+/**
+ * \file vccrypt_stream_decrypt_range.c
+ *
+ * Generic method for decrypting an arbitrary range of an encrypted stream.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdint.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Decrypt an arbitrary range of an encrypted stream.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param iv            The IV of the stream, IV_size bytes in length.
+ * \param input         The ciphertext slice, starting at body offset offset,
+ *                      which must be at least length bytes in size.
+ * \param offset        The offset of the first byte to decrypt, relative to
+ *                      the start of the message body.
+ * \param length        The number of bytes to decrypt.
+ * \param output        The output buffer, which must be at least length bytes
+ *                      in size.
+ * \param message_size  The size of the complete message body, or
+ *                      VCCRYPT_STREAM_DECRYPT_RANGE_UNBOUNDED if unknown.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if the cipher authenticates
+ *        messages, since a partial range cannot be verified.
+ *      - \ref VCCRYPT_ERROR_STREAM_DECRYPT_RANGE_INVALID_ARG if the range
+ *        extends past the end of the message body.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_decrypt_range(
+    vccrypt_stream_context_t* context, const void* iv, const void* input,
+    size_t offset, size_t length, void* output, size_t message_size)
+{
+    size_t output_offset = 0;
+    int retval;
+
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != iv);
+    MODEL_ASSERT(0 == length || NULL != input);
+    MODEL_ASSERT(0 == length || NULL != output);
+
+    /* a partial range can't be checked against the message tag. */
+    if (context->options->tag_size > 0)
+        return VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED;
+
+    /* when the message size is known, the range must lie within it. */
+    if (VCCRYPT_STREAM_DECRYPT_RANGE_UNBOUNDED != message_size
+     && (offset > message_size || length > message_size - offset))
+    {
+        return VCCRYPT_ERROR_STREAM_DECRYPT_RANGE_INVALID_ARG;
+    }
+
+    /* seek directly to the requested offset using the IV. */
+    retval =
+        context->options->vccrypt_stream_alg_continue_decryption(
+            context->options, context, iv, context->options->IV_size,
+            offset);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+        return retval;
+
+    if (0 == length)
+        return VCCRYPT_STATUS_SUCCESS;
+
+    return context->options->vccrypt_stream_alg_decrypt(
+        context->options, context, input, length, output, &output_offset);
+}
@@ -0,0 +1,40 @@
+/**
+ * \file vccrypt_stream_decryptv.c
+ *
+ * Generic method for decrypting scatter / gather segments with a stream cipher.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * \brief Decrypt a list of ciphertext segments into a list of output segments.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param input         The ciphertext input segments.
+ * \param input_count   The number of input segments.
+ * \param output        The output segments.
+ * \param output_count  The number of output segments.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_decryptv(
+    vccrypt_stream_context_t* context, const vccrypt_stream_iovec_t* input,
+    size_t input_count, const vccrypt_stream_iovec_t* output,
+    size_t output_count)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+
+    return
+        vccrypt_stream_transformv(
+            context, input, input_count, output, output_count, false);
+}
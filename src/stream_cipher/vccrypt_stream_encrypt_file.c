@@ -0,0 +1,54 @@
+/**
+ * \file vccrypt_stream_encrypt_file.c
+ *
+ * Generic method for encrypting a file using a stream cipher.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <vccrypt/os.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * \brief Encrypt the contents of one file into another.
+ *
+ * The IV header is written at the output's current position, followed by the
+ * encrypted contents of the input from its current position.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param iv            The IV to use for this stream.  MUST ONLY BE USED ONCE
+ *                      PER KEY, EVER.
+ * \param iv_size       The size of the IV in bytes.
+ * \param input_fd      The file descriptor to read from.
+ * \param output_fd     The file descriptor to write to.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_encrypt_file(
+    vccrypt_stream_context_t* context, const void* iv, size_t iv_size,
+    int input_fd, int output_fd)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+
+#if defined(VCCRYPT_OS_UNIX)
+    return
+        vccrypt_stream_file_transform(
+            context, iv, iv_size, input_fd, output_fd, true);
+#else
+    (void)context;
+    (void)iv;
+    (void)iv_size;
+    (void)input_fd;
+    (void)output_fd;
+
+    return VCCRYPT_ERROR_STREAM_FILE_UNSUPPORTED;
+#endif
+}
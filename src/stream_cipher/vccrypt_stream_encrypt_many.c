@@ -0,0 +1,31 @@
+/**
+ * \file vccrypt_stream_encrypt_many.c
+ *
+ * Generic method for encrypting many independent messages in a single call.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * \brief Encrypt many independent messages in a single call.
+ *
+ * \param jobs          The jobs to encrypt.
+ * \param count         The number of jobs.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_encrypt_many(vccrypt_stream_job_t* jobs, size_t count)
+{
+    MODEL_ASSERT(NULL != jobs || 0 == count);
+
+    return vccrypt_stream_transform_many(jobs, count, true);
+}
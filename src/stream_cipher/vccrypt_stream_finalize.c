@@ -0,0 +1,50 @@
+/**
+ * \file vccrypt_stream_finalize.c
+ *
+ * Generic method for finishing an authenticated stream cipher encryption.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Finish an authenticated encryption, appending the tag to the output.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param output        The output buffer where the tag is written.
+ * \param offset        A pointer to the current offset in the buffer.  Will be
+ *                      incremented by tag_size.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if this stream cipher does
+ *             not authenticate messages.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG if an argument is invalid
+ *             or if no message has been started.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_finalize(
+    vccrypt_stream_context_t* context, void* output, size_t* offset)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != output);
+    MODEL_ASSERT(NULL != offset);
+
+    if (NULL == context || NULL == context->options || NULL == output
+     || NULL == offset)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+    }
+
+    if (NULL == context->options->vccrypt_stream_alg_finalize)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED;
+    }
+
+    return context->options->vccrypt_stream_alg_finalize(
+        context->options, context, output, offset);
+}
@@ -7,6 +7,7 @@
  */
 
 #include <cbmc/model_assert.h>
+#include <stdint.h>
 #include <string.h>
 #include <vccrypt/stream_cipher.h>
 #include <vpr/parameters.h>
@@ -57,6 +58,60 @@ int vccrypt_stream_init(
     return options->vccrypt_stream_alg_init(options, context, key);
 }
 
+/**
+ * \brief Initialize a Stream Cipher algorithm instance, storing the cipher
+ * state in caller-provided storage instead of allocating it.
+ *
+ * \param options       The options to use for this algorithm instance.
+ * \param context       The stream cipher instance to initialize.
+ * \param key           The key to use for this algorithm instance.
+ * \param storage       The storage for the cipher state.
+ * \param storage_size  The size of the storage, in bytes.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_INIT_INVALID_ARG if one of the provided
+ *             arguments is invalid.
+ *      - \ref VCCRYPT_ERROR_STREAM_INIT_STORAGE_UNSUPPORTED if the selected
+ *             algorithm does not support caller-provided storage.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_init_with_storage(
+    vccrypt_stream_options_t* options, vccrypt_stream_context_t* context,
+    const vccrypt_buffer_t* key, void* storage, size_t storage_size)
+{
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != key);
+    MODEL_ASSERT(NULL != storage);
+
+    if (NULL == options || NULL == context || NULL == key || NULL == storage)
+    {
+        return VCCRYPT_ERROR_STREAM_INIT_INVALID_ARG;
+    }
+
+    if (NULL == options->vccrypt_stream_alg_storage_size
+     || NULL == options->vccrypt_stream_alg_init_with_storage)
+    {
+        return VCCRYPT_ERROR_STREAM_INIT_STORAGE_UNSUPPORTED;
+    }
+
+    /* the storage must be large enough and suitably aligned. */
+    if (0 != ((uintptr_t)storage % VCCRYPT_STREAM_STORAGE_ALIGNMENT)
+     || storage_size < options->vccrypt_stream_alg_storage_size(options))
+    {
+        return VCCRYPT_ERROR_STREAM_INIT_INVALID_ARG;
+    }
+
+    /* set the basics. */
+    context->hdr.dispose = &vccrypt_stream_dispose;
+    context->options = options;
+
+    return
+        options->vccrypt_stream_alg_init_with_storage(
+            options, context, key, storage, storage_size);
+}
+
 /**
  * \brief Dispose of a stream cipher instance.
  *
@@ -0,0 +1,40 @@
+/**
+ * \file vccrypt_stream_precompute.c
+ *
+ * Generic method for topping up precomputed keystream.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Top up the precomputed keystream for a stream cipher context.
+ *
+ * \param context       The stream cipher context.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_precompute(vccrypt_stream_context_t* context)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+
+    if (NULL == context || NULL == context->options)
+    {
+        return VCCRYPT_ERROR_STREAM_PRECOMPUTE_INVALID_ARG;
+    }
+
+    if (NULL == context->options->vccrypt_stream_alg_precompute)
+    {
+        return VCCRYPT_ERROR_STREAM_PRECOMPUTE_UNSUPPORTED;
+    }
+
+    return
+        context->options->vccrypt_stream_alg_precompute(
+            context->options, context);
+}
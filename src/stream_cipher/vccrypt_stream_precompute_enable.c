@@ -0,0 +1,44 @@
+/**
+ * \file vccrypt_stream_precompute_enable.c
+ *
+ * Generic method for enabling keystream precomputation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Enable, resize, or disable keystream precomputation for a stream
+ * cipher context.
+ *
+ * \param context       The stream cipher context.
+ * \param size          The number of bytes of keystream to keep ready, or 0
+ *                      to disable precomputation.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_precompute_enable(
+    vccrypt_stream_context_t* context, size_t size)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+
+    if (NULL == context || NULL == context->options)
+    {
+        return VCCRYPT_ERROR_STREAM_PRECOMPUTE_INVALID_ARG;
+    }
+
+    if (NULL == context->options->vccrypt_stream_alg_precompute_enable)
+    {
+        return VCCRYPT_ERROR_STREAM_PRECOMPUTE_UNSUPPORTED;
+    }
+
+    return
+        context->options->vccrypt_stream_alg_precompute_enable(
+            context->options, context, size);
+}
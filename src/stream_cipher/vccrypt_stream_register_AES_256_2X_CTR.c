@@ -59,6 +59,22 @@ void vccrypt_stream_register_AES_256_2X_CTR()
         &vccrypt_aes_ctr_alg_encrypt; /* yes... both are the same. */
     aes_2x_options.vccrypt_stream_alg_decrypt =
         &vccrypt_aes_ctr_alg_encrypt; /* yes... both are the same. */
+    aes_2x_options.vccrypt_stream_alg_encrypt_parallel =
+        &vccrypt_aes_ctr_alg_encrypt_parallel;
+    aes_2x_options.vccrypt_stream_alg_decrypt_parallel =
+        &vccrypt_aes_ctr_alg_encrypt_parallel; /* yes... both are the same. */
+    aes_2x_options.vccrypt_stream_alg_encrypt_many =
+        &vccrypt_aes_ctr_alg_encrypt_many;
+    aes_2x_options.vccrypt_stream_alg_decrypt_many =
+        &vccrypt_aes_ctr_alg_encrypt_many; /* yes... both are the same. */
+    aes_2x_options.vccrypt_stream_alg_precompute_enable =
+        &vccrypt_aes_ctr_alg_precompute_enable;
+    aes_2x_options.vccrypt_stream_alg_precompute =
+        &vccrypt_aes_ctr_alg_precompute;
+    aes_2x_options.vccrypt_stream_alg_storage_size =
+        &vccrypt_aes_ctr_alg_storage_size;
+    aes_2x_options.vccrypt_stream_alg_init_with_storage =
+        &vccrypt_aes_ctr_alg_init_with_storage;
     aes_2x_options.data = &aes_2x_options_data;
     aes_2x_options.vccrypt_stream_alg_options_init =
         &vccrypt_aes_ctr_alg_options_init;
@@ -0,0 +1,92 @@
+/**
+ * \file vccrypt_stream_register_AES_256_GCM.c
+ *
+ * This file contains the registration methods for the implementation of the
+ * stream cipher interface for AES 256 GCM MODE.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/abstract_factory.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/* instance data for AES-256-GCM. */
+static abstract_factory_registration_t aes_gcm_impl;
+static vccrypt_stream_options_t aes_gcm_options;
+static aes_ctr_options_data_t aes_gcm_options_data;
+static bool aes_gcm_impl_registered = false;
+
+/**
+ * Register the AES-256-GCM authenticated stream cipher.
+ */
+void vccrypt_stream_register_AES_256_GCM()
+{
+    MODEL_ASSERT(!aes_gcm_impl_registered);
+
+    /* only register once */
+    if (aes_gcm_impl_registered)
+    {
+        return;
+    }
+
+    /* set up options for aes-256-gcm */
+    aes_gcm_options_data.round_multiplier =
+        VCCRYPT_AES_CTR_ALG_ROUND_MULT_FIPS;
+    aes_gcm_options.hdr.dispose = &vccrypt_aes_ctr_alg_options_dispose;
+    aes_gcm_options.alloc_opts = 0; /* alloc by init */
+    aes_gcm_options.key_size =
+        VCCRYPT_AES_CTR_ALG_AES_256_KEY_SIZE;
+    aes_gcm_options.IV_size = VCCRYPT_AES_GCM_ALG_IV_SIZE;
+    aes_gcm_options.maximum_message_size =
+        VCCRYPT_AES_GCM_ALG_MAX_MESSAGE_SIZE;
+    aes_gcm_options.tag_size = VCCRYPT_AES_GCM_ALG_TAG_SIZE;
+    aes_gcm_options.vccrypt_stream_alg_init = &vccrypt_aes_gcm_alg_init;
+    aes_gcm_options.vccrypt_stream_alg_dispose = &vccrypt_aes_gcm_alg_dispose;
+    aes_gcm_options.vccrypt_stream_alg_start_encryption =
+        &vccrypt_aes_gcm_alg_start_encryption;
+    aes_gcm_options.vccrypt_stream_alg_continue_encryption =
+        &vccrypt_aes_gcm_alg_continue;
+    aes_gcm_options.vccrypt_stream_alg_start_decryption =
+        &vccrypt_aes_gcm_alg_start_decryption;
+    aes_gcm_options.vccrypt_stream_alg_continue_decryption =
+        &vccrypt_aes_gcm_alg_continue; /* yes... both are the same. */
+    aes_gcm_options.vccrypt_stream_alg_encrypt =
+        &vccrypt_aes_gcm_alg_encrypt;
+    aes_gcm_options.vccrypt_stream_alg_decrypt =
+        &vccrypt_aes_gcm_alg_decrypt;
+    aes_gcm_options.vccrypt_stream_alg_storage_size =
+        &vccrypt_aes_gcm_alg_storage_size;
+    aes_gcm_options.vccrypt_stream_alg_init_with_storage =
+        &vccrypt_aes_gcm_alg_init_with_storage;
+    aes_gcm_options.vccrypt_stream_alg_authenticate =
+        &vccrypt_aes_gcm_alg_authenticate;
+    aes_gcm_options.vccrypt_stream_alg_finalize =
+        &vccrypt_aes_gcm_alg_finalize;
+    aes_gcm_options.vccrypt_stream_alg_verify =
+        &vccrypt_aes_gcm_alg_verify;
+    aes_gcm_options.data = &aes_gcm_options_data;
+    aes_gcm_options.vccrypt_stream_alg_options_init =
+        &vccrypt_aes_ctr_alg_options_init;
+
+    /* set up this registration for the abstract factory. */
+    aes_gcm_impl.interface =
+        VCCRYPT_INTERFACE_STREAM;
+    aes_gcm_impl.implementation =
+        VCCRYPT_STREAM_ALGORITHM_AES_256_GCM;
+    aes_gcm_impl.implementation_features =
+        VCCRYPT_STREAM_ALGORITHM_AES_256_GCM;
+    aes_gcm_impl.factory = 0;
+    aes_gcm_impl.context = &aes_gcm_options;
+
+    /* register this instance. */
+    abstract_factory_register(&aes_gcm_impl);
+
+    /* only register once */
+    aes_gcm_impl_registered = true;
+}
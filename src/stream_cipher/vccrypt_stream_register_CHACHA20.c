@@ -0,0 +1,78 @@
+/**
+ * \file vccrypt_stream_register_CHACHA20.c
+ *
+ * This file contains the registration methods for the implementation of the
+ * stream cipher interface for ChaCha20.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/abstract_factory.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/* instance data for ChaCha20. */
+static abstract_factory_registration_t chacha20_impl;
+static vccrypt_stream_options_t chacha20_options;
+static chacha20_options_data_t chacha20_options_data;
+static bool chacha20_impl_registered = false;
+
+/**
+ * Register the ChaCha20 stream cipher.
+ */
+void vccrypt_stream_register_CHACHA20()
+{
+    MODEL_ASSERT(!chacha20_impl_registered);
+
+    /* only register once */
+    if (chacha20_impl_registered)
+    {
+        return;
+    }
+
+    /* set up options for chacha20 */
+    chacha20_options_data.aead = false;
+    chacha20_options.hdr.dispose = &vccrypt_aes_ctr_alg_options_dispose;
+    chacha20_options.alloc_opts = 0; /* alloc by init */
+    chacha20_options.key_size = VCCRYPT_CHACHA20_ALG_KEY_SIZE;
+    chacha20_options.IV_size = VCCRYPT_CHACHA20_ALG_IV_SIZE;
+    chacha20_options.maximum_message_size = VCCRYPT_CHACHA20_ALG_MAX_MESSAGE_SIZE;
+    chacha20_options.tag_size = 0;
+    chacha20_options.vccrypt_stream_alg_init = &vccrypt_chacha20_alg_init;
+    chacha20_options.vccrypt_stream_alg_dispose = &vccrypt_chacha20_alg_dispose;
+    chacha20_options.vccrypt_stream_alg_start_encryption =
+        &vccrypt_chacha20_alg_start_encryption;
+    chacha20_options.vccrypt_stream_alg_continue_encryption =
+        &vccrypt_chacha20_alg_continue;
+    chacha20_options.vccrypt_stream_alg_start_decryption =
+        &vccrypt_chacha20_alg_start_decryption;
+    chacha20_options.vccrypt_stream_alg_continue_decryption =
+        &vccrypt_chacha20_alg_continue; /* yes... both are the same. */
+    chacha20_options.vccrypt_stream_alg_encrypt = &vccrypt_chacha20_alg_encrypt;
+    chacha20_options.vccrypt_stream_alg_decrypt = &vccrypt_chacha20_alg_decrypt;
+    chacha20_options.vccrypt_stream_alg_storage_size =
+        &vccrypt_chacha20_alg_storage_size;
+    chacha20_options.vccrypt_stream_alg_init_with_storage =
+        &vccrypt_chacha20_alg_init_with_storage;
+    chacha20_options.data = &chacha20_options_data;
+    chacha20_options.vccrypt_stream_alg_options_init =
+        &vccrypt_aes_ctr_alg_options_init;
+
+    /* set up this registration for the abstract factory. */
+    chacha20_impl.interface = VCCRYPT_INTERFACE_STREAM;
+    chacha20_impl.implementation = VCCRYPT_STREAM_ALGORITHM_CHACHA20;
+    chacha20_impl.implementation_features = VCCRYPT_STREAM_ALGORITHM_CHACHA20;
+    chacha20_impl.factory = 0;
+    chacha20_impl.context = &chacha20_options;
+
+    /* register this instance. */
+    abstract_factory_register(&chacha20_impl);
+
+    /* only register once */
+    chacha20_impl_registered = true;
+}
@@ -0,0 +1,84 @@
+/**
+ * \file vccrypt_stream_register_CHACHA20_POLY1305.c
+ *
+ * This file contains the registration methods for the implementation of the
+ * stream cipher interface for ChaCha20-Poly1305.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/abstract_factory.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/* instance data for ChaCha20-Poly1305. */
+static abstract_factory_registration_t chacha20_poly1305_impl;
+static vccrypt_stream_options_t chacha20_poly1305_options;
+static chacha20_options_data_t chacha20_poly1305_options_data;
+static bool chacha20_poly1305_impl_registered = false;
+
+/**
+ * Register the ChaCha20-Poly1305 authenticated stream cipher.
+ */
+void vccrypt_stream_register_CHACHA20_POLY1305()
+{
+    MODEL_ASSERT(!chacha20_poly1305_impl_registered);
+
+    /* only register once */
+    if (chacha20_poly1305_impl_registered)
+    {
+        return;
+    }
+
+    /* set up options for chacha20_poly1305 */
+    chacha20_poly1305_options_data.aead = true;
+    chacha20_poly1305_options.hdr.dispose = &vccrypt_aes_ctr_alg_options_dispose;
+    chacha20_poly1305_options.alloc_opts = 0; /* alloc by init */
+    chacha20_poly1305_options.key_size = VCCRYPT_CHACHA20_ALG_KEY_SIZE;
+    chacha20_poly1305_options.IV_size = VCCRYPT_CHACHA20_ALG_IV_SIZE;
+    chacha20_poly1305_options.maximum_message_size = VCCRYPT_CHACHA20_POLY1305_ALG_MAX_MESSAGE_SIZE;
+    chacha20_poly1305_options.tag_size = VCCRYPT_CHACHA20_POLY1305_ALG_TAG_SIZE;
+    chacha20_poly1305_options.vccrypt_stream_alg_init = &vccrypt_chacha20_alg_init;
+    chacha20_poly1305_options.vccrypt_stream_alg_dispose = &vccrypt_chacha20_alg_dispose;
+    chacha20_poly1305_options.vccrypt_stream_alg_start_encryption =
+        &vccrypt_chacha20_alg_start_encryption;
+    chacha20_poly1305_options.vccrypt_stream_alg_continue_encryption =
+        &vccrypt_chacha20_alg_continue;
+    chacha20_poly1305_options.vccrypt_stream_alg_start_decryption =
+        &vccrypt_chacha20_alg_start_decryption;
+    chacha20_poly1305_options.vccrypt_stream_alg_continue_decryption =
+        &vccrypt_chacha20_alg_continue; /* yes... both are the same. */
+    chacha20_poly1305_options.vccrypt_stream_alg_encrypt = &vccrypt_chacha20_alg_encrypt;
+    chacha20_poly1305_options.vccrypt_stream_alg_decrypt = &vccrypt_chacha20_alg_decrypt;
+    chacha20_poly1305_options.vccrypt_stream_alg_storage_size =
+        &vccrypt_chacha20_alg_storage_size;
+    chacha20_poly1305_options.vccrypt_stream_alg_init_with_storage =
+        &vccrypt_chacha20_alg_init_with_storage;
+    chacha20_poly1305_options.vccrypt_stream_alg_authenticate =
+        &vccrypt_chacha20_poly1305_alg_authenticate;
+    chacha20_poly1305_options.vccrypt_stream_alg_finalize =
+        &vccrypt_chacha20_poly1305_alg_finalize;
+    chacha20_poly1305_options.vccrypt_stream_alg_verify =
+        &vccrypt_chacha20_poly1305_alg_verify;
+    chacha20_poly1305_options.data = &chacha20_poly1305_options_data;
+    chacha20_poly1305_options.vccrypt_stream_alg_options_init =
+        &vccrypt_aes_ctr_alg_options_init;
+
+    /* set up this registration for the abstract factory. */
+    chacha20_poly1305_impl.interface = VCCRYPT_INTERFACE_STREAM;
+    chacha20_poly1305_impl.implementation = VCCRYPT_STREAM_ALGORITHM_CHACHA20_POLY1305;
+    chacha20_poly1305_impl.implementation_features = VCCRYPT_STREAM_ALGORITHM_CHACHA20_POLY1305;
+    chacha20_poly1305_impl.factory = 0;
+    chacha20_poly1305_impl.context = &chacha20_poly1305_options;
+
+    /* register this instance. */
+    abstract_factory_register(&chacha20_poly1305_impl);
+
+    /* only register once */
+    chacha20_poly1305_impl_registered = true;
+}
@@ -0,0 +1,32 @@
+/**
+ * \file vccrypt_stream_storage_size.c
+ *
+ * Generic method for querying the cipher state storage size of a stream cipher.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Return the number of bytes of storage needed to hold the cipher
+ * state for the given options.
+ *
+ * \param options       The options for the stream cipher.
+ *
+ * \returns the size in bytes, or 0 if the selected algorithm does not support
+ *          caller-provided storage.
+ */
+size_t vccrypt_stream_storage_size(const vccrypt_stream_options_t* options)
+{
+    MODEL_ASSERT(NULL != options);
+
+    if (NULL == options->vccrypt_stream_alg_storage_size)
+        return 0;
+
+    return
+        options->vccrypt_stream_alg_storage_size(
+            (vccrypt_stream_options_t*)options);
+}
@@ -0,0 +1,97 @@
+/**
+ * \file vccrypt_stream_transform_many.c
+ *
+ * Encrypt or decrypt many independent messages in a single call.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Encrypt or decrypt many independent messages in a single call.
+ *
+ * \param jobs          The jobs to process.
+ * \param count         The number of jobs.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_transform_many(
+    vccrypt_stream_job_t* jobs, size_t count, bool encrypt)
+{
+    int (*many)(void*, void*, size_t) = NULL;
+    int retval;
+
+    MODEL_ASSERT(NULL != jobs || 0 == count);
+
+    if (0 == count)
+        return VCCRYPT_STATUS_SUCCESS;
+
+    if (NULL == jobs)
+        return VCCRYPT_ERROR_STREAM_MANY_INVALID_ARG;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (NULL == jobs[i].context || NULL == jobs[i].context->options
+         || (jobs[i].size > 0
+                && (NULL == jobs[i].input || NULL == jobs[i].output)))
+        {
+            return VCCRYPT_ERROR_STREAM_MANY_INVALID_ARG;
+        }
+    }
+
+    /* the jobs can only be interleaved if they share an implementation. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        vccrypt_stream_options_t* opts = jobs[i].context->options;
+        int (*job_many)(void*, void*, size_t) =
+            encrypt
+                ? opts->vccrypt_stream_alg_encrypt_many
+                : opts->vccrypt_stream_alg_decrypt_many;
+
+        if (0 == i)
+        {
+            many = job_many;
+        }
+        else if (many != job_many)
+        {
+            many = NULL;
+            break;
+        }
+    }
+
+    if (NULL != many)
+    {
+        return many(jobs[0].context->options, jobs, count);
+    }
+
+    /* otherwise, process each job in turn. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        vccrypt_stream_context_t* ctx = jobs[i].context;
+
+        if (0 == jobs[i].size)
+            continue;
+
+        retval =
+            encrypt
+                ? ctx->options->vccrypt_stream_alg_encrypt(
+                    ctx->options, ctx, jobs[i].input, jobs[i].size,
+                    jobs[i].output, &jobs[i].offset)
+                : ctx->options->vccrypt_stream_alg_decrypt(
+                    ctx->options, ctx, jobs[i].input, jobs[i].size,
+                    jobs[i].output, &jobs[i].offset);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            return retval;
+    }
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,106 @@
+/**
+ * \file vccrypt_stream_transformv.c
+ *
+ * Walk scatter / gather segment lists through a stream cipher.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+#include "stream_cipher_private.h"
+
+/**
+ * Encrypt or decrypt a list of input segments into a list of output segments.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param input         The input segments.
+ * \param input_count   The number of input segments.
+ * \param output        The output segments.
+ * \param output_count  The number of output segments.
+ * \param encrypt       true to encrypt, false to decrypt.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_transformv(
+    vccrypt_stream_context_t* context, const vccrypt_stream_iovec_t* input,
+    size_t input_count, const vccrypt_stream_iovec_t* output,
+    size_t output_count, bool encrypt)
+{
+    size_t input_total = 0, output_total = 0;
+    size_t in = 0, out = 0, in_pos = 0, out_pos = 0;
+    int retval;
+
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != input || 0 == input_count);
+    MODEL_ASSERT(NULL != output || 0 == output_count);
+
+    /* both sides must describe the same number of bytes. */
+    for (size_t i = 0; i < input_count; ++i)
+    {
+        if (input[i].size > SIZE_MAX - input_total)
+            return VCCRYPT_ERROR_STREAM_VECTOR_INVALID_ARG;
+
+        input_total += input[i].size;
+    }
+
+    for (size_t i = 0; i < output_count; ++i)
+    {
+        if (output[i].size > SIZE_MAX - output_total)
+            return VCCRYPT_ERROR_STREAM_VECTOR_INVALID_ARG;
+
+        output_total += output[i].size;
+    }
+
+    if (input_total != output_total)
+        return VCCRYPT_ERROR_STREAM_VECTOR_INVALID_ARG;
+
+    /* process the largest run that fits in both current segments. */
+    while (input_total > 0)
+    {
+        size_t size;
+
+        /* skip exhausted and empty segments. */
+        while (in_pos == input[in].size)
+        {
+            ++in;
+            in_pos = 0;
+        }
+
+        while (out_pos == output[out].size)
+        {
+            ++out;
+            out_pos = 0;
+        }
+
+        size = input[in].size - in_pos;
+        if (size > output[out].size - out_pos)
+            size = output[out].size - out_pos;
+
+        /* the cipher context carries the keystream position across runs. */
+        retval =
+            encrypt
+                ? context->options->vccrypt_stream_alg_encrypt(
+                    context->options, context,
+                    (const uint8_t*)input[in].data + in_pos, size,
+                    output[out].data, &out_pos)
+                : context->options->vccrypt_stream_alg_decrypt(
+                    context->options, context,
+                    (const uint8_t*)input[in].data + in_pos, size,
+                    output[out].data, &out_pos);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+            return retval;
+
+        in_pos += size;
+        input_total -= size;
+    }
+
+    return VCCRYPT_STATUS_SUCCESS;
+}
@@ -0,0 +1,47 @@
+/**
+ * \file vccrypt_stream_verify.c
+ *
+ * Generic method for finishing an authenticated stream cipher decryption.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Finish an authenticated decryption, verifying the tag.
+ *
+ * \param context       The stream cipher context for this operation.
+ * \param tag           The tag_size byte tag that followed the ciphertext.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED if this stream cipher does
+ *             not authenticate messages.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG if an argument is invalid
+ *             or if no message has been started.
+ *      - \ref VCCRYPT_ERROR_STREAM_AEAD_AUTHENTICATION_FAILED if the tag does
+ *             not match.
+ *      - a non-zero error code on failure.
+ */
+int vccrypt_stream_verify(vccrypt_stream_context_t* context, const void* tag)
+{
+    MODEL_ASSERT(NULL != context);
+    MODEL_ASSERT(NULL != context->options);
+    MODEL_ASSERT(NULL != tag);
+
+    if (NULL == context || NULL == context->options || NULL == tag)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG;
+    }
+
+    if (NULL == context->options->vccrypt_stream_alg_verify)
+    {
+        return VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED;
+    }
+
+    return context->options->vccrypt_stream_alg_verify(
+        context->options, context, tag);
+}
@@ -0,0 +1,45 @@
+/**
+ * \file suite_private.h
+ *
+ * \brief Private internal header for the crypto suite.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCRYPT_SUITE_PRIVATE_HEADER_GUARD
+#define VCCRYPT_SUITE_PRIVATE_HEADER_GUARD
+
+#include <vccrypt/suite.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The number of bytes the AEAD operations encrypt and MAC at a time.
+ *
+ * This is small enough that a chunk of ciphertext written by the stream cipher
+ * is still in L1 / L2 cache when the MAC reads it back.
+ */
+#define VCCRYPT_SUITE_AEAD_CHUNK_SIZE (16 * 1024)
+
+/**
+ * \brief Digest the AEAD length trailer: the big-endian 64-bit sizes of the
+ * associated data and of the ciphertext.
+ *
+ * \param mac           The MAC instance.
+ * \param aad_size      The size of the associated data, in bytes.
+ * \param size          The size of the ciphertext, in bytes.
+ *
+ * \returns a status indicating success or failure.
+ */
+int vccrypt_suite_aead_digest_sizes(
+    vccrypt_mac_context_t* mac, size_t aad_size, size_t size);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCRYPT_SUITE_PRIVATE_HEADER_GUARD
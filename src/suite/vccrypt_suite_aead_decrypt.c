@@ -0,0 +1,181 @@
+/**
+ * \file vccrypt_suite_aead_decrypt.c
+ *
+ * Verify and decrypt a message with the suite stream cipher and MAC.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccrypt/compare.h>
+#include <vpr/parameters.h>
+
+#include "suite_private.h"
+
+/**
+ * \brief Verify and decrypt a message produced by vccrypt_suite_aead_encrypt().
+ *
+ * Each chunk of ciphertext is MACed before it is decrypted, so this also works
+ * in place.  The output is wiped unless the tag matches.
+ *
+ * \param options       The options structure for this crypto suite.
+ * \param cipher_key    The stream cipher key.
+ * \param mac_key       The MAC key.
+ * \param aad           The associated data.
+ * \param aad_size      The size of the associated data, in bytes.
+ * \param input         The message to verify and decrypt.
+ * \param input_size    The size of the message, in bytes.
+ * \param output        The output buffer.
+ * \param output_size   The size of the output buffer.
+ *
+ * \returns a status indicating success or failure.
+ *      - \ref VCCRYPT_STATUS_SUCCESS on success.
+ *      - \ref VCCRYPT_ERROR_SUITE_AEAD_INVALID_ARG if an argument is invalid.
+ *      - \ref VCCRYPT_ERROR_SUITE_AEAD_AUTHENTICATION_FAILED if the message or
+ *             associated data has been modified.
+ *      - a non-zero return code on failure.
+ */
+int vccrypt_suite_aead_decrypt(
+    vccrypt_suite_options_t* options, const vccrypt_buffer_t* cipher_key,
+    const vccrypt_buffer_t* mac_key, const void* aad, size_t aad_size,
+    const void* input, size_t input_size, void* output, size_t output_size)
+{
+    const uint8_t* in = (const uint8_t*)input;
+    uint8_t* out = (uint8_t*)output;
+    vccrypt_stream_context_t stream;
+    vccrypt_mac_context_t mac;
+    vccrypt_buffer_t tag;
+    size_t offset = 0, output_offset = 0;
+    int retval;
+
+    MODEL_ASSERT(NULL != options);
+    MODEL_ASSERT(NULL != cipher_key);
+    MODEL_ASSERT(NULL != mac_key);
+    MODEL_ASSERT(NULL != input);
+    MODEL_ASSERT(NULL != output);
+
+    if (NULL == options || NULL == cipher_key || NULL == mac_key
+     || (NULL == aad && 0 != aad_size) || NULL == input || NULL == output)
+    {
+        return VCCRYPT_ERROR_SUITE_AEAD_INVALID_ARG;
+    }
+
+    size_t iv_size = options->stream_cipher_opts.IV_size;
+    size_t mac_size = options->mac_opts.mac_size;
+
+    if (input_size < iv_size + mac_size)
+    {
+        return VCCRYPT_ERROR_SUITE_AEAD_INVALID_ARG;
+    }
+
+    size_t size = input_size - iv_size - mac_size;
+    if (output_size < size)
+    {
+        return VCCRYPT_ERROR_SUITE_AEAD_INVALID_ARG;
+    }
+
+    retval = vccrypt_suite_stream_init(options, &stream, cipher_key);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval = vccrypt_suite_mac_init(options, &mac, mac_key);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stream;
+    }
+
+    retval =
+        vccrypt_suite_buffer_init_for_mac_authentication_code(
+            options, &tag, false);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_mac;
+    }
+
+    /* read the IV header, then MAC the associated data and the header. */
+    retval = vccrypt_stream_start_decryption(&stream, in, &offset);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tag;
+    }
+
+    if (0 != aad_size)
+    {
+        retval = vccrypt_mac_digest(&mac, (const uint8_t*)aad, aad_size);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto cleanup_tag;
+        }
+    }
+
+    retval = vccrypt_mac_digest(&mac, in, iv_size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tag;
+    }
+
+    /* MAC a chunk of ciphertext, then decrypt it while it is still in cache. */
+    for (size_t pos = 0; pos < size; pos += VCCRYPT_SUITE_AEAD_CHUNK_SIZE)
+    {
+        size_t chunk = size - pos;
+        if (chunk > VCCRYPT_SUITE_AEAD_CHUNK_SIZE)
+        {
+            chunk = VCCRYPT_SUITE_AEAD_CHUNK_SIZE;
+        }
+
+        retval = vccrypt_mac_digest(&mac, in + iv_size + pos, chunk);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto wipe_output;
+        }
+
+        retval =
+            vccrypt_stream_decrypt(
+                &stream, in + iv_size + pos, chunk, out, &output_offset);
+        if (VCCRYPT_STATUS_SUCCESS != retval)
+        {
+            goto wipe_output;
+        }
+    }
+
+    retval = vccrypt_suite_aead_digest_sizes(&mac, aad_size, size);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto wipe_output;
+    }
+
+    retval = vccrypt_mac_finalize(&mac, &tag);
+    if (VCCRYPT_STATUS_SUCCESS != retval)
+    {
+        goto wipe_output;
+    }
+
+    /* verify the tag before releasing any plaintext. */
+    if (0 != crypto_memcmp(tag.data, in + iv_size + size, mac_size))
+    {
+        retval = VCCRYPT_ERROR_SUITE_AEAD_AUTHENTICATION_FAILED;
+        goto wipe_output;
+    }
+
+    /* success. */
+    retval = VCCRYPT_STATUS_SUCCESS;
+    goto cleanup_tag;
+
+wipe_output:
+    memset(out, 0, output_offset);
+
+cleanup_tag:
+    dispose((disposable_t*)&tag);
+
+cleanup_mac:
+    dispose((disposable_t*)&mac);
+
+cleanup_stream:
+    dispose((disposable_t*)&stream);
+
+done:
+    return retval;
+}
@@ -0,0 +1,45 @@
+/**
+ * \file vccrypt_suite_aead_digest_sizes.c
+ *
+ * Digest the length trailer for the suite AEAD construction.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stdint.h>
+#include <vpr/parameters.h>
+
+#include "suite_private.h"
+
+/**
+ * \brief Digest the AEAD length trailer: the big-endian 64-bit sizes of the
+ * associated data and of the ciphertext.
+ *
+ * Binding both sizes into the MAC prevents bytes from being shifted between the
+ * associated data and the ciphertext.
+ *
+ * \param mac           The MAC instance.
+ * \param aad_size      The size of the associated data, in bytes.
+ * \param size          The size of the ciphertext, in bytes.
+ *
+ * \returns a status indicating success or failure.
+ */
+int vccrypt_suite_aead_digest_sizes(
+    vccrypt_mac_context_t* mac, size_t aad_size, size_t size)
+{
+    uint8_t trailer[16];
+    uint64_t a = aad_size, c = size;
+
+    MODEL_ASSERT(NULL != mac);
+
+    for (int i = 7; i >= 0; --i)
+    {
+        trailer[i] = (uint8_t)(a & 0xFF);
+        trailer[8 + i] = (uint8_t)(c & 0xFF);
+        a >>= 8;
+        c >>= 8;
+    }
+
+    return vccrypt_mac_digest(mac, trailer, sizeof(trailer));
+}
@@ -0,0 +1,26 @@
+/**
+ * \file vccrypt_suite_aead_overhead.c
+ *
+ * Compute the size overhead of the suite AEAD construction.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccrypt/suite.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Return the number of bytes that vccrypt_suite_aead_encrypt() adds to
+ * a message.
+ *
+ * \param options       The options structure for this crypto suite.
+ *
+ * \returns the AEAD overhead, in bytes.
+ */
+size_t vccrypt_suite_aead_overhead(const vccrypt_suite_options_t* options)
+{
+    MODEL_ASSERT(NULL != options);
+
+    return options->stream_cipher_opts.IV_size + options->mac_opts.mac_size;
+}
@@ -242,3 +242,274 @@ BEGIN_TEST_F(aes_256_cbc_fips_f25)
     dispose((disposable_t*)&ctx);
     dispose((disposable_t*)&key);
 END_TEST_F()
+
+/**
+ * A block cipher initialized in caller-provided storage produces the same
+ * output as one initialized on the heap, and its storage is sized to the
+ * selected round count.
+ */
+BEGIN_TEST_F(aes_256_cbc_init_with_storage)
+    vccrypt_block_context_t heap_ctx, stack_ctx;
+    vccrypt_buffer_t key;
+    uint8_t KEY[32], IV[16], PLAINTEXT[16];
+    uint8_t expected[16], output[16];
+    alignas(VCCRYPT_BLOCK_STORAGE_ALIGNMENT) uint8_t storage[2048];
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+    {
+        KEY[i] = (uint8_t)(11 * i + 3);
+    }
+
+    for (size_t i = 0; i < sizeof(IV); ++i)
+    {
+        IV[i] = (uint8_t)(i + 1);
+        PLAINTEXT[i] = (uint8_t)(0xA0 ^ i);
+    }
+
+    /* fewer rounds need less storage. */
+    size_t fips_size = vccrypt_block_storage_size(&fixture.fips_options);
+    size_t x3_size = vccrypt_block_storage_size(&fixture.x3_options);
+    TEST_EXPECT(0U < fips_size);
+    TEST_EXPECT(fips_size < x3_size);
+    TEST_ASSERT(x3_size <= sizeof(storage));
+
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_buffer_read_data(&key, KEY, sizeof(KEY)));
+
+    /* too small or misaligned storage is rejected. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_INIT_INVALID_ARG
+            == vccrypt_block_init_with_storage(
+                    &fixture.x3_options, &stack_ctx, &key, true, storage,
+                    x3_size - 1));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_INIT_INVALID_ARG
+            == vccrypt_block_init_with_storage(
+                    &fixture.x3_options, &stack_ctx, &key, true, storage + 1,
+                    sizeof(storage) - 1));
+
+    /* encryption matches the heap path. */
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.x3_options, &heap_ctx, &key, true));
+    TEST_ASSERT(
+        0
+            == vccrypt_block_init_with_storage(
+                    &fixture.x3_options, &stack_ctx, &key, true, storage,
+                    x3_size));
+    TEST_ASSERT(0 == vccrypt_block_encrypt(&heap_ctx, IV, PLAINTEXT, expected));
+    TEST_ASSERT(0 == vccrypt_block_encrypt(&stack_ctx, IV, PLAINTEXT, output));
+    TEST_EXPECT(0 == memcmp(expected, output, sizeof(output)));
+    dispose((disposable_t*)&stack_ctx);
+    dispose((disposable_t*)&heap_ctx);
+
+    /* decryption in caller-provided storage round trips. */
+    TEST_ASSERT(
+        0
+            == vccrypt_block_init_with_storage(
+                    &fixture.x3_options, &stack_ctx, &key, false, storage,
+                    x3_size));
+    TEST_ASSERT(0 == vccrypt_block_decrypt(&stack_ctx, IV, expected, output));
+    TEST_EXPECT(0 == memcmp(PLAINTEXT, output, sizeof(output)));
+
+    /* dispose wipes the caller-provided storage. */
+    dispose((disposable_t*)&stack_ctx);
+    for (size_t i = 0; i < x3_size; ++i)
+    {
+        TEST_ASSERT(0 == storage[i]);
+    }
+
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * The bulk CBC functions match chaining single block calls, support in-place
+ * decryption, and continue the chain across calls through the iv.
+ */
+BEGIN_TEST_F(aes_256_cbc_bulk)
+    vccrypt_block_context_t enc_ctx, dec_ctx;
+    vccrypt_buffer_t key;
+    const size_t BLOCKS = 37;
+    uint8_t KEY[32], IV[16], iv[16];
+    uint8_t plaintext[BLOCKS * 16], expected[BLOCKS * 16];
+    uint8_t output[BLOCKS * 16];
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+    {
+        KEY[i] = (uint8_t)(7 * i + 1);
+    }
+
+    for (size_t i = 0; i < sizeof(IV); ++i)
+    {
+        IV[i] = (uint8_t)(0xF0 ^ i);
+    }
+
+    for (size_t i = 0; i < sizeof(plaintext); ++i)
+    {
+        plaintext[i] = (uint8_t)(3 * i + 5);
+    }
+
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_buffer_read_data(&key, KEY, sizeof(KEY)));
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.x2_options, &enc_ctx, &key, true));
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.x2_options, &dec_ctx, &key, false));
+
+    /* compute the expected ciphertext one block at a time. */
+    const uint8_t* prev = IV;
+    for (size_t b = 0; b < BLOCKS; ++b)
+    {
+        TEST_ASSERT(
+            0
+                == vccrypt_block_encrypt(
+                        &enc_ctx, prev, plaintext + b * 16,
+                        expected + b * 16));
+        prev = expected + b * 16;
+    }
+
+    /* bulk encryption matches, and leaves the last block in the iv. */
+    memcpy(iv, IV, sizeof(iv));
+    TEST_ASSERT(
+        0 == vccrypt_block_encrypt_cbc(
+                &enc_ctx, iv, plaintext, output, BLOCKS));
+    TEST_EXPECT(0 == memcmp(expected, output, sizeof(output)));
+    TEST_EXPECT(0 == memcmp(expected + (BLOCKS - 1) * 16, iv, sizeof(iv)));
+
+    /* split encryption continues the chain. */
+    memset(output, 0, sizeof(output));
+    memcpy(iv, IV, sizeof(iv));
+    TEST_ASSERT(
+        0 == vccrypt_block_encrypt_cbc(&enc_ctx, iv, plaintext, output, 5));
+    TEST_ASSERT(
+        0 == vccrypt_block_encrypt_cbc(
+                &enc_ctx, iv, plaintext + 5 * 16, output + 5 * 16,
+                BLOCKS - 5));
+    TEST_EXPECT(0 == memcmp(expected, output, sizeof(output)));
+
+    /* bulk decryption into a separate buffer. */
+    memset(output, 0, sizeof(output));
+    memcpy(iv, IV, sizeof(iv));
+    TEST_ASSERT(
+        0 == vccrypt_block_decrypt_cbc(
+                &dec_ctx, iv, expected, output, BLOCKS));
+    TEST_EXPECT(0 == memcmp(plaintext, output, sizeof(output)));
+    TEST_EXPECT(0 == memcmp(expected + (BLOCKS - 1) * 16, iv, sizeof(iv)));
+
+    /* split, in-place decryption. */
+    memcpy(output, expected, sizeof(output));
+    memcpy(iv, IV, sizeof(iv));
+    TEST_ASSERT(
+        0 == vccrypt_block_decrypt_cbc(&dec_ctx, iv, output, output, 11));
+    TEST_ASSERT(
+        0 == vccrypt_block_decrypt_cbc(
+                &dec_ctx, iv, output + 11 * 16, output + 11 * 16,
+                BLOCKS - 11));
+    TEST_EXPECT(0 == memcmp(plaintext, output, sizeof(output)));
+
+    /* zero blocks is a no-op, and a NULL iv is rejected. */
+    TEST_EXPECT(
+        0 == vccrypt_block_encrypt_cbc(&enc_ctx, iv, NULL, NULL, 0));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG
+            == vccrypt_block_decrypt_cbc(
+                    &dec_ctx, NULL, expected, output, 1));
+
+    dispose((disposable_t*)&dec_ctx);
+    dispose((disposable_t*)&enc_ctx);
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * Encrypting many CBC messages under different keys in one call matches
+ * encrypting each message on its own.
+ */
+BEGIN_TEST_F(aes_256_cbc_encrypt_many)
+    const size_t JOBS = 10;
+    const size_t BLOCKS[JOBS] = { 1, 0, 9, 3, 20, 2, 2, 15, 1, 4 };
+    vccrypt_block_context_t ctx[JOBS];
+    vccrypt_block_job_t jobs[JOBS];
+    vccrypt_buffer_t key[JOBS];
+    uint8_t KEY[32], IV[16];
+    uint8_t iv[JOBS][16], ref_iv[16];
+    uint8_t plaintext[20 * 16];
+    uint8_t expected[20 * 16], output[JOBS][20 * 16];
+
+    for (size_t i = 0; i < sizeof(plaintext); ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 17 + 9);
+    }
+
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        /* mix round counts, which share the same lanes. */
+        vccrypt_block_options_t* options =
+            (j % 3) ? &fixture.fips_options : &fixture.x4_options;
+
+        for (size_t i = 0; i < sizeof(KEY); ++i)
+        {
+            KEY[i] = (uint8_t)(j * 13 + i);
+        }
+
+        for (size_t i = 0; i < sizeof(IV); ++i)
+        {
+            iv[j][i] = (uint8_t)(j ^ (i * 5));
+        }
+
+        TEST_ASSERT(
+            0 == vccrypt_buffer_init(&key[j], &fixture.alloc_opts,
+                    sizeof(KEY)));
+        TEST_ASSERT(
+            0 == vccrypt_buffer_read_data(&key[j], KEY, sizeof(KEY)));
+        TEST_ASSERT(0 == vccrypt_block_init(options, &ctx[j], &key[j], true));
+
+        jobs[j].context = &ctx[j];
+        jobs[j].iv = iv[j];
+        jobs[j].input = plaintext;
+        jobs[j].output = output[j];
+        jobs[j].blocks = BLOCKS[j];
+    }
+
+    TEST_ASSERT(0 == vccrypt_block_encrypt_cbc_many(jobs, JOBS));
+
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        for (size_t i = 0; i < sizeof(IV); ++i)
+        {
+            ref_iv[i] = (uint8_t)(j ^ (i * 5));
+        }
+
+        TEST_ASSERT(
+            0 == vccrypt_block_encrypt_cbc(
+                    &ctx[j], ref_iv, plaintext, expected, BLOCKS[j]));
+        TEST_EXPECT(0 == memcmp(expected, output[j], BLOCKS[j] * 16));
+        TEST_EXPECT(0 == memcmp(ref_iv, iv[j], sizeof(ref_iv)));
+    }
+
+    /* a job without an iv is rejected. */
+    jobs[3].iv = NULL;
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG
+            == vccrypt_block_encrypt_cbc_many(jobs, JOBS));
+    jobs[3].iv = iv[3];
+
+    /* so is a job whose context was initialized for decryption. */
+    vccrypt_block_context_t dec_ctx;
+    vccrypt_block_context_t* enc_ctx = jobs[5].context;
+    TEST_ASSERT(
+        0 == vccrypt_block_init(
+                &fixture.fips_options, &dec_ctx, &key[5], false));
+    jobs[5].context = &dec_ctx;
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_CBC_INVALID_ARG
+            == vccrypt_block_encrypt_cbc_many(jobs, JOBS));
+    jobs[5].context = enc_ctx;
+    dispose((disposable_t*)&dec_ctx);
+
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        dispose((disposable_t*)&ctx[j]);
+        dispose((disposable_t*)&key[j]);
+    }
+END_TEST_F()
@@ -0,0 +1,276 @@
+/**
+ * \file test_aes_xts.cpp
+ *
+ * Unit tests for AES XTS Mode.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vccrypt/block_cipher.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+class aes_xts_test {
+public:
+    void setUp()
+    {
+        /* register the AES XTS block ciphers, and a CBC one to compare. */
+        vccrypt_block_register_AES_256_XTS_FIPS();
+        vccrypt_block_register_AES_256_2X_XTS();
+        vccrypt_block_register_AES_256_CBC_FIPS();
+
+        /* set up allocator */
+        malloc_allocator_options_init(&alloc_opts);
+
+        /* set up options for each variant. */
+        fips_options_init_result =
+            vccrypt_block_options_init(
+                &fips_options, &alloc_opts,
+                VCCRYPT_BLOCK_ALGORITHM_AES_256_XTS_FIPS);
+        x2_options_init_result =
+            vccrypt_block_options_init(
+                &x2_options, &alloc_opts,
+                VCCRYPT_BLOCK_ALGORITHM_AES_256_2X_XTS);
+        cbc_options_init_result =
+            vccrypt_block_options_init(
+                &cbc_options, &alloc_opts,
+                VCCRYPT_BLOCK_ALGORITHM_AES_256_CBC_FIPS);
+
+        /* a key whose data and tweak halves differ. */
+        for (size_t i = 0; i < 32; ++i)
+        {
+            KEY[i] = (uint8_t)(i * 3 + 1);
+            KEY[32 + i] = (uint8_t)(i * 5 + 7);
+        }
+    }
+
+    void tearDown()
+    {
+        /* tear down options for each variant. */
+        if (0 == fips_options_init_result)
+        {
+            dispose((disposable_t*)&fips_options);
+        }
+        if (0 == x2_options_init_result)
+        {
+            dispose((disposable_t*)&x2_options);
+        }
+        if (0 == cbc_options_init_result)
+        {
+            dispose((disposable_t*)&cbc_options);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    allocator_options_t alloc_opts;
+    vccrypt_block_options_t fips_options;
+    vccrypt_block_options_t x2_options;
+    vccrypt_block_options_t cbc_options;
+    uint8_t KEY[64];
+
+    int fips_options_init_result;
+    int x2_options_init_result;
+    int cbc_options_init_result;
+};
+
+TEST_SUITE(aes_xts_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    aes_xts_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * AES-256-XTS-FIPS matches the IEEE 1619 construction, as implemented by
+ * OpenSSL, and round trips in place.
+ */
+BEGIN_TEST_F(aes_256_xts_fips_vector)
+    vccrypt_block_context_t enc, dec;
+    vccrypt_buffer_t key;
+    const uint64_t SECTOR = 0x123456789ULL;
+    const size_t SIZE = 4096;
+    uint8_t* plaintext = (uint8_t*)malloc(SIZE);
+    uint8_t* output = (uint8_t*)malloc(SIZE);
+    const uint8_t EXPECTED[64] = {
+        0x4e, 0x10, 0x26, 0xe8, 0x57, 0xd4, 0x34, 0xbd,
+        0x49, 0x88, 0xd3, 0x16, 0x93, 0xdf, 0x79, 0x01,
+        0xd9, 0x27, 0xd2, 0x7f, 0xb7, 0x44, 0x64, 0x19,
+        0x4e, 0x01, 0x58, 0x8e, 0x78, 0x1b, 0x19, 0x9c,
+        0xf2, 0x2f, 0xc7, 0x56, 0xa5, 0x29, 0x96, 0xb0,
+        0x8e, 0x20, 0x5d, 0x26, 0xa1, 0x2a, 0xaa, 0xc4,
+        0x80, 0xa7, 0x24, 0xd9, 0xe8, 0x7d, 0x9c, 0xc7,
+        0x60, 0xba, 0x9b, 0xcd, 0xdb, 0x6f, 0x49, 0xef };
+    const uint8_t EXPECTED_TAIL[16] = {
+        0x57, 0xdf, 0x19, 0x5c, 0xb4, 0x14, 0x0a, 0xa2,
+        0x8f, 0x04, 0x7e, 0x69, 0x80, 0x03, 0x4f, 0xa4 };
+
+    TEST_ASSERT(NULL != plaintext);
+    TEST_ASSERT(NULL != output);
+
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 11 + 2);
+    }
+
+    TEST_ASSERT(0 == fixture.fips_options_init_result);
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts,
+                sizeof(fixture.KEY)));
+    TEST_ASSERT(
+        0 == vccrypt_buffer_read_data(&key, fixture.KEY,
+                sizeof(fixture.KEY)));
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.fips_options, &enc, &key, true));
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.fips_options, &dec, &key, false));
+
+    /* a four block sector. */
+    TEST_ASSERT(
+        0 == vccrypt_block_encrypt_sector(
+                &enc, SECTOR, plaintext, output, sizeof(EXPECTED)));
+    TEST_EXPECT(0 == memcmp(EXPECTED, output, sizeof(EXPECTED)));
+
+    /* a page sized sector. */
+    TEST_ASSERT(
+        0 == vccrypt_block_encrypt_sector(
+                &enc, SECTOR, plaintext, output, SIZE));
+    TEST_EXPECT(0 == memcmp(EXPECTED, output, 16));
+    TEST_EXPECT(
+        0 == memcmp(EXPECTED_TAIL, output + SIZE - 16,
+                sizeof(EXPECTED_TAIL)));
+
+    /* in place decryption recovers the plaintext. */
+    TEST_ASSERT(
+        0 == vccrypt_block_decrypt_sector(&dec, SECTOR, output, output, SIZE));
+    TEST_EXPECT(0 == memcmp(plaintext, output, SIZE));
+
+    /* the wrong sector number does not. */
+    TEST_ASSERT(
+        0 == vccrypt_block_encrypt_sector(
+                &enc, SECTOR, plaintext, output, SIZE));
+    TEST_ASSERT(
+        0 == vccrypt_block_decrypt_sector(
+                &dec, SECTOR + 1, output, output, SIZE));
+    TEST_EXPECT(0 != memcmp(plaintext, output, SIZE));
+
+    /* the single block interface takes the tweak as its iv. */
+    uint8_t tweak[16] = { 0x89, 0x67, 0x45, 0x23, 0x01 };
+    TEST_ASSERT(0 == vccrypt_block_encrypt(&enc, tweak, plaintext, output));
+    TEST_EXPECT(0 == memcmp(EXPECTED, output, 16));
+    TEST_ASSERT(0 == vccrypt_block_decrypt(&dec, tweak, output, output));
+    TEST_EXPECT(0 == memcmp(plaintext, output, 16));
+
+    /* sectors must be whole blocks. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG
+            == vccrypt_block_encrypt_sector(
+                    &enc, SECTOR, plaintext, output, 17));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG
+            == vccrypt_block_encrypt_sector(
+                    &enc, SECTOR, plaintext, output, 0));
+
+    free(plaintext);
+    free(output);
+    dispose((disposable_t*)&dec);
+    dispose((disposable_t*)&enc);
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * Threaded multi-sector encryption matches encrypting each sector in turn.
+ */
+BEGIN_TEST_F(aes_256_2x_xts_sectors)
+    vccrypt_block_context_t enc, dec, cbc;
+    vccrypt_buffer_t key, cbc_key;
+    const uint64_t FIRST = 1000;
+    const size_t SECTOR_SIZE = 4096;
+    const size_t COUNT = 40;
+    uint8_t* plaintext = (uint8_t*)malloc(SECTOR_SIZE * COUNT);
+    uint8_t* expected = (uint8_t*)malloc(SECTOR_SIZE * COUNT);
+    uint8_t* output = (uint8_t*)malloc(SECTOR_SIZE * COUNT);
+
+    TEST_ASSERT(NULL != plaintext);
+    TEST_ASSERT(NULL != expected);
+    TEST_ASSERT(NULL != output);
+
+    for (size_t i = 0; i < SECTOR_SIZE * COUNT; ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 7 + (i >> 12));
+    }
+
+    TEST_ASSERT(0 == fixture.x2_options_init_result);
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts,
+                sizeof(fixture.KEY)));
+    TEST_ASSERT(
+        0 == vccrypt_buffer_read_data(&key, fixture.KEY,
+                sizeof(fixture.KEY)));
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.x2_options, &enc, &key, true));
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.x2_options, &dec, &key, false));
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        TEST_ASSERT(
+            0 == vccrypt_block_encrypt_sector(
+                    &enc, FIRST + i, plaintext + i * SECTOR_SIZE,
+                    expected + i * SECTOR_SIZE, SECTOR_SIZE));
+    }
+
+    TEST_ASSERT(
+        0 == vccrypt_block_encrypt_sectors(
+                &enc, FIRST, SECTOR_SIZE, plaintext, output, COUNT, 4));
+    TEST_EXPECT(0 == memcmp(expected, output, SECTOR_SIZE * COUNT));
+
+    TEST_ASSERT(
+        0 == vccrypt_block_decrypt_sectors(
+                &dec, FIRST, SECTOR_SIZE, output, output, COUNT, 0));
+    TEST_EXPECT(0 == memcmp(plaintext, output, SECTOR_SIZE * COUNT));
+
+    /* a bad sector size is rejected before any work is done. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_SECTOR_INVALID_ARG
+            == vccrypt_block_encrypt_sectors(
+                    &enc, FIRST, 4001, plaintext, output, COUNT, 4));
+
+    /* identical key halves are rejected. */
+    memcpy(fixture.KEY + 32, fixture.KEY, 32);
+    TEST_ASSERT(
+        0 == vccrypt_buffer_read_data(&key, fixture.KEY,
+                sizeof(fixture.KEY)));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_INIT_BAD_ENCRYPTION_KEY
+            == vccrypt_block_init(&fixture.x2_options, &cbc, &key, true));
+
+    /* CBC is not a sector mode. */
+    TEST_ASSERT(0 == fixture.cbc_options_init_result);
+    TEST_ASSERT(0 == vccrypt_buffer_init(&cbc_key, &fixture.alloc_opts, 32));
+    TEST_ASSERT(0 == vccrypt_buffer_read_data(&cbc_key, fixture.KEY, 32));
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.cbc_options, &cbc, &cbc_key, true));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_BLOCK_SECTOR_UNSUPPORTED
+            == vccrypt_block_encrypt_sector(
+                    &cbc, FIRST, plaintext, output, SECTOR_SIZE));
+
+    free(plaintext);
+    free(expected);
+    free(output);
+    dispose((disposable_t*)&cbc);
+    dispose((disposable_t*)&dec);
+    dispose((disposable_t*)&enc);
+    dispose((disposable_t*)&cbc_key);
+    dispose((disposable_t*)&key);
+END_TEST_F()
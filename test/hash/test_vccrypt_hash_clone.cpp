@@ -0,0 +1,296 @@
+/**
+ * \file test_vccrypt_hash_clone.cpp
+ *
+ * Unit tests for hash cloning and midstate export / import.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+class vccrypt_hash_clone_test {
+public:
+    void setUp()
+    {
+        vccrypt_hash_register_SHA_2_256();
+        vccrypt_hash_register_SHA_2_384();
+        vccrypt_hash_register_SHA_2_512();
+        vccrypt_hash_register_SHA_2_512_256();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        for (size_t i = 0; i < sizeof(input); ++i)
+        {
+            input[i] = (uint8_t)(i * 7 + 3);
+        }
+    }
+
+    void tearDown()
+    {
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Hash input[0, size) with a new instance.
+     */
+    int hash(vccrypt_hash_options_t* options, size_t size, uint8_t* digest)
+    {
+        vccrypt_hash_context_t ctx;
+        vccrypt_buffer_t md;
+        int retval;
+
+        retval = vccrypt_buffer_init(&md, &alloc_opts, options->hash_size);
+        if (0 != retval)
+            return retval;
+
+        retval = vccrypt_hash_init(options, &ctx);
+        if (0 != retval)
+            goto dispose_md;
+
+        retval = vccrypt_hash_digest(&ctx, input, size);
+        if (0 != retval)
+            goto dispose_ctx;
+
+        retval = vccrypt_hash_finalize(&ctx, &md);
+        if (0 == retval)
+            memcpy(digest, md.data, options->hash_size);
+
+    dispose_ctx:
+        dispose((disposable_t*)&ctx);
+
+    dispose_md:
+        dispose((disposable_t*)&md);
+
+        return retval;
+    }
+
+    allocator_options_t alloc_opts;
+    uint8_t input[1000];
+};
+
+TEST_SUITE(vccrypt_hash_clone_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccrypt_hash_clone_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+static const uint32_t ALGORITHMS[] = {
+    VCCRYPT_HASH_ALGORITHM_SHA_2_256,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_384,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_512,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_512_256,
+};
+
+/**
+ * A prefix hashed once and cloned should finish exactly like hashing each
+ * full message from scratch, for prefixes on and off block boundaries.
+ */
+BEGIN_TEST_F(clone_forks_prefix)
+    const size_t PREFIXES[] = { 0, 1, 63, 64, 111, 127, 128, 129, 300 };
+    const size_t SUFFIXES[] = { 0, 5, 200 };
+
+    for (uint32_t alg : ALGORITHMS)
+    {
+        vccrypt_hash_options_t options;
+        vccrypt_buffer_t md;
+        uint8_t expected[64];
+
+        TEST_ASSERT(0 ==
+            vccrypt_hash_options_init(&options, &fixture.alloc_opts, alg));
+        TEST_ASSERT(options.hash_state_size > 0);
+        TEST_ASSERT(options.hash_state_size <= VCCRYPT_HASH_MAX_STATE_SIZE);
+        TEST_ASSERT(0 ==
+            vccrypt_buffer_init(&md, &fixture.alloc_opts, options.hash_size));
+
+        for (size_t prefix : PREFIXES)
+        {
+            vccrypt_hash_context_t base;
+
+            TEST_ASSERT(0 == vccrypt_hash_init(&options, &base));
+            TEST_ASSERT(0 == vccrypt_hash_digest(&base, fixture.input, prefix));
+
+            for (size_t suffix : SUFFIXES)
+            {
+                vccrypt_hash_context_t fork;
+
+                TEST_ASSERT(0 == vccrypt_hash_clone(&fork, &base));
+                TEST_ASSERT(0 ==
+                    vccrypt_hash_digest(
+                        &fork, fixture.input + prefix, suffix));
+                TEST_ASSERT(0 == vccrypt_hash_finalize(&fork, &md));
+
+                TEST_ASSERT(0 ==
+                    fixture.hash(&options, prefix + suffix, expected));
+                TEST_EXPECT(0 == memcmp(md.data, expected, md.size));
+
+                dispose((disposable_t*)&fork);
+            }
+
+            /* the source instance is unaffected by its clones. */
+            TEST_ASSERT(0 == vccrypt_hash_finalize(&base, &md));
+            TEST_ASSERT(0 == fixture.hash(&options, prefix, expected));
+            TEST_EXPECT(0 == memcmp(md.data, expected, md.size));
+
+            dispose((disposable_t*)&base);
+        }
+
+        dispose((disposable_t*)&md);
+        dispose((disposable_t*)&options);
+    }
+END_TEST_F()
+
+/**
+ * An exported midstate can be imported into a different instance, more than
+ * once.
+ */
+BEGIN_TEST_F(export_import)
+    for (uint32_t alg : ALGORITHMS)
+    {
+        vccrypt_hash_options_t options;
+        vccrypt_hash_context_t src, dst;
+        vccrypt_buffer_t md, state;
+        uint8_t expected[64];
+
+        TEST_ASSERT(0 ==
+            vccrypt_hash_options_init(&options, &fixture.alloc_opts, alg));
+        TEST_ASSERT(0 ==
+            vccrypt_buffer_init(&md, &fixture.alloc_opts, options.hash_size));
+        TEST_ASSERT(0 ==
+            vccrypt_buffer_init(
+                &state, &fixture.alloc_opts, options.hash_state_size));
+
+        TEST_ASSERT(0 == vccrypt_hash_init(&options, &src));
+        TEST_ASSERT(0 == vccrypt_hash_digest(&src, fixture.input, 250));
+        TEST_ASSERT(0 == vccrypt_hash_export_state(&src, &state));
+        dispose((disposable_t*)&src);
+
+        TEST_ASSERT(0 == fixture.hash(&options, 700, expected));
+
+        for (int i = 0; i < 2; ++i)
+        {
+            TEST_ASSERT(0 == vccrypt_hash_init(&options, &dst));
+            TEST_ASSERT(0 == vccrypt_hash_digest(&dst, fixture.input, 17));
+            TEST_ASSERT(0 == vccrypt_hash_import_state(&dst, &state));
+            TEST_ASSERT(0 ==
+                vccrypt_hash_digest(&dst, fixture.input + 250, 450));
+            TEST_ASSERT(0 == vccrypt_hash_finalize(&dst, &md));
+            TEST_EXPECT(0 == memcmp(md.data, expected, md.size));
+            dispose((disposable_t*)&dst);
+        }
+
+        dispose((disposable_t*)&state);
+        dispose((disposable_t*)&md);
+        dispose((disposable_t*)&options);
+    }
+END_TEST_F()
+
+/**
+ * A midstate exported by one SHA-512 family algorithm is rejected by another.
+ */
+BEGIN_TEST_F(import_other_algorithm)
+    vccrypt_hash_options_t sha384_options, sha512_options;
+    vccrypt_hash_context_t sha384, sha512;
+    vccrypt_buffer_t state;
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&sha384_options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_384));
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&sha512_options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512));
+    TEST_ASSERT(
+        sha384_options.hash_state_size == sha512_options.hash_state_size);
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(
+            &state, &fixture.alloc_opts, sha384_options.hash_state_size));
+    TEST_ASSERT(0 == vccrypt_hash_init(&sha384_options, &sha384));
+    TEST_ASSERT(0 == vccrypt_hash_init(&sha512_options, &sha512));
+
+    TEST_ASSERT(0 == vccrypt_hash_digest(&sha384, fixture.input, 100));
+    TEST_ASSERT(0 == vccrypt_hash_export_state(&sha384, &state));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG ==
+        vccrypt_hash_import_state(&sha512, &state));
+
+    TEST_ASSERT(0 == vccrypt_hash_export_state(&sha512, &state));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG ==
+        vccrypt_hash_import_state(&sha384, &state));
+
+    dispose((disposable_t*)&sha512);
+    dispose((disposable_t*)&sha384);
+    dispose((disposable_t*)&state);
+    dispose((disposable_t*)&sha512_options);
+    dispose((disposable_t*)&sha384_options);
+END_TEST_F()
+
+/**
+ * Invalid arguments, short buffers, and malformed midstates are rejected.
+ */
+BEGIN_TEST_F(invalid_args)
+    vccrypt_hash_options_t options, no_state;
+    vccrypt_hash_context_t ctx, fork;
+    vccrypt_buffer_t state, short_state;
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512));
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(
+            &state, &fixture.alloc_opts, options.hash_state_size));
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(
+            &short_state, &fixture.alloc_opts, options.hash_state_size - 1));
+    TEST_ASSERT(0 == vccrypt_hash_init(&options, &ctx));
+
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_CLONE_INVALID_ARG ==
+        vccrypt_hash_clone(NULL, &ctx));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_CLONE_INVALID_ARG ==
+        vccrypt_hash_clone(&fork, NULL));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_CLONE_INVALID_ARG ==
+        vccrypt_hash_clone(&ctx, &ctx));
+
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_EXPORT_STATE_INVALID_ARG ==
+        vccrypt_hash_export_state(NULL, &state));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_EXPORT_STATE_INVALID_ARG ==
+        vccrypt_hash_export_state(&ctx, NULL));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_EXPORT_STATE_INVALID_ARG ==
+        vccrypt_hash_export_state(&ctx, &short_state));
+
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG ==
+        vccrypt_hash_import_state(NULL, &state));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG ==
+        vccrypt_hash_import_state(&ctx, NULL));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG ==
+        vccrypt_hash_import_state(&ctx, &short_state));
+
+    /* a buffered byte count of a full block is malformed. */
+    TEST_ASSERT(0 == vccrypt_hash_export_state(&ctx, &state));
+    ((uint8_t*)state.data)[81] = 128;
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_IMPORT_STATE_INVALID_ARG ==
+        vccrypt_hash_import_state(&ctx, &state));
+
+    /* algorithms without midstate support report it. */
+    memcpy(&no_state, &options, sizeof(no_state));
+    no_state.hash_state_size = 0;
+    ctx.options = &no_state;
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED ==
+        vccrypt_hash_clone(&fork, &ctx));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED ==
+        vccrypt_hash_export_state(&ctx, &state));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_STATE_UNSUPPORTED ==
+        vccrypt_hash_import_state(&ctx, &state));
+    ctx.options = &options;
+
+    dispose((disposable_t*)&ctx);
+    dispose((disposable_t*)&short_state);
+    dispose((disposable_t*)&state);
+    dispose((disposable_t*)&options);
+END_TEST_F()
@@ -0,0 +1,251 @@
+/**
+ * \file test_vccrypt_hash_digest_many.cpp
+ *
+ * Unit tests for multi-buffer hashing.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../../src/hash/ref/sha512.h"
+
+class vccrypt_hash_digest_many_test {
+public:
+    void setUp()
+    {
+        vccrypt_hash_register_SHA_2_384();
+        vccrypt_hash_register_SHA_2_512();
+        vccrypt_hash_register_SHA_2_512_256();
+
+        malloc_allocator_options_init(&alloc_opts);
+    }
+
+    void tearDown()
+    {
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Hash a single message with the streaming interface.
+     */
+    int reference(
+        vccrypt_hash_options_t* options, const uint8_t* data, size_t size,
+        uint8_t* digest)
+    {
+        vccrypt_hash_context_t ctx;
+        vccrypt_buffer_t hash;
+        int retval;
+
+        retval = vccrypt_buffer_init(&hash, &alloc_opts, options->hash_size);
+        if (0 != retval)
+            return retval;
+
+        retval = vccrypt_hash_init(options, &ctx);
+        if (0 != retval)
+            goto dispose_hash;
+
+        if (size > 0)
+        {
+            retval = vccrypt_hash_digest(&ctx, data, size);
+            if (0 != retval)
+                goto dispose_ctx;
+        }
+
+        retval = vccrypt_hash_finalize(&ctx, &hash);
+        if (0 == retval)
+            memcpy(digest, hash.data, options->hash_size);
+
+    dispose_ctx:
+        dispose((disposable_t*)&ctx);
+
+    dispose_hash:
+        dispose((disposable_t*)&hash);
+
+        return retval;
+    }
+
+    allocator_options_t alloc_opts;
+};
+
+TEST_SUITE(vccrypt_hash_digest_many_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccrypt_hash_digest_many_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Every message in a batch hashes exactly as it would on its own, for every
+ * message length around the padding and block boundaries.
+ */
+BEGIN_TEST_F(matches_streaming)
+    const uint32_t ALGORITHMS[] = {
+        VCCRYPT_HASH_ALGORITHM_SHA_2_384,
+        VCCRYPT_HASH_ALGORITHM_SHA_2_512,
+        VCCRYPT_HASH_ALGORITHM_SHA_2_512_256 };
+    const size_t COUNT = 301;
+    static uint8_t message[COUNT];
+    static uint8_t digest[COUNT][64];
+    static vccrypt_hash_job_t jobs[COUNT];
+    uint8_t expected[64];
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        message[i] = (uint8_t)(i * 7 + 3);
+    }
+
+    for (size_t a = 0; a < sizeof(ALGORITHMS) / sizeof(ALGORITHMS[0]); ++a)
+    {
+        vccrypt_hash_options_t options;
+
+        TEST_ASSERT(
+            0 == vccrypt_hash_options_init(
+                    &options, &fixture.alloc_opts, ALGORITHMS[a]));
+
+        /* job i hashes the first i bytes; reverse every other job so that
+         * lanes finish out of order. */
+        memset(digest, 0, sizeof(digest));
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            jobs[i].size = (i & 1) ? COUNT - i : i;
+            jobs[i].data = 0 == jobs[i].size ? NULL : message;
+            jobs[i].digest = digest[i];
+        }
+
+        TEST_ASSERT(0 == vccrypt_hash_digest_many(&options, jobs, COUNT));
+
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            TEST_ASSERT(
+                0 == fixture.reference(
+                        &options, message, jobs[i].size, expected));
+            TEST_EXPECT(0 == memcmp(expected, digest[i], options.hash_size));
+        }
+
+        /* a single job and an empty batch are both fine. */
+        TEST_ASSERT(
+            0 == fixture.reference(
+                    &options, message, jobs[200].size, expected));
+        memset(digest[200], 0, sizeof(digest[200]));
+        TEST_ASSERT(0 == vccrypt_hash_digest_many(&options, jobs + 200, 1));
+        TEST_EXPECT(0 == memcmp(expected, digest[200], options.hash_size));
+        TEST_EXPECT(0 == vccrypt_hash_digest_many(&options, NULL, 0));
+
+        dispose((disposable_t*)&options);
+    }
+END_TEST_F()
+
+/**
+ * Invalid jobs are rejected before any work is done.
+ */
+BEGIN_TEST_F(invalid_args)
+    vccrypt_hash_options_t options;
+    uint8_t data[4] = { 1, 2, 3, 4 };
+    uint8_t digest[2][64];
+    vccrypt_hash_job_t jobs[2] = {
+        { data, sizeof(data), digest[0] },
+        { data, sizeof(data), NULL } };
+
+    TEST_ASSERT(
+        0 == vccrypt_hash_options_init(
+                &options, &fixture.alloc_opts,
+                VCCRYPT_HASH_ALGORITHM_SHA_2_512));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_HASH_DIGEST_MANY_INVALID_ARG
+            == vccrypt_hash_digest_many(NULL, jobs, 1));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_HASH_DIGEST_MANY_INVALID_ARG
+            == vccrypt_hash_digest_many(&options, NULL, 1));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_HASH_DIGEST_MANY_INVALID_ARG
+            == vccrypt_hash_digest_many(&options, jobs, 2));
+
+    jobs[1].digest = digest[1];
+    jobs[1].data = NULL;
+    TEST_EXPECT(
+        VCCRYPT_ERROR_HASH_DIGEST_MANY_INVALID_ARG
+            == vccrypt_hash_digest_many(&options, jobs, 2));
+
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+#ifdef SHA512_X86_SIMD_SUPPORTED
+/**
+ * Each SIMD kernel lane compresses a block exactly as the scalar code does.
+ */
+TEST(simd_kernels)
+{
+    uint8_t block[SHA512_MAX_LANES][128];
+    const uint8_t* blocks[SHA512_MAX_LANES];
+    uint64_t state[8][SHA512_MAX_LANES];
+    SHA512_CTX ctx;
+
+    for (size_t l = 0; l < SHA512_MAX_LANES; ++l)
+    {
+        for (size_t i = 0; i < sizeof(block[l]); ++i)
+        {
+            block[l][i] = (uint8_t)(i * 31 + l * 101 + 5);
+        }
+
+        blocks[l] = block[l];
+    }
+
+    for (size_t width = 2; width <= SHA512_MAX_LANES; width += 2)
+    {
+        if (4 == width && !SHA512_avx2_available())
+            continue;
+
+        SHA512_Init(&ctx);
+        for (size_t i = 0; i < 8; ++i)
+        {
+            for (size_t l = 0; l < SHA512_MAX_LANES; ++l)
+            {
+                state[i][l] = ctx.h[i];
+            }
+        }
+
+        if (2 == width)
+            SHA512_x2_sse2(state, blocks);
+        else
+            SHA512_x4_avx2(state, blocks);
+
+        for (size_t l = 0; l < width; ++l)
+        {
+            SHA512_Init(&ctx);
+            SHA512_Update(&ctx, block[l], sizeof(block[l]));
+
+            for (size_t i = 0; i < 8; ++i)
+            {
+                TEST_EXPECT(ctx.h[i] == state[i][l]);
+            }
+
+#ifdef SHA512_AVX2_BMI2_SUPPORTED
+            /* the single stream kernel agrees with the lane kernels. */
+            if (SHA512_avx2_bmi2_available())
+            {
+                uint64_t h[8];
+
+                SHA512_Init(&ctx);
+                memcpy(h, ctx.h, sizeof(h));
+                SHA512_avx2_bmi2_block_data_order(h, block[l], 1);
+
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    TEST_EXPECT(h[i] == state[i][l]);
+                }
+            }
+#endif /*SHA512_AVX2_BMI2_SUPPORTED*/
+        }
+    }
+}
+#endif /*SHA512_X86_SIMD_SUPPORTED*/
@@ -0,0 +1,161 @@
+/**
+ * \file test_vccrypt_hash_digestv.cpp
+ *
+ * Unit tests for vectored hash digests.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+class vccrypt_hash_digestv_test {
+public:
+    void setUp()
+    {
+        vccrypt_hash_register_SHA_2_256();
+        vccrypt_hash_register_SHA_2_384();
+        vccrypt_hash_register_SHA_2_512();
+        vccrypt_hash_register_SHA_2_512_256();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        for (size_t i = 0; i < sizeof(input); ++i)
+        {
+            input[i] = (uint8_t)(i * 31 + 7);
+        }
+    }
+
+    void tearDown()
+    {
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Split input into segments of the given sizes, hash them with
+     * vccrypt_hash_digestv(), and compare against a single contiguous digest.
+     */
+    bool matches(
+        vccrypt_hash_options_t* options, const size_t* sizes, size_t count)
+    {
+        vccrypt_segment_t segments[32];
+        vccrypt_hash_context_t ctx;
+        vccrypt_buffer_t expected, actual;
+        size_t offset = 0;
+        bool result = false;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            segments[i].data = 0 == sizes[i] ? NULL : input + offset;
+            segments[i].size = sizes[i];
+            offset += sizes[i];
+        }
+
+        if (0 != vccrypt_buffer_init(
+                    &expected, &alloc_opts, options->hash_size))
+            return false;
+        if (0 != vccrypt_buffer_init(&actual, &alloc_opts, options->hash_size))
+            goto dispose_expected;
+
+        if (0 != vccrypt_hash_oneshot(
+                    options, input, offset, (uint8_t*)expected.data))
+            goto dispose_actual;
+
+        if (0 != vccrypt_hash_init(options, &ctx))
+            goto dispose_actual;
+        if (0 == vccrypt_hash_digestv(&ctx, segments, count)
+         && 0 == vccrypt_hash_finalize(&ctx, &actual))
+        {
+            result =
+                0 == memcmp(expected.data, actual.data, options->hash_size);
+        }
+        dispose((disposable_t*)&ctx);
+
+    dispose_actual:
+        dispose((disposable_t*)&actual);
+
+    dispose_expected:
+        dispose((disposable_t*)&expected);
+
+        return result;
+    }
+
+    allocator_options_t alloc_opts;
+    uint8_t input[4096];
+};
+
+TEST_SUITE(vccrypt_hash_digestv_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccrypt_hash_digestv_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+static const uint32_t ALGORITHMS[] = {
+    VCCRYPT_HASH_ALGORITHM_SHA_2_256,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_384,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_512,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_512_256,
+};
+
+/**
+ * Segments that straddle, fill, and span blocks hash like contiguous data.
+ */
+BEGIN_TEST_F(matches_contiguous)
+    const size_t SMALL_FIELDS[] = {
+        8, 4, 32, 0, 1, 2, 16, 64, 8, 8, 33, 0, 7, 100, 1, 3 };
+    const size_t ACROSS_BLOCKS[] = { 63, 2, 127, 130, 1, 255, 256, 64, 128 };
+    const size_t LARGE[] = { 1, 1500, 0, 2048, 17 };
+
+    for (uint32_t alg : ALGORITHMS)
+    {
+        vccrypt_hash_options_t options;
+
+        TEST_ASSERT(0 ==
+            vccrypt_hash_options_init(&options, &fixture.alloc_opts, alg));
+
+        TEST_EXPECT(fixture.matches(&options, SMALL_FIELDS,
+            sizeof(SMALL_FIELDS) / sizeof(SMALL_FIELDS[0])));
+        TEST_EXPECT(fixture.matches(&options, ACROSS_BLOCKS,
+            sizeof(ACROSS_BLOCKS) / sizeof(ACROSS_BLOCKS[0])));
+        TEST_EXPECT(fixture.matches(&options, LARGE,
+            sizeof(LARGE) / sizeof(LARGE[0])));
+        TEST_EXPECT(fixture.matches(&options, NULL, 0));
+
+        dispose((disposable_t*)&options);
+    }
+END_TEST_F()
+
+/**
+ * Invalid arguments and segments are rejected.
+ */
+BEGIN_TEST_F(invalid_args)
+    vccrypt_hash_options_t options;
+    vccrypt_hash_context_t ctx;
+    vccrypt_segment_t segments[2] = {
+        { fixture.input, 10 },
+        { NULL, 1 } };
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512));
+    TEST_ASSERT(0 == vccrypt_hash_init(&options, &ctx));
+
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_DIGESTV_INVALID_ARG ==
+        vccrypt_hash_digestv(NULL, segments, 1));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_DIGESTV_INVALID_ARG ==
+        vccrypt_hash_digestv(&ctx, NULL, 1));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_DIGESTV_INVALID_ARG ==
+        vccrypt_hash_digestv(&ctx, segments, 2));
+    TEST_EXPECT(0 == vccrypt_hash_digestv(&ctx, NULL, 0));
+
+    dispose((disposable_t*)&ctx);
+    dispose((disposable_t*)&options);
+END_TEST_F()
@@ -0,0 +1,205 @@
+/**
+ * \file test_vccrypt_hash_oneshot.cpp
+ *
+ * Unit tests for embedded hash contexts and one-shot hashing.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+class vccrypt_hash_oneshot_test {
+public:
+    void setUp()
+    {
+        vccrypt_hash_register_SHA_2_256();
+        vccrypt_hash_register_SHA_2_384();
+        vccrypt_hash_register_SHA_2_512();
+        vccrypt_hash_register_SHA_2_512_256();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        for (size_t i = 0; i < sizeof(input); ++i)
+        {
+            input[i] = (uint8_t)(i * 13 + 1);
+        }
+    }
+
+    void tearDown()
+    {
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Hash input[0, size) with an instance from the given init function.
+     */
+    int hash(
+        vccrypt_hash_options_t* options, size_t size, uint8_t* digest,
+        int (*init)(vccrypt_hash_options_t*, vccrypt_hash_context_t*),
+        bool* embedded)
+    {
+        vccrypt_hash_context_t ctx;
+        vccrypt_buffer_t md;
+        int retval;
+
+        retval = vccrypt_buffer_init(&md, &alloc_opts, options->hash_size);
+        if (0 != retval)
+            return retval;
+
+        retval = init(options, &ctx);
+        if (0 != retval)
+            goto dispose_md;
+
+        *embedded = (ctx.hash_state == (void*)ctx.hash_state_storage);
+
+        retval = vccrypt_hash_digest(&ctx, input, size);
+        if (0 != retval)
+            goto dispose_ctx;
+
+        retval = vccrypt_hash_finalize(&ctx, &md);
+        if (0 == retval)
+            memcpy(digest, md.data, options->hash_size);
+
+    dispose_ctx:
+        dispose((disposable_t*)&ctx);
+
+    dispose_md:
+        dispose((disposable_t*)&md);
+
+        return retval;
+    }
+
+    allocator_options_t alloc_opts;
+    uint8_t input[600];
+};
+
+TEST_SUITE(vccrypt_hash_oneshot_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccrypt_hash_oneshot_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+static const uint32_t ALGORITHMS[] = {
+    VCCRYPT_HASH_ALGORITHM_SHA_2_256,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_384,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_512,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_512_256,
+};
+
+static const size_t SIZES[] = { 0, 1, 55, 56, 64, 111, 112, 128, 599 };
+
+/**
+ * Embedded instances and one-shot hashing match allocated instances.
+ */
+BEGIN_TEST_F(matches_allocated)
+    for (uint32_t alg : ALGORITHMS)
+    {
+        vccrypt_hash_options_t options;
+        uint8_t expected[64], embedded[64], oneshot[64];
+        bool is_embedded;
+
+        TEST_ASSERT(0 ==
+            vccrypt_hash_options_init(&options, &fixture.alloc_opts, alg));
+        TEST_ASSERT(options.hash_context_state_size > 0);
+
+        for (size_t size : SIZES)
+        {
+            TEST_ASSERT(0 ==
+                fixture.hash(
+                    &options, size, expected, &vccrypt_hash_init,
+                    &is_embedded));
+            TEST_EXPECT(!is_embedded);
+
+            TEST_ASSERT(0 ==
+                fixture.hash(
+                    &options, size, embedded, &vccrypt_hash_init_embedded,
+                    &is_embedded));
+            TEST_EXPECT(is_embedded);
+            TEST_EXPECT(0 == memcmp(expected, embedded, options.hash_size));
+
+            memset(oneshot, 0xfe, sizeof(oneshot));
+            TEST_ASSERT(0 ==
+                vccrypt_hash_oneshot(
+                    &options, fixture.input, size, oneshot));
+            TEST_EXPECT(0 == memcmp(expected, oneshot, options.hash_size));
+
+            /* nothing is written past the hash. */
+            for (size_t i = options.hash_size; i < sizeof(oneshot); ++i)
+            {
+                TEST_EXPECT(0xfe == oneshot[i]);
+            }
+        }
+
+        dispose((disposable_t*)&options);
+    }
+END_TEST_F()
+
+/**
+ * Algorithms that cannot embed their state fall back to allocating it.
+ */
+BEGIN_TEST_F(embedded_fallback)
+    vccrypt_hash_options_t options;
+    uint8_t expected[64], actual[64];
+    bool is_embedded;
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512));
+    TEST_ASSERT(0 ==
+        fixture.hash(
+            &options, 300, expected, &vccrypt_hash_init, &is_embedded));
+
+    options.hash_context_state_size = 0;
+    TEST_ASSERT(0 ==
+        fixture.hash(
+            &options, 300, actual, &vccrypt_hash_init_embedded,
+            &is_embedded));
+    TEST_EXPECT(!is_embedded);
+    TEST_EXPECT(0 == memcmp(expected, actual, 64));
+
+    memset(actual, 0, sizeof(actual));
+    TEST_ASSERT(0 ==
+        vccrypt_hash_oneshot(&options, fixture.input, 300, actual));
+    TEST_EXPECT(0 == memcmp(expected, actual, 64));
+
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+/**
+ * Invalid arguments are rejected.
+ */
+BEGIN_TEST_F(invalid_args)
+    vccrypt_hash_options_t options;
+    vccrypt_hash_context_t ctx;
+    uint8_t digest[64];
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512));
+
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_INIT_INVALID_ARG ==
+        vccrypt_hash_init_embedded(NULL, &ctx));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_INIT_INVALID_ARG ==
+        vccrypt_hash_init_embedded(&options, NULL));
+
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_ONESHOT_INVALID_ARG ==
+        vccrypt_hash_oneshot(NULL, fixture.input, 1, digest));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_ONESHOT_INVALID_ARG ==
+        vccrypt_hash_oneshot(&options, NULL, 1, digest));
+    TEST_EXPECT(VCCRYPT_ERROR_HASH_ONESHOT_INVALID_ARG ==
+        vccrypt_hash_oneshot(&options, fixture.input, 1, NULL));
+
+    /* an empty message may omit its data. */
+    TEST_EXPECT(0 == vccrypt_hash_oneshot(&options, NULL, 0, digest));
+
+    dispose((disposable_t*)&options);
+END_TEST_F()
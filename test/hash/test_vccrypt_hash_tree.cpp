@@ -0,0 +1,285 @@
+/**
+ * \file test_vccrypt_hash_tree.cpp
+ *
+ * Unit tests for the SHA-512 tree hash.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+#define CHUNK_64K (64 * 1024)
+
+class vccrypt_hash_tree_test {
+public:
+    void setUp()
+    {
+        vccrypt_hash_register_SHA_2_512();
+        vccrypt_hash_register_SHA_2_512_TREE();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        /* enough for more than one parallel batch of 64 KiB leaves. */
+        input.resize(70 * CHUNK_64K + 7);
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            input[i] = (uint8_t)((i * 31) ^ (i >> 11));
+        }
+    }
+
+    void tearDown()
+    {
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Plain SHA-512 of prefix || data || suffix.
+     */
+    vector<uint8_t> sha512(
+        uint8_t prefix, const uint8_t* data, size_t size,
+        const uint8_t* suffix = NULL, size_t suffix_size = 0)
+    {
+        vccrypt_hash_options_t options;
+        vccrypt_hash_context_t ctx;
+        vccrypt_buffer_t md;
+        vector<uint8_t> out(VCCRYPT_HASH_SHA_512_DIGEST_SIZE);
+
+        if (0 != vccrypt_hash_options_init(
+                    &options, &alloc_opts, VCCRYPT_HASH_ALGORITHM_SHA_2_512))
+            return vector<uint8_t>();
+        if (0 != vccrypt_buffer_init(&md, &alloc_opts, options.hash_size))
+            return vector<uint8_t>();
+        if (0 != vccrypt_hash_init(&options, &ctx))
+            return vector<uint8_t>();
+
+        if (0 == vccrypt_hash_digest(&ctx, &prefix, 1)
+         && 0 == vccrypt_hash_digest(&ctx, data, size)
+         && (0 == suffix_size
+          || 0 == vccrypt_hash_digest(&ctx, suffix, suffix_size))
+         && 0 == vccrypt_hash_finalize(&ctx, &md))
+        {
+            memcpy(out.data(), md.data, out.size());
+        }
+
+        dispose((disposable_t*)&ctx);
+        dispose((disposable_t*)&md);
+        dispose((disposable_t*)&options);
+
+        return out;
+    }
+
+    /**
+     * Compute the tree hash of input[0, size) level by level.
+     */
+    vector<uint8_t> reference(size_t size, size_t chunk, size_t fanout)
+    {
+        vector<vector<uint8_t>> level;
+        uint8_t params[24];
+
+        for (size_t off = 0; off < size || level.empty(); off += chunk)
+        {
+            size_t len = (size - off < chunk) ? size - off : chunk;
+            level.push_back(sha512(0x00, input.data() + off, len));
+        }
+
+        while (level.size() > 1)
+        {
+            vector<vector<uint8_t>> next;
+
+            for (size_t i = 0; i < level.size(); i += fanout)
+            {
+                vector<uint8_t> children;
+                for (size_t j = i; j < i + fanout && j < level.size(); ++j)
+                {
+                    children.insert(
+                        children.end(), level[j].begin(), level[j].end());
+                }
+
+                next.push_back(sha512(0x01, children.data(), children.size()));
+            }
+
+            level = next;
+        }
+
+        for (int i = 0; i < 8; ++i)
+        {
+            params[i] = (uint8_t)((uint64_t)chunk >> (56 - 8 * i));
+            params[8 + i] = (uint8_t)((uint64_t)fanout >> (56 - 8 * i));
+            params[16 + i] = (uint8_t)((uint64_t)size >> (56 - 8 * i));
+        }
+
+        return
+            sha512(
+                0x02, level[0].data(), level[0].size(), params,
+                sizeof(params));
+    }
+
+    /**
+     * Tree hash input[0, size), digesting it in pieces of the given size.
+     */
+    vector<uint8_t> tree(uint32_t algorithm, size_t size, size_t piece)
+    {
+        vccrypt_hash_options_t options;
+        vccrypt_hash_context_t ctx;
+        vccrypt_buffer_t md;
+        vector<uint8_t> out(VCCRYPT_HASH_SHA_512_DIGEST_SIZE);
+        int retval = 0;
+
+        if (0 != vccrypt_hash_options_init(&options, &alloc_opts, algorithm))
+            return vector<uint8_t>();
+        if (0 != vccrypt_buffer_init(&md, &alloc_opts, options.hash_size))
+            return vector<uint8_t>();
+        if (0 != vccrypt_hash_init(&options, &ctx))
+            return vector<uint8_t>();
+
+        for (size_t off = 0; 0 == retval && off < size; off += piece)
+        {
+            size_t len = (size - off < piece) ? size - off : piece;
+            retval = vccrypt_hash_digest(&ctx, input.data() + off, len);
+        }
+
+        if (0 == retval && 0 == vccrypt_hash_finalize(&ctx, &md))
+        {
+            memcpy(out.data(), md.data, out.size());
+        }
+
+        dispose((disposable_t*)&ctx);
+        dispose((disposable_t*)&md);
+        dispose((disposable_t*)&options);
+
+        return out;
+    }
+
+    allocator_options_t alloc_opts;
+    vector<uint8_t> input;
+};
+
+TEST_SUITE(vccrypt_hash_tree_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccrypt_hash_tree_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Every chunk size and fan-out is registered under its own selector.
+ */
+BEGIN_TEST_F(options)
+    const uint32_t chunks[] = {
+        VCCRYPT_HASH_TREE_CHUNK_64K, VCCRYPT_HASH_TREE_CHUNK_256K,
+        VCCRYPT_HASH_TREE_CHUNK_1M, VCCRYPT_HASH_TREE_CHUNK_4M };
+    const size_t chunk_sizes[] = {
+        64 * 1024, 256 * 1024, 1024 * 1024, 4 * 1024 * 1024 };
+    const uint32_t fanouts[] = {
+        VCCRYPT_HASH_TREE_FANOUT_2, VCCRYPT_HASH_TREE_FANOUT_4,
+        VCCRYPT_HASH_TREE_FANOUT_8, VCCRYPT_HASH_TREE_FANOUT_16 };
+
+    for (size_t c = 0; c < 4; ++c)
+    {
+        for (size_t f = 0; f < 4; ++f)
+        {
+            vccrypt_hash_options_t options;
+
+            TEST_ASSERT(
+                0 == vccrypt_hash_options_init(
+                        &options, &fixture.alloc_opts,
+                        VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE(
+                            chunks[c], fanouts[f])));
+            TEST_EXPECT(VCCRYPT_HASH_SHA_512_DIGEST_SIZE == options.hash_size);
+            TEST_EXPECT(chunk_sizes[c] == options.hash_block_size);
+
+            dispose((disposable_t*)&options);
+        }
+    }
+END_TEST_F()
+
+/**
+ * The tree hash matches a level by level computation of the tree for inputs
+ * around the chunk boundaries and across parallel batches.
+ */
+BEGIN_TEST_F(matches_reference)
+    const size_t sizes[] = {
+        0, 1, CHUNK_64K - 1, CHUNK_64K, CHUNK_64K + 1, 5 * CHUNK_64K + 7,
+        16 * CHUNK_64K, 17 * CHUNK_64K, 70 * CHUNK_64K + 7 };
+    const uint32_t fanouts[] = {
+        VCCRYPT_HASH_TREE_FANOUT_2, VCCRYPT_HASH_TREE_FANOUT_4,
+        VCCRYPT_HASH_TREE_FANOUT_16 };
+    const size_t fanout_sizes[] = { 2, 4, 16 };
+
+    for (size_t f = 0; f < 3; ++f)
+    {
+        uint32_t algorithm =
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE(
+                VCCRYPT_HASH_TREE_CHUNK_64K, fanouts[f]);
+
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+        {
+            vector<uint8_t> expected =
+                fixture.reference(sizes[s], CHUNK_64K, fanout_sizes[f]);
+
+            TEST_ASSERT(expected.size() == VCCRYPT_HASH_SHA_512_DIGEST_SIZE);
+            TEST_EXPECT(
+                expected
+                    == fixture.tree(
+                            algorithm, sizes[s], fixture.input.size()));
+        }
+    }
+END_TEST_F()
+
+/**
+ * Splitting the input across digest calls does not change the tree hash.
+ */
+BEGIN_TEST_F(streaming)
+    uint32_t algorithm =
+        VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE(
+            VCCRYPT_HASH_TREE_CHUNK_64K, VCCRYPT_HASH_TREE_FANOUT_4);
+    size_t size = 70 * CHUNK_64K + 7;
+    vector<uint8_t> expected = fixture.tree(algorithm, size, size);
+    const size_t pieces[] = {
+        1000, CHUNK_64K - 1, CHUNK_64K, 3 * CHUNK_64K + 5 };
+
+    for (size_t p = 0; p < sizeof(pieces) / sizeof(pieces[0]); ++p)
+    {
+        TEST_EXPECT(expected == fixture.tree(algorithm, size, pieces[p]));
+    }
+END_TEST_F()
+
+/**
+ * The tree hash differs from plain SHA-512 and between parameter sets.
+ */
+BEGIN_TEST_F(domain_separation)
+    vector<uint8_t> a =
+        fixture.tree(
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE(
+                VCCRYPT_HASH_TREE_CHUNK_64K, VCCRYPT_HASH_TREE_FANOUT_2),
+            100, 100);
+    vector<uint8_t> b =
+        fixture.tree(
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE(
+                VCCRYPT_HASH_TREE_CHUNK_64K, VCCRYPT_HASH_TREE_FANOUT_4),
+            100, 100);
+    vector<uint8_t> c =
+        fixture.tree(
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512_TREE(
+                VCCRYPT_HASH_TREE_CHUNK_1M, VCCRYPT_HASH_TREE_FANOUT_2),
+            100, 100);
+    vector<uint8_t> plain =
+        fixture.tree(VCCRYPT_HASH_ALGORITHM_SHA_2_512, 100, 100);
+
+    TEST_ASSERT(a.size() == VCCRYPT_HASH_SHA_512_DIGEST_SIZE);
+    TEST_EXPECT(a != b);
+    TEST_EXPECT(a != c);
+    TEST_EXPECT(b != c);
+    TEST_EXPECT(a != plain);
+END_TEST_F()
@@ -0,0 +1,335 @@
+/**
+ * \file test_vccrypt_sha256_ref.cpp
+ *
+ * Unit tests for the reference SHA-256 implementation.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/hash.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../../src/hash/ref/sha256.h"
+
+class vccrypt_sha256_ref_test {
+public:
+    void setUp()
+    {
+        //make sure SHA-256 has been registered
+        vccrypt_hash_register_SHA_2_256();
+
+        malloc_allocator_options_init(&alloc_opts);
+    }
+
+    void tearDown()
+    {
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    allocator_options_t alloc_opts;
+};
+
+TEST_SUITE(vccrypt_sha256_ref_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccrypt_sha256_ref_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * We should be able to get SHA-256 options if it has been registered.
+ */
+BEGIN_TEST_F(init)
+    vccrypt_hash_options_t options;
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_256));
+    TEST_ASSERT(VCCRYPT_HASH_SHA_256_DIGEST_SIZE == options.hash_size);
+    TEST_ASSERT(VCCRYPT_HASH_SHA_256_BLOCK_SIZE == options.hash_block_size);
+
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+/**
+ * We should be able to hash an empty buffer.
+ */
+BEGIN_TEST_F(hash_empty)
+    const char EXPECTED_HASH[] =
+        "\xe3\xb0\xc4\x42\x98\xfc\x1c\x14\x9a\xfb\xf4\xc8\x99\x6f\xb9\x24"
+        "\x27\xae\x41\xe4\x64\x9b\x93\x4c\xa4\x95\x99\x1b\x78\x52\xb8\x55";
+    vccrypt_hash_options_t options;
+    vccrypt_hash_context_t context;
+    vccrypt_buffer_t md;
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_256));
+
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(&md, &fixture.alloc_opts, options.hash_size));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_init(&options, &context));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_finalize(&context, &md));
+
+    TEST_ASSERT(0 == memcmp(md.data, EXPECTED_HASH, 32));
+
+    dispose((disposable_t*)&context);
+    dispose((disposable_t*)&md);
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+/**
+ * We should be able to hash the FIPS 180-4 one block message "abc".
+ */
+BEGIN_TEST_F(hash_abc)
+    const char INPUT[] =
+        "\x61\x62\x63";
+    const char EXPECTED_HASH[] =
+        "\xba\x78\x16\xbf\x8f\x01\xcf\xea\x41\x41\x40\xde\x5d\xae\x22\x23"
+        "\xb0\x03\x61\xa3\x96\x17\x7a\x9c\xb4\x10\xff\x61\xf2\x00\x15\xad";
+    vccrypt_hash_options_t options;
+    vccrypt_hash_context_t context;
+    vccrypt_buffer_t md;
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_256));
+
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(&md, &fixture.alloc_opts, options.hash_size));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_init(&options, &context));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_digest(
+            &context, (const uint8_t*)INPUT, sizeof(INPUT) - 1));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_finalize(&context, &md));
+
+    TEST_ASSERT(0 == memcmp(md.data, EXPECTED_HASH, 32));
+
+    dispose((disposable_t*)&context);
+    dispose((disposable_t*)&md);
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+/**
+ * We should be able to hash the FIPS 180-4 two block message.
+ */
+BEGIN_TEST_F(hash_448)
+    const char INPUT[] =
+        "\x61\x62\x63\x64\x62\x63\x64\x65\x63\x64\x65\x66\x64\x65\x66\x67"
+        "\x65\x66\x67\x68\x66\x67\x68\x69\x67\x68\x69\x6a\x68\x69\x6a\x6b"
+        "\x69\x6a\x6b\x6c\x6a\x6b\x6c\x6d\x6b\x6c\x6d\x6e\x6c\x6d\x6e\x6f"
+        "\x6d\x6e\x6f\x70\x6e\x6f\x70\x71";
+    const char EXPECTED_HASH[] =
+        "\x24\x8d\x6a\x61\xd2\x06\x38\xb8\xe5\xc0\x26\x93\x0c\x3e\x60\x39"
+        "\xa3\x3c\xe4\x59\x64\xff\x21\x67\xf6\xec\xed\xd4\x19\xdb\x06\xc1";
+    vccrypt_hash_options_t options;
+    vccrypt_hash_context_t context;
+    vccrypt_buffer_t md;
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_256));
+
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(&md, &fixture.alloc_opts, options.hash_size));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_init(&options, &context));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_digest(
+            &context, (const uint8_t*)INPUT, sizeof(INPUT) - 1));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_finalize(&context, &md));
+
+    TEST_ASSERT(0 == memcmp(md.data, EXPECTED_HASH, 32));
+
+    dispose((disposable_t*)&context);
+    dispose((disposable_t*)&md);
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+/**
+ * A 55 byte message is the longest that pads into a single block.
+ */
+BEGIN_TEST_F(hash_55)
+    const char INPUT[] =
+        "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f"
+        "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+        "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f"
+        "\x60\x61\x62\x63\x64\x65\x66";
+    const char EXPECTED_HASH[] =
+        "\x82\xea\x60\xb9\x04\xf2\x21\xae\xe6\x87\xa3\xfb\xf1\xc1\x6e\x07"
+        "\xb9\x5c\xc4\xa6\x6a\x53\x96\xfb\xba\x94\xd5\xc0\xc3\x9a\x77\x41";
+    vccrypt_hash_options_t options;
+    vccrypt_hash_context_t context;
+    vccrypt_buffer_t md;
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_256));
+
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(&md, &fixture.alloc_opts, options.hash_size));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_init(&options, &context));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_digest(
+            &context, (const uint8_t*)INPUT, sizeof(INPUT) - 1));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_finalize(&context, &md));
+
+    TEST_ASSERT(0 == memcmp(md.data, EXPECTED_HASH, 32));
+
+    dispose((disposable_t*)&context);
+    dispose((disposable_t*)&md);
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+/**
+ * A 56 byte message forces the length into an extra padding block.
+ */
+BEGIN_TEST_F(hash_56)
+    const char INPUT[] =
+        "\x30\x31\x32\x33\x34\x35\x36\x37\x38\x39\x3a\x3b\x3c\x3d\x3e\x3f"
+        "\x40\x41\x42\x43\x44\x45\x46\x47\x48\x49\x4a\x4b\x4c\x4d\x4e\x4f"
+        "\x50\x51\x52\x53\x54\x55\x56\x57\x58\x59\x5a\x5b\x5c\x5d\x5e\x5f"
+        "\x60\x61\x62\x63\x64\x65\x66\x67";
+    const char EXPECTED_HASH[] =
+        "\xe3\xbd\xd5\x4a\xee\x96\x29\x6d\x60\x2f\x4b\x1b\x4e\x10\x5c\x2f"
+        "\x22\x39\xd3\x82\x6e\xc7\x71\xfd\x0e\x10\x0b\x8f\xca\x82\xc3\x6e";
+    vccrypt_hash_options_t options;
+    vccrypt_hash_context_t context;
+    vccrypt_buffer_t md;
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_256));
+
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(&md, &fixture.alloc_opts, options.hash_size));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_init(&options, &context));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_digest(
+            &context, (const uint8_t*)INPUT, sizeof(INPUT) - 1));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_finalize(&context, &md));
+
+    TEST_ASSERT(0 == memcmp(md.data, EXPECTED_HASH, 32));
+
+    dispose((disposable_t*)&context);
+    dispose((disposable_t*)&md);
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+/**
+ * We should be able to hash one million 'a' characters, fed in uneven pieces
+ * so that both buffered and bulk multi-block compression are exercised.
+ */
+BEGIN_TEST_F(hash_million_a)
+    const char EXPECTED_HASH[] =
+        "\xcd\xc7\x6e\x5c\x99\x14\xfb\x92\x81\xa1\xc7\xe2\x84\xd7\x3e\x67"
+        "\xf1\x80\x9a\x48\xa4\x97\x20\x0e\x04\x6d\x39\xcc\xc7\x11\x2c\xd0";
+    const size_t SIZE = 1000000;
+    static uint8_t input[1000000];
+    vccrypt_hash_options_t options;
+    vccrypt_hash_context_t context;
+    vccrypt_buffer_t md;
+    size_t offset = 0, chunk = 1;
+
+    memset(input, 'a', SIZE);
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_256));
+
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(&md, &fixture.alloc_opts, options.hash_size));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_init(&options, &context));
+
+    while (offset < SIZE)
+    {
+        size_t size = chunk < SIZE - offset ? chunk : SIZE - offset;
+
+        TEST_ASSERT(0 ==
+            vccrypt_hash_digest(&context, input + offset, size));
+
+        offset += size;
+        chunk = chunk * 3 + 1;
+    }
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_finalize(&context, &md));
+
+    TEST_ASSERT(0 == memcmp(md.data, EXPECTED_HASH, 32));
+
+    dispose((disposable_t*)&context);
+    dispose((disposable_t*)&md);
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+/**
+ * When the CPU supports the SHA extensions, the SHA-NI compression function
+ * should agree with the FIPS 180-4 two block vector.
+ */
+BEGIN_TEST_F(shani_kernel)
+#ifdef SHA256_SHANI_SUPPORTED
+    const char PADDED[] =
+        "\x61\x62\x63\x64\x62\x63\x64\x65\x63\x64\x65\x66\x64\x65\x66\x67"
+        "\x65\x66\x67\x68\x66\x67\x68\x69\x67\x68\x69\x6a\x68\x69\x6a\x6b"
+        "\x69\x6a\x6b\x6c\x6a\x6b\x6c\x6d\x6b\x6c\x6d\x6e\x6c\x6d\x6e\x6f"
+        "\x6d\x6e\x6f\x70\x6e\x6f\x70\x71\x80\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01\xc0";
+    const char EXPECTED_HASH[] =
+        "\x24\x8d\x6a\x61\xd2\x06\x38\xb8\xe5\xc0\x26\x93\x0c\x3e\x60\x39"
+        "\xa3\x3c\xe4\x59\x64\xff\x21\x67\xf6\xec\xed\xd4\x19\xdb\x06\xc1";
+    uint32_t h[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    uint8_t md[32];
+
+    if (SHA256_shani_available())
+    {
+        SHA256_shani_block_data_order(h, PADDED, 2);
+
+        for (int i = 0; i < 8; ++i)
+        {
+            md[4 * i + 0] = (uint8_t)(h[i] >> 24);
+            md[4 * i + 1] = (uint8_t)(h[i] >> 16);
+            md[4 * i + 2] = (uint8_t)(h[i] >> 8);
+            md[4 * i + 3] = (uint8_t)(h[i]);
+        }
+
+        TEST_ASSERT(0 == memcmp(md, EXPECTED_HASH, 32));
+    }
+#endif
+END_TEST_F()
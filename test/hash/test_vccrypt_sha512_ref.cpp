@@ -5416,3 +5416,53 @@ BEGIN_TEST_F(hash_128)
     dispose((disposable_t*)&md);
     dispose((disposable_t*)&options);
 END_TEST_F()
+
+/**
+ * We should be able to hash one million 'a' characters, fed in uneven pieces
+ * so that both buffered and bulk multi-block compression are exercised.
+ */
+BEGIN_TEST_F(hash_million_a)
+    const char EXPECTED_HASH[] =
+        "\xe7\x18\x48\x3d\x0c\xe7\x69\x64\x4e\x2e\x42\xc7\xbc\x15\xb4\x63"
+        "\x8e\x1f\x98\xb1\x3b\x20\x44\x28\x56\x32\xa8\x03\xaf\xa9\x73\xeb"
+        "\xde\x0f\xf2\x44\x87\x7e\xa6\x0a\x4c\xb0\x43\x2c\xe5\x77\xc3\x1b"
+        "\xeb\x00\x9c\x5c\x2c\x49\xaa\x2e\x4e\xad\xb2\x17\xad\x8c\xc0\x9b";
+    const size_t SIZE = 1000000;
+    static uint8_t input[1000000];
+    vccrypt_hash_options_t options;
+    vccrypt_hash_context_t context;
+    vccrypt_buffer_t md;
+    size_t offset = 0, chunk = 1;
+
+    memset(input, 'a', SIZE);
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_HASH_ALGORITHM_SHA_2_512));
+
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(&md, &fixture.alloc_opts, options.hash_size));
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_init(&options, &context));
+
+    while (offset < SIZE)
+    {
+        size_t size = chunk < SIZE - offset ? chunk : SIZE - offset;
+
+        TEST_ASSERT(0 ==
+            vccrypt_hash_digest(&context, input + offset, size));
+
+        offset += size;
+        chunk = chunk * 3 + 1;
+    }
+
+    TEST_ASSERT(0 ==
+        vccrypt_hash_finalize(&context, &md));
+
+    TEST_ASSERT(0 == memcmp(md.data, EXPECTED_HASH, 64));
+
+    dispose((disposable_t*)&context);
+    dispose((disposable_t*)&md);
+    dispose((disposable_t*)&options);
+END_TEST_F()
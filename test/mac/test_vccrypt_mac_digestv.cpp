@@ -0,0 +1,167 @@
+/**
+ * \file test_vccrypt_mac_digestv.cpp
+ *
+ * Unit tests for vectored MAC digests.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/mac.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+class vccrypt_mac_digestv_test {
+public:
+    void setUp()
+    {
+        vccrypt_mac_register_SHA_2_256_HMAC();
+        vccrypt_mac_register_SHA_2_512_HMAC();
+        vccrypt_mac_register_SHA_2_512_256_HMAC();
+        vccrypt_mac_register_POLY1305();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        for (size_t i = 0; i < sizeof(input); ++i)
+        {
+            input[i] = (uint8_t)(i * 11 + 5);
+        }
+    }
+
+    void tearDown()
+    {
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * MAC input[0, size) in one call or in the given segments.
+     */
+    int mac(
+        vccrypt_mac_options_t* options, const vccrypt_segment_t* segments,
+        size_t count, size_t size, vccrypt_buffer_t* out)
+    {
+        vccrypt_mac_context_t ctx;
+        vccrypt_buffer_t key;
+        int retval;
+
+        retval = vccrypt_buffer_init(&key, &alloc_opts, options->key_size);
+        if (0 != retval)
+            return retval;
+        memset(key.data, 0x42, key.size);
+
+        retval = vccrypt_mac_init(options, &ctx, &key);
+        if (0 != retval)
+            goto dispose_key;
+
+        if (NULL == segments)
+            retval = vccrypt_mac_digest(&ctx, input, size);
+        else
+            retval = vccrypt_mac_digestv(&ctx, segments, count);
+        if (0 != retval)
+            goto dispose_ctx;
+
+        retval = vccrypt_mac_finalize(&ctx, out);
+
+    dispose_ctx:
+        dispose((disposable_t*)&ctx);
+
+    dispose_key:
+        dispose((disposable_t*)&key);
+
+        return retval;
+    }
+
+    allocator_options_t alloc_opts;
+    uint8_t input[1024];
+};
+
+TEST_SUITE(vccrypt_mac_digestv_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccrypt_mac_digestv_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Segmented input produces the same MAC as contiguous input.
+ */
+BEGIN_TEST_F(matches_contiguous)
+    const uint32_t ALGORITHMS[] = {
+        VCCRYPT_MAC_ALGORITHM_SHA_2_256_HMAC,
+        VCCRYPT_MAC_ALGORITHM_SHA_2_512_HMAC,
+        VCCRYPT_MAC_ALGORITHM_SHA_2_512_256_HMAC,
+        VCCRYPT_MAC_ALGORITHM_POLY1305,
+    };
+    const size_t SIZES[] = { 5, 0, 16, 17, 127, 1, 200, 64, 3, 500 };
+    vccrypt_segment_t segments[10];
+    size_t offset = 0;
+
+    for (size_t i = 0; i < 10; ++i)
+    {
+        segments[i].data = 0 == SIZES[i] ? NULL : fixture.input + offset;
+        segments[i].size = SIZES[i];
+        offset += SIZES[i];
+    }
+
+    for (uint32_t alg : ALGORITHMS)
+    {
+        vccrypt_mac_options_t options;
+        vccrypt_buffer_t expected, actual;
+
+        TEST_ASSERT(0 ==
+            vccrypt_mac_options_init(&options, &fixture.alloc_opts, alg));
+        TEST_ASSERT(0 ==
+            vccrypt_buffer_init(
+                &expected, &fixture.alloc_opts, options.mac_size));
+        TEST_ASSERT(0 ==
+            vccrypt_buffer_init(
+                &actual, &fixture.alloc_opts, options.mac_size));
+
+        TEST_ASSERT(0 ==
+            fixture.mac(&options, NULL, 0, offset, &expected));
+        TEST_ASSERT(0 ==
+            fixture.mac(&options, segments, 10, offset, &actual));
+        TEST_EXPECT(0 == memcmp(expected.data, actual.data, expected.size));
+
+        dispose((disposable_t*)&actual);
+        dispose((disposable_t*)&expected);
+        dispose((disposable_t*)&options);
+    }
+END_TEST_F()
+
+/**
+ * Invalid arguments and segments are rejected.
+ */
+BEGIN_TEST_F(invalid_args)
+    vccrypt_mac_options_t options;
+    vccrypt_mac_context_t ctx;
+    vccrypt_buffer_t key;
+    vccrypt_segment_t segments[2] = {
+        { fixture.input, 10 },
+        { NULL, 1 } };
+
+    TEST_ASSERT(0 ==
+        vccrypt_mac_options_init(&options, &fixture.alloc_opts,
+            VCCRYPT_MAC_ALGORITHM_SHA_2_512_HMAC));
+    TEST_ASSERT(0 ==
+        vccrypt_buffer_init(&key, &fixture.alloc_opts, options.key_size));
+    memset(key.data, 0, key.size);
+    TEST_ASSERT(0 == vccrypt_mac_init(&options, &ctx, &key));
+
+    TEST_EXPECT(VCCRYPT_ERROR_MAC_DIGESTV_INVALID_ARG ==
+        vccrypt_mac_digestv(NULL, segments, 1));
+    TEST_EXPECT(VCCRYPT_ERROR_MAC_DIGESTV_INVALID_ARG ==
+        vccrypt_mac_digestv(&ctx, NULL, 1));
+    TEST_EXPECT(VCCRYPT_ERROR_MAC_DIGESTV_INVALID_ARG ==
+        vccrypt_mac_digestv(&ctx, segments, 2));
+    TEST_EXPECT(0 == vccrypt_mac_digestv(&ctx, NULL, 0));
+
+    dispose((disposable_t*)&ctx);
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&options);
+END_TEST_F()
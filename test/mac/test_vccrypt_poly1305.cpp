@@ -0,0 +1,124 @@
+/**
+ * \file test_vccrypt_poly1305.cpp
+ *
+ * Unit tests for the Poly1305 MAC.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/mac.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+class vccrypt_poly1305_test {
+public:
+    void setUp()
+    {
+        vccrypt_mac_register_POLY1305();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        options_init_result =
+            vccrypt_mac_options_init(
+                &options, &alloc_opts, VCCRYPT_MAC_ALGORITHM_POLY1305);
+    }
+
+    void tearDown()
+    {
+        if (0 == options_init_result)
+            dispose((disposable_t*)&options);
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    int options_init_result;
+    vccrypt_mac_options_t options;
+    allocator_options_t alloc_opts;
+};
+
+TEST_SUITE(vccrypt_poly1305_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccrypt_poly1305_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Poly1305 should have been successfully initialized.
+ */
+BEGIN_TEST_F(options_init)
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_EXPECT(32U == fixture.options.key_size);
+    TEST_EXPECT(16U == fixture.options.mac_size);
+    TEST_EXPECT(!fixture.options.key_expansion_supported);
+END_TEST_F()
+
+/**
+ * RFC 8439 section 2.5.2, digested in pieces that split the 16 byte blocks.
+ * The one-time key cannot be used again after finalize.
+ */
+BEGIN_TEST_F(rfc8439_2_5_2)
+    const uint8_t KEY[32] = {
+        0x85, 0xd6, 0xbe, 0x78, 0x57, 0x55, 0x6d, 0x33,
+        0x7f, 0x44, 0x52, 0xfe, 0x42, 0xd5, 0x06, 0xa8,
+        0x01, 0x03, 0x80, 0x8a, 0xfb, 0x0d, 0xb2, 0xfd,
+        0x4a, 0xbf, 0xf6, 0xaf, 0x41, 0x49, 0xf5, 0x1b
+    };
+    const char MESSAGE[] = "Cryptographic Forum Research Group";
+    const uint8_t EXPECTED[16] = {
+        0xa8, 0x06, 0x1d, 0xc1, 0x30, 0x51, 0x36, 0xc6,
+        0xc2, 0x2b, 0x8b, 0xaf, 0x0c, 0x01, 0x27, 0xa9
+    };
+    vccrypt_mac_context_t context;
+    vccrypt_buffer_t key, mac;
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, 32));
+    TEST_ASSERT(0 == vccrypt_buffer_init(&mac, &fixture.alloc_opts, 16));
+    memcpy(key.data, KEY, sizeof(KEY));
+
+    TEST_ASSERT(0 == vccrypt_mac_init(&fixture.options, &context, &key));
+    TEST_ASSERT(
+        0 == vccrypt_mac_digest(&context, (const uint8_t*)MESSAGE, 5));
+    TEST_ASSERT(
+        0 == vccrypt_mac_digest(&context, (const uint8_t*)MESSAGE + 5, 20));
+    TEST_ASSERT(
+        0 == vccrypt_mac_digest(&context, (const uint8_t*)MESSAGE + 25, 9));
+    TEST_ASSERT(0 == vccrypt_mac_finalize(&context, &mac));
+    TEST_EXPECT(0 == memcmp(EXPECTED, mac.data, sizeof(EXPECTED)));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MAC_DIGEST_INVALID_ARG
+            == vccrypt_mac_digest(&context, (const uint8_t*)MESSAGE, 1));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MAC_FINALIZE_INVALID_ARG
+            == vccrypt_mac_finalize(&context, &mac));
+
+    dispose((disposable_t*)&context);
+    dispose((disposable_t*)&mac);
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * Poly1305 keys are exactly 32 bytes; there is no key expansion.
+ */
+BEGIN_TEST_F(bad_key_size)
+    vccrypt_mac_context_t context;
+    vccrypt_buffer_t key;
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, 16));
+    memset(key.data, 0, key.size);
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MAC_INIT_INVALID_KEY_MAC
+            == vccrypt_mac_init(&fixture.options, &context, &key));
+
+    dispose((disposable_t*)&key);
+END_TEST_F()
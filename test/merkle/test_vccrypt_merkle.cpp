@@ -0,0 +1,400 @@
+/**
+ * \file test_vccrypt_merkle.cpp
+ *
+ * Unit tests for incremental Merkle trees and inclusion proofs.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/merkle.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+using namespace std;
+
+class vccrypt_merkle_test {
+public:
+    void setUp()
+    {
+        vccrypt_hash_register_SHA_2_256();
+        vccrypt_hash_register_SHA_2_512();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        /* leaves of varying length, including empty ones. */
+        for (size_t i = 0; i < 200; ++i)
+        {
+            vector<uint8_t> leaf((i * 37) % 300);
+            for (size_t j = 0; j < leaf.size(); ++j)
+            {
+                leaf[j] = (uint8_t)(i * 7 + j * 13);
+            }
+
+            leaves.push_back(leaf);
+        }
+    }
+
+    void tearDown()
+    {
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Hash prefix || a || b with a new hash instance.
+     */
+    vector<uint8_t> hash(
+        vccrypt_hash_options_t* options, int prefix,
+        const vector<uint8_t>& a, const vector<uint8_t>& b)
+    {
+        vccrypt_hash_context_t ctx;
+        vccrypt_buffer_t md;
+        vector<uint8_t> out(options->hash_size);
+        uint8_t p = (uint8_t)prefix;
+
+        if (0 != vccrypt_buffer_init(&md, &alloc_opts, options->hash_size))
+            return vector<uint8_t>();
+        if (0 != vccrypt_hash_init(options, &ctx))
+            return vector<uint8_t>();
+
+        if ((prefix < 0 || 0 == vccrypt_hash_digest(&ctx, &p, 1))
+         && (a.empty() || 0 == vccrypt_hash_digest(&ctx, a.data(), a.size()))
+         && (b.empty() || 0 == vccrypt_hash_digest(&ctx, b.data(), b.size()))
+         && 0 == vccrypt_hash_finalize(&ctx, &md))
+        {
+            memcpy(out.data(), md.data, out.size());
+        }
+
+        dispose((disposable_t*)&ctx);
+        dispose((disposable_t*)&md);
+
+        return out;
+    }
+
+    /**
+     * Compute the root of leaves [start, start + size) as in RFC 9162.
+     */
+    vector<uint8_t> reference(
+        vccrypt_hash_options_t* options, size_t start, size_t size)
+    {
+        size_t split = 1;
+
+        if (0 == size)
+            return hash(options, -1, vector<uint8_t>(), vector<uint8_t>());
+        if (1 == size)
+            return hash(options, 0x00, leaves[start], vector<uint8_t>());
+
+        while (split * 2 < size)
+            split *= 2;
+
+        return
+            hash(
+                options, 0x01, reference(options, start, split),
+                reference(options, start + split, size - split));
+    }
+
+    /**
+     * Read the root of a tree.
+     */
+    vector<uint8_t> root(vccrypt_merkle_tree_t* tree)
+    {
+        vccrypt_buffer_t md;
+        vector<uint8_t> out(tree->hash_options->hash_size);
+
+        if (0 != vccrypt_buffer_init(&md, &alloc_opts, out.size()))
+            return vector<uint8_t>();
+
+        if (0 == vccrypt_merkle_root(tree, &md))
+            memcpy(out.data(), md.data, out.size());
+
+        dispose((disposable_t*)&md);
+
+        return out;
+    }
+
+    /**
+     * Verify a proof for leaf index against a tree of the given size.
+     */
+    int verify(
+        vccrypt_hash_options_t* options, size_t index, size_t tree_size,
+        const vector<uint8_t>& leaf, const vccrypt_buffer_t* proof,
+        const vector<uint8_t>& expected_root)
+    {
+        vccrypt_buffer_t md;
+        int retval;
+
+        retval = vccrypt_buffer_init(&md, &alloc_opts, expected_root.size());
+        if (0 != retval)
+            return retval;
+
+        memcpy(md.data, expected_root.data(), expected_root.size());
+        retval =
+            vccrypt_merkle_verify(
+                options, index, tree_size, leaf.data(), leaf.size(), proof,
+                &md);
+
+        dispose((disposable_t*)&md);
+
+        return retval;
+    }
+
+    allocator_options_t alloc_opts;
+    vector<vector<uint8_t>> leaves;
+};
+
+TEST_SUITE(vccrypt_merkle_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccrypt_merkle_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+static const uint32_t ALGORITHMS[] = {
+    VCCRYPT_HASH_ALGORITHM_SHA_2_256,
+    VCCRYPT_HASH_ALGORITHM_SHA_2_512,
+};
+
+/**
+ * The root after each single append matches the RFC 9162 root of the leaves
+ * so far, with and without retained nodes.
+ */
+BEGIN_TEST_F(append_matches_reference)
+    for (uint32_t algorithm : ALGORITHMS)
+    {
+        vccrypt_hash_options_t options;
+        vccrypt_merkle_tree_t frontier;
+        vccrypt_merkle_tree_t retained;
+
+        TEST_ASSERT(
+            0 == vccrypt_hash_options_init(
+                    &options, &fixture.alloc_opts, algorithm));
+        TEST_ASSERT(0 == vccrypt_merkle_init(&frontier, &options, false));
+        TEST_ASSERT(0 == vccrypt_merkle_init(&retained, &options, true));
+
+        TEST_EXPECT(
+            fixture.reference(&options, 0, 0) == fixture.root(&frontier));
+
+        for (size_t n = 1; n <= 70; ++n)
+        {
+            const vector<uint8_t>& leaf = fixture.leaves[n - 1];
+
+            TEST_ASSERT(
+                0 == vccrypt_merkle_append(
+                        &frontier, leaf.data(), leaf.size()));
+            TEST_ASSERT(
+                0 == vccrypt_merkle_append(
+                        &retained, leaf.data(), leaf.size()));
+
+            vector<uint8_t> expected = fixture.reference(&options, 0, n);
+            TEST_EXPECT(n == frontier.size);
+            TEST_EXPECT(expected == fixture.root(&frontier));
+            TEST_EXPECT(expected == fixture.root(&retained));
+        }
+
+        /* only the retaining tree keeps its nodes. */
+        TEST_EXPECT(NULL == frontier.nodes);
+        TEST_EXPECT(2 * 70 - 3 == retained.node_count);
+
+        dispose((disposable_t*)&retained);
+        dispose((disposable_t*)&frontier);
+        dispose((disposable_t*)&options);
+    }
+END_TEST_F()
+
+/**
+ * Appending leaves in batches gives the same tree as appending them one at a
+ * time, including leaves too long to copy into a batch.
+ */
+BEGIN_TEST_F(append_many)
+    vector<uint8_t> big(100 * 1024, 0xA5);
+
+    fixture.leaves[90] = big;
+
+    for (uint32_t algorithm : ALGORITHMS)
+    {
+        vccrypt_hash_options_t options;
+        vccrypt_merkle_tree_t single;
+        vccrypt_merkle_tree_t batched;
+        vector<vccrypt_segment_t> segments;
+
+        TEST_ASSERT(
+            0 == vccrypt_hash_options_init(
+                    &options, &fixture.alloc_opts, algorithm));
+        TEST_ASSERT(0 == vccrypt_merkle_init(&single, &options, true));
+        TEST_ASSERT(0 == vccrypt_merkle_init(&batched, &options, true));
+
+        for (const vector<uint8_t>& leaf : fixture.leaves)
+        {
+            TEST_ASSERT(
+                0 == vccrypt_merkle_append(&single, leaf.data(), leaf.size()));
+            segments.push_back({ leaf.data(), leaf.size() });
+        }
+
+        /* split the leaves across calls to vary the batch boundaries. */
+        TEST_ASSERT(
+            0 == vccrypt_merkle_append_many(&batched, segments.data(), 3));
+        TEST_ASSERT(
+            0 == vccrypt_merkle_append_many(&batched, NULL, 0));
+        TEST_ASSERT(
+            0 == vccrypt_merkle_append_many(
+                    &batched, segments.data() + 3, segments.size() - 3));
+
+        TEST_EXPECT(single.size == batched.size);
+        TEST_EXPECT(single.node_count == batched.node_count);
+        TEST_EXPECT(
+            0 == memcmp(
+                    single.nodes, batched.nodes,
+                    single.node_count * options.hash_size));
+        TEST_EXPECT(fixture.root(&single) == fixture.root(&batched));
+        TEST_EXPECT(
+            fixture.reference(&options, 0, fixture.leaves.size())
+                == fixture.root(&batched));
+
+        dispose((disposable_t*)&batched);
+        dispose((disposable_t*)&single);
+        dispose((disposable_t*)&options);
+    }
+END_TEST_F()
+
+/**
+ * Every leaf of trees of various sizes has a proof that verifies against the
+ * root, and fails against a different leaf, index, or root, or a damaged
+ * proof.
+ */
+BEGIN_TEST_F(proofs)
+    const size_t sizes[] = { 1, 2, 3, 4, 5, 7, 8, 13, 64, 70 };
+    vccrypt_hash_options_t options;
+
+    TEST_ASSERT(
+        0 == vccrypt_hash_options_init(
+                &options, &fixture.alloc_opts,
+                VCCRYPT_HASH_ALGORITHM_SHA_2_256));
+
+    for (size_t n : sizes)
+    {
+        vccrypt_merkle_tree_t tree;
+        vector<uint8_t> expected = fixture.reference(&options, 0, n);
+        vector<uint8_t> wrong_root = fixture.reference(&options, 1, n - 1);
+
+        TEST_ASSERT(0 == vccrypt_merkle_init(&tree, &options, true));
+        for (size_t i = 0; i < n; ++i)
+        {
+            TEST_ASSERT(
+                0 == vccrypt_merkle_append(
+                        &tree, fixture.leaves[i].data(),
+                        fixture.leaves[i].size()));
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            vccrypt_buffer_t proof;
+            const vector<uint8_t>& leaf = fixture.leaves[i];
+
+            TEST_ASSERT(0 == vccrypt_merkle_proof(&tree, i, &proof));
+            TEST_EXPECT(0 == proof.size % options.hash_size);
+
+            TEST_EXPECT(
+                0 == fixture.verify(&options, i, n, leaf, &proof, expected));
+            TEST_EXPECT(
+                VCCRYPT_ERROR_MERKLE_VERIFY_FAILED
+                    == fixture.verify(
+                            &options, i, n, fixture.leaves[150], &proof,
+                            expected));
+            TEST_EXPECT(
+                VCCRYPT_ERROR_MERKLE_VERIFY_FAILED
+                    == fixture.verify(
+                            &options, i, n, leaf, &proof, wrong_root));
+            TEST_EXPECT(
+                VCCRYPT_ERROR_MERKLE_VERIFY_FAILED
+                    == fixture.verify(&options, n, n, leaf, &proof, expected));
+            if (n > 1)
+            {
+                TEST_EXPECT(
+                    VCCRYPT_ERROR_MERKLE_VERIFY_FAILED
+                        == fixture.verify(
+                                &options, i ^ 1, n, leaf, &proof, expected));
+
+                /* drop the last sibling. */
+                proof.size -= options.hash_size;
+                TEST_EXPECT(
+                    VCCRYPT_ERROR_MERKLE_VERIFY_FAILED
+                        == fixture.verify(
+                                &options, i, n, leaf, &proof, expected));
+                proof.size += options.hash_size;
+
+                /* flip a bit in the last sibling. */
+                ((uint8_t*)proof.data)[proof.size - 1] ^= 1;
+                TEST_EXPECT(
+                    VCCRYPT_ERROR_MERKLE_VERIFY_FAILED
+                        == fixture.verify(
+                                &options, i, n, leaf, &proof, expected));
+            }
+
+            dispose((disposable_t*)&proof);
+        }
+
+        dispose((disposable_t*)&tree);
+    }
+
+    dispose((disposable_t*)&options);
+END_TEST_F()
+
+/**
+ * Invalid arguments are rejected, and a tree without retained nodes cannot
+ * produce proofs.
+ */
+BEGIN_TEST_F(invalid_args)
+    vccrypt_hash_options_t options;
+    vccrypt_merkle_tree_t tree;
+    vccrypt_buffer_t proof;
+    vccrypt_buffer_t md;
+    vccrypt_segment_t bad = { NULL, 1 };
+
+    TEST_ASSERT(
+        0 == vccrypt_hash_options_init(
+                &options, &fixture.alloc_opts,
+                VCCRYPT_HASH_ALGORITHM_SHA_2_512));
+    TEST_ASSERT(0 == vccrypt_buffer_init(&md, &fixture.alloc_opts, 32));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MERKLE_INIT_INVALID_ARG
+            == vccrypt_merkle_init(&tree, NULL, true));
+
+    TEST_ASSERT(0 == vccrypt_merkle_init(&tree, &options, false));
+    TEST_ASSERT(0 == vccrypt_merkle_append(&tree, NULL, 0));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG
+            == vccrypt_merkle_append(&tree, NULL, 1));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MERKLE_APPEND_INVALID_ARG
+            == vccrypt_merkle_append_many(&tree, &bad, 1));
+    TEST_EXPECT(1 == tree.size);
+
+    /* the root buffer is too small for SHA-512. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MERKLE_ROOT_INVALID_ARG
+            == vccrypt_merkle_root(&tree, &md));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MERKLE_PROOF_UNSUPPORTED
+            == vccrypt_merkle_proof(&tree, 0, &proof));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MERKLE_PROOF_INVALID_ARG
+            == vccrypt_merkle_proof(&tree, 1, &proof));
+
+    /* a proof must be a whole number of hashes. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MERKLE_VERIFY_INVALID_ARG
+            == vccrypt_merkle_verify(&options, 0, 1, NULL, 0, &md, &md));
+
+    dispose((disposable_t*)&tree);
+    dispose((disposable_t*)&md);
+    dispose((disposable_t*)&options);
+END_TEST_F()
@@ -7,6 +7,7 @@
  */
 
 #include <minunit/minunit.h>
+#include <string.h>
 
 #include "../../src/stream_cipher/aes/aes.h"
 
@@ -53,20 +54,29 @@ TEST(AES_256_ECB)
 
     AES_KEY test_key;
 
-    /* test encryption AES-256-ECB */
-    TEST_ASSERT(0 == AES_set_encrypt_key(key, 256, 1, &test_key));
-    AES_encrypt(plaintext, test_ciphertext, &test_key);
-    for (int i = 0; i < 16; ++i)
+    /* every supported implementation must produce the same results. */
+    for (int impl = AES_IMPL_PORTABLE; impl <= AES_IMPL_BITSLICE; ++impl)
     {
-        TEST_EXPECT(test_ciphertext[i] == ciphertext[i]);
-    }
+        if (!AES_impl_supported(impl))
+            continue;
 
-    /* test decryption AES-256-ECB */
-    TEST_ASSERT(0 == AES_set_decrypt_key(key, 256, 1, &test_key));
-    AES_decrypt(ciphertext, test_plaintext, &test_key);
-    for (int i = 0; i < 16; ++i)
-    {
-        TEST_EXPECT(test_plaintext[i] == plaintext[i]);
+        /* test encryption AES-256-ECB */
+        TEST_ASSERT(
+            0 == AES_set_encrypt_key_impl(key, 256, 1, impl, &test_key));
+        AES_encrypt(plaintext, test_ciphertext, &test_key);
+        for (int i = 0; i < 16; ++i)
+        {
+            TEST_EXPECT(test_ciphertext[i] == ciphertext[i]);
+        }
+
+        /* test decryption AES-256-ECB */
+        TEST_ASSERT(
+            0 == AES_set_decrypt_key_impl(key, 256, 1, impl, &test_key));
+        AES_decrypt(ciphertext, test_plaintext, &test_key);
+        for (int i = 0; i < 16; ++i)
+        {
+            TEST_EXPECT(test_plaintext[i] == plaintext[i]);
+        }
     }
 }
 
@@ -97,20 +107,29 @@ TEST(AES_256X2_ECB)
 
     AES_KEY test_key;
 
-    /* test encryption AES-256X2-ECB */
-    TEST_ASSERT(0 == AES_set_encrypt_key(key, 256, 2, &test_key));
-    AES_encrypt(plaintext, test_ciphertext, &test_key);
-    for (int i = 0; i < 16; ++i)
+    /* every supported implementation must produce the same results. */
+    for (int impl = AES_IMPL_PORTABLE; impl <= AES_IMPL_BITSLICE; ++impl)
     {
-        TEST_EXPECT(test_ciphertext[i] == ciphertext[i]);
-    }
+        if (!AES_impl_supported(impl))
+            continue;
 
-    /* test decryption AES-256X2-ECB */
-    TEST_ASSERT(0 == AES_set_decrypt_key(key, 256, 2, &test_key));
-    AES_decrypt(ciphertext, test_plaintext, &test_key);
-    for (int i = 0; i < 16; ++i)
-    {
-        TEST_EXPECT(test_plaintext[i] == plaintext[i]);
+        /* test encryption AES-256X2-ECB */
+        TEST_ASSERT(
+            0 == AES_set_encrypt_key_impl(key, 256, 2, impl, &test_key));
+        AES_encrypt(plaintext, test_ciphertext, &test_key);
+        for (int i = 0; i < 16; ++i)
+        {
+            TEST_EXPECT(test_ciphertext[i] == ciphertext[i]);
+        }
+
+        /* test decryption AES-256X2-ECB */
+        TEST_ASSERT(
+            0 == AES_set_decrypt_key_impl(key, 256, 2, impl, &test_key));
+        AES_decrypt(ciphertext, test_plaintext, &test_key);
+        for (int i = 0; i < 16; ++i)
+        {
+            TEST_EXPECT(test_plaintext[i] == plaintext[i]);
+        }
     }
 }
 
@@ -155,20 +174,29 @@ TEST(AES_256X3_ECB)
 
     AES_KEY test_key;
 
-    /* test encryption AES-256X3-ECB */
-    TEST_ASSERT(0 == AES_set_encrypt_key(key, 256, 3, &test_key));
-    AES_encrypt(plaintext, test_ciphertext, &test_key);
-    for (int i = 0; i < 16; ++i)
+    /* every supported implementation must produce the same results. */
+    for (int impl = AES_IMPL_PORTABLE; impl <= AES_IMPL_BITSLICE; ++impl)
     {
-        TEST_EXPECT(test_ciphertext[i] == ciphertext[i]);
-    }
+        if (!AES_impl_supported(impl))
+            continue;
 
-    /* test decryption AES-256X3-ECB */
-    TEST_ASSERT(0 == AES_set_decrypt_key(key, 256, 3, &test_key));
-    AES_decrypt(ciphertext, test_plaintext, &test_key);
-    for (int i = 0; i < 16; ++i)
-    {
-        TEST_EXPECT(test_plaintext[i] == plaintext[i]);
+        /* test encryption AES-256X3-ECB */
+        TEST_ASSERT(
+            0 == AES_set_encrypt_key_impl(key, 256, 3, impl, &test_key));
+        AES_encrypt(plaintext, test_ciphertext, &test_key);
+        for (int i = 0; i < 16; ++i)
+        {
+            TEST_EXPECT(test_ciphertext[i] == ciphertext[i]);
+        }
+
+        /* test decryption AES-256X3-ECB */
+        TEST_ASSERT(
+            0 == AES_set_decrypt_key_impl(key, 256, 3, impl, &test_key));
+        AES_decrypt(ciphertext, test_plaintext, &test_key);
+        for (int i = 0; i < 16; ++i)
+        {
+            TEST_EXPECT(test_plaintext[i] == plaintext[i]);
+        }
     }
 }
 
@@ -213,19 +241,201 @@ TEST(AES_256X4_ECB)
 
     AES_KEY test_key;
 
-    /* test encryption AES-256X4-ECB */
-    TEST_ASSERT(0 == AES_set_encrypt_key(key, 256, 4, &test_key));
-    AES_encrypt(plaintext, test_ciphertext, &test_key);
-    for (int i = 0; i < 16; ++i)
+    /* every supported implementation must produce the same results. */
+    for (int impl = AES_IMPL_PORTABLE; impl <= AES_IMPL_BITSLICE; ++impl)
     {
-        TEST_EXPECT(test_ciphertext[i] == ciphertext[i]);
+        if (!AES_impl_supported(impl))
+            continue;
+
+        /* test encryption AES-256X4-ECB */
+        TEST_ASSERT(
+            0 == AES_set_encrypt_key_impl(key, 256, 4, impl, &test_key));
+        AES_encrypt(plaintext, test_ciphertext, &test_key);
+        for (int i = 0; i < 16; ++i)
+        {
+            TEST_EXPECT(test_ciphertext[i] == ciphertext[i]);
+        }
+
+        /* test decryption AES-256X4-ECB */
+        TEST_ASSERT(
+            0 == AES_set_decrypt_key_impl(key, 256, 4, impl, &test_key));
+        AES_decrypt(ciphertext, test_plaintext, &test_key);
+        for (int i = 0; i < 16; ++i)
+        {
+            TEST_EXPECT(test_plaintext[i] == plaintext[i]);
+        }
     }
+}
+
+/**
+ * Test that the hardware and portable implementations agree for a non-zero key
+ * across every round multiplier.
+ */
+TEST(AES_256_impls_agree)
+{
+    uint8_t key[32];
+    uint8_t block[16];
+    uint8_t portable_out[16];
+    uint8_t impl_out[16];
+    AES_KEY portable_key;
+    AES_KEY impl_key;
 
-    /* test decryption AES-256X4-ECB */
-    TEST_ASSERT(0 == AES_set_decrypt_key(key, 256, 4, &test_key));
-    AES_decrypt(ciphertext, test_plaintext, &test_key);
-    for (int i = 0; i < 16; ++i)
+    for (int i = 0; i < 32; ++i)
     {
-        TEST_EXPECT(test_plaintext[i] == plaintext[i]);
+        key[i] = (uint8_t)(0x3b * i + 0x11);
     }
+
+    for (int impl = AES_IMPL_PORTABLE; impl <= AES_IMPL_BITSLICE; ++impl)
+    {
+        if (!AES_impl_supported(impl))
+            continue;
+
+        for (int mult = 1; mult <= 4; ++mult)
+        {
+            TEST_ASSERT(
+                0 == AES_set_encrypt_key_impl(
+                        key, 256, mult, AES_IMPL_PORTABLE, &portable_key));
+            TEST_ASSERT(
+                0 == AES_set_encrypt_key_impl(key, 256, mult, impl, &impl_key));
+            TEST_EXPECT(portable_key.rounds == impl_key.rounds);
+
+            for (int j = 0; j < 16; ++j)
+            {
+                block[j] = (uint8_t)(0x5d * j + mult);
+            }
+
+            /* chain several encryptions to exercise every round key. */
+            for (int n = 0; n < 8; ++n)
+            {
+                AES_encrypt(block, portable_out, &portable_key);
+                AES_encrypt(block, impl_out, &impl_key);
+                TEST_EXPECT(0 == memcmp(portable_out, impl_out, 16));
+                memcpy(block, impl_out, 16);
+            }
+
+            /* decryption walks the chain back to the start. */
+            TEST_ASSERT(
+                0 == AES_set_decrypt_key_impl(key, 256, mult, impl, &impl_key));
+            for (int n = 0; n < 8; ++n)
+            {
+                AES_decrypt(block, block, &impl_key);
+            }
+
+            for (int j = 0; j < 16; ++j)
+            {
+                TEST_EXPECT(block[j] == (uint8_t)(0x5d * j + mult));
+            }
+        }
+    }
+}
+
+/**
+ * Test that multi-block encryption matches single-block encryption for every
+ * implementation, including partial groups.
+ */
+TEST(AES_256_encrypt_blocks)
+{
+    uint8_t key[32];
+    uint8_t in[16 * 11];
+    uint8_t expected[16 * 11];
+    uint8_t out[16 * 11];
+    AES_KEY portable_key;
+    AES_KEY impl_key;
+
+    for (size_t i = 0; i < sizeof(key); ++i)
+    {
+        key[i] = (uint8_t)(0xa7 ^ (i * 13));
+    }
+
+    for (size_t i = 0; i < sizeof(in); ++i)
+    {
+        in[i] = (uint8_t)(i * 29 + 1);
+    }
+
+    for (int impl = AES_IMPL_PORTABLE; impl <= AES_IMPL_BITSLICE; ++impl)
+    {
+        if (!AES_impl_supported(impl))
+            continue;
+
+        TEST_ASSERT(
+            0 == AES_set_encrypt_key_impl(
+                    key, 256, 2, AES_IMPL_PORTABLE, &portable_key));
+        TEST_ASSERT(
+            0 == AES_set_encrypt_key_impl(key, 256, 2, impl, &impl_key));
+
+        for (size_t i = 0; i < sizeof(in) / 16; ++i)
+        {
+            AES_encrypt(in + 16 * i, expected + 16 * i, &portable_key);
+        }
+
+        /* every block count up to eleven covers full and partial groups. */
+        for (size_t n = 1; n <= sizeof(in) / 16; ++n)
+        {
+            memset(out, 0, sizeof(out));
+            AES_encrypt_blocks(in, out, n, &impl_key);
+            TEST_EXPECT(0 == memcmp(expected, out, 16 * n));
+        }
+
+        /* in-place operation. */
+        memcpy(out, in, sizeof(in));
+        AES_encrypt_blocks(out, out, sizeof(in) / 16, &impl_key);
+        TEST_EXPECT(0 == memcmp(expected, out, sizeof(out)));
+    }
+}
+
+/**
+ * Test the AES-128 and AES-192 schedules against the FIPS-197 appendix C
+ * example vectors.
+ */
+TEST(AES_128_192_ECB)
+{
+    const uint8_t key[24] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17
+    };
+
+    const uint8_t plaintext[16] = {
+        0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+    };
+
+    const uint8_t ciphertext_128[16] = {
+        0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+        0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+    };
+
+    const uint8_t ciphertext_192[16] = {
+        0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+        0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91
+    };
+
+    uint8_t out[16];
+    AES_KEY test_key;
+
+    TEST_ASSERT(
+        0 == AES_set_encrypt_key_impl(
+                key, 128, 1, AES_IMPL_PORTABLE, &test_key));
+    TEST_EXPECT(10 == test_key.rounds);
+    AES_encrypt(plaintext, out, &test_key);
+    TEST_EXPECT(0 == memcmp(ciphertext_128, out, sizeof(out)));
+
+    TEST_ASSERT(
+        0 == AES_set_decrypt_key_impl(
+                key, 128, 1, AES_IMPL_PORTABLE, &test_key));
+    AES_decrypt(ciphertext_128, out, &test_key);
+    TEST_EXPECT(0 == memcmp(plaintext, out, sizeof(out)));
+
+    TEST_ASSERT(
+        0 == AES_set_encrypt_key_impl(
+                key, 192, 1, AES_IMPL_PORTABLE, &test_key));
+    TEST_EXPECT(12 == test_key.rounds);
+    AES_encrypt(plaintext, out, &test_key);
+    TEST_EXPECT(0 == memcmp(ciphertext_192, out, sizeof(out)));
+
+    TEST_ASSERT(
+        0 == AES_set_decrypt_key_impl(
+                key, 192, 1, AES_IMPL_PORTABLE, &test_key));
+    AES_decrypt(ciphertext_192, out, &test_key);
+    TEST_EXPECT(0 == memcmp(plaintext, out, sizeof(out)));
 }
@@ -7,6 +7,7 @@
  */
 
 #include <minunit/minunit.h>
+#include <stdlib.h>
 #include <string.h>
 #include <vccrypt/stream_cipher.h>
 #include <vpr/allocator/malloc_allocator.h>
@@ -558,3 +559,754 @@ BEGIN_TEST_F(aes_256_ctr_fips_03)
     dispose((disposable_t*)&key);
     dispose((disposable_t*)&ctx);
 END_TEST_F()
+
+/**
+ * Encrypting in arbitrarily sized chunks, including the bulk path and a carry
+ * out of the low 64 bits of the counter, should match a byte-at-a-time
+ * reference keystream.
+ */
+BEGIN_TEST_F(aes_256_2x_ctr_chunked_matches_reference)
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+    const size_t CHUNKS[] = { 1, 7, 16, 33, 130, 8, 200, 15, 17, 300 };
+    const size_t TOTAL = 727;
+    uint8_t KEY[32];
+    uint8_t START_CTR[16] = {
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa
+    };
+    uint8_t plaintext[727];
+    uint8_t expected[727];
+    uint8_t output[8 + 727];
+    uint8_t ctr[16];
+    uint8_t stream[16];
+    AES_KEY ref_key;
+    uint64_t IV = 0;
+    size_t offset = 0;
+    size_t pos = 0;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+    {
+        KEY[i] = (uint8_t)(7 * i + 3);
+    }
+
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 31);
+    }
+
+    /* build the reference ciphertext one byte at a time. */
+    TEST_ASSERT(0 == AES_set_encrypt_key(KEY, 256, 2, &ref_key));
+    memcpy(ctr, START_CTR, sizeof(ctr));
+    for (size_t i = 0; i < TOTAL; ++i)
+    {
+        if (0 == i % 16)
+        {
+            if (i > 0)
+            {
+                vccrypt_aes_ctr_incr(ctr);
+            }
+            AES_encrypt(ctr, stream, &ref_key);
+        }
+
+        expected[i] = plaintext[i] ^ stream[i % 16];
+    }
+
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_buffer_read_data(&key, KEY, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.x2_options, &ctx, &key));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &ctx, &IV, sizeof(IV), output, &offset));
+
+    /* move the counter close to a carry out of the low 64 bits. */
+    aes_ctr_context_data_t* priv = (aes_ctr_context_data_t*)ctx.stream_state;
+    memcpy(priv->ctr, START_CTR, sizeof(START_CTR));
+    AES_encrypt(priv->ctr, priv->stream, &priv->key);
+
+    /* encrypt the plaintext in uneven chunks. */
+    for (size_t i = 0; i < sizeof(CHUNKS) / sizeof(CHUNKS[0]); ++i)
+    {
+        TEST_ASSERT(
+            0
+                == vccrypt_stream_encrypt(
+                        &ctx, plaintext + pos, CHUNKS[i], output, &offset));
+        pos += CHUNKS[i];
+    }
+
+    TEST_ASSERT(TOTAL == pos);
+    TEST_EXPECT(8 + TOTAL == offset);
+    TEST_EXPECT(0 == memcmp(expected, output + 8, TOTAL));
+
+    /* decrypting in place in a single call recovers the plaintext. */
+    memcpy(priv->ctr, START_CTR, sizeof(START_CTR));
+    AES_encrypt(priv->ctr, priv->stream, &priv->key);
+    priv->count = 0;
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt(
+                    &ctx, output + 8, TOTAL, output + 8, &offset));
+    TEST_EXPECT(TOTAL == offset);
+    TEST_EXPECT(0 == memcmp(plaintext, output + 8, TOTAL));
+
+    /* tear down this instance. */
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Encrypting a multi-chunk region on several threads, starting at an unaligned
+ * stream offset, should match a serial encryption of the same region and leave
+ * the context positioned to continue the stream.
+ */
+BEGIN_TEST_F(aes_256_2x_ctr_parallel_matches_serial)
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+    const size_t SIZE = 3 * VCCRYPT_AES_CTR_ALG_PARALLEL_CHUNK_SIZE + 13;
+    const size_t START = 37;
+    const size_t TAIL = 29;
+    uint8_t KEY[32];
+    uint8_t IV[8] = { 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80 };
+    uint8_t* plaintext = (uint8_t*)malloc(SIZE + TAIL);
+    uint8_t* expected = (uint8_t*)malloc(SIZE + TAIL);
+    uint8_t* output = (uint8_t*)malloc(SIZE + TAIL);
+    size_t offset = 0;
+
+    TEST_ASSERT(NULL != plaintext);
+    TEST_ASSERT(NULL != expected);
+    TEST_ASSERT(NULL != output);
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+    {
+        KEY[i] = (uint8_t)(11 * i + 5);
+    }
+
+    for (size_t i = 0; i < SIZE + TAIL; ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 13 + (i >> 8));
+    }
+
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_buffer_read_data(&key, KEY, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.x2_options, &ctx, &key));
+
+    /* build the serial reference. */
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_continue_encryption(
+                    &ctx, IV, sizeof(IV), START));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt(
+                    &ctx, plaintext, SIZE + TAIL, expected, &offset));
+
+    /* encrypt the same region on four threads, then continue serially. */
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt_parallel(
+                    &ctx, IV, sizeof(IV), START, plaintext, SIZE, output,
+                    &offset, 4));
+    TEST_EXPECT(SIZE == offset);
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt(
+                    &ctx, plaintext + SIZE, TAIL, output, &offset));
+    TEST_EXPECT(SIZE + TAIL == offset);
+    TEST_EXPECT(0 == memcmp(expected, output, SIZE + TAIL));
+
+    /* decrypting in place on the default thread count recovers plaintext. */
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt_parallel(
+                    &ctx, IV, sizeof(IV), START, output, SIZE + TAIL, output,
+                    &offset, 0));
+    TEST_EXPECT(SIZE + TAIL == offset);
+    TEST_EXPECT(0 == memcmp(plaintext, output, SIZE + TAIL));
+
+    /* a bad IV size is rejected. */
+    offset = 0;
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_PARALLEL_INVALID_ARG
+            == vccrypt_stream_encrypt_parallel(
+                    &ctx, IV, 4, START, plaintext, SIZE, output, &offset, 4));
+
+    /* tear down this instance. */
+    free(plaintext);
+    free(expected);
+    free(output);
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Decrypting arbitrary ranges of an encrypted stream, given only the IV and
+ * the ciphertext slice for the range, should match the corresponding slice of
+ * the plaintext.
+ */
+BEGIN_TEST_F(aes_256_3x_ctr_decrypt_range)
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+    const size_t RANGES[][2] = {
+        { 0, 0 }, { 0, 1 }, { 0, 16 }, { 5, 11 }, { 15, 2 }, { 16, 64 },
+        { 17, 150 }, { 3, 597 }, { 599, 1 }, { 0, 600 }, { 600, 0 }
+    };
+    const size_t BODY = 600;
+    uint8_t KEY[32];
+    uint64_t IV = 0x0123456789abcdefULL;
+    uint8_t plaintext[600];
+    uint8_t encrypted[8 + 600];
+    uint8_t output[600];
+    size_t offset = 0;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+    {
+        KEY[i] = (uint8_t)(5 * i + 1);
+    }
+
+    for (size_t i = 0; i < BODY; ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 7 + 3);
+    }
+
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_buffer_read_data(&key, KEY, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.x3_options, &ctx, &key));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &ctx, &IV, sizeof(IV), encrypted, &offset));
+    TEST_ASSERT(
+        0 == vccrypt_stream_encrypt(&ctx, plaintext, BODY, encrypted, &offset));
+    TEST_ASSERT(sizeof(encrypted) == offset);
+
+    for (size_t i = 0; i < sizeof(RANGES) / sizeof(RANGES[0]); ++i)
+    {
+        memset(output, 0, sizeof(output));
+        TEST_ASSERT(
+            0
+                == vccrypt_stream_decrypt_range(
+                        &ctx, &IV, encrypted + 8 + RANGES[i][0], RANGES[i][0],
+                        RANGES[i][1], output, BODY));
+        TEST_EXPECT(
+            0 == memcmp(plaintext + RANGES[i][0], output, RANGES[i][1]));
+
+        /* the same range decrypts without knowing the message size. */
+        memset(output, 0, sizeof(output));
+        TEST_ASSERT(
+            0
+                == vccrypt_stream_decrypt_range(
+                        &ctx, &IV, encrypted + 8 + RANGES[i][0], RANGES[i][0],
+                        RANGES[i][1], output,
+                        VCCRYPT_STREAM_DECRYPT_RANGE_UNBOUNDED));
+        TEST_EXPECT(
+            0 == memcmp(plaintext + RANGES[i][0], output, RANGES[i][1]));
+    }
+
+    /* ranges past the end of a known body size are rejected. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_DECRYPT_RANGE_INVALID_ARG
+            == vccrypt_stream_decrypt_range(
+                    &ctx, &IV, encrypted + 8 + 590, 590, 11, output, BODY));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_DECRYPT_RANGE_INVALID_ARG
+            == vccrypt_stream_decrypt_range(
+                    &ctx, &IV, encrypted + 8, 601, 0, output, BODY));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_DECRYPT_RANGE_INVALID_ARG
+            == vccrypt_stream_decrypt_range(
+                    &ctx, &IV, encrypted + 8, 0, 1, output, 0));
+
+    /* tear down this instance. */
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Encrypting scatter / gather segments, split differently on the input and
+ * output sides, should match a contiguous encryption, and decrypting the same
+ * segments in place should recover the plaintext.
+ */
+BEGIN_TEST_F(aes_256_4x_ctr_vectored)
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+    uint8_t KEY[32];
+    uint64_t IV = 0x1122334455667788ULL;
+    uint8_t header[5], body[1000], trailer[19];
+    uint8_t plaintext[1024];
+    uint8_t expected[8 + 1024];
+    uint8_t output[1024];
+    size_t offset = 0;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+    {
+        KEY[i] = (uint8_t)(13 * i + 2);
+    }
+
+    for (size_t i = 0; i < sizeof(plaintext); ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 29 + 1);
+    }
+
+    memcpy(header, plaintext, sizeof(header));
+    memcpy(body, plaintext + sizeof(header), sizeof(body));
+    memcpy(trailer, plaintext + sizeof(header) + sizeof(body), sizeof(trailer));
+
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_buffer_read_data(&key, KEY, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.x4_options, &ctx, &key));
+
+    /* contiguous reference. */
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &ctx, &IV, sizeof(IV), expected, &offset));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt(
+                    &ctx, plaintext, sizeof(plaintext), expected, &offset));
+
+    /* gather header, body, and trailer into differently split outputs. */
+    vccrypt_stream_iovec_t in_segs[] = {
+        { header, sizeof(header) }, { NULL, 0 }, { body, sizeof(body) },
+        { trailer, sizeof(trailer) }
+    };
+    vccrypt_stream_iovec_t out_segs[] = {
+        { output, 100 }, { output + 100, 0 }, { output + 100, 900 },
+        { output + 1000, 24 }
+    };
+
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &ctx, &IV, sizeof(IV), expected, &offset));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encryptv(
+                    &ctx, in_segs, 4, out_segs, 4));
+    TEST_EXPECT(0 == memcmp(expected + 8, output, sizeof(output)));
+
+    /* decrypt the output segments in place. */
+    offset = 0;
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, expected, &offset));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decryptv(
+                    &ctx, out_segs, 4, out_segs, 4));
+    TEST_EXPECT(0 == memcmp(plaintext, output, sizeof(output)));
+
+    /* the keystream position carries across calls. */
+    offset = 0;
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, expected, &offset));
+    memcpy(output, expected + 8, sizeof(output));
+    TEST_ASSERT(0 == vccrypt_stream_decryptv(&ctx, out_segs, 1, out_segs, 1));
+    TEST_ASSERT(
+        0 == vccrypt_stream_decryptv(&ctx, out_segs + 1, 3, out_segs + 1, 3));
+    TEST_EXPECT(0 == memcmp(plaintext, output, sizeof(output)));
+
+    /* mismatched totals are rejected. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_VECTOR_INVALID_ARG
+            == vccrypt_stream_encryptv(&ctx, in_segs, 4, out_segs, 3));
+
+    /* tear down this instance. */
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * A stream cipher initialized in caller-provided storage produces the same
+ * output as one initialized on the heap, and its storage is sized to the
+ * selected round count.
+ */
+BEGIN_TEST_F(aes_256_ctr_init_with_storage)
+    vccrypt_stream_context_t heap_ctx, stack_ctx;
+    vccrypt_buffer_t key;
+    uint8_t KEY[32];
+    uint64_t IV = 0x0102030405060708ULL;
+    uint8_t plaintext[100];
+    uint8_t expected[8 + sizeof(plaintext)];
+    uint8_t output[8 + sizeof(plaintext)];
+    alignas(VCCRYPT_STREAM_STORAGE_ALIGNMENT) uint8_t storage[2048];
+    size_t offset;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+    {
+        KEY[i] = (uint8_t)(7 * i + 5);
+    }
+
+    for (size_t i = 0; i < sizeof(plaintext); ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 3 + 11);
+    }
+
+    /* fewer rounds need less storage. */
+    size_t fips_size = vccrypt_stream_storage_size(&fixture.fips_options);
+    size_t x4_size = vccrypt_stream_storage_size(&fixture.x4_options);
+    TEST_EXPECT(0U < fips_size);
+    TEST_EXPECT(fips_size < x4_size);
+    TEST_ASSERT(x4_size <= sizeof(storage));
+
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_buffer_read_data(&key, KEY, sizeof(KEY)));
+
+    /* too small or misaligned storage is rejected. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_INIT_INVALID_ARG
+            == vccrypt_stream_init_with_storage(
+                    &fixture.x4_options, &stack_ctx, &key, storage,
+                    x4_size - 1));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_INIT_INVALID_ARG
+            == vccrypt_stream_init_with_storage(
+                    &fixture.x4_options, &stack_ctx, &key, storage + 1,
+                    sizeof(storage) - 1));
+
+    TEST_ASSERT(
+        0 == vccrypt_stream_init(&fixture.x4_options, &heap_ctx, &key));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_init_with_storage(
+                    &fixture.x4_options, &stack_ctx, &key, storage,
+                    x4_size));
+    TEST_EXPECT((void*)storage == stack_ctx.stream_state);
+
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &heap_ctx, &IV, sizeof(IV), expected, &offset));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt(
+                    &heap_ctx, plaintext, sizeof(plaintext), expected,
+                    &offset));
+
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &stack_ctx, &IV, sizeof(IV), output, &offset));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt(
+                    &stack_ctx, plaintext, sizeof(plaintext), output,
+                    &offset));
+    TEST_EXPECT(0 == memcmp(expected, output, sizeof(output)));
+
+    /* dispose wipes the caller-provided storage. */
+    dispose((disposable_t*)&stack_ctx);
+    for (size_t i = 0; i < x4_size; ++i)
+    {
+        TEST_ASSERT(0 == storage[i]);
+    }
+
+    dispose((disposable_t*)&heap_ctx);
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * Encrypting many messages under different keys in one call matches encrypting
+ * each message on its own, including leftover keystream from earlier calls.
+ */
+BEGIN_TEST_F(aes_256_ctr_encrypt_many)
+    const size_t JOBS = 11;
+    const size_t SIZES[JOBS] = { 0, 5, 16, 100, 1000, 33, 48, 7, 500, 17, 64 };
+    const size_t LEAD = 3;
+    const size_t TRAIL = 7;
+    vccrypt_stream_context_t ctx[JOBS], ref[JOBS];
+    vccrypt_stream_job_t jobs[JOBS];
+    vccrypt_buffer_t key[JOBS];
+    uint8_t IV[8] = { 0x01, 0x12, 0x23, 0x34, 0x45, 0x56, 0x67, 0x78 };
+    uint8_t KEY[32];
+    uint8_t plaintext[LEAD + 1000 + TRAIL];
+    uint8_t expected[JOBS][LEAD + 1000 + TRAIL];
+    uint8_t output[JOBS][LEAD + 1000 + TRAIL];
+
+    for (size_t i = 0; i < sizeof(plaintext); ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 29 + 3);
+    }
+
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        /* mix round counts, which share the same lanes. */
+        vccrypt_stream_options_t* options =
+            (j & 1) ? &fixture.x3_options : &fixture.fips_options;
+        size_t offset = 0;
+
+        for (size_t i = 0; i < sizeof(KEY); ++i)
+        {
+            KEY[i] = (uint8_t)(j * 31 + i);
+        }
+
+        TEST_ASSERT(
+            0 == vccrypt_buffer_init(&key[j], &fixture.alloc_opts,
+                    sizeof(KEY)));
+        TEST_ASSERT(
+            0 == vccrypt_buffer_read_data(&key[j], KEY, sizeof(KEY)));
+        TEST_ASSERT(0 == vccrypt_stream_init(options, &ctx[j], &key[j]));
+        TEST_ASSERT(0 == vccrypt_stream_init(options, &ref[j], &key[j]));
+        TEST_ASSERT(
+            0 == vccrypt_stream_continue_encryption(
+                    &ctx[j], IV, sizeof(IV), 0));
+        TEST_ASSERT(
+            0 == vccrypt_stream_continue_encryption(
+                    &ref[j], IV, sizeof(IV), 0));
+
+        /* build the reference in three calls. */
+        TEST_ASSERT(
+            0 == vccrypt_stream_encrypt(
+                    &ref[j], plaintext, LEAD, expected[j], &offset));
+        if (SIZES[j] > 0)
+        {
+            TEST_ASSERT(
+                0 == vccrypt_stream_encrypt(
+                        &ref[j], plaintext + LEAD, SIZES[j], expected[j],
+                        &offset));
+        }
+        TEST_ASSERT(
+            0 == vccrypt_stream_encrypt(
+                    &ref[j], plaintext + LEAD + SIZES[j], TRAIL,
+                    expected[j], &offset));
+
+        /* leave some keystream over for the batched call. */
+        jobs[j].context = &ctx[j];
+        jobs[j].input = plaintext + LEAD;
+        jobs[j].size = SIZES[j];
+        jobs[j].output = output[j];
+        jobs[j].offset = 0;
+        TEST_ASSERT(
+            0 == vccrypt_stream_encrypt(
+                    &ctx[j], plaintext, LEAD, output[j], &jobs[j].offset));
+    }
+
+    TEST_ASSERT(0 == vccrypt_stream_encrypt_many(jobs, JOBS));
+
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        /* the offset advanced, and the context continues the stream. */
+        TEST_EXPECT(LEAD + SIZES[j] == jobs[j].offset);
+        TEST_ASSERT(
+            0 == vccrypt_stream_encrypt(
+                    &ctx[j], plaintext + LEAD + SIZES[j], TRAIL, output[j],
+                    &jobs[j].offset));
+        TEST_EXPECT(
+            0 == memcmp(expected[j], output[j], LEAD + SIZES[j] + TRAIL));
+    }
+
+    /* decrypting in place with a fresh batch recovers the plaintext. */
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        TEST_ASSERT(
+            0 == vccrypt_stream_continue_decryption(
+                    &ctx[j], IV, sizeof(IV), 0));
+        jobs[j].input = output[j];
+        jobs[j].size = LEAD + SIZES[j] + TRAIL;
+        jobs[j].offset = 0;
+    }
+
+    TEST_ASSERT(0 == vccrypt_stream_decrypt_many(jobs, JOBS));
+
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        TEST_EXPECT(
+            0 == memcmp(plaintext, output[j], LEAD + SIZES[j] + TRAIL));
+    }
+
+    /* a job without a context is rejected. */
+    jobs[0].context = NULL;
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_MANY_INVALID_ARG
+            == vccrypt_stream_encrypt_many(jobs, JOBS));
+
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        dispose((disposable_t*)&ref[j]);
+        dispose((disposable_t*)&ctx[j]);
+        dispose((disposable_t*)&key[j]);
+    }
+END_TEST_F()
+
+/**
+ * Jobs that share a context are encrypted one after another, in order, so the
+ * result matches encrypting them in turn.
+ */
+BEGIN_TEST_F(aes_256_ctr_encrypt_many_shared_context)
+    const size_t JOBS = 5;
+    const size_t SIZES[JOBS] = { 64, 200, 37, 128, 90 };
+    const size_t CTX_OF[JOBS] = { 0, 1, 0, 0, 1 };
+    vccrypt_stream_context_t ctx[2], ref[2];
+    vccrypt_stream_job_t jobs[JOBS];
+    vccrypt_buffer_t key[2];
+    uint8_t IV[8] = { 0x71, 0x62, 0x53, 0x44, 0x35, 0x26, 0x17, 0x08 };
+    uint8_t KEY[32];
+    uint8_t plaintext[200];
+    uint8_t expected[JOBS][200];
+    uint8_t output[JOBS][200];
+
+    for (size_t i = 0; i < sizeof(plaintext); ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 7 + 1);
+    }
+
+    for (size_t c = 0; c < 2; ++c)
+    {
+        for (size_t i = 0; i < sizeof(KEY); ++i)
+        {
+            KEY[i] = (uint8_t)(c * 59 + i);
+        }
+
+        TEST_ASSERT(
+            0 == vccrypt_buffer_init(&key[c], &fixture.alloc_opts,
+                    sizeof(KEY)));
+        TEST_ASSERT(
+            0 == vccrypt_buffer_read_data(&key[c], KEY, sizeof(KEY)));
+        TEST_ASSERT(
+            0 == vccrypt_stream_init(&fixture.fips_options, &ctx[c], &key[c]));
+        TEST_ASSERT(
+            0 == vccrypt_stream_init(&fixture.fips_options, &ref[c], &key[c]));
+        TEST_ASSERT(
+            0 == vccrypt_stream_continue_encryption(
+                    &ctx[c], IV, sizeof(IV), 0));
+        TEST_ASSERT(
+            0 == vccrypt_stream_continue_encryption(
+                    &ref[c], IV, sizeof(IV), 0));
+    }
+
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        size_t offset = 0;
+
+        TEST_ASSERT(
+            0 == vccrypt_stream_encrypt(
+                    &ref[CTX_OF[j]], plaintext, SIZES[j], expected[j],
+                    &offset));
+
+        jobs[j].context = &ctx[CTX_OF[j]];
+        jobs[j].input = plaintext;
+        jobs[j].size = SIZES[j];
+        jobs[j].output = output[j];
+        jobs[j].offset = 0;
+    }
+
+    TEST_ASSERT(0 == vccrypt_stream_encrypt_many(jobs, JOBS));
+
+    for (size_t j = 0; j < JOBS; ++j)
+    {
+        TEST_EXPECT(SIZES[j] == jobs[j].offset);
+        TEST_EXPECT(0 == memcmp(expected[j], output[j], SIZES[j]));
+    }
+
+    for (size_t c = 0; c < 2; ++c)
+    {
+        dispose((disposable_t*)&ref[c]);
+        dispose((disposable_t*)&ctx[c]);
+        dispose((disposable_t*)&key[c]);
+    }
+END_TEST_F()
+
+/**
+ * Precomputed keystream produces the same stream as generating it on demand,
+ * across ring exhaustion, refills, and seeks.
+ */
+BEGIN_TEST_F(aes_256_ctr_precompute)
+    vccrypt_stream_context_t ctx, ref;
+    vccrypt_buffer_t key;
+    const size_t CHUNKS[] = { 3, 50, 16, 700, 5, 900, 2000, 13, 64 };
+    const size_t NCHUNKS = sizeof(CHUNKS) / sizeof(CHUNKS[0]);
+    const size_t SIZE = 3751;
+    uint8_t KEY[32];
+    uint8_t IV[8] = { 0xF0, 0xE1, 0xD2, 0xC3, 0xB4, 0xA5, 0x96, 0x87 };
+    uint8_t plaintext[SIZE], expected[SIZE + 8], output[SIZE + 8];
+    size_t ref_offset = 0, offset = 0, pos = 0;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+    {
+        KEY[i] = (uint8_t)(i * 19 + 4);
+    }
+
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 5 + 1);
+    }
+
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_buffer_read_data(&key, KEY, sizeof(KEY)));
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.x2_options, &ctx, &key));
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.x2_options, &ref, &key));
+
+    /* the size is bounded, and rounded up to whole blocks. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_PRECOMPUTE_INVALID_ARG
+            == vccrypt_stream_precompute_enable(
+                    &ctx, VCCRYPT_STREAM_PRECOMPUTE_MAX_SIZE + 1));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_PRECOMPUTE_INVALID_ARG
+            == vccrypt_stream_precompute(&ctx));
+    TEST_ASSERT(0 == vccrypt_stream_precompute_enable(&ctx, 1000));
+
+    aes_ctr_context_data_t* ctx_data =
+        (aes_ctr_context_data_t*)ctx.stream_state;
+    TEST_EXPECT(1008U == ctx_data->ring_size);
+
+    /* starting the stream fills the ring. */
+    TEST_ASSERT(
+        0 == vccrypt_stream_start_encryption(
+                &ref, IV, sizeof(IV), expected, &ref_offset));
+    TEST_ASSERT(
+        0 == vccrypt_stream_start_encryption(
+                &ctx, IV, sizeof(IV), output, &offset));
+    TEST_EXPECT(1008U == ctx_data->ring_count);
+
+    for (size_t i = 0; i < NCHUNKS; ++i)
+    {
+        TEST_ASSERT(
+            0 == vccrypt_stream_encrypt(
+                    &ref, plaintext + pos, CHUNKS[i], expected,
+                    &ref_offset));
+        TEST_ASSERT(
+            0 == vccrypt_stream_encrypt(
+                    &ctx, plaintext + pos, CHUNKS[i], output, &offset));
+        pos += CHUNKS[i];
+
+        /* top up between every other message. */
+        if (i & 1)
+        {
+            TEST_ASSERT(0 == vccrypt_stream_precompute(&ctx));
+            TEST_EXPECT(1008U == ctx_data->ring_count);
+        }
+    }
+
+    TEST_ASSERT(SIZE == pos);
+    TEST_EXPECT(ref_offset == offset);
+    TEST_EXPECT(0 == memcmp(expected, output, offset));
+
+    /* seeking discards the old keystream and refills from the new offset. */
+    TEST_ASSERT(
+        0 == vccrypt_stream_continue_decryption(&ctx, IV, sizeof(IV), 100));
+    offset = 0;
+    TEST_ASSERT(
+        0 == vccrypt_stream_decrypt(
+                &ctx, expected + 8 + 100, SIZE - 100, output, &offset));
+    TEST_EXPECT(0 == memcmp(plaintext + 100, output, SIZE - 100));
+
+    /* disabling wipes and releases the ring. */
+    TEST_ASSERT(0 == vccrypt_stream_precompute_enable(&ctx, 0));
+    TEST_EXPECT(NULL == ctx_data->ring);
+    TEST_EXPECT(0U == ctx_data->ring_count);
+
+    dispose((disposable_t*)&ref);
+    dispose((disposable_t*)&ctx);
+    dispose((disposable_t*)&key);
+END_TEST_F()
@@ -0,0 +1,462 @@
+/**
+ * \file test_aes_gcm.cpp
+ *
+ * Unit tests for AES-256-GCM.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <unistd.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../../src/stream_cipher/ghash/ghash.h"
+
+class aes_gcm_test {
+public:
+    void setUp()
+    {
+        vccrypt_stream_register_AES_256_CTR_FIPS();
+        vccrypt_stream_register_AES_256_GCM();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        options_init_result =
+            vccrypt_stream_options_init(
+                &options, &alloc_opts, VCCRYPT_STREAM_ALGORITHM_AES_256_GCM);
+    }
+
+    void tearDown()
+    {
+        if (0 == options_init_result)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /* encrypt a message in one call and return the offset. */
+    int encrypt(
+        const uint8_t* key_data, const uint8_t* iv, const uint8_t* aad,
+        size_t aad_size, const uint8_t* input, size_t size, uint8_t* output,
+        size_t* offset)
+    {
+        vccrypt_stream_context_t ctx;
+        vccrypt_buffer_t key;
+        int retval;
+
+        retval = vccrypt_buffer_init(&key, &alloc_opts, 32);
+        if (0 != retval)
+            return retval;
+
+        memcpy(key.data, key_data, 32);
+
+        retval = vccrypt_stream_init(&options, &ctx, &key);
+        if (0 != retval)
+            goto cleanup_key;
+
+        retval =
+            vccrypt_stream_start_encryption(&ctx, iv, 12, output, offset);
+        if (0 != retval)
+            goto cleanup_ctx;
+
+        if (aad_size > 0)
+        {
+            retval = vccrypt_stream_authenticate(&ctx, aad, aad_size);
+            if (0 != retval)
+                goto cleanup_ctx;
+        }
+
+        if (size > 0)
+        {
+            retval = vccrypt_stream_encrypt(&ctx, input, size, output, offset);
+            if (0 != retval)
+                goto cleanup_ctx;
+        }
+
+        retval = vccrypt_stream_finalize(&ctx, output, offset);
+
+    cleanup_ctx:
+        dispose((disposable_t*)&ctx);
+
+    cleanup_key:
+        dispose((disposable_t*)&key);
+
+        return retval;
+    }
+
+    allocator_options_t alloc_opts;
+    vccrypt_stream_options_t options;
+    int options_init_result;
+};
+
+TEST_SUITE(aes_gcm_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    aes_gcm_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * We should be able to create an options structure for AES-256-GCM.
+ */
+BEGIN_TEST_F(register_options)
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_EXPECT(nullptr != fixture.options.hdr.dispose);
+    TEST_EXPECT(&fixture.alloc_opts == fixture.options.alloc_opts);
+    TEST_EXPECT(32U == fixture.options.key_size);
+    TEST_EXPECT(12U == fixture.options.IV_size);
+    TEST_EXPECT(16U == fixture.options.tag_size);
+    TEST_EXPECT(nullptr != fixture.options.vccrypt_stream_alg_authenticate);
+    TEST_EXPECT(nullptr != fixture.options.vccrypt_stream_alg_finalize);
+    TEST_EXPECT(nullptr != fixture.options.vccrypt_stream_alg_verify);
+END_TEST_F()
+
+/**
+ * GCM specification test cases 13 and 14: an all-zero key and IV, with an empty
+ * message and with one zero block.
+ */
+BEGIN_TEST_F(gcm_spec_13_14)
+    const uint8_t KEY[32] = { 0 };
+    const uint8_t IV[12] = { 0 };
+    const uint8_t PLAINTEXT[16] = { 0 };
+    const uint8_t TAG_13[16] = {
+        0x53, 0x0f, 0x8a, 0xfb, 0xc7, 0x45, 0x36, 0xb9,
+        0xa9, 0x63, 0xb4, 0xf1, 0xc4, 0xcb, 0x73, 0x8b
+    };
+    const uint8_t CIPHERTEXT_14[16] = {
+        0xce, 0xa7, 0x40, 0x3d, 0x4d, 0x60, 0x6b, 0x6e,
+        0x07, 0x4e, 0xc5, 0xd3, 0xba, 0xf3, 0x9d, 0x18
+    };
+    const uint8_t TAG_14[16] = {
+        0xd0, 0xd1, 0xc8, 0xa7, 0x99, 0x99, 0x6b, 0xf0,
+        0x26, 0x5b, 0x98, 0xb5, 0xd4, 0x8a, 0xb9, 0x19
+    };
+    uint8_t output[12 + 16 + 16];
+    size_t offset = 0;
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+
+    TEST_ASSERT(
+        0
+            == fixture.encrypt(
+                    KEY, IV, nullptr, 0, nullptr, 0, output, &offset));
+    TEST_ASSERT(12U + 16U == offset);
+    TEST_EXPECT(0 == memcmp(IV, output, 12));
+    TEST_EXPECT(0 == memcmp(TAG_13, output + 12, 16));
+
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == fixture.encrypt(
+                    KEY, IV, nullptr, 0, PLAINTEXT, sizeof(PLAINTEXT), output,
+                    &offset));
+    TEST_ASSERT(sizeof(output) == offset);
+    TEST_EXPECT(0 == memcmp(CIPHERTEXT_14, output + 12, 16));
+    TEST_EXPECT(0 == memcmp(TAG_14, output + 28, 16));
+END_TEST_F()
+
+/**
+ * GCM specification test case 16: a partial final block with additional data.
+ * Decryption verifies the tag, and rejects a modified tag or modified
+ * additional data.
+ */
+BEGIN_TEST_F(gcm_spec_16)
+    const uint8_t KEY[32] = {
+        0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+        0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+        0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+        0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08
+    };
+    const uint8_t IV[12] = {
+        0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+        0xde, 0xca, 0xf8, 0x88
+    };
+    const uint8_t AAD[20] = {
+        0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+        0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+        0xab, 0xad, 0xda, 0xd2
+    };
+    const uint8_t PLAINTEXT[60] = {
+        0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5,
+        0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+        0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda,
+        0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+        0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53,
+        0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+        0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57,
+        0xba, 0x63, 0x7b, 0x39
+    };
+    const uint8_t CIPHERTEXT[60] = {
+        0x52, 0x2d, 0xc1, 0xf0, 0x99, 0x56, 0x7d, 0x07,
+        0xf4, 0x7f, 0x37, 0xa3, 0x2a, 0x84, 0x42, 0x7d,
+        0x64, 0x3a, 0x8c, 0xdc, 0xbf, 0xe5, 0xc0, 0xc9,
+        0x75, 0x98, 0xa2, 0xbd, 0x25, 0x55, 0xd1, 0xaa,
+        0x8c, 0xb0, 0x8e, 0x48, 0x59, 0x0d, 0xbb, 0x3d,
+        0xa7, 0xb0, 0x8b, 0x10, 0x56, 0x82, 0x88, 0x38,
+        0xc5, 0xf6, 0x1e, 0x63, 0x93, 0xba, 0x7a, 0x0a,
+        0xbc, 0xc9, 0xf6, 0x62
+    };
+    const uint8_t TAG[16] = {
+        0x76, 0xfc, 0x6e, 0xce, 0x0f, 0x4e, 0x17, 0x68,
+        0xcd, 0xdf, 0x88, 0x53, 0xbb, 0x2d, 0x55, 0x1b
+    };
+    uint8_t output[12 + 60 + 16];
+    uint8_t poutput[60];
+    size_t offset = 0;
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+
+    TEST_ASSERT(
+        0
+            == fixture.encrypt(
+                    KEY, IV, AAD, sizeof(AAD), PLAINTEXT, sizeof(PLAINTEXT),
+                    output, &offset));
+    TEST_ASSERT(sizeof(output) == offset);
+    TEST_EXPECT(0 == memcmp(CIPHERTEXT, output + 12, sizeof(CIPHERTEXT)));
+    TEST_EXPECT(0 == memcmp(TAG, output + 72, sizeof(TAG)));
+
+    TEST_ASSERT(0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, 32));
+    memcpy(key.data, KEY, 32);
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.options, &ctx, &key));
+
+    /* decrypt and verify. */
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, output, &offset));
+    TEST_ASSERT(12U == offset);
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, sizeof(AAD)));
+    offset = 0;
+    TEST_ASSERT(
+        0 == vccrypt_stream_decrypt(&ctx, output + 12, 60, poutput, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_verify(&ctx, output + 72));
+    TEST_EXPECT(0 == memcmp(PLAINTEXT, poutput, sizeof(PLAINTEXT)));
+
+    /* a modified tag is rejected. */
+    output[72] ^= 0x80;
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, sizeof(AAD)));
+    offset = 0;
+    TEST_ASSERT(
+        0 == vccrypt_stream_decrypt(&ctx, output + 12, 60, poutput, &offset));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_AUTHENTICATION_FAILED
+            == vccrypt_stream_verify(&ctx, output + 72));
+    output[72] ^= 0x80;
+
+    /* missing additional data is rejected. */
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, output, &offset));
+    offset = 0;
+    TEST_ASSERT(
+        0 == vccrypt_stream_decrypt(&ctx, output + 12, 60, poutput, &offset));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_AUTHENTICATION_FAILED
+            == vccrypt_stream_verify(&ctx, output + 72));
+
+    /* the tag can only be computed once per message. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG
+            == vccrypt_stream_verify(&ctx, output + 72));
+
+    dispose((disposable_t*)&ctx);
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * Splitting the additional data and the message across many calls of odd sizes
+ * produces the same result as a single call, and in-place decryption works.
+ */
+BEGIN_TEST_F(chunked_and_in_place)
+    uint8_t KEY[32], IV[12];
+    const uint8_t AAD[] = "velo payments";
+    const uint8_t TAG[16] = {
+        0xf2, 0x6d, 0x7e, 0xe6, 0x7b, 0x52, 0x4f, 0x33,
+        0x49, 0x6c, 0x69, 0xe7, 0x4c, 0x84, 0xac, 0xbe
+    };
+    const uint8_t TAIL[8] = {
+        0x42, 0x1d, 0x97, 0x53, 0x4e, 0x68, 0x13, 0x4b
+    };
+    uint8_t plaintext[1000];
+    uint8_t expected[12 + 1000 + 16];
+    uint8_t output[12 + 1000 + 16];
+    size_t offset = 0;
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+        KEY[i] = (uint8_t)i;
+    for (size_t i = 0; i < sizeof(IV); ++i)
+        IV[i] = (uint8_t)(0xA0 + i);
+    for (size_t i = 0; i < sizeof(plaintext); ++i)
+        plaintext[i] = (uint8_t)(i * 7 + 3);
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+
+    TEST_ASSERT(
+        0
+            == fixture.encrypt(
+                    KEY, IV, AAD, 13, plaintext, sizeof(plaintext), expected,
+                    &offset));
+    TEST_ASSERT(sizeof(expected) == offset);
+    TEST_EXPECT(0 == memcmp(TAIL, expected + 12 + 992, sizeof(TAIL)));
+    TEST_EXPECT(0 == memcmp(TAG, expected + 12 + 1000, sizeof(TAG)));
+
+    TEST_ASSERT(0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, 32));
+    memcpy(key.data, KEY, 32);
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.options, &ctx, &key));
+
+    /* encrypt in pieces that straddle block boundaries. */
+    const size_t pieces[] = { 1, 15, 17, 3, 200, 16, 129, 0, 419, 200 };
+    TEST_ASSERT(0 == vccrypt_stream_start_encryption(&ctx, IV, 12, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, 5));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD + 5, 8));
+    size_t pos = 0;
+    for (size_t i = 0; i < sizeof(pieces) / sizeof(pieces[0]); ++i)
+    {
+        TEST_ASSERT(
+            0
+                == vccrypt_stream_encrypt(
+                        &ctx, plaintext + pos, pieces[i], output, &offset));
+        pos += pieces[i];
+    }
+    TEST_ASSERT(sizeof(plaintext) == pos);
+
+    /* additional data is rejected once the text has started. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG
+            == vccrypt_stream_authenticate(&ctx, AAD, 1));
+
+    TEST_ASSERT(0 == vccrypt_stream_finalize(&ctx, output, &offset));
+    TEST_ASSERT(sizeof(output) == offset);
+    TEST_EXPECT(0 == memcmp(expected, output, sizeof(output)));
+
+    /* decrypt in place. */
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, 13));
+    offset = 12;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt(
+                    &ctx, output + 12, 333, output, &offset));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt(
+                    &ctx, output + 345, 667, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_verify(&ctx, output + 1012));
+    TEST_EXPECT(0 == memcmp(plaintext, output + 12, sizeof(plaintext)));
+
+    /* GCM cannot be resumed in the middle of a message. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG
+            == vccrypt_stream_continue_decryption(&ctx, IV, 12, 16));
+
+    dispose((disposable_t*)&ctx);
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * Unauthenticated stream ciphers report that they do not support AEAD.
+ */
+BEGIN_TEST_F(ctr_aead_unsupported)
+    vccrypt_stream_options_t ctr_options;
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+    uint8_t tag[16] = { 0 };
+    size_t offset = 0;
+
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_options_init(
+                    &ctr_options, &fixture.alloc_opts,
+                    VCCRYPT_STREAM_ALGORITHM_AES_256_CTR_FIPS));
+    TEST_EXPECT(0U == ctr_options.tag_size);
+
+    TEST_ASSERT(0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, 32));
+    memset(key.data, 0, 32);
+    TEST_ASSERT(0 == vccrypt_stream_init(&ctr_options, &ctx, &key));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED
+            == vccrypt_stream_authenticate(&ctx, tag, sizeof(tag)));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED
+            == vccrypt_stream_finalize(&ctx, tag, &offset));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED
+            == vccrypt_stream_verify(&ctx, tag));
+
+    dispose((disposable_t*)&ctx);
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&ctr_options);
+END_TEST_F()
+
+/**
+ * The file and range helpers have nowhere to put or check the tag, so they
+ * refuse to run GCM rather than emit or accept unauthenticated data.
+ */
+BEGIN_TEST_F(unauthenticated_helpers_rejected)
+    const uint8_t KEY[32] = { 0 };
+    const uint8_t IV[12] = { 0 };
+    uint8_t input[12 + 32 + 16] = { 0 };
+    uint8_t output[32];
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+    int fds[2];
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == vccrypt_buffer_init(&key, &fixture.alloc_opts, 32));
+    memcpy(key.data, KEY, 32);
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.options, &ctx, &key));
+    TEST_ASSERT(0 == pipe(fds));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED
+            == vccrypt_stream_encrypt_file(
+                    &ctx, IV, sizeof(IV), fds[0], fds[1]));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED
+            == vccrypt_stream_decrypt_file(&ctx, fds[0], fds[1]));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED
+            == vccrypt_stream_decrypt_range(
+                    &ctx, IV, input + 12, 0, sizeof(output), output,
+                    sizeof(output)));
+
+    close(fds[0]);
+    close(fds[1]);
+    dispose((disposable_t*)&ctx);
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * The table and carry-less multiply GHASH backends agree.
+ */
+BEGIN_TEST_F(ghash_backends_agree)
+    GHASH_KEY table_key, best_key;
+    uint8_t H[16], data[16 * 37];
+    uint8_t x1[16] = { 0 }, x2[16] = { 0 };
+
+    for (size_t i = 0; i < sizeof(H); ++i)
+        H[i] = (uint8_t)(0x3C ^ (i * 17));
+    for (size_t i = 0; i < sizeof(data); ++i)
+        data[i] = (uint8_t)(i * 131 + 7);
+
+    GHASH_init(&table_key, H, GHASH_IMPL_TABLE);
+    GHASH_init(&best_key, H, GHASH_impl_default());
+
+    /* mix aggregated and single block updates. */
+    GHASH_update(&table_key, x1, data, 37);
+    GHASH_update(&best_key, x2, data, 5);
+    GHASH_update(&best_key, x2, data + 80, 1);
+    GHASH_update(&best_key, x2, data + 96, 31);
+
+    TEST_EXPECT(0 == memcmp(x1, x2, sizeof(x1)));
+END_TEST_F()
@@ -0,0 +1,501 @@
+/**
+ * \file test_chacha20.cpp
+ *
+ * Unit tests for ChaCha20 and ChaCha20-Poly1305.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <unistd.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../../src/stream_cipher/chacha/chacha.h"
+
+/* RFC 8439 sections 2.4.2 and 2.8.2 share this plaintext. */
+static const char SUNSCREEN[] =
+    "Ladies and Gentlemen of the class of '99: If I could offer you only one "
+    "tip for the future, sunscreen would be it.";
+
+class chacha20_test {
+public:
+    void setUp()
+    {
+        vccrypt_stream_register_CHACHA20();
+        vccrypt_stream_register_CHACHA20_POLY1305();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        options_init_result =
+            vccrypt_stream_options_init(
+                &options, &alloc_opts, VCCRYPT_STREAM_ALGORITHM_CHACHA20);
+
+        aead_options_init_result =
+            vccrypt_stream_options_init(
+                &aead_options, &alloc_opts,
+                VCCRYPT_STREAM_ALGORITHM_CHACHA20_POLY1305);
+    }
+
+    void tearDown()
+    {
+        if (0 == options_init_result)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (0 == aead_options_init_result)
+        {
+            dispose((disposable_t*)&aead_options);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /* create a context for the given options and key. */
+    int init(
+        vccrypt_stream_options_t* opts, vccrypt_stream_context_t* ctx,
+        const uint8_t* key_data)
+    {
+        vccrypt_buffer_t key;
+        int retval;
+
+        retval = vccrypt_buffer_init(&key, &alloc_opts, 32);
+        if (0 != retval)
+            return retval;
+
+        memcpy(key.data, key_data, 32);
+        retval = vccrypt_stream_init(opts, ctx, &key);
+        dispose((disposable_t*)&key);
+
+        return retval;
+    }
+
+    allocator_options_t alloc_opts;
+    vccrypt_stream_options_t options;
+    vccrypt_stream_options_t aead_options;
+    int options_init_result;
+    int aead_options_init_result;
+};
+
+TEST_SUITE(chacha20_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    chacha20_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * We should be able to create options structures for both algorithms.
+ */
+BEGIN_TEST_F(register_options)
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_EXPECT(32U == fixture.options.key_size);
+    TEST_EXPECT(12U == fixture.options.IV_size);
+    TEST_EXPECT(0U == fixture.options.tag_size);
+    TEST_EXPECT(nullptr == fixture.options.vccrypt_stream_alg_authenticate);
+
+    TEST_ASSERT(0 == fixture.aead_options_init_result);
+    TEST_EXPECT(32U == fixture.aead_options.key_size);
+    TEST_EXPECT(12U == fixture.aead_options.IV_size);
+    TEST_EXPECT(16U == fixture.aead_options.tag_size);
+    TEST_EXPECT(
+        nullptr != fixture.aead_options.vccrypt_stream_alg_authenticate);
+    TEST_EXPECT(nullptr != fixture.aead_options.vccrypt_stream_alg_finalize);
+    TEST_EXPECT(nullptr != fixture.aead_options.vccrypt_stream_alg_verify);
+END_TEST_F()
+
+/**
+ * RFC 8439 section 2.4.2: the test vector starts at block counter 1, which is
+ * reached by continuing the stream at offset 64.
+ */
+BEGIN_TEST_F(rfc8439_2_4_2)
+    uint8_t KEY[32];
+    const uint8_t NONCE[12] = {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a,
+        0x00, 0x00, 0x00, 0x00
+    };
+    const uint8_t CIPHERTEXT[114] = {
+        0x6e, 0x2e, 0x35, 0x9a, 0x25, 0x68, 0xf9, 0x80,
+        0x41, 0xba, 0x07, 0x28, 0xdd, 0x0d, 0x69, 0x81,
+        0xe9, 0x7e, 0x7a, 0xec, 0x1d, 0x43, 0x60, 0xc2,
+        0x0a, 0x27, 0xaf, 0xcc, 0xfd, 0x9f, 0xae, 0x0b,
+        0xf9, 0x1b, 0x65, 0xc5, 0x52, 0x47, 0x33, 0xab,
+        0x8f, 0x59, 0x3d, 0xab, 0xcd, 0x62, 0xb3, 0x57,
+        0x16, 0x39, 0xd6, 0x24, 0xe6, 0x51, 0x52, 0xab,
+        0x8f, 0x53, 0x0c, 0x35, 0x9f, 0x08, 0x61, 0xd8,
+        0x07, 0xca, 0x0d, 0xbf, 0x50, 0x0d, 0x6a, 0x61,
+        0x56, 0xa3, 0x8e, 0x08, 0x8a, 0x22, 0xb6, 0x5e,
+        0x52, 0xbc, 0x51, 0x4d, 0x16, 0xcc, 0xf8, 0x06,
+        0x81, 0x8c, 0xe9, 0x1a, 0xb7, 0x79, 0x37, 0x36,
+        0x5a, 0xf9, 0x0b, 0xbf, 0x74, 0xa3, 0x5b, 0xe6,
+        0xb4, 0x0b, 0x8e, 0xed, 0xf2, 0x78, 0x5e, 0x42,
+        0x87, 0x4d
+    };
+    uint8_t output[114];
+    size_t offset = 0;
+    vccrypt_stream_context_t ctx;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+        KEY[i] = (uint8_t)i;
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == fixture.init(&fixture.options, &ctx, KEY));
+
+    TEST_ASSERT(
+        0 == vccrypt_stream_continue_encryption(&ctx, NONCE, 12, 64));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt(
+                    &ctx, SUNSCREEN, sizeof(CIPHERTEXT), output, &offset));
+    TEST_ASSERT(sizeof(CIPHERTEXT) == offset);
+    TEST_EXPECT(0 == memcmp(CIPHERTEXT, output, sizeof(CIPHERTEXT)));
+
+    /* seeking into the middle of a block decrypts the rest of the message. */
+    offset = 0;
+    TEST_ASSERT(
+        0 == vccrypt_stream_continue_decryption(&ctx, NONCE, 12, 64 + 77));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt(
+                    &ctx, CIPHERTEXT + 77, sizeof(CIPHERTEXT) - 77, output,
+                    &offset));
+    TEST_EXPECT(
+        0 == memcmp(SUNSCREEN + 77, output, sizeof(CIPHERTEXT) - 77));
+
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * RFC 8439 section 2.8.2: ChaCha20-Poly1305 with additional data.  Decryption
+ * verifies the tag, and rejects a modified tag or ciphertext.
+ */
+BEGIN_TEST_F(rfc8439_2_8_2)
+    uint8_t KEY[32];
+    const uint8_t NONCE[12] = {
+        0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43,
+        0x44, 0x45, 0x46, 0x47
+    };
+    const uint8_t AAD[12] = {
+        0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3,
+        0xc4, 0xc5, 0xc6, 0xc7
+    };
+    const uint8_t CIPHERTEXT[114] = {
+        0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb,
+        0x7b, 0x86, 0xaf, 0xbc, 0x53, 0xef, 0x7e, 0xc2,
+        0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e, 0x08, 0xfe,
+        0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6,
+        0x3d, 0xbe, 0xa4, 0x5e, 0x8c, 0xa9, 0x67, 0x12,
+        0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b,
+        0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29,
+        0x05, 0xd6, 0xa5, 0xb6, 0x7e, 0xcd, 0x3b, 0x36,
+        0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c,
+        0x98, 0x03, 0xae, 0xe3, 0x28, 0x09, 0x1b, 0x58,
+        0xfa, 0xb3, 0x24, 0xe4, 0xfa, 0xd6, 0x75, 0x94,
+        0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc,
+        0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d,
+        0xe5, 0x76, 0xd2, 0x65, 0x86, 0xce, 0xc6, 0x4b,
+        0x61, 0x16
+    };
+    const uint8_t TAG[16] = {
+        0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09, 0xe2, 0x6a,
+        0x7e, 0x90, 0x2e, 0xcb, 0xd0, 0x60, 0x06, 0x91
+    };
+    uint8_t output[12 + 114 + 16];
+    uint8_t poutput[114];
+    size_t offset = 0;
+    vccrypt_stream_context_t ctx;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+        KEY[i] = (uint8_t)(0x80 + i);
+
+    TEST_ASSERT(0 == fixture.aead_options_init_result);
+    TEST_ASSERT(0 == fixture.init(&fixture.aead_options, &ctx, KEY));
+
+    TEST_ASSERT(
+        0 == vccrypt_stream_start_encryption(&ctx, NONCE, 12, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, sizeof(AAD)));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt(
+                    &ctx, SUNSCREEN, sizeof(CIPHERTEXT), output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_finalize(&ctx, output, &offset));
+    TEST_ASSERT(sizeof(output) == offset);
+    TEST_EXPECT(0 == memcmp(NONCE, output, 12));
+    TEST_EXPECT(0 == memcmp(CIPHERTEXT, output + 12, sizeof(CIPHERTEXT)));
+    TEST_EXPECT(0 == memcmp(TAG, output + 126, sizeof(TAG)));
+
+    /* decrypt and verify. */
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, output, &offset));
+    TEST_ASSERT(12U == offset);
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, sizeof(AAD)));
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt(
+                    &ctx, output + 12, 114, poutput, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_verify(&ctx, output + 126));
+    TEST_EXPECT(0 == memcmp(SUNSCREEN, poutput, sizeof(poutput)));
+
+    /* a modified tag is rejected. */
+    output[126] ^= 0x01;
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, sizeof(AAD)));
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt(
+                    &ctx, output + 12, 114, poutput, &offset));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_AUTHENTICATION_FAILED
+            == vccrypt_stream_verify(&ctx, output + 126));
+    output[126] ^= 0x01;
+
+    /* a modified ciphertext is rejected. */
+    output[50] ^= 0x10;
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, sizeof(AAD)));
+    offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt(
+                    &ctx, output + 12, 114, poutput, &offset));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_AUTHENTICATION_FAILED
+            == vccrypt_stream_verify(&ctx, output + 126));
+
+    /* the tag can only be computed once per message. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG
+            == vccrypt_stream_verify(&ctx, output + 126));
+
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Splitting the additional data and the message across many calls of odd sizes
+ * produces the same result as a single call, checked against an OpenSSL
+ * vector, and in-place decryption works.
+ */
+BEGIN_TEST_F(aead_chunked_and_in_place)
+    uint8_t KEY[32], NONCE[12];
+    const uint8_t AAD[] = "velo payments";
+    const uint8_t TAIL[8] = {
+        0xeb, 0xbc, 0x53, 0x34, 0x97, 0x5c, 0x1d, 0xa9
+    };
+    const uint8_t TAG[16] = {
+        0xec, 0x53, 0x02, 0x28, 0x63, 0xc9, 0xe3, 0x4e,
+        0x10, 0xf7, 0xd0, 0xdd, 0x8a, 0x67, 0x56, 0x05
+    };
+    uint8_t plaintext[1000];
+    uint8_t output[12 + 1000 + 16];
+    size_t offset = 0;
+    vccrypt_stream_context_t ctx;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+        KEY[i] = (uint8_t)i;
+    for (size_t i = 0; i < sizeof(NONCE); ++i)
+        NONCE[i] = (uint8_t)(0xA0 + i);
+    for (size_t i = 0; i < sizeof(plaintext); ++i)
+        plaintext[i] = (uint8_t)(i * 7 + 3);
+
+    TEST_ASSERT(0 == fixture.aead_options_init_result);
+    TEST_ASSERT(0 == fixture.init(&fixture.aead_options, &ctx, KEY));
+
+    /* encrypt in pieces that straddle block and batch boundaries. */
+    const size_t pieces[] = { 1, 63, 65, 3, 200, 64, 129, 0, 275, 200 };
+    TEST_ASSERT(
+        0 == vccrypt_stream_start_encryption(&ctx, NONCE, 12, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, 5));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD + 5, 8));
+    size_t pos = 0;
+    for (size_t i = 0; i < sizeof(pieces) / sizeof(pieces[0]); ++i)
+    {
+        TEST_ASSERT(
+            0
+                == vccrypt_stream_encrypt(
+                        &ctx, plaintext + pos, pieces[i], output, &offset));
+        pos += pieces[i];
+    }
+    TEST_ASSERT(sizeof(plaintext) == pos);
+
+    /* additional data is rejected once the text has started. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG
+            == vccrypt_stream_authenticate(&ctx, AAD, 1));
+
+    TEST_ASSERT(0 == vccrypt_stream_finalize(&ctx, output, &offset));
+    TEST_ASSERT(sizeof(output) == offset);
+    TEST_EXPECT(0 == memcmp(TAIL, output + 12 + 992, sizeof(TAIL)));
+    TEST_EXPECT(0 == memcmp(TAG, output + 12 + 1000, sizeof(TAG)));
+
+    /* decrypt in place. */
+    TEST_ASSERT(0 == vccrypt_stream_start_decryption(&ctx, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_authenticate(&ctx, AAD, 13));
+    offset = 12;
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt(
+                    &ctx, output + 12, 333, output, &offset));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_decrypt(
+                    &ctx, output + 345, 667, output, &offset));
+    TEST_ASSERT(0 == vccrypt_stream_verify(&ctx, output + 1012));
+    TEST_EXPECT(0 == memcmp(plaintext, output + 12, sizeof(plaintext)));
+
+    /* an AEAD message cannot be resumed in the middle. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_INVALID_ARG
+            == vccrypt_stream_continue_decryption(&ctx, NONCE, 12, 64));
+
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Plain ChaCha20 can seek up to, but not past, the end of its 2^32 block
+ * keystream, and refuses to encrypt past the end rather than wrap the block
+ * counter back to 0.
+ */
+BEGIN_TEST_F(keystream_end)
+    const uint64_t END = (uint64_t)1 << 38;
+    uint8_t KEY[32], NONCE[12], zero[64] = { 0 }, expected[64];
+    uint8_t output[64];
+    uint32_t state[16];
+    size_t offset = 0;
+    vccrypt_stream_context_t ctx;
+
+    for (size_t i = 0; i < sizeof(KEY); ++i)
+        KEY[i] = (uint8_t)(i + 1);
+    for (size_t i = 0; i < sizeof(NONCE); ++i)
+        NONCE[i] = (uint8_t)(i * 3);
+
+    /* the last keystream block is block 0xFFFFFFFF. */
+    CHACHA_init(state, KEY, 0xFFFFFFFF, NONCE);
+    CHACHA_portable_xor_blocks(state, zero, expected, 1);
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == fixture.init(&fixture.options, &ctx, KEY));
+
+    /* seeking past the end fails. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_MESSAGE_SIZE_EXCEEDED
+            == vccrypt_stream_continue_encryption(
+                    &ctx, NONCE, sizeof(NONCE), (size_t)END + 1));
+
+    /* the last 10 bytes of the keystream can be used exactly once. */
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_continue_encryption(
+                    &ctx, NONCE, sizeof(NONCE), (size_t)END - 10));
+    TEST_ASSERT(
+        0 == vccrypt_stream_encrypt(&ctx, zero, 10, output, &offset));
+    TEST_ASSERT(10U == offset);
+    TEST_EXPECT(0 == memcmp(expected + 54, output, 10));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_MESSAGE_SIZE_EXCEEDED
+            == vccrypt_stream_encrypt(&ctx, zero, 1, output, &offset));
+    TEST_EXPECT(10U == offset);
+
+    /* a single call that crosses the end fails without writing. */
+    offset = 0;
+    memset(output, 0, sizeof(output));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_continue_encryption(
+                    &ctx, NONCE, sizeof(NONCE), (size_t)END - 64));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_MESSAGE_SIZE_EXCEEDED
+            == vccrypt_stream_encrypt(&ctx, zero, 65, output, &offset));
+    TEST_EXPECT(0U == offset);
+    TEST_EXPECT(0 == memcmp(zero, output, sizeof(output)));
+
+    /* seeking to the very end is allowed, but nothing more can be written. */
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_continue_encryption(
+                    &ctx, NONCE, sizeof(NONCE), (size_t)END));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_MESSAGE_SIZE_EXCEEDED
+            == vccrypt_stream_encrypt(&ctx, zero, 1, output, &offset));
+
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * The file and range helpers have nowhere to put or check the tag, so they
+ * refuse to run ChaCha20-Poly1305 rather than emit or accept unauthenticated
+ * data.
+ */
+BEGIN_TEST_F(aead_unauthenticated_helpers_rejected)
+    const uint8_t KEY[32] = { 0 };
+    const uint8_t NONCE[12] = { 0 };
+    uint8_t input[12 + 32 + 16] = { 0 };
+    uint8_t output[32];
+    vccrypt_stream_context_t ctx;
+    int fds[2];
+
+    TEST_ASSERT(0 == fixture.aead_options_init_result);
+    TEST_ASSERT(0 == fixture.init(&fixture.aead_options, &ctx, KEY));
+    TEST_ASSERT(0 == pipe(fds));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED
+            == vccrypt_stream_encrypt_file(
+                    &ctx, NONCE, sizeof(NONCE), fds[0], fds[1]));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED
+            == vccrypt_stream_decrypt_file(&ctx, fds[0], fds[1]));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_AEAD_UNSUPPORTED
+            == vccrypt_stream_decrypt_range(
+                    &ctx, NONCE, input + 12, 0, sizeof(output), output,
+                    sizeof(output)));
+
+    close(fds[0]);
+    close(fds[1]);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Every supported ChaCha backend agrees with the portable backend, including
+ * across a 32-bit block counter wrap.
+ */
+BEGIN_TEST_F(backends_agree)
+    uint8_t key[32], nonce[12], input[64 * 37];
+    uint8_t expected[sizeof(input)], output[sizeof(input)];
+    uint32_t ref_state[16], state[16];
+
+    for (size_t i = 0; i < sizeof(key); ++i)
+        key[i] = (uint8_t)(i * 29 + 1);
+    for (size_t i = 0; i < sizeof(nonce); ++i)
+        nonce[i] = (uint8_t)(i * 5);
+    for (size_t i = 0; i < sizeof(input); ++i)
+        input[i] = (uint8_t)(i * 131 + 7);
+
+    CHACHA_init(ref_state, key, 0xFFFFFFF0, nonce);
+    CHACHA_portable_xor_blocks(ref_state, input, expected, 37);
+
+    for (int impl = CHACHA_IMPL_PORTABLE; impl <= CHACHA_IMPL_NEON; ++impl)
+    {
+        if (!CHACHA_impl_supported(impl))
+            continue;
+
+        CHACHA_init(state, key, 0xFFFFFFF0, nonce);
+        CHACHA_xor_blocks(impl, state, input, output, 37);
+        TEST_EXPECT(0 == memcmp(expected, output, sizeof(output)));
+        TEST_EXPECT(ref_state[12] == state[12]);
+
+        /* in place. */
+        memcpy(output, input, sizeof(output));
+        CHACHA_init(state, key, 0xFFFFFFF0, nonce);
+        CHACHA_xor_blocks(impl, state, output, output, 37);
+        TEST_EXPECT(0 == memcmp(expected, output, sizeof(output)));
+    }
+END_TEST_F()
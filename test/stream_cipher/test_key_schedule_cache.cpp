@@ -0,0 +1,304 @@
+/**
+ * \file test_key_schedule_cache.cpp
+ *
+ * Unit tests for the AES key schedule cache.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccrypt/block_cipher.h>
+#include <vccrypt/key_schedule_cache.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#include "../../src/stream_cipher/stream_cipher_private.h"
+
+class key_schedule_cache_test {
+public:
+    void setUp()
+    {
+        vccrypt_prng_register_source_operating_system();
+        vccrypt_stream_register_AES_256_4X_CTR();
+        vccrypt_block_register_AES_256_2X_CBC();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        prng_options_init_result =
+            vccrypt_prng_options_init(
+                &prng_options, &alloc_opts,
+                VCCRYPT_PRNG_SOURCE_OPERATING_SYSTEM);
+        if (0 == prng_options_init_result)
+        {
+            prng_init_result = vccrypt_prng_init(&prng_options, &prng);
+        }
+
+        stream_options_init_result =
+            vccrypt_stream_options_init(
+                &stream_options, &alloc_opts,
+                VCCRYPT_STREAM_ALGORITHM_AES_256_4X_CTR);
+        block_options_init_result =
+            vccrypt_block_options_init(
+                &block_options, &alloc_opts,
+                VCCRYPT_BLOCK_ALGORITHM_AES_256_2X_CBC);
+    }
+
+    void tearDown()
+    {
+        vccrypt_key_schedule_cache_disable();
+
+        if (0 == block_options_init_result)
+        {
+            dispose((disposable_t*)&block_options);
+        }
+
+        if (0 == stream_options_init_result)
+        {
+            dispose((disposable_t*)&stream_options);
+        }
+
+        if (0 == prng_options_init_result)
+        {
+            if (0 == prng_init_result)
+            {
+                dispose((disposable_t*)&prng);
+            }
+
+            dispose((disposable_t*)&prng_options);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /* create a key buffer filled with the given seed. */
+    int make_key(vccrypt_buffer_t* key, uint8_t seed)
+    {
+        int retval = vccrypt_buffer_init(key, &alloc_opts, 32);
+        if (0 == retval)
+        {
+            for (size_t i = 0; i < 32; ++i)
+            {
+                ((uint8_t*)key->data)[i] = (uint8_t)(seed + 17 * i);
+            }
+        }
+
+        return retval;
+    }
+
+    allocator_options_t alloc_opts;
+    vccrypt_prng_options_t prng_options;
+    vccrypt_prng_context_t prng;
+    vccrypt_stream_options_t stream_options;
+    vccrypt_block_options_t block_options;
+    int prng_options_init_result;
+    int prng_init_result;
+    int stream_options_init_result;
+    int block_options_init_result;
+};
+
+TEST_SUITE(key_schedule_cache_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    key_schedule_cache_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Invalid capacities are rejected.
+ */
+BEGIN_TEST_F(enable_invalid_capacity)
+    TEST_ASSERT(0 == fixture.prng_options_init_result);
+    TEST_ASSERT(0 == fixture.prng_init_result);
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_INVALID_ARG
+            == vccrypt_key_schedule_cache_enable(
+                    &fixture.prng, &fixture.alloc_opts, 0));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_KEY_SCHEDULE_CACHE_INVALID_ARG
+            == vccrypt_key_schedule_cache_enable(
+                    &fixture.prng, &fixture.alloc_opts,
+                    VCCRYPT_KEY_SCHEDULE_CACHE_MAX_CAPACITY + 1));
+END_TEST_F()
+
+/**
+ * Re-initializing a stream context with the same key hits the cache and
+ * produces the same key schedule as an uncached expansion.
+ */
+BEGIN_TEST_F(stream_init_hits)
+    vccrypt_stream_context_t ctx1, ctx2;
+    vccrypt_buffer_t key;
+    AES_KEY expected;
+    size_t hits, misses;
+
+    TEST_ASSERT(0 == fixture.prng_init_result);
+    TEST_ASSERT(0 == fixture.stream_options_init_result);
+    TEST_ASSERT(0 == fixture.make_key(&key, 1));
+
+    TEST_ASSERT(
+        0
+            == AES_set_encrypt_key_impl(
+                    (const unsigned char*)key.data, 256, 4,
+                    AES_impl_default_bulk(), &expected));
+
+    TEST_ASSERT(
+        0
+            == vccrypt_key_schedule_cache_enable(
+                    &fixture.prng, &fixture.alloc_opts, 4));
+
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.stream_options, &ctx1, &key));
+    TEST_ASSERT(0 == vccrypt_stream_init(&fixture.stream_options, &ctx2, &key));
+
+    vccrypt_key_schedule_cache_stats(&hits, &misses);
+    TEST_EXPECT(1U == hits);
+    TEST_EXPECT(1U == misses);
+
+    AES_KEY* k1 = &((aes_ctr_context_data_t*)ctx1.stream_state)->key;
+    AES_KEY* k2 = &((aes_ctr_context_data_t*)ctx2.stream_state)->key;
+    TEST_EXPECT(0 == memcmp(&expected, k1, AES_key_size(expected.rounds)));
+    TEST_EXPECT(0 == memcmp(&expected, k2, AES_key_size(expected.rounds)));
+
+    dispose((disposable_t*)&ctx1);
+    dispose((disposable_t*)&ctx2);
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * Encryption and decryption schedules for the same key are cached separately,
+ * and a CBC round trip through cached schedules recovers the plaintext.
+ */
+BEGIN_TEST_F(block_round_trip)
+    vccrypt_block_context_t enc, dec, enc2;
+    vccrypt_buffer_t key;
+    const uint8_t IV[16] = { 0 };
+    uint8_t plaintext[16], ciphertext[16], ciphertext2[16], output[16];
+    size_t hits, misses;
+
+    TEST_ASSERT(0 == fixture.prng_init_result);
+    TEST_ASSERT(0 == fixture.block_options_init_result);
+    TEST_ASSERT(0 == fixture.make_key(&key, 2));
+
+    for (size_t i = 0; i < sizeof(plaintext); ++i)
+    {
+        plaintext[i] = (uint8_t)i;
+    }
+
+    TEST_ASSERT(
+        0
+            == vccrypt_key_schedule_cache_enable(
+                    &fixture.prng, &fixture.alloc_opts, 4));
+
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.block_options, &enc, &key, true));
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.block_options, &dec, &key, false));
+    TEST_ASSERT(
+        0 == vccrypt_block_init(&fixture.block_options, &enc2, &key, true));
+
+    vccrypt_key_schedule_cache_stats(&hits, &misses);
+    TEST_EXPECT(1U == hits);
+    TEST_EXPECT(2U == misses);
+
+    TEST_ASSERT(0 == vccrypt_block_encrypt(&enc, IV, plaintext, ciphertext));
+    TEST_ASSERT(0 == vccrypt_block_encrypt(&enc2, IV, plaintext, ciphertext2));
+    TEST_ASSERT(0 == vccrypt_block_decrypt(&dec, IV, ciphertext, output));
+    TEST_EXPECT(0 == memcmp(ciphertext, ciphertext2, sizeof(ciphertext)));
+    TEST_EXPECT(0 == memcmp(plaintext, output, sizeof(plaintext)));
+
+    dispose((disposable_t*)&enc);
+    dispose((disposable_t*)&dec);
+    dispose((disposable_t*)&enc2);
+    dispose((disposable_t*)&key);
+END_TEST_F()
+
+/**
+ * When the cache is full, the least recently used key is evicted.
+ */
+BEGIN_TEST_F(lru_eviction)
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key1, key2, key3;
+    size_t hits, misses;
+
+    TEST_ASSERT(0 == fixture.prng_init_result);
+    TEST_ASSERT(0 == fixture.stream_options_init_result);
+    TEST_ASSERT(0 == fixture.make_key(&key1, 10));
+    TEST_ASSERT(0 == fixture.make_key(&key2, 20));
+    TEST_ASSERT(0 == fixture.make_key(&key3, 30));
+
+    TEST_ASSERT(
+        0
+            == vccrypt_key_schedule_cache_enable(
+                    &fixture.prng, &fixture.alloc_opts, 2));
+
+    /* fill the cache with key1 and key2, then touch key1. */
+    vccrypt_buffer_t* sequence[] = {
+        &key1, &key2, &key1, &key3, &key1, &key2
+    };
+    for (size_t i = 0; i < sizeof(sequence) / sizeof(sequence[0]); ++i)
+    {
+        TEST_ASSERT(
+            0 == vccrypt_stream_init(&fixture.stream_options, &ctx, sequence[i]));
+        dispose((disposable_t*)&ctx);
+    }
+
+    /* key1 hits twice; key3 evicts key2, so key2 misses again. */
+    vccrypt_key_schedule_cache_stats(&hits, &misses);
+    TEST_EXPECT(2U == hits);
+    TEST_EXPECT(4U == misses);
+
+    /* once disabled, nothing is counted. */
+    vccrypt_key_schedule_cache_disable();
+    TEST_ASSERT(
+        0 == vccrypt_stream_init(&fixture.stream_options, &ctx, &key1));
+    dispose((disposable_t*)&ctx);
+    vccrypt_key_schedule_cache_stats(&hits, &misses);
+    TEST_EXPECT(0U == hits);
+    TEST_EXPECT(0U == misses);
+
+    dispose((disposable_t*)&key1);
+    dispose((disposable_t*)&key2);
+    dispose((disposable_t*)&key3);
+END_TEST_F()
+
+/**
+ * With many keys spread over many sets, every key that fits is found again.
+ */
+BEGIN_TEST_F(many_keys_hit)
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+    const size_t KEYS = 64;
+    size_t hits, misses;
+
+    TEST_ASSERT(0 == fixture.prng_init_result);
+    TEST_ASSERT(0 == fixture.stream_options_init_result);
+    TEST_ASSERT(0 == fixture.make_key(&key, 0));
+
+    TEST_ASSERT(
+        0
+            == vccrypt_key_schedule_cache_enable(
+                    &fixture.prng, &fixture.alloc_opts,
+                    VCCRYPT_KEY_SCHEDULE_CACHE_MAX_CAPACITY));
+
+    for (size_t pass = 0; pass < 2; ++pass)
+    {
+        for (size_t i = 0; i < KEYS; ++i)
+        {
+            ((uint8_t*)key.data)[0] = (uint8_t)i;
+            TEST_ASSERT(
+                0 == vccrypt_stream_init(&fixture.stream_options, &ctx, &key));
+            dispose((disposable_t*)&ctx);
+        }
+    }
+
+    vccrypt_key_schedule_cache_stats(&hits, &misses);
+    TEST_EXPECT(KEYS == hits);
+    TEST_EXPECT(KEYS == misses);
+
+    dispose((disposable_t*)&key);
+END_TEST_F()
@@ -0,0 +1,519 @@
+/**
+ * \file test_stream_file.cpp
+ *
+ * Unit tests for file encryption and decryption using a stream cipher.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <fcntl.h>
+#include <minunit/minunit.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vccrypt/mock_suite.h>
+#include <vccrypt/stream_cipher.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+class stream_file_test {
+public:
+    void setUp()
+    {
+        vccrypt_stream_register_AES_256_2X_CTR();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        options_init_result =
+            vccrypt_stream_options_init(
+                &options, &alloc_opts,
+                VCCRYPT_STREAM_ALGORITHM_AES_256_2X_CTR);
+
+        for (size_t i = 0; i < sizeof(KEY); ++i)
+        {
+            KEY[i] = (uint8_t)(3 * i + 9);
+        }
+
+        if (0 == options_init_result)
+        {
+            key_init_result =
+                vccrypt_buffer_init(&key, &alloc_opts, sizeof(KEY));
+            if (0 == key_init_result)
+            {
+                memcpy(key.data, KEY, sizeof(KEY));
+            }
+        }
+    }
+
+    void tearDown()
+    {
+        if (0 == options_init_result)
+        {
+            if (0 == key_init_result)
+            {
+                dispose((disposable_t*)&key);
+            }
+
+            dispose((disposable_t*)&options);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /* create an unlinked temporary file. */
+    int temp_file()
+    {
+        char name[] = "/tmp/vccrypt_stream_file_XXXXXX";
+        int fd = mkstemp(name);
+        if (fd >= 0)
+        {
+            unlink(name);
+        }
+
+        return fd;
+    }
+
+    /* read the full contents of a file into a buffer. */
+    ssize_t read_file(int fd, uint8_t* buf, size_t size)
+    {
+        if (0 != lseek(fd, 0, SEEK_SET))
+        {
+            return -1;
+        }
+
+        size_t total = 0;
+        ssize_t rv;
+        while (total < size && (rv = read(fd, buf + total, size - total)) > 0)
+        {
+            total += (size_t)rv;
+        }
+
+        return (ssize_t)total;
+    }
+
+    allocator_options_t alloc_opts;
+    vccrypt_stream_options_t options;
+    vccrypt_buffer_t key;
+    uint8_t KEY[32];
+    int options_init_result;
+    int key_init_result;
+};
+
+TEST_SUITE(stream_file_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    stream_file_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Encrypting and decrypting regular files should match the in-memory stream
+ * API and round trip.
+ */
+BEGIN_TEST_F(mapped_round_trip)
+    vccrypt_stream_context_t ctx;
+    const size_t SIZE = 300000 + 7;
+    uint8_t IV[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    uint8_t* plaintext = (uint8_t*)malloc(SIZE);
+    uint8_t* expected = (uint8_t*)malloc(8 + SIZE);
+    uint8_t* output = (uint8_t*)malloc(8 + SIZE + 1);
+    size_t offset = 0;
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(NULL != plaintext);
+    TEST_ASSERT(NULL != expected);
+    TEST_ASSERT(NULL != output);
+
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+        plaintext[i] = (uint8_t)(i ^ (i >> 9));
+    }
+
+    /* build the expected output in memory. */
+    TEST_ASSERT(
+        0 == vccrypt_stream_init(&fixture.options, &ctx, &fixture.key));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &ctx, IV, sizeof(IV), expected, &offset));
+    TEST_ASSERT(
+        0 == vccrypt_stream_encrypt(&ctx, plaintext, SIZE, expected, &offset));
+
+    int in_fd = fixture.temp_file();
+    int enc_fd = fixture.temp_file();
+    int dec_fd = fixture.temp_file();
+    TEST_ASSERT(in_fd >= 0);
+    TEST_ASSERT(enc_fd >= 0);
+    TEST_ASSERT(dec_fd >= 0);
+    TEST_ASSERT((ssize_t)SIZE == write(in_fd, plaintext, SIZE));
+
+    TEST_ASSERT(0 == lseek(in_fd, 0, SEEK_SET));
+
+    /* pre-fill the output so the engine must truncate it. */
+    TEST_ASSERT((ssize_t)SIZE == write(dec_fd, expected, SIZE));
+    TEST_ASSERT((ssize_t)SIZE == write(enc_fd, plaintext, SIZE));
+    TEST_ASSERT((ssize_t)SIZE == write(enc_fd, plaintext, SIZE));
+    TEST_ASSERT(0 == lseek(dec_fd, 0, SEEK_SET));
+    TEST_ASSERT(0 == lseek(enc_fd, 0, SEEK_SET));
+
+    /* encrypt the file. */
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt_file(
+                    &ctx, IV, sizeof(IV), in_fd, enc_fd));
+    TEST_EXPECT(
+        (ssize_t)(8 + SIZE) == fixture.read_file(enc_fd, output, 8 + SIZE + 1));
+    TEST_EXPECT(0 == memcmp(expected, output, 8 + SIZE));
+
+    /* decrypt it again. */
+    TEST_ASSERT(0 == lseek(enc_fd, 0, SEEK_SET));
+    TEST_ASSERT(0 == vccrypt_stream_decrypt_file(&ctx, enc_fd, dec_fd));
+    TEST_EXPECT(
+        (ssize_t)SIZE == fixture.read_file(dec_fd, output, 8 + SIZE + 1));
+    TEST_EXPECT(0 == memcmp(plaintext, output, SIZE));
+
+    close(in_fd);
+    close(enc_fd);
+    close(dec_fd);
+    free(plaintext);
+    free(expected);
+    free(output);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Descriptors that cannot be mapped, such as pipes, are streamed through a
+ * buffer and produce the same output.
+ */
+BEGIN_TEST_F(pipe_round_trip)
+    vccrypt_stream_context_t ctx;
+    const size_t SIZE = 5000 + 3;
+    uint8_t IV[8] = { 8, 7, 6, 5, 4, 3, 2, 1 };
+    uint8_t plaintext[5003];
+    uint8_t expected[8 + 5003];
+    uint8_t output[8 + 5003 + 1];
+    size_t offset = 0;
+    int fds[2];
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 17);
+    }
+
+    TEST_ASSERT(
+        0 == vccrypt_stream_init(&fixture.options, &ctx, &fixture.key));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &ctx, IV, sizeof(IV), expected, &offset));
+    TEST_ASSERT(
+        0 == vccrypt_stream_encrypt(&ctx, plaintext, SIZE, expected, &offset));
+
+    /* encrypt from a pipe into a file. */
+    int enc_fd = fixture.temp_file();
+    TEST_ASSERT(enc_fd >= 0);
+    TEST_ASSERT(0 == pipe(fds));
+    TEST_ASSERT((ssize_t)SIZE == write(fds[1], plaintext, SIZE));
+    close(fds[1]);
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt_file(
+                    &ctx, IV, sizeof(IV), fds[0], enc_fd));
+    close(fds[0]);
+    TEST_EXPECT(
+        (ssize_t)(8 + SIZE) == fixture.read_file(enc_fd, output, sizeof(output)));
+    TEST_EXPECT(0 == memcmp(expected, output, 8 + SIZE));
+
+    /* decrypt from a pipe into a pipe. */
+    int out_fds[2];
+    TEST_ASSERT(0 == pipe(fds));
+    TEST_ASSERT(0 == pipe(out_fds));
+    TEST_ASSERT((ssize_t)(8 + SIZE) == write(fds[1], expected, 8 + SIZE));
+    close(fds[1]);
+    TEST_ASSERT(0 == vccrypt_stream_decrypt_file(&ctx, fds[0], out_fds[1]));
+    close(fds[0]);
+    close(out_fds[1]);
+    memset(output, 0, sizeof(output));
+    TEST_EXPECT((ssize_t)SIZE == read(out_fds[0], output, sizeof(output)));
+    TEST_EXPECT(0 == memcmp(plaintext, output, SIZE));
+    close(out_fds[0]);
+
+    close(enc_fd);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Empty plaintext encrypts to just the IV header, and a truncated header is
+ * rejected on decryption.
+ */
+BEGIN_TEST_F(empty_and_truncated)
+    vccrypt_stream_context_t ctx;
+    uint8_t IV[8] = { 9, 9, 9, 9, 9, 9, 9, 9 };
+    uint8_t output[16];
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(
+        0 == vccrypt_stream_init(&fixture.options, &ctx, &fixture.key));
+
+    int in_fd = fixture.temp_file();
+    int enc_fd = fixture.temp_file();
+    int dec_fd = fixture.temp_file();
+    TEST_ASSERT(in_fd >= 0);
+    TEST_ASSERT(enc_fd >= 0);
+    TEST_ASSERT(dec_fd >= 0);
+
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt_file(
+                    &ctx, IV, sizeof(IV), in_fd, enc_fd));
+    TEST_EXPECT(8 == fixture.read_file(enc_fd, output, sizeof(output)));
+    TEST_EXPECT(0 == memcmp(IV, output, sizeof(IV)));
+
+    TEST_ASSERT(0 == lseek(enc_fd, 0, SEEK_SET));
+    TEST_ASSERT(0 == vccrypt_stream_decrypt_file(&ctx, enc_fd, dec_fd));
+    TEST_EXPECT(0 == fixture.read_file(dec_fd, output, sizeof(output)));
+
+    /* a file shorter than the IV header is rejected. */
+    TEST_ASSERT(0 == ftruncate(enc_fd, 5));
+    TEST_ASSERT(0 == lseek(enc_fd, 0, SEEK_SET));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG
+            == vccrypt_stream_decrypt_file(&ctx, enc_fd, dec_fd));
+
+    close(in_fd);
+    close(enc_fd);
+    close(dec_fd);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Both the mapped and the buffered paths start at the current positions of
+ * the descriptors, leave them just past the processed data, and truncate a
+ * regular output file at the end of the output.
+ */
+BEGIN_TEST_F(current_positions)
+    vccrypt_stream_context_t ctx;
+    const size_t SIZE = 20000 + 11;
+    const size_t IN_SKIP = 5000 + 3;
+    const size_t OUT_SKIP = 4096 + 50;
+    uint8_t IV[8] = { 4, 4, 3, 3, 2, 2, 1, 1 };
+    uint8_t* plaintext = (uint8_t*)malloc(IN_SKIP + SIZE);
+    uint8_t* expected = (uint8_t*)malloc(OUT_SKIP + 8 + SIZE);
+    uint8_t* output = (uint8_t*)malloc(OUT_SKIP + 8 + SIZE + 1);
+    size_t offset = 0;
+    int fds[2];
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(NULL != plaintext);
+    TEST_ASSERT(NULL != expected);
+    TEST_ASSERT(NULL != output);
+
+    for (size_t i = 0; i < IN_SKIP + SIZE; ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 7 + (i >> 8));
+    }
+
+    /* the output keeps its prefix, followed by the encrypted input body. */
+    memset(expected, 0xAA, OUT_SKIP);
+    TEST_ASSERT(
+        0 == vccrypt_stream_init(&fixture.options, &ctx, &fixture.key));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &ctx, IV, sizeof(IV), expected + OUT_SKIP, &offset));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt(
+                    &ctx, plaintext + IN_SKIP, SIZE, expected + OUT_SKIP,
+                    &offset));
+
+    int in_fd = fixture.temp_file();
+    int mapped_fd = fixture.temp_file();
+    int buffered_fd = fixture.temp_file();
+    TEST_ASSERT(in_fd >= 0);
+    TEST_ASSERT(mapped_fd >= 0);
+    TEST_ASSERT(buffered_fd >= 0);
+    TEST_ASSERT(
+        (ssize_t)(IN_SKIP + SIZE) == write(in_fd, plaintext, IN_SKIP + SIZE));
+    TEST_ASSERT((off_t)IN_SKIP == lseek(in_fd, IN_SKIP, SEEK_SET));
+
+    /* both outputs start with the prefix and a long tail to truncate. */
+    const int out_fds[2] = { mapped_fd, buffered_fd };
+    for (int fd : out_fds)
+    {
+        TEST_ASSERT((ssize_t)OUT_SKIP == write(fd, expected, OUT_SKIP));
+        TEST_ASSERT(
+            (ssize_t)(IN_SKIP + SIZE) == write(fd, plaintext, IN_SKIP + SIZE));
+        TEST_ASSERT((off_t)OUT_SKIP == lseek(fd, OUT_SKIP, SEEK_SET));
+    }
+
+    /* regular file to regular file is mapped. */
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt_file(
+                    &ctx, IV, sizeof(IV), in_fd, mapped_fd));
+    TEST_EXPECT((off_t)(IN_SKIP + SIZE) == lseek(in_fd, 0, SEEK_CUR));
+    TEST_EXPECT((off_t)(OUT_SKIP + 8 + SIZE) == lseek(mapped_fd, 0, SEEK_CUR));
+    TEST_EXPECT(
+        (ssize_t)(OUT_SKIP + 8 + SIZE)
+            == fixture.read_file(mapped_fd, output, OUT_SKIP + 8 + SIZE + 1));
+    TEST_EXPECT(0 == memcmp(expected, output, OUT_SKIP + 8 + SIZE));
+
+    /* a pipe to a regular file is buffered, with the same result. */
+    TEST_ASSERT(0 == pipe(fds));
+    TEST_ASSERT((ssize_t)SIZE == write(fds[1], plaintext + IN_SKIP, SIZE));
+    close(fds[1]);
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt_file(
+                    &ctx, IV, sizeof(IV), fds[0], buffered_fd));
+    close(fds[0]);
+    TEST_EXPECT(
+        (off_t)(OUT_SKIP + 8 + SIZE) == lseek(buffered_fd, 0, SEEK_CUR));
+    TEST_EXPECT(
+        (ssize_t)(OUT_SKIP + 8 + SIZE)
+            == fixture.read_file(buffered_fd, output, OUT_SKIP + 8 + SIZE + 1));
+    TEST_EXPECT(0 == memcmp(expected, output, OUT_SKIP + 8 + SIZE));
+
+    /* decryption reads the header at the input position. */
+    TEST_ASSERT((off_t)OUT_SKIP == lseek(mapped_fd, OUT_SKIP, SEEK_SET));
+    TEST_ASSERT(0 == ftruncate(in_fd, 0));
+    TEST_ASSERT(0 == lseek(in_fd, 0, SEEK_SET));
+    TEST_ASSERT(0 == vccrypt_stream_decrypt_file(&ctx, mapped_fd, in_fd));
+    TEST_EXPECT((off_t)SIZE == lseek(in_fd, 0, SEEK_CUR));
+    TEST_EXPECT(
+        (ssize_t)SIZE == fixture.read_file(in_fd, output, SIZE + 1));
+    TEST_EXPECT(0 == memcmp(plaintext + IN_SKIP, output, SIZE));
+
+    close(in_fd);
+    close(mapped_fd);
+    close(buffered_fd);
+    free(plaintext);
+    free(expected);
+    free(output);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * Transforming a file onto itself is rejected rather than overwriting input
+ * that has not been read yet.
+ */
+BEGIN_TEST_F(same_file_rejected)
+    vccrypt_stream_context_t ctx;
+    uint8_t IV[8] = { 0 };
+    uint8_t data[64] = { 0 };
+
+    TEST_ASSERT(0 == fixture.options_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(
+        0 == vccrypt_stream_init(&fixture.options, &ctx, &fixture.key));
+
+    int fd = fixture.temp_file();
+    TEST_ASSERT(fd >= 0);
+    int other_fd = dup(fd);
+    TEST_ASSERT(other_fd >= 0);
+    TEST_ASSERT((ssize_t)sizeof(data) == write(fd, data, sizeof(data)));
+    TEST_ASSERT(0 == lseek(fd, 0, SEEK_SET));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG
+            == vccrypt_stream_encrypt_file(&ctx, IV, sizeof(IV), fd, fd));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG
+            == vccrypt_stream_encrypt_file(
+                    &ctx, IV, sizeof(IV), fd, other_fd));
+    TEST_EXPECT(
+        VCCRYPT_ERROR_STREAM_FILE_INVALID_ARG
+            == vccrypt_stream_decrypt_file(&ctx, other_fd, fd));
+
+    /* the file is untouched. */
+    TEST_EXPECT(0 == lseek(fd, 0, SEEK_CUR));
+    TEST_EXPECT(
+        (ssize_t)sizeof(data) == fixture.read_file(fd, data, sizeof(data)));
+
+    close(other_fd);
+    close(fd);
+    dispose((disposable_t*)&ctx);
+END_TEST_F()
+
+/**
+ * If the cipher fails part way through, the output file is put back to its
+ * original size rather than being left grown.
+ */
+BEGIN_TEST_F(failure_restores_size)
+    vccrypt_suite_options_t suite;
+    vccrypt_stream_context_t ctx;
+    vccrypt_buffer_t key;
+    uint8_t IV[16] = { 0 };
+    uint8_t data[4096] = { 0 };
+    struct stat st;
+
+    vccrypt_suite_register_mock();
+    TEST_ASSERT(
+        0 == vccrypt_mock_suite_options_init(&suite, &fixture.alloc_opts));
+
+    TEST_ASSERT(
+        0 == vccrypt_mock_suite_add_mock_stream_init(
+                &suite,
+                [&](
+                    vccrypt_stream_options_t*, vccrypt_stream_context_t*,
+                    const vccrypt_buffer_t*) -> int {
+                        return VCCRYPT_STATUS_SUCCESS;
+                }));
+    TEST_ASSERT(
+        0 == vccrypt_mock_suite_add_mock_stream_start_encryption(
+                &suite,
+                [&](
+                    vccrypt_stream_context_t*, const void*, size_t,
+                    void*, size_t* offset) -> int {
+                        *offset += sizeof(IV);
+                        return VCCRYPT_STATUS_SUCCESS;
+                }));
+    TEST_ASSERT(
+        0 == vccrypt_mock_suite_add_mock_stream_encrypt(
+                &suite,
+                [&](
+                    vccrypt_stream_context_t*, const void*, size_t, void*,
+                    size_t*) -> int {
+                        return VCCRYPT_ERROR_MOCK_NOT_ADDED;
+                }));
+
+    TEST_ASSERT(
+        0 == vccrypt_buffer_init(
+                &key, &fixture.alloc_opts, suite.stream_cipher_opts.key_size));
+    TEST_ASSERT(0 == vccrypt_suite_stream_init(&suite, &ctx, &key));
+
+    int input_fd = fixture.temp_file();
+    int output_fd = fixture.temp_file();
+    TEST_ASSERT(input_fd >= 0);
+    TEST_ASSERT(output_fd >= 0);
+    TEST_ASSERT((ssize_t)sizeof(data) == write(input_fd, data, sizeof(data)));
+    TEST_ASSERT((ssize_t)100 == write(output_fd, data, 100));
+    TEST_ASSERT(0 == lseek(input_fd, 0, SEEK_SET));
+    TEST_ASSERT(0 == lseek(output_fd, 0, SEEK_SET));
+
+    TEST_EXPECT(
+        VCCRYPT_ERROR_MOCK_NOT_ADDED
+            == vccrypt_stream_encrypt_file(
+                    &ctx, IV, sizeof(IV), input_fd, output_fd));
+
+    TEST_ASSERT(0 == fstat(output_fd, &st));
+    TEST_EXPECT(100 == st.st_size);
+
+    close(output_fd);
+    close(input_fd);
+    dispose((disposable_t*)&key);
+    dispose((disposable_t*)&suite);
+END_TEST_F()
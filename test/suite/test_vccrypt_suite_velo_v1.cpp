@@ -10,6 +10,7 @@
 #include <fstream>
 #include <minunit/minunit.h>
 #include <sstream>
+#include <vector>
 #include <vccrypt/suite.h>
 #include <vpr/allocator/malloc_allocator.h>
 
@@ -906,3 +907,138 @@ BEGIN_TEST_F(vccrypt_suite_buffer_init_for_uuid)
     /* dispose of the buffer. */
     dispose((disposable_t*)&uuidbuffer);
 END_TEST_F()
+
+/**
+ * The fused AEAD encryption matches a separate stream cipher pass followed by
+ * a MAC pass, and verify-then-decrypt round trips and rejects tampering.
+ */
+BEGIN_TEST_F(aead)
+    vccrypt_buffer_t cipher_key, mac_key;
+    vccrypt_stream_context_t stream;
+    vccrypt_mac_context_t mac;
+    vccrypt_buffer_t tag;
+    const uint8_t AAD[] = { 'h', 'e', 'a', 'd', 'e', 'r' };
+    const size_t SIZE = 40000;
+    uint64_t IV = mmhtonll(0x1020304050607080UL);
+
+    TEST_ASSERT(0 == fixture.suite_init_result);
+
+    size_t overhead = vccrypt_suite_aead_overhead(&fixture.options);
+    TEST_EXPECT(8U + 64U == overhead);
+
+    vector<uint8_t> plaintext(SIZE), expected(SIZE + overhead),
+        output(SIZE + overhead), poutput(SIZE);
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+        plaintext[i] = (uint8_t)(i * 7 + 3);
+    }
+
+    TEST_ASSERT(
+        0
+            == vccrypt_suite_buffer_init_for_mac_private_key(
+                    &fixture.options, &mac_key, false));
+    TEST_ASSERT(
+        0
+            == vccrypt_buffer_init(
+                    &cipher_key, &fixture.alloc_opts,
+                    fixture.options.stream_cipher_opts.key_size));
+    memset(cipher_key.data, 0x5A, cipher_key.size);
+    memset(mac_key.data, 0xA5, mac_key.size);
+
+    /* build the expected output with separate passes. */
+    size_t offset = 0;
+    TEST_ASSERT(
+        0
+            == vccrypt_suite_stream_init(
+                    &fixture.options, &stream, &cipher_key));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_start_encryption(
+                    &stream, &IV, sizeof(IV), expected.data(), &offset));
+    TEST_ASSERT(
+        0
+            == vccrypt_stream_encrypt(
+                    &stream, plaintext.data(), SIZE, expected.data(),
+                    &offset));
+    dispose((disposable_t*)&stream);
+
+    uint8_t sizes[16] = { 0 };
+    sizes[7] = sizeof(AAD);
+    sizes[13] = (uint8_t)(SIZE >> 16);
+    sizes[14] = (uint8_t)(SIZE >> 8);
+    sizes[15] = (uint8_t)SIZE;
+
+    TEST_ASSERT(
+        0 == vccrypt_suite_mac_init(&fixture.options, &mac, &mac_key));
+    TEST_ASSERT(
+        0
+            == vccrypt_suite_buffer_init_for_mac_authentication_code(
+                    &fixture.options, &tag, false));
+    TEST_ASSERT(0 == vccrypt_mac_digest(&mac, AAD, sizeof(AAD)));
+    TEST_ASSERT(0 == vccrypt_mac_digest(&mac, expected.data(), offset));
+    TEST_ASSERT(0 == vccrypt_mac_digest(&mac, sizes, sizeof(sizes)));
+    TEST_ASSERT(0 == vccrypt_mac_finalize(&mac, &tag));
+    memcpy(expected.data() + offset, tag.data, tag.size);
+    dispose((disposable_t*)&tag);
+    dispose((disposable_t*)&mac);
+
+    /* the fused encryption produces the same output. */
+    TEST_ASSERT(
+        0
+            == vccrypt_suite_aead_encrypt(
+                    &fixture.options, &cipher_key, &mac_key, &IV, AAD,
+                    sizeof(AAD), plaintext.data(), SIZE, output.data(),
+                    output.size()));
+    TEST_EXPECT(0 == memcmp(expected.data(), output.data(), output.size()));
+
+    /* the output buffer must have room for the overhead. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_SUITE_AEAD_INVALID_ARG
+            == vccrypt_suite_aead_encrypt(
+                    &fixture.options, &cipher_key, &mac_key, &IV, AAD,
+                    sizeof(AAD), plaintext.data(), SIZE, output.data(),
+                    output.size() - 1));
+
+    /* verify and decrypt. */
+    TEST_ASSERT(
+        0
+            == vccrypt_suite_aead_decrypt(
+                    &fixture.options, &cipher_key, &mac_key, AAD,
+                    sizeof(AAD), output.data(), output.size(),
+                    poutput.data(), poutput.size()));
+    TEST_EXPECT(0 == memcmp(plaintext.data(), poutput.data(), SIZE));
+
+    /* a modified ciphertext is rejected, and no plaintext is released. */
+    output[8 + SIZE / 2] ^= 0x01;
+    TEST_EXPECT(
+        VCCRYPT_ERROR_SUITE_AEAD_AUTHENTICATION_FAILED
+            == vccrypt_suite_aead_decrypt(
+                    &fixture.options, &cipher_key, &mac_key, AAD,
+                    sizeof(AAD), output.data(), output.size(),
+                    poutput.data(), poutput.size()));
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+        TEST_ASSERT(0 == poutput[i]);
+    }
+    output[8 + SIZE / 2] ^= 0x01;
+
+    /* modified associated data is rejected. */
+    TEST_EXPECT(
+        VCCRYPT_ERROR_SUITE_AEAD_AUTHENTICATION_FAILED
+            == vccrypt_suite_aead_decrypt(
+                    &fixture.options, &cipher_key, &mac_key, AAD,
+                    sizeof(AAD) - 1, output.data(), output.size(),
+                    poutput.data(), poutput.size()));
+
+    /* decryption works in place. */
+    TEST_ASSERT(
+        0
+            == vccrypt_suite_aead_decrypt(
+                    &fixture.options, &cipher_key, &mac_key, AAD,
+                    sizeof(AAD), output.data(), output.size(),
+                    output.data() + 8, SIZE));
+    TEST_EXPECT(0 == memcmp(plaintext.data(), output.data() + 8, SIZE));
+
+    dispose((disposable_t*)&cipher_key);
+    dispose((disposable_t*)&mac_key);
+END_TEST_F()